@@ -39,6 +39,7 @@
 #include "threading.h"
 #include "daal_defines.h"
 #include "service_math.h"
+#include "service_defines.h"
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
@@ -59,6 +60,8 @@ namespace training
 namespace internal
 {
 
+const size_t adaBoostBlockSize = 1024;    /* Number of observations processed by a thread at once */
+
 /**
  *  \brief AdaBoost algorithm kernel
  *
@@ -91,10 +94,6 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
     algorithmFPType *w = wTable->getArray();
     algorithmFPType *h = hTable->getArray();
 
-    algorithmFPType *errFlag;   /* Vector of flags.
-                                   errFlag[i] == 0.0, if weak classifier's classification result agrees with actual class label;
-                                   errFlag[i] == 1.0, otherwise */
-
     /* Floating point constants */
     const algorithmFPType zero = (algorithmFPType)0.0;
     const algorithmFPType one  = (algorithmFPType)1.0;
@@ -108,9 +107,17 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
     algorithmFPType *alpha = (algorithmFPType *) daal::services::daal_malloc(maxIter * sizeof(algorithmFPType));
     if (!alpha) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-    /* Allocate memory for storing intermediate results */
-    errFlag = (algorithmFPType *) daal::services::daal_malloc(nVectors * sizeof(algorithmFPType), 64);
-    if (!errFlag) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    /* Allocate memory for the partial sums computed for the blocks of observations */
+    const size_t nBlocks = nVectors / adaBoostBlockSize + !!(nVectors % adaBoostBlockSize);
+    algorithmFPType *partialSums = (algorithmFPType *) daal::services::daal_malloc(3 * nBlocks * sizeof(algorithmFPType));
+    if (!partialSums)
+    {
+        daal::services::daal_free(alpha);
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+    algorithmFPType *partialErr  = partialSums;
+    algorithmFPType *partialNErr = partialSums + nBlocks;
+    algorithmFPType *partialW    = partialSums + 2 * nBlocks;
 
     /* Initialize weights */
     for (size_t i = 0; i < nVectors; i++)
@@ -118,12 +125,12 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
         w[i] = invNVectors;
     }
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
+    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining->clone();
     learnerTrain->input.set(classifier::training::data,    weakLearnerInputTables[0]);
     learnerTrain->input.set(classifier::training::labels,  weakLearnerInputTables[1]);
     learnerTrain->input.set(classifier::training::weights, weakLearnerInputTables[2]);
 
-    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
+    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction->clone();
     learnerPredict->input.set(classifier::prediction::data, weakLearnerInputTables[0]);
 
     services::SharedPtr<classifier::prediction::Result> predictionRes(new classifier::prediction::Result());
@@ -156,18 +163,37 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
         learnerPredict->input.set(classifier::prediction::model, learnerModel);
         learnerPredict->compute();
 
-        /* Calculate weighted error and errFlag: product of predicted * ground_truth */
-        size_t nErr = 0;
-        algorithmFPType errM = zero;
-        for (size_t i = 0; i < nVectors; i++)
+        /* Calculate weighted error of the weak learner and the sum of the weights in parallel by blocks.
+           Partial sums are added in the fixed order so that the result does not depend on the threads */
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
         {
-            errFlag[i] = -one;
-            if (h[i] * y[i] < zero)
+            size_t start = iBlock * adaBoostBlockSize;
+            size_t end = (start + adaBoostBlockSize > nVectors) ? nVectors : start + adaBoostBlockSize;
+
+            algorithmFPType errBlock  = zero;
+            algorithmFPType nErrBlock = zero;
+            algorithmFPType wBlock    = zero;
+          PRAGMA_IVDEP
+            for (size_t i = start; i < end; i++)
             {
-                errFlag[i] = one;
-                nErr++;
-                errM += w[i];
+                algorithmFPType isErr = (h[i] * y[i] < zero ? one : zero);
+                nErrBlock += isErr;
+                errBlock  += isErr * w[i];
+                wBlock    += w[i];
             }
+            partialErr[iBlock]  = errBlock;
+            partialNErr[iBlock] = nErrBlock;
+            partialW[iBlock]    = wBlock;
+        } );
+
+        size_t nErr = 0;
+        algorithmFPType errM = zero;
+        algorithmFPType wSum = zero;
+        for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+        {
+            nErr += (size_t)partialNErr[iBlock];
+            errM += partialErr[iBlock];
+            wSum += partialW[iBlock];
         }
 
         if (nErr == 0)
@@ -186,23 +212,25 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
 
         algorithmFPType cM = 0.5 * sLog<cpu>((one - errM) / errM);
 
-        /* Update weights */
-        for (size_t i = 0; i < nVectors; i++)
-        {
-            errFlag[i] *= cM;
-        }
-        vExp<cpu>(nVectors, errFlag, errFlag);
-        algorithmFPType wSum = zero;
-        for (size_t i = 0; i < nVectors; i++)
-        {
-            w[i] *= errFlag[i];
-            wSum += w[i];
-        }
-        algorithmFPType invWSum = one / wSum;
-        for (size_t i = 0; i < nVectors; i++)
+        /* Update weights: the weights of misclassified observations are multiplied by exp(cM),
+           the weights of other observations by exp(-cM).
+           The sum of the updated weights is known in advance, so they are normalized in the same pass */
+        algorithmFPType expCM = sSqrt<cpu>((one - errM) / errM);   /* exp(cM) */
+        algorithmFPType invExpCM = one / expCM;
+        algorithmFPType invWSum = one / (errM * expCM + (wSum - errM) * invExpCM);
+        algorithmFPType errFactor = expCM * invWSum;
+        algorithmFPType okFactor  = invExpCM * invWSum;
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
         {
-            w[i] *= invWSum;
-        }
+            size_t start = iBlock * adaBoostBlockSize;
+            size_t end = (start + adaBoostBlockSize > nVectors) ? nVectors : start + adaBoostBlockSize;
+
+          PRAGMA_IVDEP
+            for (size_t i = start; i < end; i++)
+            {
+                w[i] *= (h[i] * y[i] < zero ? errFactor : okFactor);
+            }
+        } );
         alpha[m] = cM;
 
         if (errM < accThr) { break; }
@@ -212,7 +240,7 @@ void AdaBoostTrainKernel<method, algorithmFPType, cpu>::adaBoostFreundKernel(
     *nWeakLearnersPtr = nWeakLearners;
     *alphaPtr  = alpha;
 
-    daal::services::daal_free(errFlag);
+    daal::services::daal_free(partialSums);
     return;
 }
 
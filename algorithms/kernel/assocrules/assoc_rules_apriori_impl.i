@@ -52,14 +52,10 @@ void AssociationRulesKernel<apriori, interm, cpu>::compute(const NumericTable *a
     double minSupport = parameter->minSupport;
     size_t minItemsetSize = (parameter->minItemsetSize ? parameter->minItemsetSize : 1);
 
-    NumericTable *largeItemsetsTable        = r[0];
-    NumericTable *largeItemsetsSupportTable = r[1];
-
     /* Create association rules data set from input numeric table */
     assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
 
     ItemSetList<cpu> *L = new ItemSetList<cpu>[data.numOfUniqueItems];
-    AssocRule<cpu> *R = NULL;
 
     /* Find "large" itemsets */
     size_t L_size = 0;
@@ -67,6 +63,26 @@ void AssociationRulesKernel<apriori, interm, cpu>::compute(const NumericTable *a
     findLargeItemsets((size_t)sCeil<cpu>(minSupport * data.numOfTransactions), maxItemsetSize, data, L, &L_size);
     if (this->_errors->size() > 0) { return; }
 
+    /* Write "large" itemsets and association rules into resulting tables */
+    writeResults(L, L_size, minItemsetSize, parameter, r);
+
+    for (size_t i = 0; i < L_size; i++)
+    {
+        L[i].remove();
+    }
+    delete[] L;
+    return;
+}
+
+template <typename interm, CpuType cpu>
+void AssociationRulesKernel<apriori, interm, cpu>::writeResults(ItemSetList<cpu> *L, size_t L_size, size_t minItemsetSize,
+                                                                const daal::algorithms::association_rules::Parameter *parameter,
+                                                                NumericTable *r[])
+{
+    NumericTable *largeItemsetsTable        = r[0];
+    NumericTable *largeItemsetsSupportTable = r[1];
+    AssocRule<cpu> *R = NULL;
+
     /* Allocate memory to store "large" itemsets */
     size_t nLargeItemSets = 0;
     size_t nItemInLargeItemSets = 0;
@@ -114,13 +130,6 @@ void AssociationRulesKernel<apriori, interm, cpu>::compute(const NumericTable *a
 
         delete[] R;
     }
-
-    for (size_t i = 0; i < L_size; i++)
-    {
-        L[i].remove();
-    }
-    delete[] L;
-    return;
 }
 
 template <typename interm, CpuType cpu>
@@ -48,6 +48,10 @@ public:
     /** Find "large" item sets and build association rules */
     void compute(const NumericTable *a, size_t nr, NumericTable *r[], const daal::algorithms::Parameter *parameter);
 protected:
+    /** Write "large" item sets and association rules built from them into resulting tables */
+    void writeResults(ItemSetList<cpu> *L, size_t L_size, size_t minItemsetSize,
+                      const daal::algorithms::association_rules::Parameter *parameter, NumericTable *r[]);
+
     void findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> &data, ItemSetList<cpu> *L, size_t *L_size);
 
     void allocateItemsetsTableData(ItemSetList<cpu> *L, size_t L_size, size_t minItemsetSize,
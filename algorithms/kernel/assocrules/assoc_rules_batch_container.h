@@ -24,6 +24,7 @@
 #include "apriori.h"
 #include "assoc_rules_kernel.h"
 #include "assoc_rules_apriori_kernel.h"
+#include "assoc_rules_fpgrowth_kernel.h"
 
 namespace daal
 {
@@ -0,0 +1,47 @@
+/* file: assoc_rules_fpgrowth_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of association rules FP-Growth method.
+//--
+*/
+
+#include "assoc_rules_batch_container.h"
+#include "assoc_rules_fpgrowth_kernel.h"
+#include "assoc_rules_fpgrowth_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, fpGrowth, DAAL_CPU>;
+} // namespace interface1
+
+namespace internal
+{
+template class AssociationRulesKernel<fpGrowth, DAAL_FPTYPE, DAAL_CPU>;
+} // namespace internal
+
+} // namespace association_rules
+} // namespace algorithms
+} // namespace daal
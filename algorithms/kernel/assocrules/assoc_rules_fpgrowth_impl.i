@@ -0,0 +1,426 @@
+/* file: assoc_rules_fpgrowth_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of FP-Growth method of association rules mining algorithm.
+//
+//  The transactions are stored in the prefix tree built in two passes over the
+//  data: the first pass counts the supports of the items, the second inserts
+//  the frequent items of every transaction in the order of decreasing support.
+//  "Large" itemsets that end with different items are mined from the conditional
+//  trees of those items in parallel. Association rules are built from the found
+//  itemsets in the same way as in Apriori method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_IMPL_I__
+#define __ASSOC_RULES_FPGROWTH_IMPL_I__
+
+#include "threading.h"
+#include "service_memory.h"
+#include "service_sort.h"
+#include "service_profiler.h"
+
+#include "assoc_rules_fpgrowth_kernel.h"
+#include "assoc_rules_apriori_impl.i"
+
+using namespace daal::algorithms::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+template <CpuType cpu>
+int compareItemsBySupport(const void *a, const void *b)
+{
+    const assocRulesUniqueItem<cpu> *aa = (const assocRulesUniqueItem<cpu> *)a;
+    const assocRulesUniqueItem<cpu> *bb = (const assocRulesUniqueItem<cpu> *)b;
+
+    if (aa->support < bb->support) { return  1; }
+    if (bb->support < aa->support) { return -1; }
+    if (aa->itemID  < bb->itemID)  { return -1; }
+    if (bb->itemID  < aa->itemID)  { return  1; }
+    return 0;
+}
+
+template <CpuType cpu>
+int compareItemsetsLexicographically(const void *a, const void *b)
+{
+    const assocrules_itemset<cpu> *aa = *((assocrules_itemset<cpu> **)a);
+    const assocrules_itemset<cpu> *bb = *((assocrules_itemset<cpu> **)b);
+
+    for (size_t i = 0; i < aa->size && i < bb->size; i++)
+    {
+        if (aa->items[i] < bb->items[i]) { return -1; }
+        if (bb->items[i] < aa->items[i]) { return  1; }
+    }
+    if (aa->size < bb->size) { return -1; }
+    if (bb->size < aa->size) { return  1; }
+    return 0;
+}
+
+/**
+ *  \brief Buffers used by a thread to mine the conditional trees
+ */
+template <CpuType cpu>
+struct FPGrowthTls
+{
+    FPGrowthTls(size_t nItems, size_t nLevels)
+    {
+        L        = new ItemSetList<cpu>[nLevels];
+        buffer   = (size_t *)daal::services::daal_malloc(4 * nItems * sizeof(size_t));
+        suffix   = buffer;
+        items    = suffix   + nItems;
+        supports = items    + nItems;
+        path     = supports + nItems;
+    }
+
+    ~FPGrowthTls()
+    {
+        delete[] L;
+        daal::services::daal_free(buffer);
+    }
+
+    static void *operator new(size_t sz)
+    {
+        return daal::services::daal_malloc(sz);
+    }
+
+    static void operator delete(void *ptr, size_t sz)
+    {
+        daal::services::daal_free(ptr);
+    }
+
+    ItemSetList<cpu> *L;        /*<! Lists of "large" itemsets found by the thread */
+    size_t *buffer;
+    size_t *suffix;             /*<! Ranks of the items of the current suffix */
+    size_t *items;              /*<! Items of the itemset being added to the lists */
+    size_t *supports;           /*<! Supports of the items in the paths of the conditional tree */
+    size_t *path;               /*<! Path being inserted into the conditional tree */
+};
+
+template <typename interm, CpuType cpu>
+void AssociationRulesKernel<fpGrowth, interm, cpu>::compute(const NumericTable *a, size_t nr, NumericTable *r[],
+                                                            const daal::algorithms::Parameter *algParameter)
+{
+    NumericTable *dataTable = const_cast<NumericTable *>(a);
+    const daal::algorithms::association_rules::Parameter *parameter =
+            static_cast<const daal::algorithms::association_rules::Parameter *>(algParameter);
+    double minSupport = parameter->minSupport;
+    size_t minItemsetSize = (parameter->minItemsetSize ? parameter->minItemsetSize : 1);
+
+    /* The first pass over the data: the supports of the items are counted
+       while the data set is created from input numeric table */
+    assocrules_dataset<cpu> data(dataTable, parameter->nTransactions, parameter->nUniqueItems, minSupport);
+
+    ItemSetList<cpu> *L = new ItemSetList<cpu>[data.numOfUniqueItems];
+
+    /* Find "large" itemsets */
+    size_t L_size = 0;
+    size_t maxItemsetSize = ((parameter->maxItemsetSize == 0) ? (size_t) - 1 : parameter->maxItemsetSize);
+    findLargeItemsets((size_t)sCeil<cpu>(minSupport * data.numOfTransactions), maxItemsetSize, data, L, &L_size);
+
+    if (this->_errors->size() == 0)
+    {
+        /* Write "large" itemsets and association rules into resulting tables */
+        this->writeResults(L, L_size, minItemsetSize, parameter, r);
+    }
+
+    for (size_t i = 0; i < data.numOfUniqueItems; i++)
+    {
+        L[i].remove();
+    }
+    delete[] L;
+}
+
+template <typename interm, CpuType cpu>
+void AssociationRulesKernel<fpGrowth, interm, cpu>::findLargeItemsets(size_t minSupport, size_t maxItemsetSize,
+                                                                      assocrules_dataset<cpu> &data,
+                                                                      ItemSetList<cpu> *L, size_t *L_size_ptr)
+{
+    size_t nItems = data.numOfUniqueItems;
+    if (nItems == 0) { return; }
+
+    /* "Large" itemsets of size 1 are the unique items of the data set */
+    this->firstPass(minSupport, data, L, L_size_ptr);
+    if (maxItemsetSize < 2) { return; }
+
+    /* Ranks of the items in the order of decreasing support */
+    assocRulesUniqueItem<cpu> *rankedItems = new assocRulesUniqueItem<cpu>[nItems];
+    size_t maxItemID = data.uniq_items[nItems - 1].itemID;
+    size_t *itemRanks = (size_t *)daal::services::daal_malloc((maxItemID + 1) * sizeof(size_t));
+    size_t *rankItems = (size_t *)daal::services::daal_malloc(nItems * sizeof(size_t));
+    if (!rankedItems || !itemRanks || !rankItems)
+    {
+        delete[] rankedItems;
+        daal::services::daal_free(itemRanks);
+        daal::services::daal_free(rankItems);
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    for (size_t i = 0; i < nItems; i++)
+    {
+        rankedItems[i] = data.uniq_items[i];
+    }
+    qSort<assocRulesUniqueItem<cpu>, cpu>(nItems, rankedItems, compareItemsBySupport<cpu>);
+    for (size_t i = 0; i < nItems; i++)
+    {
+        rankItems[i] = rankedItems[i].itemID;
+        itemRanks[rankedItems[i].itemID] = i;
+    }
+    delete[] rankedItems;
+
+    /* The second pass over the data */
+    fpgrowth_tree<cpu> *tree = buildTree(data, itemRanks);
+    daal::services::daal_free(itemRanks);
+    if (!tree)
+    {
+        daal::services::daal_free(rankItems);
+        this->_errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    size_t nLevels = (maxItemsetSize < nItems ? maxItemsetSize : nItems);
+    daal::tls<FPGrowthTls<cpu> *> fpTls([ = ]()
+    {
+        return new FPGrowthTls<cpu>(nItems, nLevels);
+    } );
+
+    /* Mine the conditional trees of the items, the least frequent items have the largest trees */
+    daal::threader_flag allocationFailed;
+    {
+        DAAL_PROFILER_TASK("assoc_rules.fpgrowth.mine");
+        daal::threader_for(nItems, nItems, [ =, &fpTls, &allocationFailed](int i)
+        {
+            FPGrowthTls<cpu> *local = fpTls.local();
+            if (!local || !local->buffer) { allocationFailed.set(); return; }
+
+            size_t item = nItems - 1 - i;
+            fpgrowth_tree<cpu> *condTree = NULL;
+            if (!buildConditionalTree(*tree, item, minSupport, local->supports, local->path, &condTree))
+            { allocationFailed.set(); return; }
+            if (!condTree) { return; }
+
+            local->suffix[0] = item;
+            if (!mineTree(*condTree, minSupport, maxItemsetSize, local->suffix, 1, rankItems,
+                          local->items, local->supports, local->path, local->L))
+            { allocationFailed.set(); }
+            delete condTree;
+        } );
+    }
+
+    /* Collect itemsets found by the threads */
+    fpTls.reduce([ = ](FPGrowthTls<cpu> *local)
+    {
+        if (!local) { return; }
+        for (size_t k = 1; k < nLevels; k++)
+        {
+            for (auto *current = local->L[k].start; current != NULL; current = current->next)
+            {
+                L[k].insert(current->itemSet);
+            }
+        }
+        delete local;
+    } );
+
+    delete tree;
+    daal::services::daal_free(rankItems);
+
+    if (allocationFailed.isSet()) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    size_t L_size = 1;
+    for (size_t k = 1; k < nLevels && L[k].size > 0; k++)
+    {
+        sortItemsets(L[k]);
+        L_size = k + 1;
+    }
+    *L_size_ptr = L_size;
+}
+
+template <typename interm, CpuType cpu>
+fpgrowth_tree<cpu> *AssociationRulesKernel<fpGrowth, interm, cpu>::buildTree(assocrules_dataset<cpu> &data,
+                                                                              const size_t *itemRanks)
+{
+    DAAL_PROFILER_TASK("assoc_rules.fpgrowth.build");
+
+    size_t nItems = data.numOfUniqueItems;
+    fpgrowth_tree<cpu> *tree = new fpgrowth_tree<cpu>(nItems);
+    size_t *path = (size_t *)daal::services::daal_malloc(nItems * sizeof(size_t));
+    if (!tree || !tree->isValid() || !path)
+    {
+        delete tree;
+        daal::services::daal_free(path);
+        return NULL;
+    }
+
+    for (size_t t = 0; t < data.numOfLargeTransactions; t++)
+    {
+        const assocrules_transaction<cpu> *transaction = data.large_tran[t];
+
+        /* Items of the transaction in the order of decreasing support without repetitions */
+        size_t pathSize = 0;
+        for (size_t j = 0; j < transaction->size; j++)
+        {
+            path[pathSize++] = itemRanks[transaction->items[j]];
+        }
+        qSort<size_t, cpu>(pathSize, path);
+        size_t nUnique = (pathSize > 0 ? 1 : 0);
+        for (size_t j = 1; j < pathSize; j++)
+        {
+            if (path[j] != path[nUnique - 1]) { path[nUnique++] = path[j]; }
+        }
+
+        if (!tree->insert(path, nUnique, 1))
+        {
+            delete tree;
+            daal::services::daal_free(path);
+            return NULL;
+        }
+    }
+
+    daal::services::daal_free(path);
+    return tree;
+}
+
+template <typename interm, CpuType cpu>
+bool AssociationRulesKernel<fpGrowth, interm, cpu>::buildConditionalTree(const fpgrowth_tree<cpu> &tree, size_t item,
+        size_t minSupport, size_t *supports, size_t *path, fpgrowth_tree<cpu> **condTree)
+{
+    *condTree = NULL;
+
+    /* Only the items with lower ranks precede the item in the paths */
+    if (item == 0) { return true; }
+
+    const fpgrowth_node<cpu> *nodes = tree.nodes;
+    for (size_t i = 0; i < item; i++)
+    {
+        supports[i] = 0;
+    }
+    for (size_t node = tree.heads[item]; node != fpgrowth_tree<cpu>::noNode; node = nodes[node].nextSameItem)
+    {
+        size_t count = nodes[node].count;
+        for (size_t p = nodes[node].parent; p != 0; p = nodes[p].parent)
+        {
+            supports[nodes[p].item] += count;
+        }
+    }
+
+    bool found = false;
+    for (size_t i = 0; i < item && !found; i++)
+    {
+        found = (supports[i] >= minSupport);
+    }
+    if (!found) { return true; }
+
+    fpgrowth_tree<cpu> *result = new fpgrowth_tree<cpu>(item);
+    if (!result || !result->isValid()) { delete result; return false; }
+
+    for (size_t node = tree.heads[item]; node != fpgrowth_tree<cpu>::noNode; node = nodes[node].nextSameItem)
+    {
+        /* The path from the node to the root contains the items in the order of decreasing ranks */
+        size_t pathSize = 0;
+        for (size_t p = nodes[node].parent; p != 0; p = nodes[p].parent)
+        {
+            if (supports[nodes[p].item] >= minSupport) { path[pathSize++] = nodes[p].item; }
+        }
+        for (size_t j = 0; j < pathSize / 2; j++)
+        {
+            size_t tmp = path[j];
+            path[j] = path[pathSize - 1 - j];
+            path[pathSize - 1 - j] = tmp;
+        }
+
+        if (pathSize > 0 && !result->insert(path, pathSize, nodes[node].count)) { delete result; return false; }
+    }
+
+    *condTree = result;
+    return true;
+}
+
+template <typename interm, CpuType cpu>
+bool AssociationRulesKernel<fpGrowth, interm, cpu>::mineTree(const fpgrowth_tree<cpu> &tree, size_t minSupport,
+        size_t maxItemsetSize, size_t *suffix, size_t suffixSize, const size_t *rankItems,
+        size_t *items, size_t *supports, size_t *path, ItemSetList<cpu> *L)
+{
+    size_t itemsetSize = suffixSize + 1;
+    for (size_t item = tree.nItems; item-- > 0; )
+    {
+        size_t support = tree.supports[item];
+        if (support < minSupport) { continue; }
+
+        suffix[suffixSize] = item;
+        for (size_t k = 0; k < itemsetSize; k++)
+        {
+            items[k] = rankItems[suffix[k]];
+        }
+        qSort<size_t, cpu>(itemsetSize, items);
+
+        assocrules_itemset<cpu> *iset = new assocrules_itemset<cpu>(itemsetSize, items, items[itemsetSize - 1], support);
+        if (!iset) { return false; }
+        L[itemsetSize - 1].insert(iset);
+
+        if (itemsetSize >= maxItemsetSize) { continue; }
+
+        fpgrowth_tree<cpu> *condTree = NULL;
+        if (!buildConditionalTree(tree, item, minSupport, supports, path, &condTree)) { return false; }
+        if (!condTree) { continue; }
+
+        bool ok = mineTree(*condTree, minSupport, maxItemsetSize, suffix, itemsetSize, rankItems,
+                           items, supports, path, L);
+        delete condTree;
+        if (!ok) { return false; }
+    }
+    return true;
+}
+
+template <typename interm, CpuType cpu>
+void AssociationRulesKernel<fpGrowth, interm, cpu>::sortItemsets(ItemSetList<cpu> &list)
+{
+    assocrules_itemset<cpu> **itemsetsArray = (assocrules_itemset<cpu> **)daal::services::daal_malloc(
+        list.size * sizeof(assocrules_itemset<cpu> *));
+    if (!itemsetsArray) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    size_t k = 0;
+    for (auto *current = list.start; current != NULL; current = current->next, k++)
+    {
+        itemsetsArray[k] = current->itemSet;
+    }
+
+    qSort<assocrules_itemset<cpu> *, cpu>(list.size, itemsetsArray, compareItemsetsLexicographically<cpu>);
+
+    k = 0;
+    for (auto *current = list.start; current != NULL; current = current->next, k++)
+    {
+        current->itemSet = itemsetsArray[k];
+    }
+    daal::services::daal_free(itemsetsArray);
+}
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
@@ -0,0 +1,80 @@
+/* file: assoc_rules_fpgrowth_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template function that computes association rules results
+//  using FP-Growth method.
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_KERNEL_H__
+#define __ASSOC_RULES_FPGROWTH_KERNEL_H__
+
+#include "assoc_rules_apriori_kernel.h"
+#include "assoc_rules_fpgrowth_tree.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+/**
+ *  Structure that contains kernels for FP-Growth association rules mining.
+ *  "Large" itemsets are found in the prefix tree of the transactions, then
+ *  they are written into resulting tables and association rules are built
+ *  in the same way as in Apriori method
+ */
+template <typename interm, CpuType cpu>
+class AssociationRulesKernel<fpGrowth, interm, cpu> : public AssociationRulesKernel<apriori, interm, cpu>
+{
+public:
+    /** Find "large" item sets and build association rules */
+    void compute(const NumericTable *a, size_t nr, NumericTable *r[], const daal::algorithms::Parameter *parameter);
+protected:
+    void findLargeItemsets(size_t minSupport, size_t maxItemsetSize, assocrules_dataset<cpu> &data, ItemSetList<cpu> *L, size_t *L_size);
+
+    /** Build the prefix tree from the transactions of the data set */
+    fpgrowth_tree<cpu> *buildTree(assocrules_dataset<cpu> &data, const size_t *itemRanks);
+
+    /** Build the conditional tree of the item from the paths that lead to the nodes of the item.
+        The tree is not built if no item in the paths has the minimum support */
+    bool buildConditionalTree(const fpgrowth_tree<cpu> &tree, size_t item, size_t minSupport,
+                              size_t *supports, size_t *path, fpgrowth_tree<cpu> **condTree);
+
+    /** Add the itemsets that consist of the suffix and an item of the tree to the lists of "large" itemsets,
+        and mine the conditional trees of those itemsets recursively */
+    bool mineTree(const fpgrowth_tree<cpu> &tree, size_t minSupport, size_t maxItemsetSize,
+                  size_t *suffix, size_t suffixSize, const size_t *rankItems,
+                  size_t *items, size_t *supports, size_t *path, ItemSetList<cpu> *L);
+
+    /** Sort the itemsets of the list in lexicographical order */
+    void sortItemsets(ItemSetList<cpu> &list);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
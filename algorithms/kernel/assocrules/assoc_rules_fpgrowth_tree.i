@@ -0,0 +1,197 @@
+/* file: assoc_rules_fpgrowth_tree.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the prefix tree (FP-tree) used in FP-Growth algorithm
+//--
+*/
+
+#ifndef __ASSOC_RULES_FPGROWTH_TREE_I__
+#define __ASSOC_RULES_FPGROWTH_TREE_I__
+
+#include "service_memory.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace association_rules
+{
+namespace internal
+{
+
+/**
+ *  \brief Node of the prefix tree
+ */
+template<CpuType cpu>
+struct fpgrowth_node
+{
+    size_t item;                /*<! Rank of the item in the order of decreasing support */
+    size_t count;               /*<! Number of transactions that share the path from the root to this node */
+    size_t parent;              /*<! Index of the parent node */
+    size_t firstChild;          /*<! Index of the first child node */
+    size_t nextSibling;         /*<! Index of the next node with the same parent */
+    size_t nextSameItem;        /*<! Index of the next node with the same item */
+};
+
+/**
+ *  \brief Prefix tree that stores the transactions in compressed form.
+ *         The items of the transactions are represented by their ranks, and the items
+ *         with lower ranks are closer to the root, so the frequent items share the nodes.
+ *         The nodes are stored in an array and reference each other by their indices.
+ */
+template<CpuType cpu>
+struct fpgrowth_tree
+{
+    static const size_t noNode = (size_t) - 1;
+
+    /** \brief Construct empty tree for the items with ranks from 0 to nItems - 1 */
+    fpgrowth_tree(size_t _nItems) :
+        nodes(NULL), nNodes(0), capacity(0), nItems(_nItems), heads(NULL), supports(NULL), rootChildren(NULL)
+    {
+        heads        = (size_t *)daal::services::daal_malloc(nItems * sizeof(size_t));
+        supports     = (size_t *)daal::services::daal_malloc(nItems * sizeof(size_t));
+        rootChildren = (size_t *)daal::services::daal_malloc(nItems * sizeof(size_t));
+        if (!heads || !supports || !rootChildren) { return; }
+
+        for (size_t i = 0; i < nItems; i++)
+        {
+            heads[i]        = noNode;
+            supports[i]     = 0;
+            rootChildren[i] = noNode;
+        }
+        if (!reserve(nItems + 1)) { return; }
+
+        /* Root node */
+        nodes[0].item        = noNode;
+        nodes[0].count       = 0;
+        nodes[0].parent      = noNode;
+        nodes[0].firstChild  = noNode;
+        nodes[0].nextSibling = noNode;
+        nodes[0].nextSameItem = noNode;
+        nNodes = 1;
+    }
+
+    ~fpgrowth_tree()
+    {
+        daal::services::daal_free(nodes);
+        daal::services::daal_free(heads);
+        daal::services::daal_free(supports);
+        daal::services::daal_free(rootChildren);
+    }
+
+    /** \brief Returns true if the memory for the tree was allocated successfully */
+    bool isValid() const { return (nNodes > 0); }
+
+    /**
+     *  \brief Add the path of items to the tree
+     *
+     *  \param path[in]     ranks of the items sorted in ascending order
+     *  \param pathSize[in] number of items in the path
+     *  \param count[in]    number of transactions that contain the path
+     *
+     *  \return false if memory allocation failed
+     */
+    bool insert(const size_t *path, size_t pathSize, size_t count)
+    {
+        size_t current = 0;
+        for (size_t i = 0; i < pathSize; i++)
+        {
+            size_t item = path[i];
+            size_t child = (current == 0 ? rootChildren[item] : findChild(current, item));
+            if (child == noNode)
+            {
+                if (nNodes == capacity && !reserve(2 * capacity)) { return false; }
+                child = nNodes++;
+                fpgrowth_node<cpu> &node = nodes[child];
+                node.item         = item;
+                node.count        = 0;
+                node.parent       = current;
+                node.firstChild   = noNode;
+                node.nextSibling  = nodes[current].firstChild;
+                node.nextSameItem = heads[item];
+                nodes[current].firstChild = child;
+                heads[item] = child;
+                if (current == 0) { rootChildren[item] = child; }
+            }
+            nodes[child].count += count;
+            supports[item] += count;
+            current = child;
+        }
+        return true;
+    }
+
+    static void *operator new(size_t sz)
+    {
+        return daal::services::daal_malloc(sz);
+    }
+
+    static void operator delete(void *ptr, size_t sz)
+    {
+        daal::services::daal_free(ptr);
+    }
+
+    fpgrowth_node<cpu> *nodes;  /*<! Nodes of the tree, the root is the node 0 */
+    size_t nNodes;              /*<! Number of nodes */
+    size_t capacity;            /*<! Number of nodes the memory is allocated for */
+    size_t nItems;              /*<! Number of items */
+    size_t *heads;              /*<! Index of the first node of every item in the list of nodes with the same item */
+    size_t *supports;           /*<! Support of every item in the tree */
+
+protected:
+    size_t *rootChildren;       /*<! Index of the child node of the root for every item */
+
+    size_t findChild(size_t parent, size_t item) const
+    {
+        for (size_t child = nodes[parent].firstChild; child != noNode; child = nodes[child].nextSibling)
+        {
+            if (nodes[child].item == item) { return child; }
+        }
+        return noNode;
+    }
+
+    bool reserve(size_t newCapacity)
+    {
+        fpgrowth_node<cpu> *newNodes = (fpgrowth_node<cpu> *)daal::services::daal_malloc(
+            newCapacity * sizeof(fpgrowth_node<cpu>));
+        if (!newNodes) { return false; }
+        if (nNodes)
+        {
+            daal::services::daal_memcpy_s(newNodes, newCapacity * sizeof(fpgrowth_node<cpu>),
+                                          nodes, nNodes * sizeof(fpgrowth_node<cpu>));
+        }
+        daal::services::daal_free(nodes);
+        nodes = newNodes;
+        capacity = newCapacity;
+        return true;
+    }
+
+private:
+    fpgrowth_tree(const fpgrowth_tree &);
+    fpgrowth_tree &operator=(const fpgrowth_tree &);
+};
+
+} // namespace internal
+
+} // namespace association_rules
+
+} // namespace algorithms
+
+} // namespace daal
+
+#endif
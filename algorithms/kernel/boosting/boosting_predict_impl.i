@@ -53,7 +53,7 @@ void BoostingPredictKernel<algorithmFPType, cpu>::compute(services::SharedPtr<Nu
         new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(1, nVectors));
     algorithmFPType *rWeak = rWeakTable->getArray();
 
-    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
+    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction->clone();
     learnerPredict->input.set(classifier::prediction::data, xTable);
 
     services::SharedPtr<classifier::prediction::Result> predictionRes(new classifier::prediction::Result());
@@ -36,6 +36,7 @@
 #include "threading.h"
 #include "daal_defines.h"
 #include "service_math.h"
+#include "service_defines.h"
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
@@ -56,6 +57,8 @@ namespace training
 namespace internal
 {
 
+const size_t brownBoostBlockSize = 1024;    /* Number of observations processed by a thread at once */
+
 template <Method method, typename algorithmFPType, CpuType cpu>
 void BrownBoostTrainKernel<method, algorithmFPType, cpu>::compute(size_t na, services::SharedPtr<NumericTable> *a,
                                                                   Model *r, const Parameter *par)
@@ -153,12 +156,12 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
     r = daal::services::internal::service_calloc<algorithmFPType, cpu>(nVectors);
     if (!r) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
+    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining->clone();
     learnerTrain->input.set(classifier::training::data,    weakLearnerInputTables[0]);
     learnerTrain->input.set(classifier::training::labels,  weakLearnerInputTables[1]);
     learnerTrain->input.set(classifier::training::weights, weakLearnerInputTables[2]);
 
-    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
+    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction->clone();
     learnerPredict->input.set(classifier::prediction::data, weakLearnerInputTables[0]);
 
     services::SharedPtr<classifier::prediction::Result> predictionRes(new classifier::prediction::Result());
@@ -175,7 +178,7 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
         nWeakLearners++;
 
         /* Update weights */
-        updateWeights(nVectors, s, nr.c, nr.invSqrtC, r, nr.nra, nr.nre2, w);
+        updateWeights(nVectors, s, nr.c, nr.invSqrtC, r, nr.nra, nr.nre2, w, nr.partialSums);
 
         /* Re-allocate array of weak learners' models and boosting coefficients */
         alpha = reallocateAlpha(nWeakLearners-1, nWeakLearners, alpha);
@@ -195,15 +198,36 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
         learnerPredict->input.set(classifier::prediction::model, learnerModel);
         learnerPredict->compute();
 
-        algorithmFPType gamma = zero;
+        /* Compute the correlation of the predictions with the labels in parallel by blocks.
+           Partial sums are added in the fixed order so that the result does not depend on the threads */
+        size_t nBlocks = nr.nBlocks;
+        algorithmFPType *partialGamma = nr.partialSums;
+        algorithmFPType *partialCorrect = nr.partialSums + nBlocks;
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+        {
+            size_t start = iBlock * brownBoostBlockSize;
+            size_t end = (start + brownBoostBlockSize > nVectors) ? nVectors : start + brownBoostBlockSize;
+
+            algorithmFPType gammaBlock = zero;
+            algorithmFPType nCorrectBlock = zero;
+          PRAGMA_IVDEP
+            for (size_t j = start; j < end; j++)
+            {
+                h[j] = ((h[j] > zero) ? one : -one);
+                algorithmFPType hy = h[j] * y[j];
+                gammaBlock += w[j] * hy;
+                nCorrectBlock += (hy > zero ? one : zero);
+            }
+            partialGamma[iBlock] = gammaBlock;
+            partialCorrect[iBlock] = nCorrectBlock;
+        } );
 
+        algorithmFPType gamma = zero;
         size_t nCorrect = 0;
-        for (size_t j = 0; j < nVectors; j++)
+        for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
         {
-            h[j] = ((h[j] > zero) ? one : -one);
-            algorithmFPType hy = h[j] * y[j];
-            gamma += w[j] * hy;
-            nCorrect += (size_t)(hy > zero);
+            gamma += partialGamma[iBlock];
+            nCorrect += (size_t)partialCorrect[iBlock];
         }
 
         if (nCorrect == nVectors)
@@ -221,10 +245,19 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
         alpha[nWeakLearners - 1] = nr.nrAlpha;
 
         /* Update margin */
-        for (size_t j = 0; j < nVectors; j++)
+        algorithmFPType nrAlpha = nr.nrAlpha;
+        algorithmFPType *nrb = nr.nrb;
+        daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
         {
-            r[j] += nr.nrAlpha * nr.nrb[j];
-        }
+            size_t start = iBlock * brownBoostBlockSize;
+            size_t end = (start + brownBoostBlockSize > nVectors) ? nVectors : start + brownBoostBlockSize;
+
+          PRAGMA_IVDEP
+            for (size_t j = start; j < end; j++)
+            {
+                r[j] += nrAlpha * nrb[j];
+            }
+        } );
     }
 
     *nWeakLearnersPtr = nWeakLearners;
@@ -236,26 +269,57 @@ void BrownBoostTrainKernel<method, algorithmFPType, cpu>::brownBoostFreundKernel
 template <Method method, typename algorithmFPType, CpuType cpu>
 void BrownBoostTrainKernel<method, algorithmFPType, cpu>::updateWeights(
             size_t nVectors, algorithmFPType s, algorithmFPType c, algorithmFPType invSqrtC,
-            const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w)
+            const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w,
+            algorithmFPType *partialSums)
 {
-    for (size_t j = 0; j < nVectors; j++)
+    const algorithmFPType invC = (algorithmFPType)1.0 / c;
+    size_t nBlocks = nVectors / brownBoostBlockSize + !!(nVectors % brownBoostBlockSize);
+
+    /* Weights and the values of erf function are computed for the blocks of observations in parallel,
+       so that the arguments of vExp and vErf stay in cache */
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        nra[j] = r[j] + s;
-        nre2[j] = nra[j] * invSqrtC;
-        w[j] = -nra[j] * nra[j] / c;
-    }
-    vExp<cpu>(nVectors, w, w);
-    vErf<cpu>(nVectors, nre2, nre2);
+        size_t start = iBlock * brownBoostBlockSize;
+        size_t nRows = (start + brownBoostBlockSize > nVectors) ? nVectors - start : brownBoostBlockSize;
+        algorithmFPType *nraBlock  = nra  + start;
+        algorithmFPType *nre2Block = nre2 + start;
+        algorithmFPType *wBlock    = w    + start;
+
+      PRAGMA_IVDEP
+        for (size_t j = 0; j < nRows; j++)
+        {
+            nraBlock[j] = r[start + j] + s;
+            nre2Block[j] = nraBlock[j] * invSqrtC;
+            wBlock[j] = -nraBlock[j] * nraBlock[j] * invC;
+        }
+        vExp<cpu>(nRows, wBlock, wBlock);
+        vErf<cpu>(nRows, nre2Block, nre2Block);
+
+        algorithmFPType wSum = (algorithmFPType)0.0;
+        for (size_t j = 0; j < nRows; j++)
+        {
+            wSum += wBlock[j];
+        }
+        partialSums[iBlock] = wSum;
+    } );
+
     algorithmFPType wSum = (algorithmFPType)0.0;
-    for (size_t j = 0; j < nVectors; j++)
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
     {
-        wSum += w[j];
+        wSum += partialSums[iBlock];
     }
     algorithmFPType invWSum = 1.0 / wSum;
-    for (size_t j = 0; j < nVectors; j++)
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        w[j] *= invWSum;
-    }
+        size_t start = iBlock * brownBoostBlockSize;
+        size_t end = (start + brownBoostBlockSize > nVectors) ? nVectors : start + brownBoostBlockSize;
+
+      PRAGMA_IVDEP
+        for (size_t j = start; j < end; j++)
+        {
+            w[j] *= invWSum;
+        }
+    } );
 }
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -283,7 +347,9 @@ NewtonRaphsonKernel<method, algorithmFPType, cpu>::NewtonRaphsonKernel(
     nrw  = (algorithmFPType *)daal::services::daal_malloc(nVectors * sizeof(algorithmFPType));
     nre1 = (algorithmFPType *)daal::services::daal_malloc(nVectors * sizeof(algorithmFPType));
     nre2 = (algorithmFPType *)daal::services::daal_malloc(nVectors * sizeof(algorithmFPType));
-    if (!nra || !nrb || !nrd || !nrw || !nre1 || !nre2) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    nBlocks = nVectors / brownBoostBlockSize + !!(nVectors % brownBoostBlockSize);
+    partialSums = (algorithmFPType *)daal::services::daal_malloc(nBlocks * nPartialSums * sizeof(algorithmFPType));
+    if (!nra || !nrb || !nrd || !nrw || !nre1 || !nre2 || !partialSums) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
     const algorithmFPType one = (algorithmFPType)1.0;
     const algorithmFPType pi  = (algorithmFPType)3.1415926535897932384626433832795;
@@ -308,6 +374,7 @@ NewtonRaphsonKernel<method, algorithmFPType, cpu>::~NewtonRaphsonKernel()
     if (nrw) daal::services::daal_free(nrw);
     if (nre1) daal::services::daal_free(nre1);
     if (nre2) daal::services::daal_free(nre2);
+    if (partialSums) daal::services::daal_free(partialSums);
 }
 
 template <Method method, typename algorithmFPType, CpuType cpu>
@@ -334,37 +401,39 @@ void NewtonRaphsonKernel<method, algorithmFPType, cpu>::compute(algorithmFPType
     nrAlpha = ((error < gamma) ? error : gamma);
     nrT     = nrAlpha * nrAlpha / 3.0;
 
-    for (size_t j = 0; j < nVectors; j++)
+    algorithmFPType *b = nrb;
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        nrb[j] = h[j] * y[j] * alphaSign;
-    }
+        size_t start = iBlock * brownBoostBlockSize;
+        size_t end = (start + brownBoostBlockSize > nVectors) ? nVectors : start + brownBoostBlockSize;
+
+      PRAGMA_IVDEP
+        for (size_t j = start; j < end; j++)
+        {
+            b[j] = h[j] * y[j] * alphaSign;
+        }
+    } );
 
     bool nrDone = false;
     for (size_t nrIter = 0; !nrDone && nrIter < nrMaxIter; nrIter++)
     {
-        /* Calculate Newton-Raphson parameters */
+        /* Calculate Newton-Raphson parameters in a single pass over the blocks of observations.
+           Partial sums are added in the fixed order so that the result does not depend on the threads */
+        computeSums();
+
         nrW = zero;
         nrU = zero;
         nrB = zero;
         nrV = zero;
         nrE = zero;
-        for (size_t j = 0; j < nVectors; j++)
+        for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
         {
-            nrd[j] = nra[j] + nrAlpha * nrb[j] - nrT;
-            nrw[j] = -invC * nrd[j] * nrd[j];
-            nre1[j] = nrd[j] * invSqrtC;
-        }
-        vExp<cpu>(nVectors, nrw,  nrw);
-        vErf<cpu>(nVectors, nre1, nre1);
-        for (size_t j = 0; j < nVectors; j++)
-        {
-            algorithmFPType nrwb  = nrw[j] * nrb[j];
-            algorithmFPType nrwdb = nrwb * nrd[j];
-            nrW += nrw[j];
-            nrB += nrwb;
-            nrU += nrwdb;
-            nrV += nrwdb * nrb[j];
-            nrE += nre1[j] - nre2[j];
+            const algorithmFPType *sums = partialSums + iBlock * nPartialSums;
+            nrW += sums[0];
+            nrB += sums[1];
+            nrU += sums[2];
+            nrV += sums[3];
+            nrE += sums[4];
         }
 
         /* Update Newton-Raphson variables */
@@ -380,6 +449,51 @@ void NewtonRaphsonKernel<method, algorithmFPType, cpu>::compute(algorithmFPType
     nrAlpha *= alphaSign;
 }
 
+template <Method method, typename algorithmFPType, CpuType cpu>
+void NewtonRaphsonKernel<method, algorithmFPType, cpu>::computeSums()
+{
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        size_t start = iBlock * brownBoostBlockSize;
+        size_t nRows = (start + brownBoostBlockSize > nVectors) ? nVectors - start : brownBoostBlockSize;
+        const algorithmFPType *nraBlock  = nra  + start;
+        const algorithmFPType *nre2Block = nre2 + start;
+        const algorithmFPType *nrbBlock = nrb + start;
+        algorithmFPType *nrdBlock  = nrd  + start;
+        algorithmFPType *nrwBlock  = nrw  + start;
+        algorithmFPType *nre1Block = nre1 + start;
+
+      PRAGMA_IVDEP
+        for (size_t j = 0; j < nRows; j++)
+        {
+            nrdBlock[j] = nraBlock[j] + nrAlpha * nrbBlock[j] - nrT;
+            nrwBlock[j] = -invC * nrdBlock[j] * nrdBlock[j];
+            nre1Block[j] = nrdBlock[j] * invSqrtC;
+        }
+        vExp<cpu>(nRows, nrwBlock,  nrwBlock);
+        vErf<cpu>(nRows, nre1Block, nre1Block);
+
+        algorithmFPType nrW = 0.0, nrB = 0.0, nrU = 0.0, nrV = 0.0, nrE = 0.0;
+        for (size_t j = 0; j < nRows; j++)
+        {
+            algorithmFPType nrwb  = nrwBlock[j] * nrbBlock[j];
+            algorithmFPType nrwdb = nrwb * nrdBlock[j];
+            nrW += nrwBlock[j];
+            nrB += nrwb;
+            nrU += nrwdb;
+            nrV += nrwdb * nrbBlock[j];
+            nrE += nre1Block[j] - nre2Block[j];
+        }
+
+        algorithmFPType *sums = partialSums + iBlock * nPartialSums;
+        sums[0] = nrW;
+        sums[1] = nrB;
+        sums[2] = nrU;
+        sums[3] = nrV;
+        sums[4] = nrE;
+    } );
+}
+
 
 } // namespace daal::algorithms::brownboost::training::internal
 }
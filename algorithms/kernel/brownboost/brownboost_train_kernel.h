@@ -50,7 +50,8 @@ public:
 
 private:
     void updateWeights(size_t nVectors, algorithmFPType s, algorithmFPType c, algorithmFPType invSqrtC,
-                       const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w);
+                       const algorithmFPType *r, algorithmFPType *nra, algorithmFPType *nre2, algorithmFPType *w,
+                       algorithmFPType *partialSums);
 
     algorithmFPType *reallocateAlpha(size_t oldAlphaSize, size_t alphaSize, algorithmFPType *oldAlpha);
 
@@ -71,6 +72,11 @@ struct NewtonRaphsonKernel
 
     void compute(algorithmFPType gamma, algorithmFPType s, algorithmFPType *h, algorithmFPType *y);
 
+    /* Computes the sums over the observations needed by an iteration of Newton-Raphson method */
+    void computeSums();
+
+    static const size_t nPartialSums = 5;   /* Number of sums computed by computeSums */
+
     size_t nVectors;
     algorithmFPType nrT;
     algorithmFPType nrAlpha;
@@ -81,6 +87,8 @@ struct NewtonRaphsonKernel
     algorithmFPType *nrb;
     algorithmFPType *nre1;
     algorithmFPType *nre2;
+    algorithmFPType *partialSums;   /* Partial sums computed for the blocks of observations */
+    size_t nBlocks;
 
     size_t nrMaxIter;
     algorithmFPType error;
@@ -0,0 +1,72 @@
+/* file: classifier_model_selection_dense_default_batch_container.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the container for the classifier model selection algorithm.
+//--
+*/
+
+#ifndef __CLASSIFIER_MODEL_SELECTION_DENSE_DEFAULT_BATCH_CONTAINER_H__
+#define __CLASSIFIER_MODEL_SELECTION_DENSE_DEFAULT_BATCH_CONTAINER_H__
+
+#include "algorithms/classifier/classifier_model_selection_batch.h"
+#include "classifier_model_selection_dense_default_batch_kernel.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace model_selection
+{
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
+{
+    __DAAL_INTIALIZE_KERNELS(internal::ModelSelectionKernel, method, algorithmFPType);
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+BatchContainer<algorithmFPType, method, cpu>::~BatchContainer()
+{
+    __DAAL_DEINTIALIZE_KERNELS();
+}
+
+template<typename algorithmFPType, Method method, CpuType cpu>
+void BatchContainer<algorithmFPType, method, cpu>::compute()
+{
+    Input *input = static_cast<Input *>(_in);
+    Result *result = static_cast<Result *>(_res);
+    Parameter *parameter = static_cast<Parameter *>(_par);
+    NumericTable *dataTable   = static_cast<NumericTable *>(input->get(data  ).get());
+    NumericTable *labelsTable = static_cast<NumericTable *>(input->get(labels).get());
+
+    DataCollection *qualityMetricsCollection = result->get(qualityMetrics).get();
+    NumericTable *errorRatesTable = result->getTable(errorRates).get();
+
+    daal::services::Environment::env &env = *_env;
+    __DAAL_CALL_KERNEL(env, internal::ModelSelectionKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType),   \
+                       compute, dataTable, labelsTable, qualityMetricsCollection, errorRatesTable, parameter);
+}
+
+}
+}
+}
+}
+
+#endif
@@ -0,0 +1,334 @@
+/* file: classifier_model_selection_dense_default_batch_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the k-fold cross-validation method of the classifier model selection algorithm.
+//
+//  Observation i belongs to the validation fold i mod nFolds. The observations are copied once in the fold
+//  by fold order, and the copy is extended cyclically by all the folds but the last one, so the validation
+//  part of every fold and its training part, the folds that follow it, are contiguous ranges of the copy
+//  shared by all folds and configurations. The models of all pairs of a configuration and a fold are trained
+//  and evaluated in parallel; the predictions of every configuration are stored fold by fold, so the confusion
+//  matrix of a configuration is computed on the predictions for all observations.
+//--
+*/
+
+#ifndef __CLASSIFIER_MODEL_SELECTION_DENSE_DEFAULT_BATCH_IMPL_I__
+#define __CLASSIFIER_MODEL_SELECTION_DENSE_DEFAULT_BATCH_IMPL_I__
+
+#include "classifier_model_selection_dense_default_batch_kernel.h"
+#include "binary_confusion_matrix_batch.h"
+#include "multiclass_confusion_matrix_batch.h"
+#include "csr_numeric_table.h"
+
+#include "threading.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
+#include "service_numeric_table.h"
+#include "service_blas.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace model_selection
+{
+namespace internal
+{
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void ModelSelectionKernel<method, algorithmFPType, cpu>::compute(const NumericTable *dataTable, const NumericTable *labelsTable,
+            DataCollection *qualityMetricsCollection, NumericTable *errorRatesTable, const Parameter *parameter)
+{
+    const algorithmFPType zero = 0.0;
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nFolds    = parameter->nFolds;
+    const size_t nClasses  = parameter->nClasses;
+    const size_t nConfigurations = parameter->training.size();
+    const size_t nPredictions    = parameter->prediction.size();
+
+    /* Retrieve the input data once for all the folds */
+    const bool isCSR = (dataTable->getDataLayout() == NumericTableIface::csrArray);
+    CSRBlockMicroTable<algorithmFPType, readOnly, cpu> mtXCSR(dataTable);
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtX(dataTable);
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtY(labelsTable);
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtErrorRates(errorRatesTable);
+    algorithmFPType *x = NULL, *y = NULL, *errorRates = NULL;
+    size_t *colIndices = NULL, *rowOffsets = NULL;
+    size_t nRowsRead = (isCSR ? mtXCSR.getSparseBlock(0, nVectors, &x, &colIndices, &rowOffsets) :
+                                mtX.getBlockOfRows(0, nVectors, &x));
+    size_t nLabelsRead = mtY.getBlockOfRows(0, nVectors, &y);
+    size_t nErrorRatesRead = mtErrorRates.getBlockOfRows(0, nConfigurations, &errorRates);
+
+    /* Predictions of every configuration and the labels are stored fold by fold, fold f starts at foldOffsets[f] */
+    ModelSelectionFold<algorithmFPType, cpu> *folds = new ModelSelectionFold<algorithmFPType, cpu>[nFolds];
+    size_t *foldOffsets = (size_t *)daal::services::daal_malloc((nFolds + 1) * sizeof(size_t));
+    if (foldOffsets)
+    {
+        foldOffsets[0] = 0;
+        for (size_t f = 0; f < nFolds; f++)
+        {
+            foldOffsets[f + 1] = foldOffsets[f] + (nVectors - f + nFolds - 1) / nFolds;
+        }
+    }
+
+    /* The permuted copy holds the observations fold by fold followed by the copy of all the folds but the last one */
+    const size_t nCopiedRows = (foldOffsets ? nVectors + foldOffsets[nFolds - 1] : 0);
+    size_t *copyRowOffsets = NULL, *copyColIndices = NULL;
+    size_t nCopiedValues = nCopiedRows * nFeatures;
+    if (isCSR && foldOffsets && nRowsRead == nVectors)
+    {
+        copyRowOffsets = (size_t *)daal::services::daal_malloc((nCopiedRows + 1) * sizeof(size_t));
+        if (copyRowOffsets)
+        {
+            copyRowOffsets[0] = 1;
+            for (size_t f = 0, row = 0; row < nCopiedRows; f = (f + 1 == nFolds ? 0 : f + 1))
+            {
+                for (size_t i = f; i < nVectors; i += nFolds, row++)
+                {
+                    copyRowOffsets[row + 1] = copyRowOffsets[row] + rowOffsets[i + 1] - rowOffsets[i];
+                }
+            }
+            nCopiedValues = copyRowOffsets[nCopiedRows] - 1;
+            copyColIndices = (size_t *)daal::services::daal_malloc(nCopiedValues * sizeof(size_t));
+        }
+    }
+    algorithmFPType *copyX = (algorithmFPType *)daal::services::daal_malloc(nCopiedValues * sizeof(algorithmFPType));
+    algorithmFPType *foldLabels  = (algorithmFPType *)daal::services::daal_malloc(
+            (nConfigurations * nVectors + nCopiedRows) * sizeof(algorithmFPType));
+    algorithmFPType *predictions = foldLabels + nCopiedRows;
+
+    if (nRowsRead < nVectors || nLabelsRead < nVectors || nErrorRatesRead < nConfigurations)
+    {
+        this->_errors->add(services::ErrorIncorrectNumberOfObservations);
+    }
+    else if (!foldOffsets || !copyX || !foldLabels || (isCSR && (!copyRowOffsets || !copyColIndices)))
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+    }
+    else
+    {
+        for (size_t f = 0, row = 0; row < nCopiedRows; f = (f + 1 == nFolds ? 0 : f + 1))
+        {
+            for (size_t i = f; i < nVectors; i += nFolds, row++)
+            {
+                foldLabels[row] = y[i];
+                const size_t start  = (isCSR ? rowOffsets[i] - 1 : i * nFeatures);
+                const size_t nCopy  = (isCSR ? rowOffsets[i + 1] - rowOffsets[i] : nFeatures);
+                const size_t offset = (isCSR ? copyRowOffsets[row] - 1 : row * nFeatures);
+                for (size_t k = 0; k < nCopy; k++)
+                {
+                    copyX[offset + k] = x[start + k];
+                }
+                if (isCSR)
+                {
+                    for (size_t k = 0; k < nCopy; k++)
+                    {
+                        copyColIndices[offset + k] = colIndices[start + k];
+                    }
+                }
+            }
+        }
+
+        daal::threader_flag allocationFailed;
+        daal::threader_for(nFolds, nFolds, [ =, &allocationFailed ](int f)
+        {
+            if (!this->prepareFold(f, foldOffsets, nVectors, nFeatures, isCSR, copyX, copyColIndices, copyRowOffsets, foldLabels, folds + f))
+            {
+                allocationFailed.set();
+            }
+        } );
+
+        if (allocationFailed.isSet()) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+    }
+
+    if (this->_errors->isEmpty())
+    {
+        const size_t nTasks = nConfigurations * nFolds;
+        services::Collection<services::SharedPtr<services::ErrorCollection> > taskErrors(nTasks);
+
+        /* Every task trains the model of one configuration on one fold and evaluates it on the validation part */
+        daal::threader_for(nTasks, nTasks, [ =, &taskErrors ](int iTask)
+        {
+            const size_t iConfiguration = iTask / nFolds;
+            const size_t iFold = iTask % nFolds;
+            const ModelSelectionFold<algorithmFPType, cpu> &fold = folds[iFold];
+            algorithmFPType *foldPredictions = predictions + iConfiguration * nVectors + foldOffsets[iFold];
+
+            services::SharedPtr<classifier::training::Batch> training = parameter->training[iConfiguration]->clone();
+            training->input.set(classifier::training::data,    fold.trainData);
+            training->input.set(classifier::training::labels,  fold.trainLabels);
+            training->input.set(classifier::training::weights, services::SharedPtr<NumericTable>());
+            training->resetResult();
+
+            int oldNumberOfThreads = fpk_serv_set_num_threads_local(1);
+            training->compute();
+            fpk_serv_set_num_threads_local(oldNumberOfThreads);
+            if (training->getErrors()->size() != 0) { taskErrors[iTask] = training->getErrors(); return; }
+
+            services::SharedPtr<classifier::prediction::Batch> prediction =
+                parameter->prediction[nPredictions == 1 ? 0 : iConfiguration]->clone();
+            prediction->input.set(classifier::prediction::data,  fold.validationData);
+            prediction->input.set(classifier::prediction::model, training->getResult()->get(classifier::training::model));
+
+            services::SharedPtr<classifier::prediction::Result> predictionResult(new classifier::prediction::Result());
+            predictionResult->set(classifier::prediction::prediction, services::SharedPtr<NumericTable>(
+                    new HomogenNumericTableCPU<algorithmFPType, cpu>(foldPredictions, 1, fold.nValidation)));
+            prediction->setResult(predictionResult);
+
+            oldNumberOfThreads = fpk_serv_set_num_threads_local(1);
+            prediction->compute();
+            fpk_serv_set_num_threads_local(oldNumberOfThreads);
+            if (prediction->getErrors()->size() != 0) { taskErrors[iTask] = prediction->getErrors(); return; }
+
+            /* Two-class classifiers predict the sign of the label, multi-class classifiers predict the label */
+            const algorithmFPType *validationLabels = foldLabels + foldOffsets[iFold];
+            size_t nErrors = 0;
+            for (size_t i = 0; i < fold.nValidation; i++)
+            {
+                if (nClasses == 2) { nErrors += ((foldPredictions[i] > zero) != (validationLabels[i] > zero)); }
+                else               { nErrors += ((size_t)foldPredictions[i] != (size_t)validationLabels[i]); }
+            }
+            errorRates[iConfiguration * nFolds + iFold] = (algorithmFPType)nErrors / (algorithmFPType)fold.nValidation;
+        } );
+
+        for (size_t iTask = 0; iTask < nTasks; iTask++)
+        {
+            if (taskErrors[iTask]) { this->_errors->add(taskErrors[iTask]->getErrors()); break; }
+        }
+
+        for (size_t iConfiguration = 0; iConfiguration < nConfigurations && this->_errors->isEmpty(); iConfiguration++)
+        {
+            (*qualityMetricsCollection)[iConfiguration] =
+                computeQualityMetrics(nClasses, nVectors, predictions + iConfiguration * nVectors, foldLabels);
+        }
+    }
+
+    delete[] folds;
+    if (foldLabels)     { daal::services::daal_free(foldLabels); }
+    if (copyX)          { daal::services::daal_free(copyX); }
+    if (copyColIndices) { daal::services::daal_free(copyColIndices); }
+    if (copyRowOffsets) { daal::services::daal_free(copyRowOffsets); }
+    if (foldOffsets)    { daal::services::daal_free(foldOffsets); }
+
+    mtErrorRates.release();
+    mtY.release();
+    if (isCSR) { mtXCSR.release(); }
+    else       { mtX.release(); }
+}
+
+/*
+ *  The validation part of the fold starts at row foldOffsets[fold] of the permuted copy,
+ *  and the training part follows it. Only the row offsets of CSR data are rebased for every fold
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+bool ModelSelectionKernel<method, algorithmFPType, cpu>::prepareFold(size_t fold, const size_t *foldOffsets, size_t nVectors, size_t nFeatures,
+            bool isCSR, algorithmFPType *x, size_t *colIndices, const size_t *rowOffsets, algorithmFPType *y,
+            ModelSelectionFold<algorithmFPType, cpu> *foldData)
+{
+    const size_t validationStart = foldOffsets[fold];
+    const size_t trainStart = foldOffsets[fold + 1];
+    const size_t nValidation = trainStart - validationStart;
+    const size_t nTrain = nVectors - nValidation;
+    foldData->nTrain = nTrain;
+    foldData->nValidation = nValidation;
+
+    foldData->trainLabels = services::SharedPtr<NumericTable>(
+            new HomogenNumericTableCPU<algorithmFPType, cpu>(y + trainStart, 1, nTrain));
+
+    if (isCSR)
+    {
+        foldData->rowOffsets = (size_t *)daal::services::daal_malloc((nVectors + 2) * sizeof(size_t));
+        if (!foldData->rowOffsets) { return false; }
+
+        size_t *trainRowOffsets = foldData->rowOffsets;
+        size_t *validationRowOffsets = foldData->rowOffsets + nTrain + 1;
+        for (size_t i = 0; i <= nTrain; i++)
+        {
+            trainRowOffsets[i] = rowOffsets[trainStart + i] - rowOffsets[trainStart] + 1;
+        }
+        for (size_t i = 0; i <= nValidation; i++)
+        {
+            validationRowOffsets[i] = rowOffsets[validationStart + i] - rowOffsets[validationStart] + 1;
+        }
+
+        const size_t trainOffset = rowOffsets[trainStart] - 1;
+        const size_t validationOffset = rowOffsets[validationStart] - 1;
+        foldData->trainData = services::SharedPtr<NumericTable>(
+                new CSRNumericTable(x + trainOffset, colIndices + trainOffset, trainRowOffsets, nFeatures, nTrain));
+        foldData->validationData = services::SharedPtr<NumericTable>(
+                new CSRNumericTable(x + validationOffset, colIndices + validationOffset, validationRowOffsets, nFeatures, nValidation));
+    }
+    else
+    {
+        foldData->trainData = services::SharedPtr<NumericTable>(
+                new HomogenNumericTableCPU<algorithmFPType, cpu>(x + trainStart * nFeatures, nFeatures, nTrain));
+        foldData->validationData = services::SharedPtr<NumericTable>(
+                new HomogenNumericTableCPU<algorithmFPType, cpu>(x + validationStart * nFeatures, nFeatures, nValidation));
+    }
+    return true;
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+services::SharedPtr<SerializationIface> ModelSelectionKernel<method, algorithmFPType, cpu>::computeQualityMetrics(
+            size_t nClasses, size_t nVectors, algorithmFPType *predictions, algorithmFPType *labels)
+{
+    services::SharedPtr<NumericTable> predictionsTable(new HomogenNumericTableCPU<algorithmFPType, cpu>(predictions, 1, nVectors));
+    services::SharedPtr<NumericTable> labelsTable(new HomogenNumericTableCPU<algorithmFPType, cpu>(labels, 1, nVectors));
+
+    if (nClasses == 2)
+    {
+        quality_metric::binary_confusion_matrix::Batch<algorithmFPType> qualityMetric;
+        qualityMetric.input.set(quality_metric::binary_confusion_matrix::predictedLabels,   predictionsTable);
+        qualityMetric.input.set(quality_metric::binary_confusion_matrix::groundTruthLabels, labelsTable);
+        qualityMetric.compute();
+        if (qualityMetric.getErrors()->size() != 0)
+        {
+            this->_errors->add(qualityMetric.getErrors()->getErrors());
+            return services::SharedPtr<SerializationIface>();
+        }
+        return services::staticPointerCast<SerializationIface, quality_metric::binary_confusion_matrix::Result>(
+                   qualityMetric.getResult());
+    }
+
+    quality_metric::multiclass_confusion_matrix::Batch<algorithmFPType> qualityMetric(nClasses);
+    qualityMetric.input.set(quality_metric::multiclass_confusion_matrix::predictedLabels,   predictionsTable);
+    qualityMetric.input.set(quality_metric::multiclass_confusion_matrix::groundTruthLabels, labelsTable);
+    qualityMetric.compute();
+    if (qualityMetric.getErrors()->size() != 0)
+    {
+        this->_errors->add(qualityMetric.getErrors()->getErrors());
+        return services::SharedPtr<SerializationIface>();
+    }
+    return services::staticPointerCast<SerializationIface, quality_metric::multiclass_confusion_matrix::Result>(
+               qualityMetric.getResult());
+}
+
+}
+}
+}
+}
+}
+
+#endif
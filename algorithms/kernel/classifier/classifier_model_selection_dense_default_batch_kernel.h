@@ -0,0 +1,91 @@
+/* file: classifier_model_selection_dense_default_batch_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template class that selects the parameters of a classifier with cross-validation.
+//--
+*/
+
+#ifndef __CLASSIFIER_MODEL_SELECTION_DENSE_DEFAULT_BATCH_KERNEL_H__
+#define __CLASSIFIER_MODEL_SELECTION_DENSE_DEFAULT_BATCH_KERNEL_H__
+
+#include "classifier_model_selection_types.h"
+#include "kernel.h"
+#include "numeric_table.h"
+#include "data_collection.h"
+
+using namespace daal::data_management;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace model_selection
+{
+namespace internal
+{
+
+/**
+ * Training and validation data of one fold of the cross-validation.
+ * The tables are views of the permuted copy of the input data shared by all the folds
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct ModelSelectionFold
+{
+    ModelSelectionFold() : rowOffsets(0), nTrain(0), nValidation(0) {}
+
+    ~ModelSelectionFold()
+    {
+        if (rowOffsets) { daal::services::daal_free(rowOffsets); }
+    }
+
+    size_t *rowOffsets;             /* One-based row offsets of the training part followed by the validation part for CSR input */
+    size_t nTrain;
+    size_t nValidation;
+    services::SharedPtr<NumericTable> trainData;
+    services::SharedPtr<NumericTable> trainLabels;
+    services::SharedPtr<NumericTable> validationData;
+};
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+class ModelSelectionKernel : public Kernel
+{
+public:
+    virtual ~ModelSelectionKernel() {}
+
+    void compute(const NumericTable *dataTable, const NumericTable *labelsTable,
+                 DataCollection *qualityMetricsCollection, NumericTable *errorRatesTable, const Parameter *parameter);
+
+protected:
+    bool prepareFold(size_t fold, const size_t *foldOffsets, size_t nVectors, size_t nFeatures, bool isCSR,
+                     algorithmFPType *x, size_t *colIndices, const size_t *rowOffsets, algorithmFPType *y,
+                     ModelSelectionFold<algorithmFPType, cpu> *foldData);
+
+    services::SharedPtr<SerializationIface> computeQualityMetrics(size_t nClasses, size_t nVectors,
+                                                                  algorithmFPType *predictions, algorithmFPType *labels);
+};
+
+}
+}
+}
+}
+}
+
+#endif
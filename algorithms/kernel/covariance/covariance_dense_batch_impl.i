@@ -43,6 +43,12 @@ void CovarianceDenseBatchKernel<algorithmFPType, method, cpu>::compute(
             SharedPtr<NumericTable> &dataTable, SharedPtr<NumericTable> &covTable,
             SharedPtr<NumericTable> &meanTable, const Parameter *parameter)
 {
+    if (isPackedSymmetric<cpu>(covTable->getDataLayout()) && method != singlePassDense)
+    {
+        computePackedCovariance<algorithmFPType, method, cpu>(dataTable, covTable, meanTable, parameter, this->_errors);
+        return;
+    }
+
     algorithmFPType nObservationsValue = 0.0;
     SharedPtr<NumericTable> nObservationsTable(
         new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(&nObservationsValue, 1, 1));
@@ -31,6 +31,7 @@
 #include "service_blas.h"
 #include "service_spblas.h"
 #include "service_stat.h"
+#include "service_micro_table.h"
 #include "threading.h"
 
 using namespace daal::internal;
@@ -44,6 +45,25 @@ namespace covariance
 namespace internal
 {
 
+const size_t covPackedRowsBlockSize     = 128;  /* Number of observations centered at once in the packed computation */
+const size_t covPackedFeaturesBlockSize = 256;  /* Number of rows of the cross-product computed by one matrix multiplication */
+
+template<CpuType cpu>
+bool isPackedSymmetric(NumericTableIface::StorageLayout layout)
+{
+    return (layout == NumericTableIface::lowerPackedSymmetricMatrix ||
+            layout == NumericTableIface::upperPackedSymmetricMatrix);
+}
+
+/* Returns the position of the element (i, j), j <= i, of a symmetric matrix stored with the given layout */
+template<CpuType cpu>
+size_t symmetricIndex(NumericTableIface::StorageLayout layout, size_t nFeatures, size_t i, size_t j)
+{
+    if (layout == NumericTableIface::lowerPackedSymmetricMatrix) { return i * (i + 1) / 2 + j; }
+    if (layout == NumericTableIface::upperPackedSymmetricMatrix) { return j * nFeatures - j * (j - 1) / 2 + (i - j); }
+    return i * nFeatures + j;
+}
+
 template<typename algorithmFPType, CpuType cpu>
 void getTableData(ReadWriteMode rwMode, SharedPtr<NumericTable> &numericTable,
             BlockDescriptor<algorithmFPType> &bd, algorithmFPType **dataArray)
@@ -359,6 +379,58 @@ void finalizeCovariance(size_t nFeatures, algorithmFPType nObservations,
     }
 }
 
+/*
+ *  Computes the correlation or variance-covariance matrix from the lower triangle of the cross-product
+ *  stored with the layout crossProductLayout into the lower triangle of the matrix stored with the layout covLayout.
+ *  The cross-product and the result may share the memory if the layouts are the same
+ */
+template<typename algorithmFPType, CpuType cpu>
+void finalizePackedCovariance(size_t nFeatures, algorithmFPType nObservations,
+            NumericTableIface::StorageLayout crossProductLayout, const algorithmFPType *crossProduct, const algorithmFPType *sums,
+            NumericTableIface::StorageLayout covLayout, algorithmFPType *cov, algorithmFPType *mean,
+            const Parameter *parameter, services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    algorithmFPType invNObservations = 1.0 / nObservations;
+    algorithmFPType invNObservationsM1 = 1.0;
+    if (nObservations > 1.0)
+    {
+        invNObservationsM1 = 1.0 / (nObservations - 1.0);
+    }
+
+    for (size_t i = 0; i < nFeatures; i++)
+    {
+        mean[i] = sums[i] * invNObservations;
+    }
+
+    const bool isCorrelation = (parameter->outputMatrixType == correlationMatrix);
+    algorithmFPType *diagInvSqrts = NULL;
+    if (isCorrelation)
+    {
+        diagInvSqrts = (algorithmFPType *)daal::services::daal_malloc(nFeatures * sizeof(algorithmFPType));
+        if (!diagInvSqrts) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            diagInvSqrts[i] = 1.0 / sSqrt<cpu>(crossProduct[symmetricIndex<cpu>(crossProductLayout, nFeatures, i, i)]);
+        }
+    }
+
+    daal::threader_for(nFeatures, nFeatures, [ = ](size_t i)
+    {
+        for (size_t j = 0; j < i; j++)
+        {
+            algorithmFPType value = crossProduct[symmetricIndex<cpu>(crossProductLayout, nFeatures, i, j)];
+            value *= (isCorrelation ? diagInvSqrts[i] * diagInvSqrts[j] : invNObservationsM1);
+            cov[symmetricIndex<cpu>(covLayout, nFeatures, i, j)] = value;
+        }
+        size_t iDiag = symmetricIndex<cpu>(covLayout, nFeatures, i, i);
+        cov[iDiag] = (isCorrelation ? (algorithmFPType)1.0 :
+                      crossProduct[symmetricIndex<cpu>(crossProductLayout, nFeatures, i, i)] * invNObservationsM1);
+    } );
+
+    if (diagInvSqrts) { daal::services::daal_free(diagInvSqrts); }
+}
+
 template<typename algorithmFPType, CpuType cpu>
 void finalizeCovariance(SharedPtr<NumericTable> &covTable, SharedPtr<NumericTable> &meanTable,
         SharedPtr<NumericTable> &nObservationsTable, const Parameter *parameter,
@@ -395,18 +467,174 @@ void finalizeCovariance(SharedPtr<NumericTable> &crossProductTable,
 
     BlockDescriptor<algorithmFPType> covBD, meanBD;
     algorithmFPType *cov, *mean;
-    getTableData<algorithmFPType, cpu>(writeOnly, covTable, covBD, &cov);
     getTableData<algorithmFPType, cpu>(writeOnly, meanTable, meanBD, &mean);
 
-    finalizeCovariance<algorithmFPType, cpu>(nFeatures, *nObservations, crossProduct, sums, cov, mean, parameter, _errors);
+    if (isPackedSymmetric<cpu>(covTable->getDataLayout()))
+    {
+        /* Write the result directly into the packed storage */
+        PackedArrayMicroTable<algorithmFPType, writeOnly, cpu> mtCov(covTable.get());
+        mtCov.getPackedArray(&cov);
+        finalizePackedCovariance<algorithmFPType, cpu>(nFeatures, *nObservations, NumericTableIface::aos, crossProduct, sums,
+            covTable->getDataLayout(), cov, mean, parameter, _errors);
+        mtCov.release();
+    }
+    else
+    {
+        getTableData<algorithmFPType, cpu>(writeOnly, covTable, covBD, &cov);
+        finalizeCovariance<algorithmFPType, cpu>(nFeatures, *nObservations, crossProduct, sums, cov, mean, parameter, _errors);
+        covTable->releaseBlockOfRows(covBD);
+    }
 
     releaseDenseCrossProductAndSums<algorithmFPType, cpu>(crossProductTable, crossProductBD, sumTable, sumBD,
         nObservationsTable, nObservationsBD);
 
-    covTable->releaseBlockOfRows(covBD);
     meanTable->releaseBlockOfRows(meanBD);
 }
 
+/*
+ *  Computes the correlation or variance-covariance matrix of dense data directly in the packed storage
+ *  of the result, without a full nFeatures x nFeatures buffer. The data is read twice by blocks of rows:
+ *  first to compute the sums, then to center every block and accumulate its cross-product, computed by
+ *  panels of rows, into the result
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+void computePackedCovariance(SharedPtr<NumericTable> &dataTable, SharedPtr<NumericTable> &covTable,
+            SharedPtr<NumericTable> &meanTable, const Parameter *parameter,
+            services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    const bool isNormalized = dataTable->isNormalized(NumericTableIface::standardScoreNormalized);
+    const NumericTableIface::StorageLayout covLayout = covTable->getDataLayout();
+
+    const size_t nRowsInBlock = (nVectors < covPackedRowsBlockSize ? nVectors : covPackedRowsBlockSize);
+    algorithmFPType *buffer = (algorithmFPType *)daal::services::daal_malloc(
+        (nFeatures + nRowsInBlock * nFeatures + covPackedFeaturesBlockSize * nFeatures) * sizeof(algorithmFPType));
+    if (!buffer) { _errors->add(services::ErrorMemoryAllocationFailed); return; }
+    algorithmFPType *sums     = buffer;
+    algorithmFPType *centered = sums + nFeatures;
+    algorithmFPType *panel    = centered + nRowsInBlock * nFeatures;
+
+    /* The data is read by blocks of rows, so the tables that are not stored as contiguous rows
+       are copied by the blocks only */
+    BlockDescriptor<algorithmFPType> dataBD;
+
+    /* Sums of the features: precomputed by the user, or zero for the normalized data */
+    const algorithmFPType zero = 0.0;
+    daal::services::internal::service_memset<algorithmFPType, cpu>(sums, zero, nFeatures);
+    if (method == sumDense)
+    {
+        services::SharedPtr<NumericTable> userSumsTable = dataTable->basicStatistics.get(NumericTable::sum);
+        if (!userSumsTable)
+        {
+            _errors->add(services::ErrorPrecomputedSumNotAvailable);
+            daal::services::daal_free(buffer);
+            return;
+        }
+        BlockDescriptor<algorithmFPType> userSumsBD;
+        userSumsTable->getBlockOfRows(0, 1, readOnly, userSumsBD);
+        daal_memcpy_s(sums, nFeatures * sizeof(algorithmFPType), userSumsBD.getBlockPtr(), nFeatures * sizeof(algorithmFPType));
+        userSumsTable->releaseBlockOfRows(userSumsBD);
+    }
+    else if (!isNormalized)
+    {
+        for (size_t startRow = 0; startRow < nVectors; startRow += nRowsInBlock)
+        {
+            size_t nRows = (startRow + nRowsInBlock > nVectors) ? nVectors - startRow : nRowsInBlock;
+            dataTable->getBlockOfRows(startRow, nRows, readOnly, dataBD);
+            const algorithmFPType *dataBlock = dataBD.getBlockPtr();
+            for (size_t k = 0; k < nRows; k++)
+            {
+              PRAGMA_IVDEP
+              PRAGMA_VECTOR_ALWAYS
+                for (size_t j = 0; j < nFeatures; j++)
+                {
+                    sums[j] += dataBlock[k * nFeatures + j];
+                }
+            }
+            dataTable->releaseBlockOfRows(dataBD);
+        }
+    }
+
+    const algorithmFPType invNObservations = (nVectors ? 1.0 / (algorithmFPType)nVectors : 0.0);
+
+    PackedArrayMicroTable<algorithmFPType, writeOnly, cpu> mtCov(covTable.get());
+    algorithmFPType *cov;
+    mtCov.getPackedArray(&cov);
+    daal::services::internal::service_memset<algorithmFPType, cpu>(cov, zero, nFeatures * (nFeatures + 1) / 2);
+
+    char transa = 'N';
+    char transb = 'T';
+    algorithmFPType one = 1.0;
+    algorithmFPType beta = 0.0;
+    MKL_INT ldx = (MKL_INT)nFeatures;
+
+    for (size_t startRow = 0; startRow < nVectors; startRow += nRowsInBlock)
+    {
+        size_t nRows = (startRow + nRowsInBlock > nVectors) ? nVectors - startRow : nRowsInBlock;
+        dataTable->getBlockOfRows(startRow, nRows, readOnly, dataBD);
+        const algorithmFPType *dataBlock = dataBD.getBlockPtr();
+        daal::threader_for(nRows, nRows, [ = ](size_t k)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                centered[k * nFeatures + j] = dataBlock[k * nFeatures + j] - sums[j] * invNObservations;
+            }
+        } );
+        dataTable->releaseBlockOfRows(dataBD);
+
+        for (size_t startFeature = 0; startFeature < nFeatures; startFeature += covPackedFeaturesBlockSize)
+        {
+            size_t nPanelRows = (startFeature + covPackedFeaturesBlockSize > nFeatures) ?
+                                nFeatures - startFeature : covPackedFeaturesBlockSize;
+            size_t nPanelCols = startFeature + nPanelRows;
+
+            /* panel[r * nPanelCols + j] = sum over the block of centered[startFeature + r] * centered[j] */
+            MKL_INT m = (MKL_INT)nPanelCols;
+            MKL_INT n = (MKL_INT)nPanelRows;
+            MKL_INT k = (MKL_INT)nRows;
+            Blas<algorithmFPType, cpu>::xgemm(&transa, &transb, &m, &n, &k, &one, centered, &ldx,
+                                              centered + startFeature, &ldx, &beta, panel, &m);
+
+            daal::threader_for(nPanelRows, nPanelRows, [ = ](size_t r)
+            {
+                size_t i = startFeature + r;
+                const algorithmFPType *panelRow = panel + r * nPanelCols;
+                if (covLayout == NumericTableIface::lowerPackedSymmetricMatrix)
+                {
+                    algorithmFPType *covRow = cov + i * (i + 1) / 2;
+                  PRAGMA_IVDEP
+                  PRAGMA_VECTOR_ALWAYS
+                    for (size_t j = 0; j <= i; j++)
+                    {
+                        covRow[j] += panelRow[j];
+                    }
+                }
+                else
+                {
+                    for (size_t j = 0; j <= i; j++)
+                    {
+                        cov[symmetricIndex<cpu>(covLayout, nFeatures, i, j)] += panelRow[j];
+                    }
+                }
+            } );
+        }
+    }
+
+    BlockDescriptor<algorithmFPType> meanBD;
+    algorithmFPType *mean;
+    getTableData<algorithmFPType, cpu>(writeOnly, meanTable, meanBD, &mean);
+
+    finalizePackedCovariance<algorithmFPType, cpu>(nFeatures, (algorithmFPType)nVectors, covLayout, cov, sums,
+        covLayout, cov, mean, parameter, _errors);
+
+    meanTable->releaseBlockOfRows(meanBD);
+    mtCov.release();
+    daal::services::daal_free(buffer);
+}
+
 } // namespace internal
 } // namespace covariance
 } // namespace algorithms
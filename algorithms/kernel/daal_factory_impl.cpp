@@ -43,6 +43,7 @@
 #include "classifier_predict_types.h"
 #include "binary_confusion_matrix_types.h"
 #include "multiclass_confusion_matrix_types.h"
+#include "classifier_model_selection_types.h"
 
 #include "cholesky_types.h"
 
@@ -253,6 +254,7 @@ Factory::Factory()
     registerObject(new Creator<algorithms::classifier::quality_metric::multiclass_confusion_matrix::Result>());
     registerObject(new Creator<algorithms::classifier::prediction::Result>());
     registerObject(new Creator<algorithms::classifier::training::Result>());
+    registerObject(new Creator<algorithms::classifier::model_selection::Result>());
 
     registerObject(new Creator<algorithms::correlation_distance::Result>());
     registerObject(new Creator<algorithms::cosine_distance::Result>());
@@ -315,6 +317,7 @@ Factory::Factory()
     registerObject(new Creator<algorithms::qr::DistributedPartialResult>());
     registerObject(new Creator<algorithms::qr::DistributedPartialResultStep3>());
 
+    registerObject(new Creator<algorithms::quantiles::PartialResult>());
     registerObject(new Creator<algorithms::quantiles::Result>());
 
     registerObject(new Creator<algorithms::math::relu::Result>());
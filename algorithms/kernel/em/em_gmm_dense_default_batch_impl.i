@@ -127,7 +127,7 @@ void EMKernel<algorithmFPType, method, cpu>::compute(const size_t na, const Nume
 
         logLikelyhood = 0;
 
-        daal::threader_for( nBlocks, nBlocks, [ =, &threadBuffer, &threadLocalError ](size_t iBlock)
+        daal::threader_for_numa( nBlocks, nBlocks, [ =, &threadBuffer, &threadLocalError ](size_t iBlock)
         {
             Error *localError = threadLocalError.local();
             size_t jn = blockSizeDeafult;
@@ -472,10 +472,15 @@ void ErrorMessageCollection::parseResourceFile()
                   "Input correlation matrix is not supported in online and distributed computation modes")));
 
     // QR errors: -8000..-8199
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorQRInternal, "QR internal error")));
 
     // Stump errors: -8200..-8399
 
     // SVD errors: -8400..-8599
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorSvdIthParamIllegalValue,
+              "Incorrect parameter in the internal SVD computation")));
+    push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorSvdXBDSQRDidNotConverge,
+              "Internal SVD computation did not converge")));
 
     // SVM errors: -8600..-8799
     push_back(services::SharedPtr<Message<ErrorID> >(new Message<ErrorID>(ErrorSVMinnerKernel, "Error in kernel function")));
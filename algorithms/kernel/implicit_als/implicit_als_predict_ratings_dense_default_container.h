@@ -44,7 +44,14 @@ namespace ratings
 template <typename algorithmFPType, prediction::ratings::Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv) : PredictionContainerIface()
 {
-    __DAAL_INTIALIZE_KERNELS(internal::ImplicitALSPredictKernel, algorithmFPType);
+    if (method == topNItems)
+    {
+        __DAAL_INTIALIZE_KERNELS(internal::ImplicitALSPredictTopNKernel, algorithmFPType);
+    }
+    else
+    {
+        __DAAL_INTIALIZE_KERNELS(internal::ImplicitALSPredictKernel, algorithmFPType);
+    }
 }
 
 template <typename algorithmFPType, prediction::ratings::Method method, CpuType cpu>
@@ -68,6 +75,14 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
     daal::services::Environment::env &env = *_env;
 
     NumericTable *ratingsTable = static_cast<NumericTable *>(result->get(prediction).get());
+    if (method == topNItems)
+    {
+        NumericTable *ratedItemsTable   = static_cast<NumericTable *>(input->get(ratedItems).get());
+        NumericTable *itemsIndicesTable = static_cast<NumericTable *>(result->get(itemsIndices).get());
+        __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictTopNKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
+                           compute, usersFactorsTable, itemsFactorsTable, ratedItemsTable, ratingsTable, itemsIndicesTable, par);
+        return;
+    }
     __DAAL_CALL_KERNEL(env, internal::ImplicitALSPredictKernel, __DAAL_KERNEL_ARGUMENTS(algorithmFPType),
                        compute, usersFactorsTable, itemsFactorsTable, ratingsTable, par);
 }
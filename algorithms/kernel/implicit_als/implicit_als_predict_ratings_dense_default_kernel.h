@@ -64,6 +64,34 @@ protected:
                 size_t nRows2, algorithmFPType **factors2);
 };
 
+template <typename algorithmFPType, CpuType cpu>
+class ImplicitALSPredictTopNKernel : public ImplicitALSPredictKernel<algorithmFPType, cpu>
+{
+public:
+    ImplicitALSPredictTopNKernel() {}
+    virtual ~ImplicitALSPredictTopNKernel() {}
+
+    void compute(const NumericTable *usersFactorsTable, const NumericTable *itemsFactorsTable,
+                const NumericTable *ratedItemsTable, NumericTable *ratingsTable, NumericTable *itemsIndicesTable,
+                const Parameter *parameter);
+
+protected:
+    /* Item with its predicted rating; ordered by the rating */
+    struct RatedItem
+    {
+        algorithmFPType rating;
+        int index;
+
+        bool operator<(const RatedItem &other) const { return rating < other.rating; }
+    };
+
+    void computeBlockOfUsers(size_t nUsers, size_t nItems, size_t nFactors, size_t nTopItems,
+                const algorithmFPType *usersFactors, const algorithmFPType *itemsFactors,
+                const size_t *ratedColIndices, const size_t *ratedRowOffsets,
+                algorithmFPType *scores, RatedItem *heaps, size_t *ratedPos,
+                algorithmFPType *ratings, int *itemsIndices);
+};
+
 }
 }
 }
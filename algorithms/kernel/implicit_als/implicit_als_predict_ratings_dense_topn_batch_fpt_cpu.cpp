@@ -0,0 +1,50 @@
+/* file: implicit_als_predict_ratings_dense_topn_batch_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of top-N items method of implicit ALS prediction for AVX2.
+//--
+*/
+
+#include "implicit_als_predict_ratings_dense_default_kernel.h"
+#include "implicit_als_predict_ratings_dense_default_container.h"
+#include "implicit_als_predict_ratings_dense_topn_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace prediction
+{
+namespace ratings
+{
+namespace interface1
+{
+template class BatchContainer<DAAL_FPTYPE, topNItems, DAAL_CPU>;
+}
+namespace internal
+{
+template class ImplicitALSPredictTopNKernel<DAAL_FPTYPE, DAAL_CPU>;
+}
+}
+}
+}
+}
+}
@@ -0,0 +1,250 @@
+/* file: implicit_als_predict_ratings_dense_topn_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the top-N items method of impicit ALS prediction algorithm.
+//
+//  The matrix of ratings is never materialized: the users are split into blocks
+//  processed in parallel, and for every block the ratings are computed by tiles
+//  of items. Every tile is merged into the per-user heaps of the items with the
+//  highest ratings, so the memory used by a thread does not depend on the number
+//  of users and items.
+//--
+*/
+
+#ifndef __IMPLICIT_ALS_PREDICT_RATINGS_DENSE_TOPN_IMPL_I__
+#define __IMPLICIT_ALS_PREDICT_RATINGS_DENSE_TOPN_IMPL_I__
+
+#include "implicit_als_predict_ratings_dense_default_kernel.h"
+#include "implicit_als_predict_ratings_dense_default_impl.i"
+#include "service_micro_table.h"
+#include "service_memory.h"
+#include "service_sort.h"
+#include "service_blas.h"
+#include "service_data_utils.h"
+#include "threading.h"
+
+using namespace daal::data_management;
+using namespace daal::internal;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace implicit_als
+{
+namespace prediction
+{
+namespace ratings
+{
+namespace internal
+{
+
+const size_t topNUsersBlockSize = 64;     /* Number of users processed by a thread at once */
+const size_t topNItemsBlockSize = 512;    /* Number of items in a tile of the matrix of ratings */
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSPredictTopNKernel<algorithmFPType, cpu>::compute(
+            const NumericTable *usersFactorsTable, const NumericTable *itemsFactorsTable,
+            const NumericTable *ratedItemsTable, NumericTable *ratingsTable, NumericTable *itemsIndicesTable,
+            const Parameter *parameter)
+{
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtUsersFactors(usersFactorsTable);
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtItemsFactors(itemsFactorsTable);
+
+    size_t nUsers = mtUsersFactors.getFullNumberOfRows();
+    size_t nItems = mtItemsFactors.getFullNumberOfRows();
+    size_t nFactors = parameter->nFactors;
+
+    algorithmFPType *usersFactors, *itemsFactors;
+    this->getFactors(mtUsersFactors, nUsers, &usersFactors, mtItemsFactors, nItems, &itemsFactors);
+    if (!this->_errors->isEmpty()) { return; }
+
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtRatings(ratingsTable);
+    BlockMicroTable<int, writeOnly, cpu> mtItemsIndices(itemsIndicesTable);
+    size_t nTopItems = mtRatings.getFullNumberOfColumns();
+
+    algorithmFPType *ratings;
+    int *itemsIndices;
+    size_t nRatingsRows = mtRatings.getBlockOfRows(0, nUsers, &ratings);
+    size_t nIndicesRows = mtItemsIndices.getBlockOfRows(0, nUsers, &itemsIndices);
+
+    /* Known ratings of the users, optional */
+    CSRBlockMicroTable<algorithmFPType, readOnly, cpu> mtRatedItems(ratedItemsTable);
+    size_t *ratedColIndices = NULL, *ratedRowOffsets = NULL;
+    size_t nRatedRows = nUsers;
+    if (ratedItemsTable)
+    {
+        algorithmFPType *ratedValues;
+        nRatedRows = mtRatedItems.getSparseBlock(0, nUsers, &ratedValues, &ratedColIndices, &ratedRowOffsets);
+    }
+
+    if (nRatingsRows < nUsers || nIndicesRows < nUsers || nRatedRows < nUsers)
+    {
+        this->_errors->add(services::ErrorIncorrectNumberOfRowsInInputNumericTable);
+    }
+    else
+    {
+        daal::tls<algorithmFPType *> tlsScores( [ = ]()-> algorithmFPType *
+        {
+            return (algorithmFPType *)daal::services::daal_malloc(topNUsersBlockSize * topNItemsBlockSize * sizeof(algorithmFPType));
+        } );
+        daal::tls<RatedItem *> tlsHeaps( [ = ]()-> RatedItem *
+        {
+            return (RatedItem *)daal::services::daal_malloc(topNUsersBlockSize * nTopItems * sizeof(RatedItem));
+        } );
+
+        daal::threader_flag allocationFailed;
+        size_t nBlocks = nUsers / topNUsersBlockSize + !!(nUsers % topNUsersBlockSize);
+        daal::threader_for(nBlocks, nBlocks, [ =, &tlsScores, &tlsHeaps, &allocationFailed](int iBlock)
+        {
+            algorithmFPType *scores = tlsScores.local();
+            RatedItem *heaps = tlsHeaps.local();
+            if (!scores || !heaps) { allocationFailed.set(); return; }
+
+            size_t startUser = iBlock * topNUsersBlockSize;
+            size_t nUsersInBlock = (startUser + topNUsersBlockSize > nUsers) ? nUsers - startUser : topNUsersBlockSize;
+
+            size_t ratedPos[topNUsersBlockSize];
+            this->computeBlockOfUsers(nUsersInBlock, nItems, nFactors, nTopItems,
+                usersFactors + startUser * nFactors, itemsFactors,
+                ratedColIndices, (ratedRowOffsets ? ratedRowOffsets + startUser : NULL),
+                scores, heaps, ratedPos, ratings + startUser * nTopItems, itemsIndices + startUser * nTopItems);
+        } );
+
+        tlsScores.reduce( [ = ](algorithmFPType *scores)
+        {
+            if (scores) { daal::services::daal_free(scores); }
+        } );
+        tlsHeaps.reduce( [ = ](RatedItem *heaps)
+        {
+            if (heaps) { daal::services::daal_free(heaps); }
+        } );
+
+        if (allocationFailed.isSet()) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+    }
+
+    if (ratedItemsTable) { mtRatedItems.release(); }
+    mtItemsIndices.release();
+    mtRatings.release();
+    mtUsersFactors.release();
+    mtItemsFactors.release();
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSPredictTopNKernel<algorithmFPType, cpu>::computeBlockOfUsers(
+            size_t nUsers, size_t nItems, size_t nFactors, size_t nTopItems,
+            const algorithmFPType *usersFactors, const algorithmFPType *itemsFactors,
+            const size_t *ratedColIndices, const size_t *ratedRowOffsets,
+            algorithmFPType *scores, RatedItem *heaps, size_t *ratedPos,
+            algorithmFPType *ratings, int *itemsIndices)
+{
+    /* Rated items and empty places in the heaps get the lowest rating, so they never enter the heaps */
+    const algorithmFPType lowestRating = -daal::data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
+
+    RatedItem empty;
+    empty.rating = lowestRating;
+    empty.index  = -1;
+    for (size_t i = 0; i < nUsers * nTopItems; i++)
+    {
+        heaps[i] = empty;
+    }
+    if (ratedColIndices)
+    {
+        for (size_t u = 0; u < nUsers; u++)
+        {
+            ratedPos[u] = ratedRowOffsets[u] - 1;
+        }
+    }
+
+    /* GEMM parameters */
+    char trans   = 'T';
+    char notrans = 'N';
+    algorithmFPType one  = 1.0;
+    algorithmFPType zero = 0.0;
+    MKL_INT m = (MKL_INT)nUsers;
+    MKL_INT k = (MKL_INT)nFactors;
+
+    for (size_t startItem = 0; startItem < nItems; startItem += topNItemsBlockSize)
+    {
+        size_t nItemsInBlock = (startItem + topNItemsBlockSize > nItems) ? nItems - startItem : topNItemsBlockSize;
+        size_t endItem = startItem + nItemsInBlock;
+        MKL_INT n = (MKL_INT)nItemsInBlock;
+
+        /* scores[u * nItemsInBlock + i] = <usersFactors[u], itemsFactors[startItem + i]> */
+        Blas<algorithmFPType, cpu>::xxgemm(&trans, &notrans, &n, &m, &k, &one,
+                           const_cast<algorithmFPType *>(itemsFactors + startItem * nFactors), &k,
+                           const_cast<algorithmFPType *>(usersFactors), &k, &zero, scores, &n);
+
+        for (size_t u = 0; u < nUsers; u++)
+        {
+            algorithmFPType *userScores = scores + u * nItemsInBlock;
+
+            if (ratedColIndices)
+            {
+                size_t pos = ratedPos[u];
+                size_t endPos = ratedRowOffsets[u + 1] - 1;
+                for ( ; pos < endPos && ratedColIndices[pos] - 1 < endItem; pos++)
+                {
+                    size_t item = ratedColIndices[pos] - 1;
+                    if (item >= startItem) { userScores[item - startItem] = lowestRating; }
+                }
+                ratedPos[u] = pos;
+            }
+
+            RatedItem *heap = heaps + u * nTopItems;
+            for (size_t i = 0; i < nItemsInBlock; i++)
+            {
+                if (userScores[i] > heap[0].rating)
+                {
+                    RatedItem item;
+                    item.rating = userScores[i];
+                    item.index  = (int)(startItem + i);
+                    daal::algorithms::internal::heapSiftDown<RatedItem, true, cpu>(heap, nTopItems, item);
+                }
+            }
+        }
+    }
+
+    for (size_t u = 0; u < nUsers; u++)
+    {
+        /* Heap sort of the selected items in the descending order of the ratings */
+        RatedItem *heap = heaps + u * nTopItems;
+        for (size_t heapSize = nTopItems; heapSize > 1; heapSize--)
+        {
+            RatedItem item = heap[heapSize - 1];
+            heap[heapSize - 1] = heap[0];
+            daal::algorithms::internal::heapSiftDown<RatedItem, true, cpu>(heap, heapSize - 1, item);
+        }
+
+        for (size_t i = 0; i < nTopItems; i++)
+        {
+            itemsIndices[u * nTopItems + i] = heap[i].index;
+            ratings     [u * nTopItems + i] = (heap[i].index < 0 ? (algorithmFPType)0 : heap[i].rating);
+        }
+    }
+}
+
+}
+}
+}
+}
+}
+}
+
+#endif
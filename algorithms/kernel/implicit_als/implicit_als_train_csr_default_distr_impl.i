@@ -189,12 +189,17 @@ struct AlsTls
     daal::internal::BlockMicroTable<algorithmFPType, readOnly,  cpu> **mtSrcFactors;
     daal::internal::BlockMicroTable<algorithmFPType, writeOnly, cpu>  *mtDstFactors;
     algorithmFPType *lhs;
+    algorithmFPType *cgBuffer;      /* Buffer of the conjugate gradient solver */
     size_t nBlocks;
 
-    AlsTls(size_t nBlocks, size_t nFactors, data_management::KeyValueDataCollection *srcPartialModels,
-           implicit_als::PartialModel *dstPartialModel) : nBlocks(nBlocks)
+    AlsTls(size_t nBlocks, size_t nFactors, size_t cgBufferSize, data_management::KeyValueDataCollection *srcPartialModels,
+           implicit_als::PartialModel *dstPartialModel) : nBlocks(nBlocks), cgBuffer(NULL)
     {
         lhs = (algorithmFPType *)daal::services::daal_malloc(nFactors * nFactors * sizeof(algorithmFPType));
+        if (cgBufferSize)
+        {
+            cgBuffer = (algorithmFPType *)daal::services::daal_malloc(cgBufferSize * sizeof(algorithmFPType));
+        }
 
         mtDstFactors = new daal::internal::BlockMicroTable<algorithmFPType, writeOnly, cpu>(dstPartialModel->getFactors().get());
 
@@ -212,6 +217,7 @@ struct AlsTls
     ~AlsTls()
     {
         daal::services::daal_free(lhs);
+        if (cgBuffer) { daal::services::daal_free(cgBuffer); }
         delete mtDstFactors;
         for (size_t i = 0; i < nBlocks; i++)
         {
@@ -255,10 +261,6 @@ void ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
     algorithmFPType alpha  = (algorithmFPType)(parameter->alpha);
     algorithmFPType lambda = (algorithmFPType)(parameter->lambda);
 
-    daal::tls<AlsTls<algorithmFPType, cpu> *> alsTls([=]()
-    {
-        return new AlsTls<algorithmFPType, cpu>(nBlocks, nFactors, srcPartialModels, dstPartialModel);
-    });
 
     daal::internal::BlockMicroTable<algorithmFPType, readOnly,  cpu> mtXTX(cpTable);
     algorithmFPType *xtx;
@@ -275,6 +277,26 @@ void ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
     if (nRowsRead < nRows)
     { this->_errors->add(services::ErrorIncorrectNumberOfRowsInInputNumericTable); return; }
 
+    /* The conjugate gradient solver needs the factors and coefficients of the rated columns,
+       the right hand side and the work arrays */
+    bool useCG = (parameter->solver == conjugateGradientSolver);
+    size_t maxRated = 0;
+    if (useCG)
+    {
+        for (size_t i = 0; i < nRows; i++)
+        {
+            size_t nRated = rowOffsets[i + 1] - rowOffsets[i];
+            if (nRated > maxRated) { maxRated = nRated; }
+        }
+    }
+    size_t cgBufferSize = (useCG ? maxRated * nFactors + maxRated + 4 * nFactors : 0);
+
+    daal::tls<AlsTls<algorithmFPType, cpu> *> alsTls([=]()
+    {
+        return new AlsTls<algorithmFPType, cpu>(nBlocks, nFactors, cgBufferSize, srcPartialModels, dstPartialModel);
+    });
+
+    daal::threader_flag allocationFailed;
     daal::threader_for(nRows, nRows, [ & ](size_t i)
     {
         int oldNumberOfThreads = fpk_serv_set_num_threads_local(1);
@@ -290,6 +312,34 @@ void ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
             this->_errors->add(services::ErrorIncorrectNumberOfRowsInInputNumericTable); return;
         }
 
+        if (useCG)
+        {
+            /* Factors of the previous iteration are not available in this step,
+               so the conjugate gradient solver starts from zero */
+            algorithmFPType *cgBuffer = alsTlsLocal->cgBuffer;
+            if (!cgBuffer)
+            {
+                mtDstFactors->release();
+                fpk_serv_set_num_threads_local(oldNumberOfThreads);
+                allocationFailed.set(); return;
+            }
+            algorithmFPType *ratedFactors = cgBuffer;
+            algorithmFPType *coeffs = ratedFactors + maxRated * nFactors;
+            algorithmFPType *cgRhs  = coeffs + maxRated;
+            algorithmFPType *work   = cgRhs + nFactors;
+
+            algorithmFPType gamma;
+            size_t nRated = formSparseSystem(i, data, colIndices, rowOffsets, nFactors, nBlocks, nFactorsRows, indices,
+                    mtSrcFactors, alpha, lambda, ratedFactors, coeffs, cgRhs, &gamma);
+            if (!this->_errors->isEmpty()) { fpk_serv_set_num_threads_local(oldNumberOfThreads); return; }
+
+            service_memset<algorithmFPType, cpu>(rhs, 0.0, nFactors);
+            this->solveCG(nFactors, xtx, gamma, nRated, ratedFactors, coeffs, cgRhs, rhs, parameter->nCGIterations, work);
+            mtDstFactors->release();
+            fpk_serv_set_num_threads_local(oldNumberOfThreads);
+            return;
+        }
+
         service_memset<algorithmFPType, cpu>(rhs, 0.0, nFactors);
         daal::services::daal_memcpy_s(lhs, nFactors * nFactors * sizeof(algorithmFPType),
                                       xtx, nFactors * nFactors * sizeof(algorithmFPType));
@@ -309,6 +359,7 @@ void ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::compute(
     {
         delete alsTlsLocal;
     } );
+    if (allocationFailed.isSet()) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
 
     for (size_t i = 0; i < nBlocks;  i++)
     {
@@ -341,31 +392,9 @@ void ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::formSystem
         algorithmFPType c = c1 + 1.0;
         int colIndex = (int)colIndices[j] - 1;
 
-        int blockIndex = -1;
-        /* find block that contains needed index */
-        for (size_t block = 0; block < nBlocks; block++)
-        {
-            if (indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
-            {
-                blockIndex = block;
-                break;
-            }
-        }
-        if (blockIndex == -1) { this->_errors->add(services::ErrorALSInconsistentSparseDataBlocks); return; }
-
-        int *blockIndices = indices[blockIndex];
-        /* find index in the block using binary search */
-        size_t hiIndex = nColFactorsRows[blockIndex] - 1;
-        size_t loIndex = 0;
-        size_t meIndex = ((loIndex + hiIndex) >> 1);
-        while (colIndex != blockIndices[meIndex])
-        {
-            if (colIndex < blockIndices[meIndex]) { hiIndex = meIndex - 1; }
-            if (colIndex > blockIndices[meIndex]) { loIndex = meIndex + 1; }
-            meIndex = ((loIndex + hiIndex) >> 1);
-            if (loIndex >= hiIndex) { break; }
-        }
-        if (colIndex != blockIndices[meIndex]) { this->_errors->add(services::ErrorALSInconsistentSparseDataBlocks); return; }
+        size_t blockIndex, meIndex;
+        if (!findColFactorsRow(colIndex, nBlocks, nColFactorsRows, indices, &blockIndex, &meIndex))
+        { this->_errors->add(services::ErrorALSInconsistentSparseDataBlocks); return; }
 
         algorithmFPType *colFactorsRow;
         size_t nRowsRead = mtSrcFactors[blockIndex]->getBlockOfRows(meIndex, 1, &colFactorsRow);
@@ -384,6 +413,91 @@ void ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::formSystem
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+size_t ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::formSparseSystem(
+            size_t i, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+            size_t nFactors, size_t nBlocks, size_t *nColFactorsRows,
+            int **indices,
+            daal::internal::BlockMicroTable<algorithmFPType, readOnly, cpu> **mtSrcFactors,
+            algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *ratedFactors,
+            algorithmFPType *coeffs, algorithmFPType *rhs, algorithmFPType *gamma)
+{
+    size_t startIdx = rowOffsets[i]   - 1;
+    size_t endIdx   = rowOffsets[i + 1] - 1;
+
+    service_memset<algorithmFPType, cpu>(rhs, 0.0, nFactors);
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        algorithmFPType c1 = alpha * data[j];
+        algorithmFPType c = c1 + 1.0;
+        int colIndex = (int)colIndices[j] - 1;
+
+        size_t blockIndex, rowIndex;
+        if (!findColFactorsRow(colIndex, nBlocks, nColFactorsRows, indices, &blockIndex, &rowIndex))
+        { this->_errors->add(services::ErrorALSInconsistentSparseDataBlocks); return 0; }
+
+        algorithmFPType *colFactorsRow;
+        size_t nRowsRead = mtSrcFactors[blockIndex]->getBlockOfRows(rowIndex, 1, &colFactorsRow);
+        if (nRowsRead < 1)
+        { this->_errors->add(services::ErrorIncorrectNumberOfRowsInInputNumericTable); return 0; }
+
+        /* Copy the factors, so that the solver does not need to access the partial models */
+        algorithmFPType *ratedFactorsRow = ratedFactors + (j - startIdx) * nFactors;
+        coeffs[j - startIdx] = c1;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            ratedFactorsRow[k] = colFactorsRow[k];
+        }
+        if (c1 > 0.0)
+        {
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                rhs[k] += c * colFactorsRow[k];
+            }
+        }
+        mtSrcFactors[blockIndex]->release();
+    }
+
+    *gamma = lambda * (endIdx - startIdx);
+    return endIdx - startIdx;
+}
+
+template <typename algorithmFPType, CpuType cpu>
+bool ImplicitALSTrainDistrStep4Kernel<algorithmFPType, fastCSR, cpu>::findColFactorsRow(
+            int colIndex, size_t nBlocks, size_t *nColFactorsRows, int **indices,
+            size_t *blockIndexPtr, size_t *rowIndexPtr)
+{
+    int blockIndex = -1;
+    /* find block that contains needed index */
+    for (size_t block = 0; block < nBlocks; block++)
+    {
+        if (indices[block][0] <= colIndex && colIndex <= indices[block][nColFactorsRows[block] - 1])
+        {
+            blockIndex = block;
+            break;
+        }
+    }
+    if (blockIndex == -1) { return false; }
+
+    int *blockIndices = indices[blockIndex];
+    /* find index in the block using binary search */
+    size_t hiIndex = nColFactorsRows[blockIndex] - 1;
+    size_t loIndex = 0;
+    size_t meIndex = ((loIndex + hiIndex) >> 1);
+    while (colIndex != blockIndices[meIndex])
+    {
+        if (colIndex < blockIndices[meIndex]) { hiIndex = meIndex - 1; }
+        if (colIndex > blockIndices[meIndex]) { loIndex = meIndex + 1; }
+        meIndex = ((loIndex + hiIndex) >> 1);
+        if (loIndex >= hiIndex) { break; }
+    }
+    if (colIndex != blockIndices[meIndex]) { return false; }
+
+    *blockIndexPtr = (size_t)blockIndex;
+    *rowIndexPtr   = meIndex;
+    return true;
+}
+
 }
 }
 }
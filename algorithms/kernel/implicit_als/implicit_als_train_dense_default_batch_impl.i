@@ -27,6 +27,7 @@
 #include "threading.h"
 #include "service_blas.h"
 #include "service_lapack.h"
+#include "service_defines.h"
 
 using namespace daal::internal;
 
@@ -112,6 +113,151 @@ void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactors(
     } );
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::computeFactorsCG(
+    size_t nRows, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+    algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, size_t nIterations)
+{
+    /* Maximal number of rated columns in a row */
+    size_t maxRated = nCols;
+    if (rowOffsets)
+    {
+        maxRated = 0;
+        for (size_t i = 0; i < nRows; i++)
+        {
+            size_t nRated = rowOffsets[i + 1] - rowOffsets[i];
+            if (nRated > maxRated) { maxRated = nRated; }
+        }
+    }
+
+    /* Factors and coefficients of the rated columns, right hand side and work arrays of the solver */
+    size_t bufferSize = maxRated * nFactors + maxRated + 4 * nFactors;
+    daal::tls<algorithmFPType *> buffers([ = ]() -> algorithmFPType *
+    {
+        return (algorithmFPType *)daal::services::daal_malloc(bufferSize * sizeof(algorithmFPType));
+    } );
+
+    daal::threader_flag allocationFailed;
+    daal::threader_for(nRows, nRows, [ & ](size_t i)
+    {
+        algorithmFPType *buffer = buffers.local();
+        if (!buffer) { allocationFailed.set(); return; }
+
+        algorithmFPType *ratedFactors = buffer;
+        algorithmFPType *coeffs = ratedFactors + maxRated * nFactors;
+        algorithmFPType *rhs    = coeffs + maxRated;
+        algorithmFPType *work   = rhs + nFactors;
+
+        algorithmFPType gamma;
+        size_t nRated = formSparseSystem(i, nCols, data, colIndices, rowOffsets, nFactors, colFactors, alpha, lambda,
+                                         ratedFactors, coeffs, rhs, &gamma);
+
+        /* The current factors of the row are the initial approximation of the solution */
+        solveCG(nFactors, xtx, gamma, nRated, ratedFactors, coeffs, rhs, rowFactors + i * nFactors, nIterations, work);
+    } );
+
+    buffers.reduce([](algorithmFPType *buffer)
+    {
+        if (buffer) { daal::services::daal_free(buffer); }
+    } );
+
+    if (allocationFailed.isSet()) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::applySystem(
+    size_t nFactors, const algorithmFPType *xtx, algorithmFPType gamma,
+    size_t nRated, const algorithmFPType *ratedFactors, const algorithmFPType *coeffs,
+    const algorithmFPType *v, algorithmFPType *av)
+{
+    /* av = (xtx + gamma * I) * v, only the upper triangle of xtx is computed by SYRK */
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        av[k] = gamma * v[k];
+    }
+    for (size_t c = 0; c < nFactors; c++)
+    {
+        const algorithmFPType *xtxCol = xtx + c * nFactors;
+        algorithmFPType sum = xtxCol[c] * v[c];
+        PRAGMA_IVDEP
+        for (size_t r = 0; r < c; r++)
+        {
+            sum   += xtxCol[r] * v[r];
+            av[r] += xtxCol[r] * v[c];
+        }
+        av[c] += sum;
+    }
+
+    /* av += sum(coeffs[j] * y_j * y_j' * v) over the rated columns */
+    for (size_t j = 0; j < nRated; j++)
+    {
+        const algorithmFPType *y = ratedFactors + j * nFactors;
+        algorithmFPType dotProduct = 0.0;
+        PRAGMA_IVDEP
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            dotProduct += y[k] * v[k];
+        }
+        dotProduct *= coeffs[j];
+        PRAGMA_IVDEP
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            av[k] += dotProduct * y[k];
+        }
+    }
+}
+
+template <typename algorithmFPType, CpuType cpu>
+void ImplicitALSTrainKernelBase<algorithmFPType, cpu>::solveCG(
+    size_t nFactors, const algorithmFPType *xtx, algorithmFPType gamma,
+    size_t nRated, const algorithmFPType *ratedFactors, const algorithmFPType *coeffs,
+    const algorithmFPType *rhs, algorithmFPType *x, size_t nIterations, algorithmFPType *work)
+{
+    algorithmFPType *r  = work;
+    algorithmFPType *p  = r + nFactors;
+    algorithmFPType *ap = p + nFactors;
+
+    /* r = p = rhs - A * x */
+    applySystem(nFactors, xtx, gamma, nRated, ratedFactors, coeffs, x, ap);
+    algorithmFPType rr = 0.0;
+    for (size_t k = 0; k < nFactors; k++)
+    {
+        r[k] = rhs[k] - ap[k];
+        p[k] = r[k];
+        rr += r[k] * r[k];
+    }
+
+    for (size_t iter = 0; iter < nIterations && rr > 0.0; iter++)
+    {
+        applySystem(nFactors, xtx, gamma, nRated, ratedFactors, coeffs, p, ap);
+        algorithmFPType pap = 0.0;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            pap += p[k] * ap[k];
+        }
+        if (!(pap > 0.0)) { break; }
+
+        algorithmFPType step = rr / pap;
+        algorithmFPType rrNew = 0.0;
+        PRAGMA_IVDEP
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            x[k] += step * p[k];
+            r[k] -= step * ap[k];
+            rrNew += r[k] * r[k];
+        }
+
+        algorithmFPType beta = rrNew / rr;
+        PRAGMA_IVDEP
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            p[k] = r[k] + beta * p[k];
+        }
+        rr = rrNew;
+    }
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::computeCostFunction(
     size_t nUsers, size_t nItems, size_t nFactors, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
@@ -228,6 +374,42 @@ void ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::formSystem(
 }
 
 
+template <typename algorithmFPType, CpuType cpu>
+size_t ImplicitALSTrainKernel<algorithmFPType, fastCSR, cpu>::formSparseSystem(
+    size_t i, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+    algorithmFPType *ratedFactors, algorithmFPType *coeffs, algorithmFPType *rhs, algorithmFPType *gamma)
+{
+    size_t startIdx = rowOffsets[i]   - 1;
+    size_t endIdx   = rowOffsets[i + 1] - 1;
+
+    service_memset<algorithmFPType, cpu>(rhs, 0.0, nFactors);
+    for (size_t j = startIdx; j < endIdx; j++)
+    {
+        algorithmFPType c1 = alpha * data[j];
+        algorithmFPType c = c1 + 1.0;
+        algorithmFPType *colFactorsRow = colFactors + (colIndices[j] - 1) * nFactors;
+        algorithmFPType *ratedFactorsRow = ratedFactors + (j - startIdx) * nFactors;
+
+        coeffs[j - startIdx] = c1;
+        for (size_t k = 0; k < nFactors; k++)
+        {
+            ratedFactorsRow[k] = colFactorsRow[k];
+        }
+        if (c1 > 0.0)
+        {
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                rhs[k] += c * colFactorsRow[k];
+            }
+        }
+    }
+
+    *gamma = lambda * (endIdx - startIdx);
+    return endIdx - startIdx;
+}
+
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSystem(
     size_t i, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
@@ -259,6 +441,45 @@ void ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSystem(
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+size_t ImplicitALSTrainKernel<algorithmFPType, defaultDense, cpu>::formSparseSystem(
+    size_t i, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+    size_t nFactors, algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+    algorithmFPType *ratedFactors, algorithmFPType *coeffs, algorithmFPType *rhs, algorithmFPType *gamma)
+{
+    size_t nRated = 0;
+    service_memset<algorithmFPType, cpu>(rhs, 0.0, nFactors);
+    for (size_t j = 0; j < nCols; j++)
+    {
+        algorithmFPType rating = data[i * nCols + j];
+        if (rating > 0.0)
+        {
+            algorithmFPType c1 = alpha * rating;
+            algorithmFPType c = c1 + 1.0;
+            algorithmFPType *colFactorsRow = colFactors + j * nFactors;
+            algorithmFPType *ratedFactorsRow = ratedFactors + nRated * nFactors;
+
+            coeffs[nRated] = c1;
+            for (size_t k = 0; k < nFactors; k++)
+            {
+                ratedFactorsRow[k] = colFactorsRow[k];
+            }
+            if (c1 > 0.0)
+            {
+                for (size_t k = 0; k < nFactors; k++)
+                {
+                    rhs[k] += c * colFactorsRow[k];
+                }
+            }
+            nRated++;
+        }
+    }
+
+    /* Same regularization as in formSystem */
+    *gamma = lambda * (algorithmFPType)(nRated + 1);
+    return nRated;
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(const NumericTable *dataTable,
                                                                          implicit_als::Model *initModel,
@@ -292,19 +513,42 @@ void ImplicitALSTrainBatchKernel<algorithmFPType, fastCSR, cpu>::compute(const N
     computeCostFunction(nUsers, nItems, nFactors, data, colIndices, rowOffsets, itemsFactors, usersFactors,
                         alpha, lambda, &costFunction);
 #endif
+    bool useCG = (parameter->solver == conjugateGradientSolver);
+    if (useCG)
+    {
+        /* Initial approximation of the users factors for the conjugate gradient solver */
+        service_memset<algorithmFPType, cpu>(usersFactors, 0.0, nUsers * nFactors);
+    }
+
     algorithmFPType beta = 0.0;
     for (size_t i = 0; i < maxIterations; i++)
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors,
-                             alpha, lambda, xtx, lhs);
+        if (useCG)
+        {
+            this->computeFactorsCG(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors,
+                                   alpha, lambda, xtx, parameter->nCGIterations);
+        }
+        else
+        {
+            this->computeFactors(nUsers, nItems, data, colIndices, rowOffsets, nFactors, itemsFactors, usersFactors,
+                                 alpha, lambda, xtx, lhs);
+        }
         if (!this->_errors->isEmpty()) { return; }
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors,
-                             alpha, lambda, xtx, lhs);
+        if (useCG)
+        {
+            this->computeFactorsCG(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors,
+                                   alpha, lambda, xtx, parameter->nCGIterations);
+        }
+        else
+        {
+            this->computeFactors(nItems, nUsers, tdata, rowIndices, colOffsets, nFactors, usersFactors, itemsFactors,
+                                 alpha, lambda, xtx, lhs);
+        }
         if (!this->_errors->isEmpty()) { return; }
 
 #if 0
@@ -344,19 +588,42 @@ void ImplicitALSTrainBatchKernel<algorithmFPType, defaultDense, cpu>::compute(co
                         alpha, lambda, &costFunction);
 #endif
 
+    bool useCG = (parameter->solver == conjugateGradientSolver);
+    if (useCG)
+    {
+        /* Initial approximation of the users factors for the conjugate gradient solver */
+        service_memset<algorithmFPType, cpu>(usersFactors, 0.0, nUsers * nFactors);
+    }
+
     algorithmFPType beta = 0.0;
     for (size_t i = 0; i < maxIterations; i++)
     {
         this->computeXtX(&nItems, &nFactors, &beta, itemsFactors, &nFactors, xtx, &nFactors);
 
-        this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors,
-                             alpha, lambda, xtx, lhs);
+        if (useCG)
+        {
+            this->computeFactorsCG(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors,
+                                   alpha, lambda, xtx, parameter->nCGIterations);
+        }
+        else
+        {
+            this->computeFactors(nUsers, nItems, data, NULL, NULL, nFactors, itemsFactors, usersFactors,
+                                 alpha, lambda, xtx, lhs);
+        }
         if (!this->_errors->isEmpty()) { return; }
 
         this->computeXtX(&nUsers, &nFactors, &beta, usersFactors, &nFactors, xtx, &nFactors);
 
-        this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors,
-                             alpha, lambda, xtx, lhs);
+        if (useCG)
+        {
+            this->computeFactorsCG(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors,
+                                   alpha, lambda, xtx, parameter->nCGIterations);
+        }
+        else
+        {
+            this->computeFactors(nItems, nUsers, tdata, NULL, NULL, nFactors, usersFactors, itemsFactors,
+                                 alpha, lambda, xtx, lhs);
+        }
         if (!this->_errors->isEmpty()) { return; }
 
 #if 0
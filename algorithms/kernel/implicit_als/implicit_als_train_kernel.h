@@ -81,10 +81,27 @@ protected:
                 size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
                 algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, daal::tls<algorithmFPType *> *lhs);
 
+    void computeFactorsCG(
+                size_t nRows, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+                size_t nFactors, algorithmFPType *colFactors, algorithmFPType *rowFactors,
+                algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *xtx, size_t nIterations);
+
+    void solveCG(size_t nFactors, const algorithmFPType *xtx, algorithmFPType gamma,
+                size_t nRated, const algorithmFPType *ratedFactors, const algorithmFPType *coeffs,
+                const algorithmFPType *rhs, algorithmFPType *x, size_t nIterations, algorithmFPType *work);
+
+    void applySystem(size_t nFactors, const algorithmFPType *xtx, algorithmFPType gamma,
+                size_t nRated, const algorithmFPType *ratedFactors, const algorithmFPType *coeffs,
+                const algorithmFPType *v, algorithmFPType *av);
+
     virtual void formSystem(size_t i, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
                 size_t nFactors, algorithmFPType *colFactors,
                 algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda) = 0;
 
+    virtual size_t formSparseSystem(size_t i, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+                size_t nFactors, algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                algorithmFPType *ratedFactors, algorithmFPType *coeffs, algorithmFPType *rhs, algorithmFPType *gamma) = 0;
+
     virtual void computeCostFunction(size_t nItems, size_t nUsers, size_t nFactors, algorithmFPType *data,
                 size_t *colIndices, size_t *rowOffsets, algorithmFPType *itemsFactors, algorithmFPType *usersFactors,
                 algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *costFunctionPtr) = 0;
@@ -102,6 +119,10 @@ protected:
                 size_t nFactors, algorithmFPType *colFactors,
                 algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda);
 
+    size_t formSparseSystem(size_t i, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+                size_t nFactors, algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                algorithmFPType *ratedFactors, algorithmFPType *coeffs, algorithmFPType *rhs, algorithmFPType *gamma);
+
     void computeCostFunction(size_t nItems, size_t nUsers, size_t nFactors, algorithmFPType *data,
                 size_t *colIndices, size_t *rowOffsets, algorithmFPType *itemsFactors, algorithmFPType *usersFactors,
                 algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *costFunctionPtr);
@@ -115,6 +136,10 @@ protected:
                 size_t nFactors, algorithmFPType *colFactors,
                 algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda);
 
+    size_t formSparseSystem(size_t i, size_t nCols, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+                size_t nFactors, algorithmFPType *colFactors, algorithmFPType alpha, algorithmFPType lambda,
+                algorithmFPType *ratedFactors, algorithmFPType *coeffs, algorithmFPType *rhs, algorithmFPType *gamma);
+
     void computeCostFunction(size_t nItems, size_t nUsers, size_t nFactors, algorithmFPType *data,
                 size_t *colIndices, size_t *rowOffsets, algorithmFPType *itemsFactors, algorithmFPType *usersFactors,
                 algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *costFunctionPtr);
@@ -334,6 +359,16 @@ protected:
                 int **indices,
                 daal::internal::BlockMicroTable<algorithmFPType, readOnly, cpu> **mtFactors,
                 algorithmFPType alpha, algorithmFPType *lhs, algorithmFPType *rhs, algorithmFPType lambda);
+
+    size_t formSparseSystem(size_t i, algorithmFPType *data, size_t *colIndices, size_t *rowOffsets,
+                size_t nFactors, size_t nBlocks, size_t *nColFactorsRows,
+                int **indices,
+                daal::internal::BlockMicroTable<algorithmFPType, readOnly, cpu> **mtFactors,
+                algorithmFPType alpha, algorithmFPType lambda, algorithmFPType *ratedFactors,
+                algorithmFPType *coeffs, algorithmFPType *rhs, algorithmFPType *gamma);
+
+    bool findColFactorsRow(int colIndex, size_t nBlocks, size_t *nColFactorsRows, int **indices,
+                size_t *blockIndex, size_t *rowIndex);
 };
 
 }
@@ -26,6 +26,7 @@
 
 #include "daal_defines.h"
 #include "service_defines.h"
+#include "service_profiler.h"
 
 #undef __DAAL_INTIALIZE_KERNELS
 #define __DAAL_INTIALIZE_KERNELS(KernelClass, ...)        \
@@ -45,6 +46,7 @@
 #undef __DAAL_CALL_KERNEL
 #define __DAAL_CALL_KERNEL(env, KernelClass, templateArguments, method, ...)            \
     {                                                                                   \
+        DAAL_PROFILER_KERNEL_TASK(#KernelClass "::" #method);                           \
         ((KernelClass<templateArguments, cpu> *)(_kernel))->method(__VA_ARGS__);        \
     }
 
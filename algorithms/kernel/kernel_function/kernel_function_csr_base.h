@@ -138,6 +138,12 @@ protected:
     inline AlgorithmFPType computeDotProduct(size_t startIndex1, size_t endIndex1, const AlgorithmFPType *dataA1, const size_t *colIndicesA1,
                                              size_t startIndex2, size_t endIndex2, const AlgorithmFPType *dataA2, const size_t *colIndicesA2);
 
+    /* Computes dataR[i * ldR + j] = <A1[i], A2[j]> for all the rows of A1 and A2, or only for j <= i if lowerTriangle is set */
+    bool computeDotProducts(size_t nFeatures,
+                            size_t nVectors1, const AlgorithmFPType *dataA1, const size_t *colIndicesA1, const size_t *rowOffsetsA1,
+                            size_t nVectors2, const AlgorithmFPType *dataA2, const size_t *colIndicesA2, const size_t *rowOffsetsA2,
+                            AlgorithmFPType *dataR, size_t ldR, bool lowerTriangle);
+
     ComputationMode _computationMode;
 };
 
@@ -24,6 +24,9 @@
 #ifndef __KERNEL_FUNCTION_CSR_IMPL_I__
 #define __KERNEL_FUNCTION_CSR_IMPL_I__
 
+#include "service_memory.h"
+#include "threading.h"
+
 namespace daal
 {
 namespace algorithms
@@ -63,6 +66,97 @@ AlgorithmFPType KernelCSRImplBase<AlgorithmFPType, cpu>::computeDotProduct(
     return sum;
 }
 
+const size_t kernelCSRBlockSize = 256;    /* Number of rows of the second matrix processed by a thread at once */
+
+/*
+ *  The rows of A2 are split into blocks processed in parallel. Every row of A1 is scattered
+ *  into the dense buffer of the thread, and its dot products with the rows of the block are
+ *  gathered from the buffer, so the cost of every product is the number of non-zeros in the row of A2.
+ *  The scatter costs O(nFeatures) memory per thread, so a single block of A2 is processed
+ *  with the sparse merge instead
+ */
+template <typename AlgorithmFPType, CpuType cpu>
+bool KernelCSRImplBase<AlgorithmFPType, cpu>::computeDotProducts(size_t nFeatures,
+            size_t nVectors1, const AlgorithmFPType *dataA1, const size_t *colIndicesA1, const size_t *rowOffsetsA1,
+            size_t nVectors2, const AlgorithmFPType *dataA2, const size_t *colIndicesA2, const size_t *rowOffsetsA2,
+            AlgorithmFPType *dataR, size_t ldR, bool lowerTriangle)
+{
+    if (nVectors2 <= kernelCSRBlockSize)
+    {
+        for (size_t i = 0; i < nVectors1; i++)
+        {
+            const size_t endRow = (lowerTriangle ? i + 1 : nVectors2);
+            AlgorithmFPType *r = dataR + i * ldR;
+            for (size_t j = 0; j < endRow; j++)
+            {
+                r[j] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i + 1] - 1, dataA1, colIndicesA1,
+                                         rowOffsetsA2[j] - 1, rowOffsetsA2[j + 1] - 1, dataA2, colIndicesA2);
+            }
+        }
+        return true;
+    }
+
+    daal::tls<AlgorithmFPType *> tlsDense( [ = ]()-> AlgorithmFPType *
+    {
+        AlgorithmFPType *dense = (AlgorithmFPType *)daal::services::daal_malloc(nFeatures * sizeof(AlgorithmFPType));
+        if (dense)
+        {
+            for (size_t k = 0; k < nFeatures; k++) { dense[k] = (AlgorithmFPType)0.0; }
+        }
+        return dense;
+    } );
+
+    daal::threader_flag allocationFailed;
+    size_t nBlocks = nVectors2 / kernelCSRBlockSize + !!(nVectors2 % kernelCSRBlockSize);
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsDense, &allocationFailed](int iBlock)
+    {
+        AlgorithmFPType *dense = tlsDense.local();
+        if (!dense) { allocationFailed.set(); return; }
+
+        size_t startRow2 = iBlock * kernelCSRBlockSize;
+        size_t endRow2 = (startRow2 + kernelCSRBlockSize > nVectors2) ? nVectors2 : startRow2 + kernelCSRBlockSize;
+
+        for (size_t i = (lowerTriangle ? startRow2 : 0); i < nVectors1; i++)
+        {
+            const size_t startIndex1 = rowOffsetsA1[i]     - 1;
+            const size_t endIndex1   = rowOffsetsA1[i + 1] - 1;
+            for (size_t index = startIndex1; index < endIndex1; index++)
+            {
+                dense[colIndicesA1[index] - 1] = dataA1[index];
+            }
+
+            const size_t endRow = (lowerTriangle && i + 1 < endRow2) ? i + 1 : endRow2;
+            AlgorithmFPType *r = dataR + i * ldR;
+            for (size_t j = startRow2; j < endRow; j++)
+            {
+                AlgorithmFPType sum = 0.0;
+                for (size_t index = rowOffsetsA2[j] - 1; index < rowOffsetsA2[j + 1] - 1; index++)
+                {
+                    sum += dataA2[index] * dense[colIndicesA2[index] - 1];
+                }
+                r[j] = sum;
+            }
+
+            for (size_t index = startIndex1; index < endIndex1; index++)
+            {
+                dense[colIndicesA1[index] - 1] = (AlgorithmFPType)0.0;
+            }
+        }
+    } );
+
+    tlsDense.reduce( [ = ](AlgorithmFPType *dense)
+    {
+        if (dense) { daal::services::daal_free(dense); }
+    } );
+
+    if (allocationFailed.isSet())
+    {
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return false;
+    }
+    return true;
+}
+
 }
 }
 }
@@ -137,12 +137,13 @@ void KernelImplLinear<fastCSR, AlgorithmFPType, cpu>::computeInternalMatrixMatri
 
     if (inputTablesSame)
     {
+        if (!this->computeDotProducts(nFeatures, nVectors1, dataA1, colIndicesA1, rowOffsetsA1,
+                                      nVectors1, dataA1, colIndicesA1, rowOffsetsA1, dataR, nVectors1, true)) { return; }
+
         for (size_t i = 0; i < nVectors1; i++)
         {
             for (size_t j = 0; j <= i; j++)
             {
-                dataR[i * nVectors1 + j] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i+1] - 1, dataA1, colIndicesA1,
-                                                             rowOffsetsA1[j] - 1, rowOffsetsA1[j+1] - 1, dataA1, colIndicesA1);
                 dataR[i * nVectors1 + j] = dataR[i * nVectors1 + j] * k + b;
             }
         }
@@ -156,14 +157,12 @@ void KernelImplLinear<fastCSR, AlgorithmFPType, cpu>::computeInternalMatrixMatri
     }
     else
     {
-        for (size_t i = 0; i < nVectors1; i++)
+        if (!this->computeDotProducts(nFeatures, nVectors1, dataA1, colIndicesA1, rowOffsetsA1,
+                                      nVectors2, dataA2, colIndicesA2, rowOffsetsA2, dataR, nVectors2, false)) { return; }
+
+        for (size_t i = 0; i < nVectors1 * nVectors2; i++)
         {
-            for (size_t j = 0; j < nVectors2; j++)
-            {
-                dataR[i * nVectors2 + j] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i+1] - 1, dataA1, colIndicesA1,
-                                                             rowOffsetsA2[j] - 1, rowOffsetsA2[j+1] - 1, dataA2, colIndicesA2);
-                dataR[i * nVectors2 + j] = dataR[i * nVectors2 + j] * k + b;
-            }
+            dataR[i] = dataR[i] * k + b;
         }
     }
 }
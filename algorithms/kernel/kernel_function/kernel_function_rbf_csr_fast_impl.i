@@ -171,14 +171,8 @@ void KernelImplRBF<fastCSR, AlgorithmFPType, cpu>::computeInternalMatrixMatrix(
 
     if (inputTablesSame)
     {
-        for (size_t i = 0; i < nVectors1; i++)
-        {
-            for (size_t j = 0; j <= i; j++)
-            {
-                dataR[i*nVectors1 + j] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i+1] - 1, dataA1, colIndicesA1,
-                                                           rowOffsetsA1[j] - 1, rowOffsetsA1[j+1] - 1, dataA1, colIndicesA1);
-            }
-        }
+        if (!this->computeDotProducts(nFeatures, nVectors1, dataA1, colIndicesA1, rowOffsetsA1,
+                                      nVectors1, dataA1, colIndicesA1, rowOffsetsA1, dataR, nVectors1, true)) { return; }
         for (size_t i = 0; i < nVectors1; i++)
         {
             for (size_t k = 0; k < i; k++)
@@ -202,14 +196,9 @@ void KernelImplRBF<fastCSR, AlgorithmFPType, cpu>::computeInternalMatrixMatrix(
     }
     else
     {
-        for (size_t i = 0; i < nVectors1; i++)
-        {
-            for (size_t j = 0; j < nVectors2; j++)
-            {
-                dataR[i*nVectors2 + j] = computeDotProduct(rowOffsetsA1[i] - 1, rowOffsetsA1[i+1] - 1, dataA1, colIndicesA1,
-                                                           rowOffsetsA2[j] - 1, rowOffsetsA2[j+1] - 1, dataA2, colIndicesA2);
-            }
-        }
+        if (!this->computeDotProducts(nFeatures, nVectors1, dataA1, colIndicesA1, rowOffsetsA1,
+                                      nVectors2, dataA2, colIndicesA2, rowOffsetsA2, dataR, nVectors2, false)) { return; }
+
         AlgorithmFPType *buffer = (AlgorithmFPType *)daal::services::daal_malloc((nVectors1 + nVectors2) * sizeof(AlgorithmFPType));
         if (!buffer) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
         AlgorithmFPType *sqrDataA1 = buffer;
@@ -27,6 +27,7 @@
 #include "daal_defines.h"
 #include "service_memory.h"
 #include "service_micro_table.h"
+#include "service_profiler.h"
 
 #include "kmeans_lloyd_impl.i"
 
@@ -104,16 +105,22 @@ void KMeansBatchKernel<method, interm, cpu>::compute( size_t na, const NumericTa
     {
         void *task = kmeansInitTask<interm, cpu>(p, nClusters, inClusters);
 
-        addNTToTaskThreaded<method, interm, cpu, 0>(task, ntData, catCoef );
+        {
+            DAAL_PROFILER_TASK("kmeans.assign");
+            addNTToTaskThreaded<method, interm, cpu, 0>(task, ntData, catCoef );
+        }
 
-        for (size_t i = 0; i < nClusters; i++)
         {
-            for (size_t j = 0; j < p; j++)
+            DAAL_PROFILER_TASK("kmeans.reduce");
+            for (size_t i = 0; i < nClusters; i++)
             {
-                clusterS1[i * p + j] = 0.0;
-            }
+                for (size_t j = 0; j < p; j++)
+                {
+                    clusterS1[i * p + j] = 0.0;
+                }
 
-            clusterS0[i] = kmeansUpdateCluster<interm, cpu>( task, i, &clusterS1[i * p] );
+                clusterS0[i] = kmeansUpdateCluster<interm, cpu>( task, i, &clusterS1[i * p] );
+            }
         }
 
         for (size_t i = 0; i < nClusters; i++)
@@ -153,6 +160,7 @@ void KMeansBatchKernel<method, interm, cpu>::compute( size_t na, const NumericTa
 
     if( par->assignFlag )
     {
+        DAAL_PROFILER_TASK("kmeans.assignments");
         void *task = kmeansInitTask<interm, cpu>(p, nClusters, clusters);
         getNTAssignmentsThreaded<method, interm, cpu>(task, ntData, r[1], catCoef);
         kmeansClearClusters<interm, cpu>(task, 0);
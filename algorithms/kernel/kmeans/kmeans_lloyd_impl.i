@@ -28,6 +28,7 @@
 #include "threading.h"
 #include "service_blas.h"
 #include "service_spblas.h"
+#include "service_profiler.h"
 
 using namespace daal::services::internal;
 using namespace daal::internal;
@@ -100,8 +101,10 @@ void addNTToTaskThreadedDense(void * task_id, const NumericTable * ntData, inter
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks*blockSizeDeafult != n);
 
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_numa( nBlocks, nBlocks, [=](int k)
     {
+        DAAL_PROFILER_TASK("kmeans.assign.block");
+
         size_t blockSize = blockSizeDeafult;
         if( k == nBlocks-1 )
         {
@@ -202,8 +205,10 @@ void addNTToTaskThreadedCSR(void * task_id, const NumericTable * ntDataGen, inte
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks*blockSizeDeafult != n);
 
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_numa( nBlocks, nBlocks, [=](int k)
     {
+        DAAL_PROFILER_TASK("kmeans.assign.block");
+
         size_t blockSize = blockSizeDeafult;
         if( k == nBlocks-1 )
         {
@@ -322,8 +327,10 @@ void getNTAssignmentsThreaded(void * task_id, const NumericTable * ntData, const
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks*blockSizeDeafult != n);
 
-    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    daal::threader_for_numa( nBlocks, nBlocks, [=](int k)
     {
+        DAAL_PROFILER_TASK("kmeans.assignments.block");
+
         size_t blockSize = blockSizeDeafult;
         if( k == nBlocks-1 )
         {
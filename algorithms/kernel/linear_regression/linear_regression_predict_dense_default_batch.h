@@ -71,6 +71,13 @@ protected:
     void computeBlockOfResponses(MKL_INT *numFeatures, MKL_INT *numRows, algorithmFpType *dataBlock,
                                  MKL_INT *numBetas, algorithmFpType *beta,
                                  MKL_INT *numResponses, algorithmFpType *responseBlock, bool findBeta0);
+
+    void computeCSR(const NumericTable *dataTable, NumericTable *r, size_t numResponses, size_t numBetas,
+                    const algorithmFpType *beta, bool findBeta0);
+
+    void computeBlockOfResponsesCSR(size_t numRows, const algorithmFpType *values, const size_t *colIndices,
+                                    const size_t *rowOffsets, size_t numResponses, size_t numBetas, const algorithmFpType *beta,
+                                    const algorithmFpType *betaT, algorithmFpType *responseBlock, bool findBeta0);
 };
 
 } // namespace internal
@@ -32,7 +32,10 @@
 #include "linear_regression_ne_model.h"
 #include "threading.h"
 #include "daal_defines.h"
+#include "service_defines.h"
 #include "service_blas.h"
+#include "service_memory.h"
+#include "service_micro_table.h"
 
 using namespace daal::internal;
 
@@ -130,6 +133,14 @@ void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::compute(
     betaTable->getBlockOfRows(0, numResponses, readOnly, betaBD);
     algorithmFpType *beta = betaBD.getBlockPtr();
 
+    if (dataTable->getDataLayout() == NumericTableIface::csrArray)
+    {
+        /* Sparse input data is processed without conversion into the dense format */
+        computeCSR(dataTable, r, numResponses, nAllBetas, beta, findBeta0);
+        betaTable->releaseBlockOfRows(betaBD);
+        return;
+    }
+
     size_t numRowsInBlock = __DAAL_LINREG_PREDICT_BLOCK_SIZE;
     if (numRowsInBlock < 1) { numRowsInBlock = 1; }
 
@@ -147,9 +158,9 @@ void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::compute(
 
         /* Retrieve data blocks associated with input and resulting tables */
         algorithmFpType *dataBlock, *responseBlock;
-        dataTable->getBlockOfRows(startRow, endRow, readOnly,  dataBM);
+        dataTable->getBlockOfRows(startRow, numRows, readOnly,  dataBM);
         dataBlock = dataBM.getBlockPtr();
-        r        ->getBlockOfRows(startRow, endRow, writeOnly, responseBM);
+        r        ->getBlockOfRows(startRow, numRows, writeOnly, responseBM);
         responseBlock = responseBM.getBlockPtr();
 
         /* Calculate predictions */
@@ -163,6 +174,99 @@ void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::compute(
     betaTable->releaseBlockOfRows(betaBD);
 }
 
+/**
+ *  \brief Function that computes linear regression prediction results
+ *         for a block of input data rows stored in the CSR format
+ *
+ *  \param numRows[in]          Number of input data rows
+ *  \param values[in]           Non-zero values of the block of input data rows
+ *  \param colIndices[in]       One-based column indices of the non-zero values
+ *  \param rowOffsets[in]       One-based offsets of the rows in the arrays of values and column indices
+ *  \param numResponses[in]     Number of responses to calculate for each input data row
+ *  \param numBetas[in]         Number of regression coefficients
+ *  \param beta[in]             Regression coefficients
+ *  \param betaT[in]            Regression coefficients without intercept term, transposed:
+ *                              numResponses coefficients for every feature
+ *  \param responseBlock[out]   Resulting block of responses
+ *  \param findBeta0[in]        Flag. True if regression coefficient contain intercept term;
+ *                              false - otherwise.
+ */
+template<typename algorithmFpType, CpuType cpu>
+void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::computeBlockOfResponsesCSR(
+            size_t numRows, const algorithmFpType *values, const size_t *colIndices, const size_t *rowOffsets,
+            size_t numResponses, size_t numBetas, const algorithmFpType *beta, const algorithmFpType *betaT,
+            algorithmFpType *responseBlock, bool findBeta0)
+{
+    for (size_t i = 0; i < numRows; i++)
+    {
+        algorithmFpType *response = responseBlock + i * numResponses;
+        for (size_t j = 0; j < numResponses; j++)
+        {
+            response[j] = (findBeta0 ? beta[j * numBetas] : (algorithmFpType)0.0);
+        }
+
+        for (size_t k = rowOffsets[i] - 1; k < rowOffsets[i + 1] - 1; k++)
+        {
+            const algorithmFpType value = values[k];
+            const algorithmFpType *betaRow = betaT + (colIndices[k] - 1) * numResponses;
+          PRAGMA_IVDEP
+            for (size_t j = 0; j < numResponses; j++)
+            {
+                response[j] += value * betaRow[j];
+            }
+        }
+    }
+}
+
+template<typename algorithmFpType, CpuType cpu>
+void LinearRegressionPredictKernel<algorithmFpType, defaultDense, cpu>::computeCSR(
+            const NumericTable *dataTable, NumericTable *r, size_t numResponses, size_t numBetas,
+            const algorithmFpType *beta, bool findBeta0)
+{
+    size_t numFeatures = dataTable->getNumberOfColumns();
+    size_t numVectors  = dataTable->getNumberOfRows();
+
+    /* Coefficients of every feature for all the responses are stored contiguously */
+    algorithmFpType *betaT = (algorithmFpType *)daal::services::daal_malloc(numFeatures * numResponses * sizeof(algorithmFpType));
+    if (!betaT) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    for (size_t j = 0; j < numResponses; j++)
+    {
+        for (size_t k = 0; k < numFeatures; k++)
+        {
+            betaT[k * numResponses + j] = beta[j * numBetas + k + 1];
+        }
+    }
+
+    size_t numRowsInBlock = __DAAL_LINREG_PREDICT_BLOCK_SIZE;
+    if (numRowsInBlock < 1) { numRowsInBlock = 1; }
+
+    size_t numBlocks = numVectors / numRowsInBlock;
+    if (numBlocks * numRowsInBlock < numVectors) { numBlocks++; }
+
+    daal::threader_for(numBlocks, numBlocks, [ = ](int iBlock)
+    {
+        size_t startRow = iBlock * numRowsInBlock;
+        size_t numRows = (startRow + numRowsInBlock > numVectors) ? numVectors - startRow : numRowsInBlock;
+
+        CSRBlockMicroTable<algorithmFpType, readOnly, cpu> mtData(dataTable);
+        BlockMicroTable<algorithmFpType, writeOnly, cpu> mtResponses(r);
+
+        algorithmFpType *values, *responseBlock;
+        size_t *colIndices, *rowOffsets;
+        mtData.getSparseBlock(startRow, numRows, &values, &colIndices, &rowOffsets);
+        mtResponses.getBlockOfRows(startRow, numRows, &responseBlock);
+
+        computeBlockOfResponsesCSR(numRows, values, colIndices, rowOffsets, numResponses, numBetas,
+                                   beta, betaT, responseBlock, findBeta0);
+
+        mtResponses.release();
+        mtData.release();
+    } );
+
+    daal::services::daal_free(betaT);
+}
+
 }
 }
 }
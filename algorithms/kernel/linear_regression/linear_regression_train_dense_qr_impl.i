@@ -26,7 +26,10 @@
 
 #include "service_lapack.h"
 #include "service_memory.h"
+#include "service_micro_table.h"
 #include "linear_regression_train_kernel.h"
+#include "qr_dense_default_impl.i"
+#include "threading.h"
 
 using namespace daal::internal;
 
@@ -96,16 +99,24 @@ static void releaseModelQRPartialSums(NumericTable *rTable,   BlockDescriptor<in
  *  \param tau[in]      LAPACK GERQF TAU parameter. Array of size p
  *  \param work[in]     LAPACK GERQF WORK parameter
  *  \param lwork[out]   Calculated size of WORK array
+ *  \param sequential[in] Flag that specifies whether sequential LAPACK routines are used
  *
  */
 template <typename interm, CpuType cpu>
 static void computeQRWorkSize(MKL_INT *p, MKL_INT *n, interm *x, interm *tau, interm **work, MKL_INT *lwork,
-            services::SharedPtr<services::KernelErrorCollection> &_errors)
+            services::SharedPtr<services::KernelErrorCollection> &_errors, bool sequential = false)
 {
     MKL_INT info = 0;
 
     *lwork = -1;
-    Lapack<interm, cpu>::xgerqf(p, n, x, p, tau, *work, lwork, &info);
+    if (sequential)
+    {
+        Lapack<interm, cpu>::xxgerqf(p, n, x, p, tau, *work, lwork, &info);
+    }
+    else
+    {
+        Lapack<interm, cpu>::xgerqf(p, n, x, p, tau, *work, lwork, &info);
+    }
     if (info != 0) { _errors->add(services::ErrorLinearRegressionInternal); return; }
 
     *lwork = (*work)[0];
@@ -123,23 +134,33 @@ static void computeQRWorkSize(MKL_INT *p, MKL_INT *n, interm *x, interm *tau, in
  *  \param tau[in]      LAPACK GERQF/ORMRQ TAU parameter. Array of size p
  *  \param work[out]    LAPACK GERQF/ORMRQ WORK parameter
  *  \param lwork[out]   Calculated size of WORK array
+ *  \param sequential[in] Flag that specifies whether sequential LAPACK routines are used
  *
  */
 template <typename interm, CpuType cpu>
 static void mallocQRWorkBuffer(MKL_INT *p, MKL_INT *n, interm *x, MKL_INT *ny, interm *y, interm *tau,
-            interm **work, MKL_INT *lwork, services::SharedPtr<services::KernelErrorCollection> &_errors)
+            interm **work, MKL_INT *lwork, services::SharedPtr<services::KernelErrorCollection> &_errors,
+            bool sequential = false)
 {
     MKL_INT info = 0;
 
     MKL_INT lwork1;
-    computeQRWorkSize<interm, cpu>(p, n, x, tau, work, &lwork1, _errors);
+    computeQRWorkSize<interm, cpu>(p, n, x, tau, work, &lwork1, _errors, sequential);
     if (!_errors->isEmpty()) { return; }
 
     char side = 'R';
     char trans = 'T';
     MKL_INT lwork2 = -1;
-    Lapack<interm, cpu>::xormrq(&side, &trans, ny, n, p, x, p, tau,
-                    y, ny, *work, &lwork2, &info);
+    if (sequential)
+    {
+        Lapack<interm, cpu>::xxormrq(&side, &trans, ny, n, p, x, p, tau,
+                        y, ny, *work, &lwork2, &info);
+    }
+    else
+    {
+        Lapack<interm, cpu>::xormrq(&side, &trans, ny, n, p, x, p, tau,
+                        y, ny, *work, &lwork2, &info);
+    }
     if (info != 0) { _errors->add(services::ErrorLinearRegressionInternal); return; }
     lwork2 = (*work)[0];
 
@@ -211,11 +232,13 @@ static void copyDataToBuffer(MKL_INT *dim, MKL_INT *betaDim, MKL_INT *n, interm
  *  \param tau[in]   LAPACK GERQF/ORMRQ TAU parameter. Array of size p
  *  \param work[in]  LAPACK GERQF/ORMRQ WORK parameter
  *  \param lwork[in] Calculated size of WORK array
+ *  \param sequential[in] Flag that specifies whether sequential LAPACK routines are used
  *
  */
 template <typename interm, CpuType cpu>
 static void computeQRForBlock(MKL_INT *p, MKL_INT *n, interm *x, MKL_INT *ny, interm *y, interm *r, interm *qty,
-            interm *tau, interm *work, MKL_INT *lwork, services::SharedPtr<services::KernelErrorCollection> &_errors)
+            interm *tau, interm *work, MKL_INT *lwork, services::SharedPtr<services::KernelErrorCollection> &_errors,
+            bool sequential = false)
 {
     MKL_INT iOne = 1;             // integer one
     MKL_INT info = 0;
@@ -227,7 +250,14 @@ static void computeQRForBlock(MKL_INT *p, MKL_INT *n, interm *x, MKL_INT *ny, in
     MKL_INT yqtOffset = (n_val - pVal) * ny_val;
 
     /* Calculate RQ decomposition of X */
-    Lapack<interm, cpu>::xgerqf(p, n, x, p, tau, work, lwork, &info);
+    if (sequential)
+    {
+        Lapack<interm, cpu>::xxgerqf(p, n, x, p, tau, work, lwork, &info);
+    }
+    else
+    {
+        Lapack<interm, cpu>::xgerqf(p, n, x, p, tau, work, lwork, &info);
+    }
     if (info != 0) { _errors->add(services::ErrorLinearRegressionInternal); return; }
 
     /* Copy result into matrix R */
@@ -243,7 +273,14 @@ static void computeQRForBlock(MKL_INT *p, MKL_INT *n, interm *x, MKL_INT *ny, in
     /* Calculate Y*Q' */
     char side = 'R';
     char trans = 'T';
-    Lapack<interm, cpu>::xormrq(&side, &trans, ny, n, p, x, p, tau, y, ny, work, lwork, &info);
+    if (sequential)
+    {
+        Lapack<interm, cpu>::xxormrq(&side, &trans, ny, n, p, x, p, tau, y, ny, work, lwork, &info);
+    }
+    else
+    {
+        Lapack<interm, cpu>::xormrq(&side, &trans, ny, n, p, x, p, tau, y, ny, work, lwork, &info);
+    }
     if (info != 0) { _errors->add(services::ErrorLinearRegressionInternal); return; }
 
     /* Copy result into matrix QTY */
@@ -268,12 +305,13 @@ static void computeQRForBlock(MKL_INT *p, MKL_INT *n, interm *x, MKL_INT *ny, in
  *  \param tau[in]   LAPACK GERQF TAU parameter. Array of size p
  *  \param work[in]  LAPACK GERQF WORK parameter
  *  \param lwork[in] Size of WORK array
+ *  \param sequential[in] Flag that specifies whether sequential LAPACK routines are used
  *
  */
 template <typename interm, CpuType cpu>
 static void mergeQR(MKL_INT *p, MKL_INT *ny, interm *r1,  interm *qty1,  interm *r2, interm *qty2,
             interm *r12, interm *qty12, interm *r,  interm *qty, interm *tau, interm *work, MKL_INT *lwork,
-            services::SharedPtr<services::KernelErrorCollection> &_errors)
+            services::SharedPtr<services::KernelErrorCollection> &_errors, bool sequential = false)
 {
     MKL_INT iOne = 1;             // integer one
     MKL_INT p_val = *p;
@@ -289,7 +327,7 @@ static void mergeQR(MKL_INT *p, MKL_INT *ny, interm *r1,  interm *qty1,  interm
     daal::services::daal_memcpy_s(qty12          ,qtySize*2*sizeof(interm),qty1,qtySize*sizeof(interm));
     daal::services::daal_memcpy_s(qty12 + qtySize,qtySize*sizeof(interm),  qty2,qtySize*sizeof(interm));
 
-    computeQRForBlock<interm, cpu>(p, &n_val, r12, ny, qty12, r, qty, tau, work, lwork, _errors);
+    computeQRForBlock<interm, cpu>(p, &n_val, r12, ny, qty12, r, qty, tau, work, lwork, _errors, sequential);
 }
 
 /**
@@ -329,6 +367,142 @@ static void finalizeQR(MKL_INT *p, interm *r, MKL_INT *ny, interm *qty, interm *
     if (info != 0) { _errors->add(services::ErrorLinearRegressionInternal); return; }
 }
 
+/**
+ *  \brief Function that calculates R and Y*Q' by the tall-skinny qrDense decomposition.
+ *         Row blocks of X and Y are decomposed in parallel, and the partial results
+ *         are merged pairwise in a reduction tree.
+ *
+ *  \param nBlocks[in]  Number of row blocks
+ *  \param xTable[in]   Input matrix X of size (n x dim), n > p
+ *  \param yTable[in]   Input matrix Y of size (n x ny)
+ *  \param dim[in]      Number of columns in input matrix X
+ *  \param p[in]        Number of regression coefficients
+ *  \param ny[in]       Number of columns in input matrix Y
+ *  \param r[out]       Matrix R of size (p x p)
+ *  \param qty[out]     Matrix Y*Q' of size (ny x p)
+ *
+ */
+template <typename interm, CpuType cpu>
+static void computeQRInParallel(size_t nBlocks, NumericTable *xTable, NumericTable *yTable,
+            MKL_INT dim, MKL_INT p, MKL_INT ny, interm *r, interm *qty,
+            services::SharedPtr<services::KernelErrorCollection> &_errors)
+{
+    const size_t n = xTable->getNumberOfRows();
+    const size_t rowsInBlock = n / nBlocks;
+    const size_t rSize   = p * p;
+    const size_t qtySize = p * ny;
+
+    /* Partial results (R, Y*Q') of the blocks */
+    interm *rBlocks   = (interm *)daal::services::daal_malloc(nBlocks * rSize   * sizeof(interm));
+    interm *qtyBlocks = (interm *)daal::services::daal_malloc(nBlocks * qtySize * sizeof(interm));
+    bool   *failed    = (bool   *)daal::services::daal_malloc(nBlocks * sizeof(bool));
+    if (!rBlocks || !qtyBlocks || !failed)
+    {
+        daal::services::daal_free(rBlocks);
+        daal::services::daal_free(qtyBlocks);
+        daal::services::daal_free(failed);
+        _errors->add(services::ErrorMemoryAllocationFailed); return;
+    }
+
+    for (size_t i = 0; i < nBlocks * rSize; i++) { rBlocks[i] = 0.0; }
+
+    daal::threader_for(nBlocks, nBlocks, [=](int k)
+    {
+        failed[k] = true;
+
+        MKL_INT row0 = k * rowsInBlock;
+        MKL_INT nk   = (k == nBlocks - 1) ? n - row0 : rowsInBlock;
+        MKL_INT dimVal = dim, pVal = p, nyVal = ny;
+
+        interm *tau       = (interm *)daal::services::daal_malloc(p * sizeof(interm));
+        interm *qrBuffer  = (interm *)daal::services::daal_malloc(p * nk * sizeof(interm));
+        interm *qtyBuffer = (interm *)daal::services::daal_malloc(ny * nk * sizeof(interm));
+        interm *work      = (interm *)daal::services::daal_malloc(2 * sizeof(interm));
+        if (tau && qrBuffer && qtyBuffer && work)
+        {
+            services::SharedPtr<services::KernelErrorCollection> blockErrors(new services::KernelErrorCollection());
+
+            interm *dx, *dy;
+            BlockMicroTable<interm, readOnly, cpu> mtX(xTable);
+            BlockMicroTable<interm, readOnly, cpu> mtY(yTable);
+            mtX.getBlockOfRows(row0, nk, &dx);
+            mtY.getBlockOfRows(row0, nk, &dy);
+
+            MKL_INT lwork = -1;
+            mallocQRWorkBuffer<interm, cpu>(&pVal, &nk, dx, &nyVal, dy, tau, &work, &lwork, blockErrors, true);
+            if (blockErrors->isEmpty())
+            {
+                copyDataToBuffer<interm, cpu>(&dimVal, &pVal, &nk, dx, &nyVal, dy, qrBuffer, qtyBuffer);
+                computeQRForBlock<interm, cpu>(&pVal, &nk, qrBuffer, &nyVal, qtyBuffer,
+                    rBlocks + k * rSize, qtyBlocks + k * qtySize, tau, work, &lwork, blockErrors, true);
+            }
+
+            mtX.release();
+            mtY.release();
+
+            failed[k] = !blockErrors->isEmpty();
+        }
+
+        daal::services::daal_free(tau);
+        daal::services::daal_free(qrBuffer);
+        daal::services::daal_free(qtyBuffer);
+        daal::services::daal_free(work);
+    } );
+
+    /* Reduction tree: on each level the partial result of block (k + step) is merged into block k */
+    for (size_t step = 1; step < nBlocks; step *= 2)
+    {
+        size_t nPairs = (nBlocks - step + 2 * step - 1) / (2 * step);
+        daal::threader_for(nPairs, nPairs, [=](int iPair)
+        {
+            size_t k1 = iPair * 2 * step;
+            size_t k2 = k1 + step;
+            if (failed[k1] || failed[k2]) { failed[k1] = true; return; }
+
+            MKL_INT pVal = p, nyVal = ny, n2 = 2 * p;
+
+            interm *tau   = (interm *)daal::services::daal_malloc(p * sizeof(interm));
+            interm *r12   = (interm *)daal::services::daal_malloc(2 * rSize   * sizeof(interm));
+            interm *qty12 = (interm *)daal::services::daal_malloc(2 * qtySize * sizeof(interm));
+            interm *work  = (interm *)daal::services::daal_malloc(2 * sizeof(interm));
+            failed[k1] = true;
+            if (tau && r12 && qty12 && work)
+            {
+                services::SharedPtr<services::KernelErrorCollection> blockErrors(new services::KernelErrorCollection());
+
+                MKL_INT lwork = -1;
+                mallocQRWorkBuffer<interm, cpu>(&pVal, &n2, r12, &nyVal, qty12, tau, &work, &lwork, blockErrors, true);
+                if (blockErrors->isEmpty())
+                {
+                    mergeQR<interm, cpu>(&pVal, &nyVal, rBlocks + k1 * rSize, qtyBlocks + k1 * qtySize,
+                        rBlocks + k2 * rSize, qtyBlocks + k2 * qtySize, r12, qty12,
+                        rBlocks + k1 * rSize, qtyBlocks + k1 * qtySize, tau, work, &lwork, blockErrors, true);
+                }
+                failed[k1] = !blockErrors->isEmpty();
+            }
+
+            daal::services::daal_free(tau);
+            daal::services::daal_free(r12);
+            daal::services::daal_free(qty12);
+            daal::services::daal_free(work);
+        } );
+    }
+
+    if (failed[0])
+    {
+        _errors->add(services::ErrorLinearRegressionInternal);
+    }
+    else
+    {
+        daal::services::daal_memcpy_s(r,   rSize   * sizeof(interm), rBlocks,   rSize   * sizeof(interm));
+        daal::services::daal_memcpy_s(qty, qtySize * sizeof(interm), qtyBlocks, qtySize * sizeof(interm));
+    }
+
+    daal::services::daal_free(rBlocks);
+    daal::services::daal_free(qtyBlocks);
+    daal::services::daal_free(failed);
+}
+
 template <typename interm, CpuType cpu>
 void updatePartialModelQR(SharedPtr<NumericTable> &x, SharedPtr<NumericTable> &y,
             SharedPtr<linear_regression::Model> &r,
@@ -344,14 +518,6 @@ void updatePartialModelQR(SharedPtr<NumericTable> &x, SharedPtr<NumericTable> &y
     MKL_INT nBetasIntercept = nBetas;
     if (parameter && !parameter->interceptFlag) { nBetasIntercept--; }
 
-    /* Retrieve data associated with input tables */
-    BlockDescriptor<interm> xBD;
-    BlockDescriptor<interm> yBD;
-    x->getBlockOfRows(0, nRows, readOnly, xBD);
-    y->getBlockOfRows(0, nRows, readOnly, yBD);
-    interm *dy = yBD.getBlockPtr();
-    interm *dx = xBD.getBlockPtr();
-
     /* Retrieve matrices R and Q'*Y from daal::algorithms::Model */
     NumericTable *rTable, *qtyTable;
     BlockDescriptor<interm> rBD, qtyBD;
@@ -375,27 +541,59 @@ void updatePartialModelQR(SharedPtr<NumericTable> &x, SharedPtr<NumericTable> &y
     }
 
     MKL_INT lwork = -1;
-    interm *tau       = (interm *)daal::services::daal_malloc(nBetasIntercept * sizeof(interm));
-    interm *qrBuffer  = (interm *)daal::services::daal_malloc(nBetasIntercept * nRows * sizeof(interm));
-    interm *qtyBuffer = (interm *)daal::services::daal_malloc(nResponses * nRows * sizeof(interm));
-    interm *work      = (interm *)daal::services::daal_malloc(2 * sizeof(interm));
-    if (!tau || !qrBuffer || !qtyBuffer || !work)
+    interm *tau  = (interm *)daal::services::daal_malloc(nBetasIntercept * sizeof(interm));
+    interm *work = (interm *)daal::services::daal_malloc(2 * sizeof(interm));
+    if (!tau || !work)
     { _errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-    mallocQRWorkBuffer<interm, cpu>(&nBetasIntercept, &nRows, dx, &nResponses, dy, tau, &work, &lwork, _errors);
-    if(!_errors->isEmpty()) { return; }
+    size_t nBlocks = qr::internal::getNumberOfTSQRBlocks<cpu>(nRows, nBetasIntercept);
+    if (nBlocks > 1)
+    {
+        computeQRInParallel<interm, cpu>(nBlocks, x.get(), y.get(), nFeatures, nBetasIntercept, nResponses,
+            qrR, qrQTY, _errors);
+        if(!_errors->isEmpty()) { return; }
+    }
+    else
+    {
+        /* Retrieve data associated with input tables */
+        BlockDescriptor<interm> xBD;
+        BlockDescriptor<interm> yBD;
+        x->getBlockOfRows(0, nRows, readOnly, xBD);
+        y->getBlockOfRows(0, nRows, readOnly, yBD);
+        interm *dy = yBD.getBlockPtr();
+        interm *dx = xBD.getBlockPtr();
+
+        interm *qrBuffer  = (interm *)daal::services::daal_malloc(nBetasIntercept * nRows * sizeof(interm));
+        interm *qtyBuffer = (interm *)daal::services::daal_malloc(nResponses * nRows * sizeof(interm));
+        if (!qrBuffer || !qtyBuffer)
+        { _errors->add(services::ErrorMemoryAllocationFailed); return; }
 
-    copyDataToBuffer<interm, cpu>(&nFeatures, &nBetasIntercept, &nRows, dx, &nResponses, dy, qrBuffer, qtyBuffer);
+        mallocQRWorkBuffer<interm, cpu>(&nBetasIntercept, &nRows, dx, &nResponses, dy, tau, &work, &lwork, _errors);
+        if(!_errors->isEmpty()) { return; }
 
-    computeQRForBlock<interm, cpu>(&nBetasIntercept, &nRows, qrBuffer, &nResponses, qtyBuffer, qrR, qrQTY,
-        tau, work, &lwork, _errors);
-    if(!_errors->isEmpty()) { return; }
+        copyDataToBuffer<interm, cpu>(&nFeatures, &nBetasIntercept, &nRows, dx, &nResponses, dy, qrBuffer, qtyBuffer);
+
+        computeQRForBlock<interm, cpu>(&nBetasIntercept, &nRows, qrBuffer, &nResponses, qtyBuffer, qrR, qrQTY,
+            tau, work, &lwork, _errors);
+        if(!_errors->isEmpty()) { return; }
 
-    x->releaseBlockOfRows(xBD);
-    y->releaseBlockOfRows(yBD);
+        x->releaseBlockOfRows(xBD);
+        y->releaseBlockOfRows(yBD);
+
+        daal::services::daal_free(qrBuffer);
+        daal::services::daal_free(qtyBuffer);
+    }
 
     if (isOnline)
     {
+        if (lwork < 0)
+        {
+            /* Work buffer for the merge was not allocated by the tall-skinny decomposition */
+            MKL_INT nMerge = 2 * nBetasIntercept;
+            mallocQRWorkBuffer<interm, cpu>(&nBetasIntercept, &nMerge, qrRMerge, &nResponses, qrQTYMerge, tau,
+                &work, &lwork, _errors);
+            if(!_errors->isEmpty()) { return; }
+        }
         mergeQR<interm, cpu>(&nBetasIntercept, &nResponses, qrR, qrQTY, qrROld, qrQTYOld,
                 qrRMerge, qrQTYMerge, qrR, qrQTY, tau, work, &lwork, _errors);
         if(!_errors->isEmpty()) { return; }
@@ -405,8 +603,6 @@ void updatePartialModelQR(SharedPtr<NumericTable> &x, SharedPtr<NumericTable> &y
         daal::services::daal_free(qrQTYMerge);
     }
     daal::services::daal_free(tau);
-    daal::services::daal_free(qrBuffer);
-    daal::services::daal_free(qtyBuffer);
     daal::services::daal_free(work);
 
     releaseModelQRPartialSums<interm, cpu>(rTable, rBD, qtyTable, qtyBD);
@@ -28,6 +28,8 @@
 #include <cmath>
 #include "service_math.h"
 #include "service_data_utils.h"
+#include "service_memory.h"
+#include "threading.h"
 
 namespace daal
 {
@@ -38,19 +40,17 @@ namespace logitboost
 namespace internal
 {
 
+const size_t logitBoostBlockSize = 1024;    /* Number of observations processed by a thread at once */
+
 /**
  *  \brief Update additive function's F values.
  *         Step 2.b) of the Algorithm 6 from [1] (page 356).
+ *         The observations are split into blocks processed in parallel
  *
  *  \param dim[in]          Number of features
  *  \param n[in]            Number of observations
  *  \param nc[in]           Number of classes
- *  \param x[in]            Input dataset
- *  \param xbm[in]          Buffer manager associated with input dataset
- *  \param splitFeature[in] Indices of the split features
- *  \param splitPoint[in]   Split points
- *  \param lMean[in]        "left" average sof weighted responses
- *  \param rMean[in]        "right" averages of weighted responses
+ *  \param pred[in]         Responses of the weak learners of size nc x n
  *  \param F[out]           Additive function's values (column-major format:
  *                          values for the first sample come first,
  *                          for the second - second, etc)
@@ -58,76 +58,94 @@ namespace internal
 template<typename algorithmFPType, CpuType cpu>
 void UpdateF(size_t dim, size_t n, size_t nc, algorithmFPType *pred, algorithmFPType *F)
 {
-    algorithmFPType s, r, rj;
     algorithmFPType inv_nc = 1.0 / (algorithmFPType)nc;
     algorithmFPType coef = (algorithmFPType)(nc - 1) / (algorithmFPType)nc;
 
-    for ( size_t i = 0; i < n; i++ )
+    size_t nBlocks = n / logitBoostBlockSize + !!(n % logitBoostBlockSize);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        for ( size_t j = 0; j < nc; j++ )
-        {
-            rj = pred[j * n + i];
-            s = rj;
+        size_t start = iBlock * logitBoostBlockSize;
+        size_t end = (start + logitBoostBlockSize > n) ? n : start + logitBoostBlockSize;
 
-            for( size_t k = 0; k < j; k++ )
+        for ( size_t i = start; i < end; i++ )
+        {
+            /* The sum of the responses over all classes is the same for every class */
+            algorithmFPType s = 0.0;
+            for ( size_t k = 0; k < nc; k++ )
             {
-                r = pred[k * n + i];
-                s += r;
+                s += pred[k * n + i];
             }
+            s *= inv_nc;
 
-            for( size_t k = j + 1; k < nc; k++ )
+            for ( size_t j = 0; j < nc; j++ )
             {
-                r = pred[k * n + i];
-                s += r;
+                F[i * nc + j] += coef * ( pred[j * n + i] - s );
             }
-
-            F[i * nc + j] += coef * ( rj - s * inv_nc );
         }
-    }
+    } );
 
     return;
 }
 
 /**
- *  \brief Update probailities matrix
+ *  \brief Update probailities matrix.
+ *         The observations are split into blocks processed in parallel,
+ *         the exponents are computed for a whole block at once
  *
  *  \param nc[in]   Number of classes
  *  \param n[in]    Number of observations
  *  \param F[in]    Values of additive function
  *  \param P[out]   Probailities matrix of size nc x n
+ *
+ *  \return false if memory allocation failed, true otherwise
  */
 template<typename algorithmFPType, CpuType cpu>
-void UpdateP( size_t nc, size_t n, algorithmFPType *F, algorithmFPType *P, algorithmFPType *Fbuf )
+bool UpdateP( size_t nc, size_t n, algorithmFPType *F, algorithmFPType *P )
 {
-    algorithmFPType s;
     algorithmFPType zero = (algorithmFPType)0.0;
     algorithmFPType overflowThreshold = daal::data_feature_utils::internal::MaxVal<algorithmFPType, cpu>::get();
 
-    for ( size_t i = 0; i < n; i++ )
+    daal::tls<algorithmFPType *> tlsFbuf( [ = ]()-> algorithmFPType *
     {
-        vExp<cpu>(nc, F + i * nc, Fbuf);
+        return (algorithmFPType *)daal::services::daal_malloc(logitBoostBlockSize * nc * sizeof(algorithmFPType));
+    } );
 
-        s = 0.0;
-        for ( size_t j = 0; j < nc; j++ )
-        {
-            s += Fbuf[j];
-        }
+    daal::threader_flag allocationFailed;
+    size_t nBlocks = n / logitBoostBlockSize + !!(n % logitBoostBlockSize);
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsFbuf, &allocationFailed](int iBlock)
+    {
+        algorithmFPType *Fbuf = tlsFbuf.local();
+        if (!Fbuf) { allocationFailed.set(); return; }
+
+        size_t start = iBlock * logitBoostBlockSize;
+        size_t nRows = (start + logitBoostBlockSize > n) ? n - start : logitBoostBlockSize;
 
-        s = (algorithmFPType)1.0 / s;
-        for ( size_t j = 0; j < nc; j++ )
+        /* Rows of F for the block are stored contiguously */
+        vExp<cpu>(nRows * nc, F + start * nc, Fbuf);
+
+        for ( size_t i = 0; i < nRows; i++ )
         {
-            if (Fbuf[j] > overflowThreshold)
+            algorithmFPType *Frow = Fbuf + i * nc;
+            algorithmFPType s = 0.0;
+            for ( size_t j = 0; j < nc; j++ )
             {
-                P[j * n + i] = zero;
+                s += Frow[j];
             }
-            else
+
+            s = (algorithmFPType)1.0 / s;
+            for ( size_t j = 0; j < nc; j++ )
             {
-                P[j * n + i] = Fbuf[j] * s;
+                P[j * n + start + i] = (Frow[j] > overflowThreshold ? zero : Frow[j] * s);
             }
         }
-    }
+    } );
 
-    return;
+    tlsFbuf.reduce( [ = ](algorithmFPType *Fbuf)
+    {
+        if (Fbuf) { daal::services::daal_free(Fbuf); }
+    } );
+
+    return !allocationFailed.isSet();
 }
 
 } // namespace daal::algorithms::logitboost::internal
@@ -69,7 +69,7 @@ void LogitBoostPredictKernel<defaultDense, algorithmFPType, cpu>::compute( servi
     }
     daal::services::internal::service_memset<algorithmFPType, cpu>(F, 0, n * nc);
 
-    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
+    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction->clone();
     learnerPredict->input.set(classifier::prediction::data, a);
 
     /* Calculate additive function values */
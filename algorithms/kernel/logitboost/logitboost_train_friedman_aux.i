@@ -39,6 +39,8 @@
 #define __LOGITBOOST_TRAIN_FRIEDMAN_AUX_I__
 
 #include "stump_train_impl.i"
+#include "service_defines.h"
+#include "threading.h"
 
 using namespace daal::algorithms::logitboost::internal;
 
@@ -54,7 +56,8 @@ namespace internal
 {
 
 /**
- *  \brief Update working responses and weights for current class
+ *  \brief Update working responses and weights for current class.
+ *         The observations are split into blocks processed in parallel
  *
  *  \param n[in]        Number of observations in training data set
  *  \param nc[in]       Number of classes in training data set
@@ -64,45 +67,62 @@ namespace internal
  *  \param thrW[in]     Threshold for weight calculations
  *  \param w[out]       Array of weights of size n
  *  \param thrZ[in]     Threshold for responses calculations
- *  \param w[out]       Array of responses of size n
+ *  \param z[out]       Array of responses of size n
+ *  \param partialSums[out] Work array with one element per block of observations
  */
 template<typename algorithmFPType, CpuType cpu>
 void initWZ(size_t n, size_t nc, size_t curClass, int *label, algorithmFPType *P,
-            algorithmFPType thrW, algorithmFPType *w, algorithmFPType thrZ, algorithmFPType *z)
+            algorithmFPType thrW, algorithmFPType *w, algorithmFPType thrZ, algorithmFPType *z,
+            algorithmFPType *partialSums)
 {
-
-    algorithmFPType sumW = 0.0;
-    algorithmFPType invSumW;
     algorithmFPType one = (algorithmFPType)1.0;
     algorithmFPType three = (algorithmFPType)3.0;
-    algorithmFPType negThree = (algorithmFPType)(-3.0);
     int iCurClass = (int)curClass;
     algorithmFPType *Pptr = P + curClass * n;
 
-    for ( size_t i = 0; i < n; i++ )
+    size_t nBlocks = n / logitBoostBlockSize + !!(n % logitBoostBlockSize);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
     {
-        algorithmFPType p = Pptr[i];
-        w[i] = p * (one - p);
-        if (thrW > w[i]) { w[i] = thrW; }
-        sumW += w[i];
+        size_t start = iBlock * logitBoostBlockSize;
+        size_t end = (start + logitBoostBlockSize > n) ? n : start + logitBoostBlockSize;
 
-        if (label[i] == iCurClass)
+        algorithmFPType sumW = 0.0;
+      PRAGMA_IVDEP
+        for ( size_t i = start; i < end; i++ )
         {
-            if (p > thrZ) { z[i] = one / p; }
-            else { z[i] = three; }
-        }
-        else
-        {
-            if (one - p > thrZ) { z[i] = -one / (one - p); }
-            else { z[i] = negThree; }
+            algorithmFPType p = Pptr[i];
+            algorithmFPType wi = p * (one - p);
+            wi = (thrW > wi ? thrW : wi);
+            w[i] = wi;
+            sumW += wi;
+
+            /* Responses are clipped to [-3, 3] in the degenerate cases */
+            algorithmFPType q = (label[i] == iCurClass ? p : one - p);
+            algorithmFPType sign = (label[i] == iCurClass ? one : -one);
+            z[i] = sign * (q > thrZ ? one / q : three);
         }
-    }
+        partialSums[iBlock] = sumW;
+    } );
 
-    invSumW = one / sumW;
-    for ( size_t i = 0; i < n; i++ )
+    /* Partial sums are added in the fixed order so that the result does not depend on the threads */
+    algorithmFPType sumW = 0.0;
+    for ( size_t iBlock = 0; iBlock < nBlocks; iBlock++ )
     {
-        w[i] *= invSumW;
+        sumW += partialSums[iBlock];
     }
+
+    algorithmFPType invSumW = one / sumW;
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        size_t start = iBlock * logitBoostBlockSize;
+        size_t end = (start + logitBoostBlockSize > n) ? n : start + logitBoostBlockSize;
+
+      PRAGMA_IVDEP
+        for ( size_t i = start; i < end; i++ )
+        {
+            w[i] *= invSumW;
+        }
+    } );
 }
 
 /**
@@ -114,18 +134,35 @@ void initWZ(size_t n, size_t nc, size_t curClass, int *label, algorithmFPType *P
  *  \param P[in]        Array of probabilities of size nc x n
  *  \param lCurPtr[out] Log-likelihood of the model
  *  \param accPtr[out]  Training accuracy
+ *  \param partialSums[out] Work array with one element per block of observations
  */
 template<typename algorithmFPType, CpuType cpu>
 void calculateAccuracy( size_t n, size_t nc, int *y_label, algorithmFPType *P,
-                        algorithmFPType *lCurPtr, algorithmFPType *accPtr )
+                        algorithmFPType *lCurPtr, algorithmFPType *accPtr, algorithmFPType *partialSums )
 {
     algorithmFPType acc, diff;
     algorithmFPType lPrev = *lCurPtr;
+
+    size_t nBlocks = n / logitBoostBlockSize + !!(n % logitBoostBlockSize);
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        size_t start = iBlock * logitBoostBlockSize;
+        size_t end = (start + logitBoostBlockSize > n) ? n : start + logitBoostBlockSize;
+
+        algorithmFPType lBlock = 0.0;
+        for ( size_t i = start; i < end; i++ )
+        {
+            lBlock -= sLog<cpu>(P[y_label[i] * n + i]);
+        }
+        partialSums[iBlock] = lBlock;
+    } );
+
     algorithmFPType lCur = 0.0;
-    for ( size_t i = 0; i < n; i++)
+    for ( size_t iBlock = 0; iBlock < nBlocks; iBlock++ )
     {
-        lCur -= sLog<cpu>(P[y_label[i] * n + i]);
+        lCur += partialSums[iBlock];
     }
+
     diff = sFabs<algorithmFPType, cpu>(lPrev - lCur);
     acc  = sMin<algorithmFPType, cpu>( diff, diff / (lPrev + (algorithmFPType)1e-6) );
     *accPtr = acc;
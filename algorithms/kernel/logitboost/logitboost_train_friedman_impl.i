@@ -68,8 +68,8 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
     algorithmFPType thrW, thrZ;
     algorithmFPType logL = 0.0;
 
-    algorithmFPType *pred, *F, *P, *Fbuf;
-    algorithmFPType inv_n, inv_nc;
+    algorithmFPType *pred, *F, *P, *W, *Z, *partialSums;
+    algorithmFPType inv_nc;
     algorithmFPType fp_one = (algorithmFPType)1.0;
     Parameter *parameter = const_cast<Parameter *>(par);
     services::SharedPtr<NumericTable> x = a[0];
@@ -83,28 +83,30 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
     dim = x->getNumberOfColumns();
     n   = x->getNumberOfRows();
 
+    size_t nBlocks = n / logitBoostBlockSize + !!(n % logitBoostBlockSize);
+
     pred = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
     F    = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
-    Fbuf = (algorithmFPType *) daal::services::daal_malloc (    nc * sizeof(algorithmFPType));
     P    = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
+    W    = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
+    Z    = (algorithmFPType *) daal::services::daal_malloc (n * nc * sizeof(algorithmFPType));
+    partialSums = (algorithmFPType *) daal::services::daal_malloc (nBlocks * sizeof(algorithmFPType));
 
-    if (!pred || !F || !P || !Fbuf)
+    if (!pred || !F || !P || !W || !Z || !partialSums)
     {
+        daal::services::daal_free (pred);
+        daal::services::daal_free (F);
+        daal::services::daal_free (P);
+        daal::services::daal_free (W);
+        daal::services::daal_free (Z);
+        daal::services::daal_free (partialSums);
         this->_errors->add(services::ErrorMemoryAllocationFailed); return;
     }
-    services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > wTable(
-        new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(1, n));
-    services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > zTable(
-        new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(1, n));
-    algorithmFPType *w = wTable->getArray();
-    algorithmFPType *z = zTable->getArray();
-
-    inv_n  = fp_one / (algorithmFPType)n;
+
     inv_nc = fp_one / (algorithmFPType)nc;
 
     /* Initialize weights, probs and additive function values.
        Step 1) of the Algorithm 6 from [1] */
-    for ( size_t i = 0; i < n; i++ ) { w[i] = inv_n; }
     for ( size_t i = 0; i < n * nc; i++ ) { P[i] = inv_nc; }
     for ( size_t i = 0; i < n; i++)
     {
@@ -122,13 +124,33 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
     y->getBlockOfColumnValues( 0, 0, n, readOnly, block );
     y_label = block.getBlockPtr();
 
-    services::SharedPtr<weak_learner::training::Batch>   learnerTrain   = parameter->weakLearnerTraining;
-    learnerTrain->input.set(classifier::training::data,    x);
-    learnerTrain->input.set(classifier::training::labels,  zTable);
-    learnerTrain->input.set(classifier::training::weights, wTable);
+    /* The weak learners for different classes are independent within an iteration,
+       so every class gets its own copies of the training and prediction algorithms,
+       and its own weights, responses and predictions */
+    services::Collection<services::SharedPtr<weak_learner::training::Batch> >   learnerTrain(nc);
+    services::Collection<services::SharedPtr<weak_learner::prediction::Batch> > learnerPredict(nc);
+    services::Collection<services::SharedPtr<weak_learner::Model> >             learnerModel(nc);
 
-    services::SharedPtr<weak_learner::prediction::Batch> learnerPredict = parameter->weakLearnerPrediction;
-    learnerPredict->input.set(classifier::prediction::data, x);
+    for ( size_t j = 0; j < nc; j++ )
+    {
+        services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > wTable(
+            new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(W + j * n, 1, n));
+        services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > zTable(
+            new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(Z + j * n, 1, n));
+        services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > predTable(
+            new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(pred + j * n, 1, n));
+
+        learnerTrain[j] = parameter->weakLearnerTraining->clone();
+        learnerTrain[j]->input.set(classifier::training::data,    x);
+        learnerTrain[j]->input.set(classifier::training::labels,  zTable);
+        learnerTrain[j]->input.set(classifier::training::weights, wTable);
+
+        services::SharedPtr<classifier::prediction::Result> predictionRes(new classifier::prediction::Result());
+        predictionRes->set(classifier::prediction::prediction, predTable);
+        learnerPredict[j] = parameter->weakLearnerPrediction->clone();
+        learnerPredict[j]->input.set(classifier::prediction::data, x);
+        learnerPredict[j]->setResult(predictionRes);
+    }
 
     /* Clear the collection of weak learners models in the boosting model */
     r->clearWeakLearnerModels();
@@ -137,28 +159,29 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
        Step 2) of the Algorithm 6 from [1] */
     for ( size_t m = 0; m < M; m++ )
     {
-        /* Repeat for j = 0, 1, ..., nk-1
-           Step 2.a) of the Algorithm 6 from [1] */
         for ( size_t j = 0; j < nc; j++ )
         {
-            initWZ<algorithmFPType, cpu>(n, nc, j, y_label, P, thrW, w, thrZ, z);
+            initWZ<algorithmFPType, cpu>(n, nc, j, y_label, P, thrW, W + j * n, thrZ, Z + j * n, partialSums);
+        }
 
-            learnerTrain->resetResult();
-            learnerTrain->compute();
-            services::SharedPtr<classifier::training::Result> trainingRes = learnerTrain->getResult();
-            services::SharedPtr<weak_learner::Model> learnerModel =
+        /* Repeat for j = 0, 1, ..., nk-1
+           Step 2.a) of the Algorithm 6 from [1] */
+        daal::threader_for(nc, nc, [ =, &learnerTrain, &learnerPredict, &learnerModel](int j)
+        {
+            learnerTrain[j]->resetResult();
+            learnerTrain[j]->compute();
+            services::SharedPtr<classifier::training::Result> trainingRes = learnerTrain[j]->getResult();
+            learnerModel[j] =
                 services::staticPointerCast<weak_learner::Model, classifier::Model>(trainingRes->get(classifier::training::model));
 
-            /* Add new model to the collection of the boosting algorithm models */
-            r->addWeakLearnerModel(learnerModel);
+            learnerPredict[j]->input.set(classifier::prediction::model, learnerModel[j]);
+            learnerPredict[j]->compute();
+        } );
 
-            learnerPredict->input.set(classifier::prediction::model, learnerModel);
-            services::SharedPtr<daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu> > predTable(
-                new daal::internal::HomogenNumericTableCPU<algorithmFPType, cpu>(pred + j * n, 1, n));
-            services::SharedPtr<classifier::prediction::Result> predictionRes(new classifier::prediction::Result());
-            predictionRes->set(classifier::prediction::prediction, predTable);
-            learnerPredict->setResult(predictionRes);
-            learnerPredict->compute();
+        /* Add new models to the collection of the boosting algorithm models in the order of classes */
+        for ( size_t j = 0; j < nc; j++ )
+        {
+            r->addWeakLearnerModel(learnerModel[j]);
         }
 
         /* Update additive function's values
@@ -168,10 +191,14 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
 
         /* Update probabilities
            Step 2.c) of the Algorithm 6 from [1] */
-        UpdateP<algorithmFPType, cpu>( nc, n, F, P, Fbuf );
+        if (!UpdateP<algorithmFPType, cpu>( nc, n, F, P ))
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            break;
+        }
 
         /* Calculate model accuracy */
-        calculateAccuracy<algorithmFPType, cpu>( n, nc, y_label, P, &logL, &accCur );
+        calculateAccuracy<algorithmFPType, cpu>( n, nc, y_label, P, &logL, &accCur, partialSums );
 
         if (accCur < acc)
         {
@@ -184,8 +211,10 @@ void LogitBoostTrainKernel<friedman, algorithmFPType, cpu>::compute(const size_t
 
     daal::services::daal_free (pred);
     daal::services::daal_free (F);
-    daal::services::daal_free (Fbuf);
     daal::services::daal_free (P);
+    daal::services::daal_free (W);
+    daal::services::daal_free (Z);
+    daal::services::daal_free (partialSums);
 }
 
 } // namepsace internal
@@ -72,6 +72,28 @@ void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
     /* Compute data size needed to store the largest subset of input tables */
     size_t nSubsetVectors, dataSize;
     computeDataSize(nVectors, nFeatures, nClasses, xTable, y, &nSubsetVectors, &dataSize);
+    if (!this->_errors->isEmpty()) { mtY.release(); return; }
+
+    /* Find the rows of every class once, so the subsets are built without scanning the whole data set */
+    size_t *classOffsets = (size_t *)daal::services::daal_malloc((nClasses + 1 + nVectors) * sizeof(size_t));
+    if (!classOffsets) { this->_errors->add(services::ErrorMemoryAllocationFailed); mtY.release(); return; }
+    size_t *classRows = classOffsets + nClasses + 1;
+    computeClassRows(nVectors, nClasses, y, classOffsets, classRows);
+
+    /* Retrieve the input data once for all the threads */
+    const bool isCSR = (xTable->getDataLayout() == NumericTableIface::csrArray);
+    CSRBlockMicroTable<algorithmFPType, readOnly, cpu> mtXCSR(xTable);
+    BlockMicroTable<algorithmFPType, readOnly, cpu> mtX(xTable);
+    algorithmFPType *x = NULL;
+    size_t *colIndices = NULL, *rowOffsets = NULL;
+    if (isCSR)
+    {
+        mtXCSR.getSparseBlock(0, nVectors, &x, &colIndices, &rowOffsets);
+    }
+    else
+    {
+        mtX.getBlockOfRows(0, nVectors, &x);
+    }
 
     /* Allocate memory for storing subsets of input data */
     daal::tls<MultiClassClassifierTls<algorithmFPType, cpu> *> subset([=]()
@@ -105,34 +127,35 @@ void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
         services::SharedPtr<NumericTable> subsetXTable = subsetLocal->subsetXTable;
         services::SharedPtr<NumericTable> subsetYTable = subsetLocal->subsetYTable;
 
+        const size_t *positiveRows = classRows + classOffsets[i];
+        const size_t *negativeRows = classRows + classOffsets[j];
+        size_t nPositiveRows = classOffsets[i + 1] - classOffsets[i];
+        size_t nNegativeRows = classOffsets[j + 1] - classOffsets[j];
+
         size_t nTotal, nPositive, nNegative;
-        if (xTable->getDataLayout() == NumericTableIface::csrArray)
+        if (isCSR)
         {
-            CSRBlockMicroTable<algorithmFPType, readOnly, cpu> *mtX =
-                static_cast<CSRBlockMicroTable<algorithmFPType, readOnly, cpu> *>(subsetLocal->mtX);
             /* Prepare "positive" observations of the training subset */
             size_t positiveDataSize;
             rowOffsetsX[0] = 1;
-            copyDataIntoSubtable(nFeatures, nVectors, i, 1, *mtX, y, subsetX, colIndicesX, rowOffsetsX,
-                                 subsetY, &nPositive, &positiveDataSize);
+            copyDataIntoSubtable(nFeatures, nPositiveRows, positiveRows, 1, x, colIndices, rowOffsets,
+                                 subsetX, colIndicesX, rowOffsetsX, subsetY, &nPositive, &positiveDataSize);
 
             /* Prepare "negative" observations of the training subset */
             size_t negativeDataSize;
-            copyDataIntoSubtable(nFeatures, nVectors, j, -1, *mtX, y,
+            copyDataIntoSubtable(nFeatures, nNegativeRows, negativeRows, -1, x, colIndices, rowOffsets,
                                  subsetX + positiveDataSize, colIndicesX + positiveDataSize, rowOffsetsX + nPositive,
                                  subsetY + nPositive, &nNegative, &negativeDataSize);
         }
         else
         {
-            BlockMicroTable<algorithmFPType, readOnly, cpu> *mtX =
-                static_cast<BlockMicroTable<algorithmFPType, readOnly, cpu> *>(subsetLocal->mtX);
             /* Prepare "positive" observations of the training subset */
             size_t positiveDataSize;
-            copyDataIntoSubtable(nFeatures, nVectors, i, 1, *mtX, y, subsetX, subsetY, &nPositive, &positiveDataSize);
+            copyDataIntoSubtable(nFeatures, nPositiveRows, positiveRows, 1, x, subsetX, subsetY, &nPositive, &positiveDataSize);
 
             /* Prepare "negative" observations of the training subset */
             size_t negativeDataSize;
-            copyDataIntoSubtable(nFeatures, nVectors, j, -1, *mtX, y,
+            copyDataIntoSubtable(nFeatures, nNegativeRows, negativeRows, -1, x,
                                  subsetX + positiveDataSize, subsetY + nPositive, &nNegative, &negativeDataSize);
         }
         nTotal = nPositive + nNegative;
@@ -166,6 +189,9 @@ void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
         delete subsetLocal;
     } );
 
+    if (isCSR) { mtXCSR.release(); }
+    else       { mtX.release(); }
+    daal::services::daal_free(classOffsets);
     mtY.release();
 }
 
@@ -218,67 +244,80 @@ void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
     daal::services::daal_free(buffer);
 }
 
+/* Sorts the indices of the rows by class keeping their order within a class: the rows of the class i
+   are classRows[classOffsets[i]], ..., classRows[classOffsets[i + 1] - 1] */
+template<typename algorithmFPType, CpuType cpu>
+void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
+    computeClassRows(size_t nVectors, size_t nClasses, const int *y, size_t *classOffsets, size_t *classRows)
+{
+    for (size_t i = 0; i <= nClasses; i++)
+    {
+        classOffsets[i] = 0;
+    }
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        classOffsets[y[i] + 1]++;
+    }
+    for (size_t i = 0; i < nClasses; i++)
+    {
+        classOffsets[i + 1] += classOffsets[i];
+    }
+    for (size_t i = 0; i < nVectors; i++)
+    {
+        classRows[classOffsets[y[i]]++] = i;
+    }
+    for (size_t i = nClasses; i > 0; i--)
+    {
+        classOffsets[i] = classOffsets[i - 1];
+    }
+    classOffsets[0] = 0;
+}
+
 template<typename algorithmFPType, CpuType cpu>
 void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
-    copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                         BlockMicroTable  <algorithmFPType, readOnly, cpu> &mtX,
-                         const int *y, algorithmFPType *subsetX, algorithmFPType *subsetY,
+    copyDataIntoSubtable(size_t nFeatures, size_t nClassRows, const size_t *classRows, algorithmFPType label,
+                         const algorithmFPType *x, algorithmFPType *subsetX, algorithmFPType *subsetY,
                          size_t *nRowsPtr, size_t *dataSize)
 {
-    size_t nRows = 0;
-    algorithmFPType *xRow;
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t ix = 0; ix < nClassRows; ix++)
     {
-        if (y[ix] == classIdx)
+        const algorithmFPType *xRow = x + classRows[ix] * nFeatures;
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t jx = 0; jx < nFeatures; jx++)
         {
-            mtX.getBlockOfRows(ix, 1, &xRow);
-          PRAGMA_IVDEP
-          PRAGMA_VECTOR_ALWAYS
-            for (size_t jx = 0; jx < nFeatures; jx++)
-            {
-                subsetX[nRows * nFeatures + jx] = xRow[jx];
-            }
-            subsetY[nRows] = label;
-            mtX.release();
-            nRows++;
+            subsetX[ix * nFeatures + jx] = xRow[jx];
         }
+        subsetY[ix] = label;
     }
-    *nRowsPtr = nRows;
-    *dataSize = nRows * nFeatures;
+    *nRowsPtr = nClassRows;
+    *dataSize = nClassRows * nFeatures;
 }
 
 template<typename algorithmFPType, CpuType cpu>
 void MultiClassClassifierTrainKernel<oneAgainstOne, algorithmFPType, cpu>::
-    copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                         CSRBlockMicroTable<algorithmFPType, readOnly, cpu> &mtX,
-                         const int *y, algorithmFPType *subsetX, size_t *colIndicesX, size_t *rowOffsetsX,
+    copyDataIntoSubtable(size_t nFeatures, size_t nClassRows, const size_t *classRows, algorithmFPType label,
+                         const algorithmFPType *values, const size_t *colIndices, const size_t *rowOffsets,
+                         algorithmFPType *subsetX, size_t *colIndicesX, size_t *rowOffsetsX,
                          algorithmFPType *subsetY, size_t *nRowsPtr, size_t *dataSize)
 {
-    size_t nRows = 0;
-    algorithmFPType *xRow;
-    size_t *colIndices, *rowOffsets;
     size_t dataIndex = 0;
-    for (size_t ix = 0; ix < nVectors; ix++)
+    for (size_t ix = 0; ix < nClassRows; ix++)
     {
-        if (y[ix] == classIdx)
+        size_t startIndex = rowOffsets[classRows[ix]] - 1;
+        size_t nNonZeroValuesInRow = rowOffsets[classRows[ix] + 1] - rowOffsets[classRows[ix]];
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for (size_t jx = 0; jx < nNonZeroValuesInRow; jx++, dataIndex++)
         {
-            mtX.getSparseBlock(ix, 1, &xRow, &colIndices, &rowOffsets);
-            size_t nNonZeroValuesInRow = rowOffsets[1] - rowOffsets[0];
-          PRAGMA_IVDEP
-          PRAGMA_VECTOR_ALWAYS
-            for (size_t jx = 0; jx < nNonZeroValuesInRow; jx++, dataIndex++)
-            {
-                subsetX[dataIndex] = xRow[jx];
-                colIndicesX[dataIndex] = colIndices[jx];
-            }
-            rowOffsetsX[nRows + 1] = rowOffsetsX[nRows] + nNonZeroValuesInRow;
-            subsetY[nRows] = label;
-            mtX.release();
-            nRows++;
+            subsetX[dataIndex] = values[startIndex + jx];
+            colIndicesX[dataIndex] = colIndices[startIndex + jx];
         }
+        rowOffsetsX[ix + 1] = rowOffsetsX[ix] + nNonZeroValuesInRow;
+        subsetY[ix] = label;
     }
-    *nRowsPtr = nRows;
-    *dataSize = rowOffsetsX[nRows] - rowOffsetsX[0];
+    *nRowsPtr = nClassRows;
+    *dataSize = rowOffsetsX[nClassRows] - rowOffsetsX[0];
 }
 
 } // namespace internal
@@ -63,28 +63,25 @@ struct MultiClassClassifierTls
         this->simpleTraining = simpleTraining->clone();
         if (xTable->getDataLayout() == NumericTableIface::csrArray)
         {
-            colIndicesX = (size_t *)daal::services::daal_malloc((dataSize + nSubsetVectors + 1) * sizeof(algorithmFPType));
+            colIndicesX = (size_t *)daal::services::daal_malloc((dataSize + nSubsetVectors + 1) * sizeof(size_t));
             if (!colIndicesX) { error.setId(services::ErrorMemoryAllocationFailed); return; }
             rowOffsetsX = colIndicesX + dataSize;
             subsetXTable = services::SharedPtr<NumericTable>(
                     new CSRNumericTable(subsetX, colIndicesX, rowOffsetsX, nFeatures));
-            mtX = new CSRBlockMicroTable<algorithmFPType, readOnly, cpu>(xTable);
         }
         else
         {
             colIndicesX = NULL;
             subsetXTable = services::SharedPtr<NumericTable>(
                 new HomogenNumericTableCPU<algorithmFPType, cpu> (subsetX, nFeatures, nSubsetVectors));
-            mtX = new BlockMicroTable<algorithmFPType, readOnly, cpu>(xTable);
         }
-        if (!subsetXTable || !mtX) { error.setId(services::ErrorMemoryAllocationFailed); return; }
+        if (!subsetXTable) { error.setId(services::ErrorMemoryAllocationFailed); return; }
     }
 
     virtual ~MultiClassClassifierTls()
     {
         daal::services::daal_free(subsetX);
         if (colIndicesX) daal::services::daal_free(colIndicesX);
-        delete mtX;
     }
 
     algorithmFPType *subsetX;
@@ -93,7 +90,6 @@ struct MultiClassClassifierTls
     size_t *rowOffsetsX;
     services::SharedPtr<NumericTable> subsetXTable;
     services::SharedPtr<NumericTable> subsetYTable;
-    MicroTable *mtX;
     services::SharedPtr<classifier::training::Batch> simpleTraining;
     services::Error error;
 };
@@ -108,14 +104,15 @@ protected:
     void computeDataSize(size_t nVectors, size_t nFeatures, size_t nClasses,
                 const NumericTable *xTable, int *y, size_t *nSubsetVectorsPtr, size_t *dataSizePtr);
 
-    void copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                              BlockMicroTable  <algorithmFPType, readOnly, cpu> &mtX,
-                              const int *y, algorithmFPType *subsetX, algorithmFPType *subsetY,
+    void computeClassRows(size_t nVectors, size_t nClasses, const int *y, size_t *classOffsets, size_t *classRows);
+
+    void copyDataIntoSubtable(size_t nFeatures, size_t nClassRows, const size_t *classRows, algorithmFPType label,
+                              const algorithmFPType *x, algorithmFPType *subsetX, algorithmFPType *subsetY,
                               size_t *nRowsPtr, size_t *dataSize);
 
-    void copyDataIntoSubtable(size_t nFeatures, size_t nVectors, int classIdx, algorithmFPType label,
-                              CSRBlockMicroTable<algorithmFPType, readOnly, cpu> &mtX,
-                              const int *y, algorithmFPType *subsetX, size_t *colIndicesX, size_t *rowOffsetsX,
+    void copyDataIntoSubtable(size_t nFeatures, size_t nClassRows, const size_t *classRows, algorithmFPType label,
+                              const algorithmFPType *values, const size_t *colIndices, const size_t *rowOffsets,
+                              algorithmFPType *subsetX, size_t *colIndicesX, size_t *rowOffsetsX,
                               algorithmFPType *subsetY, size_t *nRowsPtr, size_t *dataSize);
 };
 
@@ -95,19 +95,8 @@ void NaiveBayesPredictKernel<interm, method, cpu>::compute(const NumericTable *a
     size_t nBlocks = n / blockSizeDeafult;
     nBlocks += (nBlocks * blockSizeDeafult != n);
 
-    daal::tls<interm *> mkl_buff( [ = ]()-> interm* { return service_calloc<interm, cpu>(blockSizeDeafult * c); } );
-
-    daal::threader_for( nBlocks, nBlocks, [ =, &mkl_buff ](int k)
+    auto predictBlock = [ = ](size_t j0, size_t jn, interm *buff)
     {
-        interm *buff =  mkl_buff.local();
-
-        size_t jn = blockSizeDeafult;
-        if( k == nBlocks - 1 )
-        {
-            jn = n - k * blockSizeDeafult;
-        }
-        size_t j0 = k * blockSizeDeafult;
-
         BlockDescriptor<int>    classesBlock;
         ntClass->getBlockOfRows( j0, jn, writeOnly, classesBlock );
         int *classes = classesBlock.getBlockPtr();
@@ -115,9 +104,47 @@ void NaiveBayesPredictKernel<interm, method, cpu>::compute(const NumericTable *a
         methodSpecific<method, interm, cpu>::getPredictionData( aux_table, ntData, j0, jn, p, c, classes, buff );
 
         ntClass->releaseBlockOfRows( classesBlock );
-    } );
+    };
 
-    mkl_buff.reduce( [ = ](interm * v)-> void { daal::services::daal_free( v ); } );
+    if( nBlocks == 1 )
+    {
+        /* Small batches are scored in the calling thread, so the latency does not include threading overhead */
+        interm *buff = (interm *)daal::services::daal_malloc( n * c * sizeof(interm) );
+        if( !buff )
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+        }
+        else
+        {
+            predictBlock( 0, n, buff );
+            daal::services::daal_free( buff );
+        }
+    }
+    else if( nBlocks > 1 )
+    {
+        /* The buffers are fully overwritten by the matrix multiplication, so they are not zeroed */
+        daal::tls<interm *> mkl_buff( [ = ]()-> interm* { return (interm *)daal::services::daal_malloc( blockSizeDeafult * c * sizeof(interm) ); } );
+
+        daal::threader_flag allocationFailed;
+        daal::threader_for( nBlocks, nBlocks, [ =, &mkl_buff, &allocationFailed ](int k)
+        {
+            interm *buff =  mkl_buff.local();
+            if( !buff ) { allocationFailed.set(); return; }
+
+            size_t jn = blockSizeDeafult;
+            if( k == nBlocks - 1 )
+            {
+                jn = n - k * blockSizeDeafult;
+            }
+            size_t j0 = k * blockSizeDeafult;
+
+            predictBlock( j0, jn, buff );
+        } );
+
+        mkl_buff.reduce( [ = ](interm * v)-> void { if( v ) { daal::services::daal_free( v ); } } );
+
+        if( allocationFailed.isSet() ) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+    }
 
     ntAuxTable->releaseBlockOfRows( auxTableBlock );
 
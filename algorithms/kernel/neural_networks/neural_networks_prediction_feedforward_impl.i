@@ -24,6 +24,11 @@
 #ifndef __NEURAL_NETWORKS_PREDICTION_FEEDFORWARD_IMPL_I__
 #define __NEURAL_NETWORKS_PREDICTION_FEEDFORWARD_IMPL_I__
 
+#include "service_math.h"
+#include "threading.h"
+#include "neural_networks_prediction_memory_planner.h"
+
+using namespace daal::internal;
 using namespace daal::services;
 
 namespace daal
@@ -40,48 +45,83 @@ namespace internal
 
 namespace
 {
-template<typename algorithmFPType>
-SharedPtr<HomogenTensor<algorithmFPType> > getSample(const size_t firstElement, const size_t nElements, const SharedPtr<Tensor> tensor)
+/**
+ *  Allocates the results of the layers for the batch of samples set in the input of the first layer
+ *  and connects the results with the inputs of the next layers
+ */
+void allocateLayersForBatch(const SharedPtr<ForwardLayers> &forwardLayers, const SharedPtr<Collection<NextLayers> > &nextLayers)
 {
-    SubtensorDescriptor<algorithmFPType> tensorBlock;
-    tensor->getSubtensor(0, 0, firstElement, nElements, readOnly, tensorBlock);
-    algorithmFPType *sampleArray = tensorBlock.getPtr();
-
-    Collection<size_t> tensorSize = tensor->getDimensions();
-    Collection<size_t> sampleSize;
-    sampleSize.push_back(nElements);
-    for(size_t i = 1; i < tensorSize.size(); i++) { sampleSize.push_back(tensorSize[i]); }
-
-    SharedPtr<HomogenTensor<algorithmFPType> > sample(new HomogenTensor<algorithmFPType>(sampleSize, sampleArray));
-    tensor->releaseSubtensor(tensorBlock);
-    return sample;
+    size_t nLayers = forwardLayers->size();
+
+    resetLayerInputCollections(forwardLayers);
+    for(size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        SharedPtr<forward::LayerIface> layer = forwardLayers->get(layerId);
+        layer->allocateResult();
+        connectNextLayers(forwardLayers, nextLayers->get(layerId), layer->getLayerResult());
+    }
 }
 
-template<typename algorithmFPType>
-SharedPtr<HomogenTensor<algorithmFPType> > getSampleValue(const size_t firstElement, const size_t nElements, const SharedPtr<Tensor> tensor)
+/**
+ *  Applies the activation function to the block of values in place
+ */
+template<typename algorithmFPType, CpuType cpu>
+void applyActivation(LayerActivation activation, size_t size, algorithmFPType *values)
 {
-    SubtensorDescriptor<algorithmFPType> tensorBlock;
-    tensor->getSubtensor(0, 0, firstElement, nElements, readOnly, tensorBlock);
-    algorithmFPType *sampleArray = tensorBlock.getPtr();
-
-    Collection<size_t> tensorSize = tensor->getDimensions();
-
-    tensorSize[0] = nElements;
-
-    SharedPtr<HomogenTensor<algorithmFPType> > sample(new HomogenTensor<algorithmFPType>(tensorSize, Tensor::doAllocate));
-
-    SubtensorDescriptor<algorithmFPType> sampleBlock;
-    sample->getSubtensor(0, 0, 0, nElements, writeOnly, sampleBlock);
-    algorithmFPType *sampleData = sampleBlock.getPtr();
-
-    size_t size = tensorBlock.getSize();
-    for (int i = 0; i < size; i++) {
-        sampleData[i] = sampleArray[i];
+    const algorithmFPType zero = (algorithmFPType)0.0;
+    const algorithmFPType one  = (algorithmFPType)1.0;
+    if(activation == reluActivation)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < size; i++)
+        {
+            values[i] = (values[i] > zero ? values[i] : zero);
+        }
+    }
+    else if(activation == tanhActivation)
+    {
+        vTanh<cpu>(size, values, values);
+    }
+    else if(activation == logisticActivation)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < size; i++)
+        {
+            values[i] = -values[i];
+        }
+        vExp<cpu>(size, values, values);
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < size; i++)
+        {
+            values[i] = one / (one + values[i]);
+        }
     }
+}
 
-    tensor->releaseSubtensor(tensorBlock);
-    sample->releaseSubtensor(sampleBlock);
-    return sample;
+/**
+ *  Applies the activation function fused into the layer to the value of the layer in place
+ */
+template<typename algorithmFPType, CpuType cpu>
+void applyFusedActivation(LayerActivation activation, const SharedPtr<Tensor> &value)
+{
+    SubtensorDescriptor<algorithmFPType> valueBlock;
+    value->getSubtensor(0, 0, 0, value->getDimensionSize(0), readWrite, valueBlock);
+    algorithmFPType *valueArray = valueBlock.getPtr();
+    const size_t size = valueBlock.getSize();
+
+    const size_t blockSize = 4096;
+    const size_t nBlocks = (size + blockSize - 1) / blockSize;
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        const size_t start = iBlock * blockSize;
+        const size_t end = (start + blockSize < size ? start + blockSize : size);
+        applyActivation<algorithmFPType, cpu>(activation, end - start, valueArray + start);
+    } );
+
+    value->releaseSubtensor(valueBlock);
 }
 }
 
@@ -93,25 +133,104 @@ void NeuralNetworksFeedforwardPredictionKernel<algorithmFPType, method, cpu>::co
     const Input *input, const neural_networks::prediction::Parameter *parameter, Result *result)
 {
     SharedPtr<Model> model = input->get(prediction::model);
+    /* The network is optimized for the prediction once, on the first computation with the model */
+    model->optimize();
+
     SharedPtr<ForwardLayers> forwardLayers = model->getLayers();
+    SharedPtr<Collection<NextLayers> > nextLayers = model->getNextLayers();
+    SharedPtr<Collection<LayerActivation> > fusedActivations = model->getFusedActivations();
     size_t nLayers = forwardLayers->size();
+    size_t nFusedActivations = (fusedActivations ? fusedActivations->size() : 0);
+    SharedPtr<forward::LayerIface> firstLayer = forwardLayers->get(0);
+    SharedPtr<forward::LayerIface> lastLayer  = forwardLayers->get(nLayers - 1);
 
     SharedPtr<Tensor> data = input->get(prediction::data);
     SharedPtr<Tensor> predictionResults = result->get(prediction::prediction);
     size_t nSamples = data->getDimensions().get(0);
+    size_t batchSize = (parameter->batchSize < nSamples ? parameter->batchSize : nSamples);
+
+    Collection<size_t> batchDims = data->getDimensions();
+    Collection<size_t> predictionBatchDims = predictionResults->getDimensions();
 
-    for(size_t i = 0; i < nSamples; i++)
+    /* The layers are computed on the blocks of contiguous samples that are accessed without copying */
+    ActivationMemoryPlanner<algorithmFPType, cpu> planner;
+    size_t nPlannedBytes = 0;
+    size_t nNaiveBytes = 0;
+    size_t allocatedBatchSize = 0;
+    for(size_t firstSample = 0; firstSample < nSamples; firstSample += batchSize)
     {
-        SharedPtr<HomogenTensor<algorithmFPType> > sample = getSampleValue<algorithmFPType>(i, 1, data);
-        SharedPtr<HomogenTensor<algorithmFPType> > predictionSample = getSample<algorithmFPType>(i, 1, predictionResults);
+        size_t nBatchSamples = (firstSample + batchSize < nSamples ? batchSize : nSamples - firstSample);
+        batchDims[0] = nBatchSamples;
+        predictionBatchDims[0] = nBatchSamples;
 
-        forwardLayers->get(0)->getLayerInput()->set(forward::data, sample);
-        forwardLayers->get(nLayers - 1)->getLayerResult()->set(forward::value, predictionSample);
+        SubtensorDescriptor<algorithmFPType> dataBlock;
+        data->getSubtensor(0, 0, firstSample, nBatchSamples, readOnly, dataBlock);
+        SubtensorDescriptor<algorithmFPType> predictionBlock;
+        predictionResults->getSubtensor(0, 0, firstSample, nBatchSamples, writeOnly, predictionBlock);
+
+        firstLayer->getLayerInput()->set(forward::data,
+                                         SharedPtr<Tensor>(new HomogenTensor<algorithmFPType>(batchDims, dataBlock.getPtr())));
+
+        /* Buffers of the intermediate layers are reallocated only when the number of samples in the batch changes */
+        if(nBatchSamples != allocatedBatchSize)
+        {
+            if(parameter->reuseActivationMemory)
+            {
+                if(!planner.allocate(forwardLayers, nextLayers))
+                {
+                    data->releaseSubtensor(dataBlock);
+                    predictionResults->releaseSubtensor(predictionBlock);
+                    this->_errors->add(ErrorMemoryAllocationFailed);
+                    return;
+                }
+            }
+            else
+            {
+                allocateLayersForBatch(forwardLayers, nextLayers);
+            }
+
+            /* The footprint is reported for the first batch, which is the largest one */
+            if(allocatedBatchSize == 0)
+            {
+                nPlannedBytes = (parameter->reuseActivationMemory ? planner.getPlannedSize() :
+                                 getNumberOfElementsInActivations(forwardLayers, nextLayers) * sizeof(algorithmFPType));
+                nNaiveBytes   = (parameter->reuseActivationMemory ? planner.getNaiveSize() : nPlannedBytes);
+            }
+            allocatedBatchSize = nBatchSamples;
+        }
+        else
+        {
+            firstLayer->allocateLayerData();
+        }
+
+        lastLayer->getLayerResult()->set(forward::value,
+                                         SharedPtr<Tensor>(new HomogenTensor<algorithmFPType>(predictionBatchDims, predictionBlock.getPtr())));
+        lastLayer->allocateLayerData();
 
         for(size_t layerId = 0; layerId < nLayers; layerId++)
         {
             forwardLayers->get(layerId)->compute();
+            if(layerId < nFusedActivations && (*fusedActivations)[layerId] != noActivation)
+            {
+                applyFusedActivation<algorithmFPType, cpu>((*fusedActivations)[layerId],
+                                                           forwardLayers->get(layerId)->getLayerResult()->get(forward::value));
+            }
         }
+
+        data->releaseSubtensor(dataBlock);
+        predictionResults->releaseSubtensor(predictionBlock);
+    }
+
+    SharedPtr<Tensor> activationMemory = result->get(prediction::activationMemory);
+    if(activationMemory)
+    {
+        /* Byte counts are reported in double since float cannot represent them exactly */
+        SubtensorDescriptor<double> memoryBlock;
+        activationMemory->getSubtensor(0, 0, 0, activationMemory->getDimensionSize(0), writeOnly, memoryBlock);
+        double *memoryArray = memoryBlock.getPtr();
+        memoryArray[0] = (double)nPlannedBytes;
+        memoryArray[1] = (double)nNaiveBytes;
+        activationMemory->releaseSubtensor(memoryBlock);
     }
 }
 
@@ -0,0 +1,369 @@
+/* file: neural_networks_prediction_memory_planner.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+//++
+//  Declaration of the planner of the memory for the values of the layers
+//  used in the prediction stage of the neural network
+//--
+
+
+#ifndef __NEURAL_NETWORKS_PREDICTION_MEMORY_PLANNER_H__
+#define __NEURAL_NETWORKS_PREDICTION_MEMORY_PLANNER_H__
+
+#include "neural_networks/neural_networks_prediction_model.h"
+#include "homogen_tensor.h"
+
+using namespace daal::data_management;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace prediction
+{
+namespace internal
+{
+
+/**
+ *  Sets empty collections of input tensors to the layers with the collection input layout
+ */
+inline void resetLayerInputCollections(const SharedPtr<ForwardLayers> &forwardLayers)
+{
+    size_t nLayers = forwardLayers->size();
+    for(size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        layers::forward::Input *layerInput = forwardLayers->get(layerId)->getLayerInput();
+        if(layerInput->getLayout() == layers::collectionInput)
+        {
+            layerInput->set(layers::forward::inputLayerData, SharedPtr<layers::LayerData>(new layers::LayerData()));
+        }
+    }
+}
+
+/**
+ *  Sets the results of the layer as the inputs of its next layers
+ */
+inline void connectNextLayers(const SharedPtr<ForwardLayers> &forwardLayers, const layers::NextLayers &next,
+                              const SharedPtr<layers::forward::Result> &layerResult)
+{
+    for(size_t j = 0; j < next.size(); j++)
+    {
+        SharedPtr<Tensor> value;
+        if(layerResult->getLayout() == layers::tensorResult)
+        {
+            value = layerResult->get(layers::forward::value);
+        }
+        else
+        {
+            value = staticPointerCast<Tensor, SerializationIface>((*(layerResult->get(layers::forward::resultForBackward)))[j]);
+        }
+
+        layers::forward::Input *nextInput = forwardLayers->get(next[j])->getLayerInput();
+        if(nextInput->getLayout() == layers::tensorInput)
+        {
+            nextInput->set(layers::forward::data, value);
+        }
+        else
+        {
+            SharedPtr<layers::LayerData> layerData = nextInput->get(layers::forward::inputLayerData);
+            size_t n = layerData->size();
+            (*layerData)[n] = value;
+        }
+    }
+}
+
+/**
+ *  Returns the number of elements in the tensor with the given dimensions
+ */
+inline size_t getNumberOfElements(const Collection<size_t> &dims)
+{
+    size_t size = 1;
+    for(size_t i = 0; i < dims.size(); i++)
+    {
+        size *= dims[i];
+    }
+    return size;
+}
+
+/**
+ *  Returns the number of elements in the results of the layers that are passed to the next layers
+ */
+inline size_t getNumberOfElementsInResults(const SharedPtr<layers::forward::Result> &layerResult, size_t nNextLayers)
+{
+    if(layerResult->getLayout() == layers::tensorResult)
+    {
+        return getNumberOfElements(layerResult->get(layers::forward::value)->getDimensions());
+    }
+
+    size_t size = 0;
+    SharedPtr<layers::LayerData> resultCollection = layerResult->get(layers::forward::resultForBackward);
+    for(size_t j = 0; j < nNextLayers; j++)
+    {
+        size += getNumberOfElements(staticPointerCast<Tensor, SerializationIface>((*resultCollection)[j])->getDimensions());
+    }
+    return size;
+}
+
+/**
+ *  Returns the number of elements in the results of all the layers except the last one
+ */
+inline size_t getNumberOfElementsInActivations(const SharedPtr<ForwardLayers> &forwardLayers,
+                                               const SharedPtr<Collection<layers::NextLayers> > &nextLayers)
+{
+    size_t size = 0;
+    size_t nLayers = forwardLayers->size();
+    for(size_t layerId = 0; layerId + 1 < nLayers; layerId++)
+    {
+        size += getNumberOfElementsInResults(forwardLayers->get(layerId)->getLayerResult(), nextLayers->get(layerId).size());
+    }
+    return size;
+}
+
+/**
+ *  \brief Tensor that views a part of the memory arena shared by the values of several layers.
+ *         The tensor keeps the arena alive while the tensor is referenced by the layers
+ */
+template<typename algorithmFPType>
+class ArenaTensor : public HomogenTensor<algorithmFPType>
+{
+public:
+    ArenaTensor(const Collection<size_t> &dims, const SharedPtr<HomogenTensor<algorithmFPType> > &arena) :
+        HomogenTensor<algorithmFPType>(dims, arena->getArray()), _arena(arena) {}
+
+    virtual ~ArenaTensor() {}
+
+private:
+    SharedPtr<HomogenTensor<algorithmFPType> > _arena;
+};
+
+/**
+ *  \brief Plans the memory for the values of the layers of the neural network in the prediction stage.
+ *
+ *  The value of the layer is live from the computation of the layer up to the computation of the last layer
+ *  that reads this value. The values with disjoint lifetimes are placed into the same memory arena,
+ *  the arena is chosen with the best fit strategy. The elementwise layers write the value in place of their input
+ *  if the input is not read by other layers.
+ *  The value of the last layer is not planned as it is set by the prediction kernel,
+ *  the results of the layers with the collection result layout are allocated separately
+ */
+template<typename algorithmFPType, CpuType cpu>
+class ActivationMemoryPlanner
+{
+public:
+    ActivationMemoryPlanner() : _nPlannedElements(0), _nNaiveElements(0) {}
+
+    /**
+     *  Allocates the results of the layers for the batch of samples set in the input of the first layer
+     *  and connects the results with the inputs of the next layers
+     *  \return false if the memory arenas cannot be allocated
+     */
+    bool allocate(const SharedPtr<ForwardLayers> &forwardLayers, const SharedPtr<Collection<layers::NextLayers> > &nextLayers)
+    {
+        size_t nLayers = forwardLayers->size();
+        Collection<Collection<size_t> > valueDims(nLayers);
+        Collection<bool> isPlanned(nLayers);
+
+        /* Results are allocated by the layers to get the dimensions of the values,
+           the values are immediately replaced with the tensors without memory */
+        _arenas.clear();
+        resetLayerInputCollections(forwardLayers);
+        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        {
+            SharedPtr<layers::forward::LayerIface> layer = forwardLayers->get(layerId);
+            layer->allocateResult();
+
+            SharedPtr<layers::forward::Result> layerResult = layer->getLayerResult();
+            isPlanned[layerId] = (layerResult->getLayout() == layers::tensorResult && layerId + 1 < nLayers);
+            if(isPlanned[layerId])
+            {
+                valueDims[layerId] = layerResult->get(layers::forward::value)->getDimensions();
+                layerResult->set(layers::forward::value,
+                                 SharedPtr<Tensor>(new HomogenTensor<algorithmFPType>(valueDims[layerId], Tensor::notAllocate)));
+                layer->allocateLayerData();
+            }
+            connectNextLayers(forwardLayers, nextLayers->get(layerId), layerResult);
+        }
+
+        Collection<size_t> valueArena(nLayers);
+        Collection<size_t> arenaSizes;
+        planArenas(forwardLayers, nextLayers, valueDims, isPlanned, valueArena, arenaSizes);
+
+        for(size_t i = 0; i < arenaSizes.size(); i++)
+        {
+            Collection<size_t> arenaDims(1);
+            arenaDims[0] = arenaSizes[i];
+            SharedPtr<HomogenTensor<algorithmFPType> > arena(new HomogenTensor<algorithmFPType>(arenaDims, Tensor::doAllocate));
+            if(!arena->getArray())
+            {
+                _arenas.clear();
+                return false;
+            }
+            _arenas.push_back(arena);
+        }
+
+        resetLayerInputCollections(forwardLayers);
+        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        {
+            SharedPtr<layers::forward::LayerIface> layer = forwardLayers->get(layerId);
+            SharedPtr<layers::forward::Result> layerResult = layer->getLayerResult();
+            if(isPlanned[layerId])
+            {
+                layerResult->set(layers::forward::value,
+                                 SharedPtr<Tensor>(new ArenaTensor<algorithmFPType>(valueDims[layerId], _arenas[valueArena[layerId]])));
+            }
+            layer->allocateLayerData();
+            connectNextLayers(forwardLayers, nextLayers->get(layerId), layerResult);
+        }
+        return true;
+    }
+
+    /**
+     *  Returns the size in bytes of the memory used for the values of the layers
+     */
+    size_t getPlannedSize() const { return _nPlannedElements * sizeof(algorithmFPType); }
+
+    /**
+     *  Returns the size in bytes of the memory needed for the values of the layers without buffer reuse
+     */
+    size_t getNaiveSize() const { return _nNaiveElements * sizeof(algorithmFPType); }
+
+private:
+    /**
+     *  Assigns the values of the layers to the memory arenas
+     */
+    void planArenas(const SharedPtr<ForwardLayers> &forwardLayers, const SharedPtr<Collection<layers::NextLayers> > &nextLayers,
+                    const Collection<Collection<size_t> > &valueDims, const Collection<bool> &isPlanned,
+                    Collection<size_t> &valueArena, Collection<size_t> &arenaSizes)
+    {
+        size_t nLayers = forwardLayers->size();
+
+        /* Index of the last layer that reads the value of the layer and the layer that produces the input of the layer */
+        Collection<size_t> lastUse(nLayers);
+        Collection<size_t> producer(nLayers);
+        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        {
+            producer[layerId] = nLayers;
+        }
+        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        {
+            const layers::NextLayers &next = nextLayers->get(layerId);
+            lastUse[layerId] = layerId;
+            for(size_t j = 0; j < next.size(); j++)
+            {
+                if(next[j] > lastUse[layerId]) { lastUse[layerId] = next[j]; }
+                if(next.size() == 1 && forwardLayers->get(next[j])->getLayerInput()->getLayout() == layers::tensorInput)
+                {
+                    producer[next[j]] = layerId;
+                }
+            }
+        }
+
+        _nPlannedElements = 0;
+        _nNaiveElements = 0;
+        Collection<size_t> arenaLastUse;
+        for(size_t layerId = 0; layerId + 1 < nLayers; layerId++)
+        {
+            if(!isPlanned[layerId])
+            {
+                size_t size = getNumberOfElementsInResults(forwardLayers->get(layerId)->getLayerResult(),
+                                                           nextLayers->get(layerId).size());
+                _nPlannedElements += size;
+                _nNaiveElements += size;
+                continue;
+            }
+
+            size_t size = getNumberOfElements(valueDims[layerId]);
+            _nNaiveElements += size;
+
+            size_t p = producer[layerId];
+            size_t arena = arenaSizes.size();
+            if(p < nLayers && isPlanned[p] && isElementwise(forwardLayers->get(layerId)) &&
+               getNumberOfElements(valueDims[p]) == size)
+            {
+                /* The input is read only by this layer, the value is written in place of the input */
+                arena = valueArena[p];
+            }
+            else
+            {
+                /* Best fit: the smallest free arena that holds the value, otherwise the largest free arena is grown */
+                size_t largest = arenaSizes.size();
+                for(size_t i = 0; i < arenaSizes.size(); i++)
+                {
+                    if(arenaLastUse[i] >= layerId) { continue; }
+                    if(arenaSizes[i] >= size && (arena == arenaSizes.size() || arenaSizes[i] < arenaSizes[arena]))
+                    {
+                        arena = i;
+                    }
+                    if(largest == arenaSizes.size() || arenaSizes[i] > arenaSizes[largest])
+                    {
+                        largest = i;
+                    }
+                }
+                if(arena == arenaSizes.size())
+                {
+                    arena = largest;
+                }
+                if(arena == arenaSizes.size())
+                {
+                    arenaSizes.push_back(size);
+                    arenaLastUse.push_back(lastUse[layerId]);
+                }
+                else if(arenaSizes[arena] < size)
+                {
+                    arenaSizes[arena] = size;
+                }
+            }
+
+            valueArena[layerId] = arena;
+            arenaLastUse[arena] = lastUse[layerId];
+        }
+
+        for(size_t i = 0; i < arenaSizes.size(); i++)
+        {
+            _nPlannedElements += arenaSizes[i];
+        }
+    }
+
+    /**
+     *  Checks whether the value of the layer is computed elementwise from the input of the layer
+     */
+    static bool isElementwise(const SharedPtr<layers::forward::LayerIface> &layer)
+    {
+        int tag = layer->getLayerResult()->getSerializationTag();
+        return (tag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_RELU_FORWARD_RESULT_ID     ||
+                tag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_ABS_FORWARD_RESULT_ID      ||
+                tag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_TANH_FORWARD_RESULT_ID     ||
+                tag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_LOGISTIC_FORWARD_RESULT_ID ||
+                tag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_SMOOTHRELU_FORWARD_RESULT_ID ||
+                tag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_DROPOUT_FORWARD_RESULT_ID);
+    }
+
+    Collection<SharedPtr<HomogenTensor<algorithmFPType> > > _arenas;
+    size_t _nPlannedElements;
+    size_t _nNaiveElements;
+};
+
+} // namespace daal::internal
+} // namespace prediction
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
+
+#endif
@@ -0,0 +1,305 @@
+/* file: neural_networks_prediction_model.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//++
+//  Implementation of the optimization of the neural network prediction model.
+//--
+*/
+
+#include <cmath>
+#include "neural_networks_prediction_model.h"
+#include "homogen_tensor.h"
+#include "layers/fullyconnected/fullyconnected_layer_types.h"
+#include "layers/convolution2d/convolution2d_layer_types.h"
+#include "layers/batch_normalization/batch_normalization_layer_forward_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace neural_networks
+{
+namespace prediction
+{
+namespace interface1
+{
+using namespace daal::services;
+using namespace daal::data_management;
+using namespace daal::algorithms::neural_networks::layers;
+
+/* Checks that the layer can be removed from the network by connecting its producer with its consumers */
+static bool canBypass(size_t layerId, const Collection<NextLayers> &nextLayers, const Collection<size_t> &nProducers)
+{
+    const NextLayers &next = nextLayers[layerId];
+    if(next.size() == 0) { return false; }
+    for(size_t j = 0; j < next.size(); j++)
+    {
+        if(nProducers[next[j]] != 1) { return false; }
+    }
+    return true;
+}
+
+/* Removes the layer from the network by connecting its producer with its consumers */
+static void bypassLayer(size_t layerId, size_t producerId, Collection<NextLayers> &nextLayers,
+                        Collection<size_t> &nConsumers, Collection<size_t> &producer)
+{
+    NextLayers &producerNext = nextLayers[producerId];
+    const NextLayers &next = nextLayers[layerId];
+
+    NextLayers newProducerNext;
+    for(size_t j = 0; j < producerNext.size(); j++)
+    {
+        if(producerNext[j] != layerId) { newProducerNext.push_back(producerNext[j]); continue; }
+        for(size_t k = 0; k < next.size(); k++)
+        {
+            newProducerNext.push_back(next[k]);
+            producer[next[k]] = producerId;
+        }
+    }
+    producerNext = newProducerNext;
+    nConsumers[producerId] = producerNext.size();
+}
+
+/* Returns the number of elements in the tensor */
+static size_t getTensorSize(const SharedPtr<Tensor> &tensor)
+{
+    const Collection<size_t> &dims = tensor->getDimensions();
+    size_t size = 1;
+    for(size_t i = 0; i < dims.size(); i++) { size *= dims[i]; }
+    return size;
+}
+
+/*
+ * Folds the batch normalization layer into the weights and biases of the fully-connected or 2D convolution layer
+ * that produces its input: y = gamma * (W x + b - mean) / sqrt(variance + epsilon) + beta
+ * Returns true if the layer is folded
+ */
+template<typename modelFPType>
+static bool foldBatchNormalization(const SharedPtr<forward::LayerIface> &bnLayer, const SharedPtr<forward::LayerIface> &layer,
+                                   int layerTag)
+{
+    const batch_normalization::Parameter *bnParameter = static_cast<const batch_normalization::Parameter *>(bnLayer->getLayerParameter());
+    const batch_normalization::forward::Input *bnInput = static_cast<const batch_normalization::forward::Input *>(bnLayer->getLayerInput());
+
+    SharedPtr<Tensor> gamma    = bnInput->get(forward::weights);
+    SharedPtr<Tensor> beta     = bnInput->get(forward::biases);
+    SharedPtr<Tensor> mean     = bnInput->get(batch_normalization::forward::populationMean);
+    SharedPtr<Tensor> variance = bnInput->get(batch_normalization::forward::populationVariance);
+    SharedPtr<Tensor> weights  = layer->getLayerInput()->get(forward::weights);
+    SharedPtr<Tensor> biases   = layer->getLayerInput()->get(forward::biases);
+    if(!gamma || !beta || !mean || !variance || !weights || !biases) { return false; }
+
+    /* Index of the output dimension of the layer and position of the output index in the weights */
+    size_t outputDimension, weightsOutputPosition;
+    if(layerTag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_FULLYCONNECTED_FORWARD_RESULT_ID)
+    {
+        outputDimension = 1;
+        weightsOutputPosition = static_cast<const fullyconnected::Parameter *>(layer->getLayerParameter())->dim;
+    }
+    else
+    {
+        outputDimension = static_cast<const convolution2d::Parameter *>(layer->getLayerParameter())->groupDimension;
+        weightsOutputPosition = 0;
+    }
+    if(bnParameter->dimension != outputDimension) { return false; }
+
+    const Collection<size_t> &weightsDims = weights->getDimensions();
+    const size_t nOutputs = getTensorSize(biases);
+    if(weightsOutputPosition >= weightsDims.size() || weightsDims[weightsOutputPosition] != nOutputs ||
+       getTensorSize(gamma) != nOutputs || getTensorSize(beta) != nOutputs ||
+       getTensorSize(mean) != nOutputs || getTensorSize(variance) != nOutputs) { return false; }
+
+    size_t weightsStride = 1;
+    for(size_t d = weightsOutputPosition + 1; d < weightsDims.size(); d++) { weightsStride *= weightsDims[d]; }
+    const size_t weightsSize = getTensorSize(weights);
+
+    SharedPtr<HomogenTensor<modelFPType> > foldedWeights(new HomogenTensor<modelFPType>(weightsDims, Tensor::doAllocate));
+    SharedPtr<HomogenTensor<modelFPType> > foldedBiases(new HomogenTensor<modelFPType>(biases->getDimensions(), Tensor::doAllocate));
+    modelFPType *foldedWeightsArray = foldedWeights->getArray();
+    modelFPType *foldedBiasesArray  = foldedBiases->getArray();
+    if(!foldedWeightsArray || !foldedBiasesArray) { return false; }
+
+    SubtensorDescriptor<modelFPType> gammaBlock, betaBlock, meanBlock, varianceBlock, weightsBlock, biasesBlock;
+    gamma->getSubtensor(0, 0, 0, gamma->getDimensionSize(0), readOnly, gammaBlock);
+    beta->getSubtensor(0, 0, 0, beta->getDimensionSize(0), readOnly, betaBlock);
+    mean->getSubtensor(0, 0, 0, mean->getDimensionSize(0), readOnly, meanBlock);
+    variance->getSubtensor(0, 0, 0, variance->getDimensionSize(0), readOnly, varianceBlock);
+    weights->getSubtensor(0, 0, 0, weightsDims[0], readOnly, weightsBlock);
+    biases->getSubtensor(0, 0, 0, biases->getDimensionSize(0), readOnly, biasesBlock);
+
+    const modelFPType *gammaArray    = gammaBlock.getPtr();
+    const modelFPType *varianceArray = varianceBlock.getPtr();
+    const modelFPType *weightsArray  = weightsBlock.getPtr();
+    const modelFPType epsilon = (modelFPType)bnParameter->epsilon;
+
+    Collection<modelFPType> scale(nOutputs);
+    for(size_t k = 0; k < nOutputs; k++)
+    {
+        scale[k] = gammaArray[k] / (modelFPType)std::sqrt((double)(varianceArray[k] + epsilon));
+        foldedBiasesArray[k] = (biasesBlock.getPtr()[k] - meanBlock.getPtr()[k]) * scale[k] + betaBlock.getPtr()[k];
+    }
+    for(size_t i = 0; i < weightsSize; i++)
+    {
+        foldedWeightsArray[i] = weightsArray[i] * scale[(i / weightsStride) % nOutputs];
+    }
+
+    gamma->releaseSubtensor(gammaBlock);
+    beta->releaseSubtensor(betaBlock);
+    mean->releaseSubtensor(meanBlock);
+    variance->releaseSubtensor(varianceBlock);
+    weights->releaseSubtensor(weightsBlock);
+    biases->releaseSubtensor(biasesBlock);
+
+    layer->getLayerInput()->set(forward::weights, foldedWeights);
+    layer->getLayerInput()->set(forward::biases, foldedBiases);
+    return true;
+}
+
+/* Folds the batch normalization layer keeping the floating-point type of the weights of the layer */
+static bool foldBatchNormalization(const SharedPtr<forward::LayerIface> &bnLayer, const SharedPtr<forward::LayerIface> &layer,
+                                   int layerTag)
+{
+    SharedPtr<Tensor> weights = layer->getLayerInput()->get(forward::weights);
+    if(!weights) { return false; }
+
+    const int floatTensorTag = data_feature_utils::getIndexNumType<float>() + SERIALIZATION_HOMOGEN_TENSOR_ID;
+    if(weights->getSerializationTag() == floatTensorTag)
+    {
+        return foldBatchNormalization<float>(bnLayer, layer, layerTag);
+    }
+    return foldBatchNormalization<double>(bnLayer, layer, layerTag);
+}
+
+void Model::optimize()
+{
+    const size_t nLayers = _forwardLayers->size();
+    if(_isOptimized || nLayers == 0) { return; }
+
+    SharedPtr<ForwardLayers> forwardLayers(new ForwardLayers(*_forwardLayers));
+    Collection<NextLayers> nextLayers(*_nextLayers);
+    Collection<LayerActivation> activations(nLayers);
+    Collection<size_t> nConsumers(nLayers), nProducers(nLayers), producer(nLayers);
+    Collection<bool> isRemoved(nLayers), isCopied(nLayers);
+
+    for(size_t i = 0; i < nLayers; i++)
+    {
+        activations[i] = (i < _fusedActivations->size() ? (*_fusedActivations)[i] : noActivation);
+        nConsumers[i] = nextLayers[i].size();
+        nProducers[i] = 0;
+        isRemoved[i] = false;
+        isCopied[i] = false;
+    }
+    for(size_t i = 0; i < nLayers; i++)
+    {
+        for(size_t j = 0; j < nextLayers[i].size(); j++)
+        {
+            nProducers[nextLayers[i][j]]++;
+            producer[nextLayers[i][j]] = i;
+        }
+    }
+
+    for(size_t i = 1; i < nLayers - 1; i++)
+    {
+        if(nProducers[i] != 1) { continue; }
+        const size_t p = producer[i];
+        SharedPtr<forward::LayerIface> producerLayer = (*forwardLayers)[p];
+        if(producerLayer->getLayerResult()->getLayout() != tensorResult) { continue; }
+        if(!canBypass(i, nextLayers, nProducers)) { continue; }
+
+        const int layerTag    = (*forwardLayers)[i]->getLayerResult()->getSerializationTag();
+        const int producerTag = producerLayer->getLayerResult()->getSerializationTag();
+        const bool hasSingleConsumer = (nConsumers[p] == 1 && activations[p] == noActivation);
+
+        if(layerTag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_DROPOUT_FORWARD_RESULT_ID)
+        {
+            bypassLayer(i, p, nextLayers, nConsumers, producer);
+            isRemoved[i] = true;
+        }
+        else if(layerTag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_BATCH_NORMALIZATION_FORWARD_RESULT_ID && hasSingleConsumer &&
+                (producerTag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_FULLYCONNECTED_FORWARD_RESULT_ID ||
+                 producerTag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_CONVOLUTION2D_FORWARD_RESULT_ID))
+        {
+            SharedPtr<forward::LayerIface> foldedLayer = (isCopied[p] ? producerLayer : producerLayer->clone());
+            if(foldBatchNormalization((*forwardLayers)[i], foldedLayer, producerTag))
+            {
+                (*forwardLayers)[p] = foldedLayer;
+                isCopied[p] = true;
+                bypassLayer(i, p, nextLayers, nConsumers, producer);
+                isRemoved[i] = true;
+            }
+        }
+        else if(hasSingleConsumer)
+        {
+            LayerActivation activation = noActivation;
+            if(layerTag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_RELU_FORWARD_RESULT_ID)     { activation = reluActivation; }
+            if(layerTag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_TANH_FORWARD_RESULT_ID)     { activation = tanhActivation; }
+            if(layerTag == SERIALIZATION_NEURAL_NETWORKS_LAYERS_LOGISTIC_FORWARD_RESULT_ID) { activation = logisticActivation; }
+            if(activation != noActivation)
+            {
+                activations[p] = activation;
+                bypassLayer(i, p, nextLayers, nConsumers, producer);
+                isRemoved[i] = true;
+            }
+        }
+    }
+
+    /* Build the network from the remaining layers */
+    Collection<size_t> newIndex(nLayers);
+    size_t nNewLayers = 0;
+    for(size_t i = 0; i < nLayers; i++)
+    {
+        newIndex[i] = nNewLayers;
+        if(!isRemoved[i]) { nNewLayers++; }
+    }
+
+    SharedPtr<ForwardLayers> newForwardLayers(new ForwardLayers());
+    SharedPtr<Collection<NextLayers> > newNextLayers(new Collection<NextLayers>());
+    SharedPtr<Collection<LayerActivation> > newActivations(new Collection<LayerActivation>());
+    SharedPtr<Collection<SharedPtr<layers::Parameter> > > newParameters;
+    if(_parameters && _parameters->size() == nLayers)
+    {
+        newParameters = SharedPtr<Collection<SharedPtr<layers::Parameter> > >(new Collection<SharedPtr<layers::Parameter> >());
+    }
+
+    for(size_t i = 0; i < nLayers; i++)
+    {
+        if(isRemoved[i]) { continue; }
+        NextLayers next;
+        for(size_t j = 0; j < nextLayers[i].size(); j++)
+        {
+            next.push_back(newIndex[nextLayers[i][j]]);
+        }
+        newForwardLayers->push_back((*forwardLayers)[i]);
+        newNextLayers->push_back(next);
+        newActivations->push_back(activations[i]);
+        if(newParameters) { newParameters->push_back((*_parameters)[i]); }
+    }
+
+    _forwardLayers = newForwardLayers;
+    _nextLayers = newNextLayers;
+    _fusedActivations = newActivations;
+    if(newParameters) { _parameters = newParameters; }
+    _isOptimized = true;
+}
+
+} // namespace interface1
+} // namespace prediction
+} // namespace neural_networks
+} // namespace algorithms
+} // namespace daal
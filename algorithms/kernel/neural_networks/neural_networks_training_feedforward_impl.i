@@ -25,6 +25,9 @@
 #define __NEURAL_NETWORKS_TRAINING_FEEDFORWARD_IMPL_I__
 
 #include "service_numeric_table.h"
+#include "service_micro_table.h"
+#include "service_memory.h"
+#include "threading.h"
 
 using namespace daal::internal;
 
@@ -119,6 +122,202 @@ SharedPtr<HomogenTensor<algorithmFPType> > getSample(const size_t firstElement,
     sample->releaseSubtensor(sampleBlock);
     return sample;
 }
+
+/**
+ *  \brief Network used by one worker of the training: the forward and backward layers of the model
+ *         and the objective function that computes the gradient at the output of the network
+ */
+template<typename algorithmFPType, CpuType cpu>
+class TrainingWorker
+{
+public:
+    TrainingWorker(const SharedPtr<Model> &nnModel) : _model(nnModel),
+        _forwardLayers(nnModel->getForwardLayers()), _backwardLayers(nnModel->getBackwardLayers()),
+        _crossEntropy(new optimization_solver::internal::cross_entropy::Batch<algorithmFPType>())
+    {
+        using namespace optimization_solver;
+        using namespace optimization_solver::internal;
+
+        size_t nLayers = _forwardLayers->size();
+
+        SharedPtr<Tensor> probabilities = _forwardLayers->get(nLayers - 1)->getLayerResult()->get(forward::value);
+        SharedPtr<NumericTable> probabilitiesTable = tensorToRowTable<algorithmFPType, cpu>(probabilities);
+
+        SharedPtr<Tensor> objectiveFunctionGradient = _backwardLayers->get(nLayers - 1)->getLayerInput()->get(backward::inputGradient);
+        SharedPtr<NumericTable> objectiveFunctionGradientTable = tensorToRowTable<algorithmFPType, cpu>(objectiveFunctionGradient);
+
+        _crossEntropy->input.set(sum_of_loss::probabilities, probabilitiesTable);
+
+        SharedPtr<DataCollection> crossEntropyCollection = SharedPtr<DataCollection>(new DataCollection(3));
+        crossEntropyCollection->get(objective_function::gradientIdx) = objectiveFunctionGradientTable;
+
+        SharedPtr<sum_of_loss::Result> crossEntropyResult(new sum_of_loss::Result());
+        crossEntropyResult->set(objective_function::resultCollection, crossEntropyCollection);
+        _crossEntropy->setResult(crossEntropyResult);
+
+        _crossEntropy->parameter.resultsToCompute = objective_function::gradient;
+    }
+
+    /**
+     *  Runs the forward and backward layers on one sample.
+     *  The derivatives of the weights and biases are stored in the model of the worker
+     */
+    void computeDerivatives(size_t sampleId, const SharedPtr<Tensor> &data, const SharedPtr<Tensor> &groundTruth)
+    {
+        using namespace optimization_solver;
+        using namespace optimization_solver::internal;
+
+        size_t nLayers = _forwardLayers->size();
+
+        SharedPtr<HomogenTensor<algorithmFPType> > sample = getSample<algorithmFPType>(sampleId, 1, data);
+        SharedPtr<HomogenTensor<algorithmFPType> > sampleGroundTruth = getSample<algorithmFPType>(sampleId, 1, groundTruth);
+
+        _forwardLayers->get(0)->getLayerInput()->set(forward::data, sample);
+        _forwardLayers->get(0)->allocateLayerData();
+        _backwardLayers->get(0)->getLayerInput()->set(backward::inputFromForward,
+                                                      _forwardLayers->get(0)->getLayerResult()->get(forward::resultForBackward));
+
+        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        {
+            _forwardLayers->get(layerId)->compute();
+        }
+
+        SharedPtr<NumericTable> groundTruthTable = tensorToColumnTable<algorithmFPType, cpu>(sampleGroundTruth);
+        _crossEntropy->input.set(sum_of_loss::groundTruth, groundTruthTable);
+
+        _crossEntropy->compute();
+
+        for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+        {
+            _backwardLayers->get(layerId)->compute();
+        }
+    }
+
+    SharedPtr<NumericTable> getWeightsAndBiasesDerivatives() const { return _model->getWeightsAndBiasesDerivatives(); }
+
+private:
+    SharedPtr<Model> _model;
+    SharedPtr<ForwardLayers> _forwardLayers;
+    SharedPtr<BackwardLayers> _backwardLayers;
+    SharedPtr<optimization_solver::internal::cross_entropy::Batch<algorithmFPType> > _crossEntropy;
+};
+
+/**
+ *  Creates the copy of the network with its own layer buffers and derivatives of the weights and biases.
+ *  The layers of the copy read the weights and biases of the model
+ */
+template<typename algorithmFPType>
+SharedPtr<Model> createReplica(const SharedPtr<Model> &nnModel, const Collection<size_t> &dataSize)
+{
+    SharedPtr<ForwardLayers> modelForwardLayers = nnModel->getForwardLayers();
+    SharedPtr<BackwardLayers> modelBackwardLayers = nnModel->getBackwardLayers();
+    size_t nLayers = modelForwardLayers->size();
+
+    SharedPtr<ForwardLayers> forwardLayers(new ForwardLayers());
+    SharedPtr<BackwardLayers> backwardLayers(new BackwardLayers());
+    for(size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        forwardLayers->push_back(modelForwardLayers->get(layerId)->clone());
+        backwardLayers->push_back(modelBackwardLayers->get(layerId)->clone());
+    }
+
+    SharedPtr<Model> replica(new Model());
+    replica->setForwardLayers(forwardLayers);
+    replica->setBackwardLayers(backwardLayers);
+    replica->setNextLayers(nnModel->getNextLayers());
+
+    /* The parameter provides the objective function that is connected to the output of the copy */
+    Parameter<algorithmFPType> replicaParameter;
+    replica->allocate<algorithmFPType>(dataSize, &replicaParameter);
+
+    for(size_t layerId = 0; layerId < nLayers; layerId++)
+    {
+        forward::Input *modelInput = modelForwardLayers->get(layerId)->getLayerInput();
+        forward::Input *replicaInput = forwardLayers->get(layerId)->getLayerInput();
+        replicaInput->set(forward::weights, modelInput->get(forward::weights));
+        replicaInput->set(forward::biases, modelInput->get(forward::biases));
+        forwardLayers->get(layerId)->allocateLayerData();
+    }
+    return replica;
+}
+
+/**
+ *  Computes the derivatives of the weights and biases averaged over the batch of samples.
+ *  The samples of the batch are split between the workers, the derivatives computed by the workers
+ *  are summed in thread-local buffers which are then reduced into the derivatives of the model
+ */
+template<typename algorithmFPType, CpuType cpu>
+bool computeBatchDerivatives(const Collection<SharedPtr<TrainingWorker<algorithmFPType, cpu> > > &workers,
+                             size_t firstSampleId, size_t batchSize, const SharedPtr<Tensor> &data, const SharedPtr<Tensor> &groundTruth,
+                             const SharedPtr<NumericTable> &weightsAndBiasesDerivatives)
+{
+    size_t nWorkers = workers.size();
+    size_t nSamples = data->getDimensionSize(0);
+    size_t nParameters = weightsAndBiasesDerivatives->getNumberOfColumns();
+
+    daal::tls<algorithmFPType *> tlsDerivativesSum( [ = ]()-> algorithmFPType *
+    {
+        return daal::services::internal::service_calloc<algorithmFPType, cpu>(nParameters);
+    } );
+
+    daal::threader_for(nWorkers, nWorkers, [ =, &workers, &tlsDerivativesSum](int iWorker)
+    {
+        algorithmFPType *derivativesSum = tlsDerivativesSum.local();
+        if (derivativesSum == NULL) { return; }
+
+        TrainingWorker<algorithmFPType, cpu> *worker = workers[iWorker].get();
+        SharedPtr<NumericTable> workerDerivatives = worker->getWeightsAndBiasesDerivatives();
+
+        size_t firstInShard = iWorker * batchSize / nWorkers;
+        size_t lastInShard = (iWorker + 1) * batchSize / nWorkers;
+        for(size_t k = firstInShard; k < lastInShard; k++)
+        {
+            worker->computeDerivatives((firstSampleId + k) % nSamples, data, groundTruth);
+
+            BlockMicroTable<algorithmFPType, readOnly, cpu> mtDerivatives(workerDerivatives.get());
+            algorithmFPType *sampleDerivatives;
+            mtDerivatives.getBlockOfRows(0, 1, &sampleDerivatives);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < nParameters; j++)
+            {
+                derivativesSum[j] += sampleDerivatives[j];
+            }
+            mtDerivatives.release();
+        }
+    } );
+
+    /* The first worker runs the layers of the model, so the derivatives of the model are overwritten only after all workers finish */
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> mtModelDerivatives(weightsAndBiasesDerivatives.get());
+    algorithmFPType *modelDerivatives;
+    mtModelDerivatives.getBlockOfRows(0, 1, &modelDerivatives);
+    for(size_t j = 0; j < nParameters; j++)
+    {
+        modelDerivatives[j] = (algorithmFPType)0.0;
+    }
+
+    bool allocationFailed = false;
+    tlsDerivativesSum.reduce( [ =, &allocationFailed ](algorithmFPType *derivativesSum)
+    {
+        if (derivativesSum == NULL) { allocationFailed = true; return; }
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t j = 0; j < nParameters; j++)
+        {
+            modelDerivatives[j] += derivativesSum[j];
+        }
+        daal::services::daal_free(derivativesSum);
+    } );
+
+    const algorithmFPType invBatchSize = (algorithmFPType)1.0 / (algorithmFPType)batchSize;
+    for(size_t j = 0; j < nParameters; j++)
+    {
+        modelDerivatives[j] *= invBatchSize;
+    }
+    mtModelDerivatives.release();
+
+    return !allocationFailed;
+}
 }
 
 /**
@@ -132,32 +331,26 @@ void NeuralNetworksFeedforwardTrainingKernel<algorithmFPType, method, cpu>::comp
     using namespace optimization_solver::internal;
 
     SharedPtr<Model> nnModel = result->get(model);
-    SharedPtr<ForwardLayers> forwardLayers = nnModel->getForwardLayers();
-    SharedPtr<BackwardLayers> backwardLayers = nnModel->getBackwardLayers();
-    size_t nLayers = forwardLayers->size();
 
     SharedPtr<Tensor> data = input->get(training::data);
     size_t nSamples = data->getDimensions().get(0);
 
     SharedPtr<Tensor> groundTruth = input->get(training::groundTruth);
 
-    SharedPtr<Tensor> probabilities = forwardLayers->get(nLayers - 1)->getLayerResult()->get(forward::value);
-    SharedPtr<NumericTable> probabilitiesTable = tensorToRowTable<algorithmFPType, cpu>(probabilities);
+    /* The samples of the batch are split between the workers. The first worker runs the layers of the model,
+       other workers run the copies of the layers that share the weights and biases with the model */
+    size_t batchSize = parameter->batchSize;
+    size_t nWorkers = daal::threader_get_threads_number();
+    if(nWorkers > batchSize) { nWorkers = batchSize; }
 
-    SharedPtr<Tensor> objectiveFunctionGradient = backwardLayers->get(nLayers - 1)->getLayerInput()->get(backward::inputGradient);
-    SharedPtr<NumericTable> objectiveFunctionGradientTable = tensorToRowTable<algorithmFPType, cpu>(objectiveFunctionGradient);
-
-    optimization_solver::internal::cross_entropy::Batch<algorithmFPType> crossEntropy;
-    crossEntropy.input.set(sum_of_loss::probabilities, probabilitiesTable);
-
-    SharedPtr<DataCollection> crossEntropyCollection = SharedPtr<DataCollection>(new DataCollection(3));
-    crossEntropyCollection->get(objective_function::gradientIdx) = objectiveFunctionGradientTable;
-
-    SharedPtr<sum_of_loss::Result> crossEntropyResult(new sum_of_loss::Result());
-    crossEntropyResult->set(objective_function::resultCollection, crossEntropyCollection);
-    crossEntropy.setResult(crossEntropyResult);
-
-    crossEntropy.parameter.resultsToCompute = objective_function::gradient;
+    Collection<SharedPtr<TrainingWorker<algorithmFPType, cpu> > > workers;
+    workers.push_back(SharedPtr<TrainingWorker<algorithmFPType, cpu> >(new TrainingWorker<algorithmFPType, cpu>(nnModel)));
+    for(size_t iWorker = 1; iWorker < nWorkers; iWorker++)
+    {
+        SharedPtr<Model> replica = createReplica<algorithmFPType>(nnModel, data->getDimensions());
+        if(!replica->getWeightsAndBiasesDerivatives()) { this->_errors->add(ErrorMemoryAllocationFailed); return; }
+        workers.push_back(SharedPtr<TrainingWorker<algorithmFPType, cpu> >(new TrainingWorker<algorithmFPType, cpu>(replica)));
+    }
 
     SharedPtr<NumericTable> weightsAndBiases = nnModel->getWeightsAndBiases();
     SharedPtr<NumericTable> weightsAndBiasesDerivatives = nnModel->getWeightsAndBiasesDerivatives();
@@ -187,30 +380,18 @@ void NeuralNetworksFeedforwardTrainingKernel<algorithmFPType, method, cpu>::comp
 
     for(size_t i = 0; i < parameter->nIterations; i++)
     {
-        size_t sampleId = i % nSamples;
-        SharedPtr<HomogenTensor<algorithmFPType> > sample = getSample<algorithmFPType>(sampleId, 1, data);
-        SharedPtr<HomogenTensor<algorithmFPType> > sampleGroundTruth = getSample<algorithmFPType>(sampleId, 1, groundTruth);
-
-        forwardLayers->get(0)->getLayerInput()->set(forward::data, sample);
-        forwardLayers->get(0)->allocateLayerData();
-        backwardLayers->get(0)->getLayerInput()->set(backward::inputFromForward,
-                                                     forwardLayers->get(0)->getLayerResult()->get(forward::resultForBackward));
-
-        for(size_t layerId = 0; layerId < nLayers; layerId++)
+        size_t firstSampleId = (i * batchSize) % nSamples;
+        if(batchSize == 1)
         {
-            forwardLayers->get(layerId)->compute();
+            workers[0]->computeDerivatives(firstSampleId, data, groundTruth);
         }
-
-        SharedPtr<NumericTable> groundTruthTable = tensorToColumnTable<algorithmFPType, cpu>(sampleGroundTruth);
-        crossEntropy.input.set(sum_of_loss::groundTruth, groundTruthTable);
-
-        crossEntropy.compute();
-
-        for(int layerId = nLayers - 1; layerId >= 0; layerId--)
+        else if(!computeBatchDerivatives<algorithmFPType, cpu>(workers, firstSampleId, batchSize, data, groundTruth,
+                                                                weightsAndBiasesDerivatives))
         {
-            backwardLayers->get(layerId)->compute();
+            this->_errors->add(ErrorMemoryAllocationFailed); return;
         }
 
+        /* The weights and biases are updated once per batch */
         sgdAlgorithm->compute();
     }
 }
@@ -64,7 +64,7 @@ public:
     virtual void releaseData(algorithmFPType *meanArray) = 0;
 
 protected:
-    const size_t _nRowsInBlock = 5000;
+    const size_t _nRowsInBlock = 1024;
 
 private:
 
@@ -103,8 +103,21 @@ private:
      *  \param  meanArray[in]                Array of mean values
      *  \param  standardDeviationInverse[in] Array of inversed values of standard deviations
      */
-    inline void normalizeDataInBlock(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                                     SharedPtr<NumericTable> resultTable, algorithmFPType *meanArray, algorithmFPType *standardDeviationInverse);
+    inline void normalizeDataInBlock(NumericTable *inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                     NumericTable *resultTable, algorithmFPType *meanArray, algorithmFPType *standardDeviationInverse);
+
+    /**
+     *  \brief Normalizes data by blocks in place
+     *
+     *  \param  dataTable[in,out]            Numeric table containing input data that is replaced by normalization results
+     *  \param  nInputColumns[in]            Number of columns in input table
+     *  \param  nProcessedRows[in]           Number of processed rows
+     *  \param  nRowsInCurrentBlock[in]      Number of rows to process
+     *  \param  meanArray[in]                Array of mean values
+     *  \param  standardDeviationInverse[in] Array of inversed values of standard deviations
+     */
+    inline void normalizeDataInBlockInplace(NumericTable *dataTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                            algorithmFPType *meanArray, algorithmFPType *standardDeviationInverse);
 };
 
 template <typename algorithmFPType, Method method, CpuType cpu>
@@ -26,6 +26,8 @@
 
 #include "service_micro_table.h"
 #include "service_math.h"
+#include "service_memory.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -41,20 +43,74 @@ namespace zscore
 namespace internal
 {
 
+/**
+ *  \brief Merges partial means and sums of squared differences from the means
+ *         of two sets of observations into the first set
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline void mergeMoments(size_t nColumns, algorithmFPType n1, algorithmFPType *mean1, algorithmFPType *sumSq1,
+                         algorithmFPType n2, const algorithmFPType *mean2, const algorithmFPType *sumSq2)
+{
+    const algorithmFPType n = n1 + n2;
+    const algorithmFPType meanCoeff  = n2 / n;
+    const algorithmFPType sumSqCoeff = n1 * n2 / n;
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for(size_t i = 0; i < nColumns; i++)
+    {
+        algorithmFPType delta = mean2[i] - mean1[i];
+        mean1[i]  += delta * meanCoeff;
+        sumSq1[i] += sumSq2[i] + delta * delta * sumSqCoeff;
+    }
+}
+
 template<typename algorithmFPType, CpuType cpu>
 void ZScoreKernel<algorithmFPType, defaultDense, cpu>::
     computeInternal(SharedPtr<NumericTable> inputTable, size_t nInputRows, size_t nInputColumns, size_t nBlocks, size_t nRowsInLastBlock,
             daal::algorithms::Parameter *par, algorithmFPType **meanArray, algorithmFPType *standardDeviationInverse)
 {
+    Parameter<algorithmFPType, defaultDense> *parameter = static_cast<Parameter<algorithmFPType, defaultDense> *>(par);
+
+    if(parameter->moments.get() == 0)
+    {
+        meanTable = SharedPtr<NumericTable>();
+
+        *meanArray = (algorithmFPType *) daal_malloc(nInputColumns * sizeof(algorithmFPType));
+        algorithmFPType *varianceArray = (algorithmFPType *) daal_malloc(nInputColumns * sizeof(algorithmFPType));
+        if (!*meanArray || !varianceArray)
+        {
+            daal_free(*meanArray);
+            daal_free(varianceArray);
+            this->_errors->add(ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        computeMeansAndVariances(inputTable.get(), nInputColumns, nBlocks, this->_nRowsInBlock, nRowsInLastBlock, *meanArray, varianceArray);
+
+        for(size_t i = 0; i < nInputColumns && this->_errors->size() == 0; i++)
+        {
+            if(varianceArray[i] <= zero)
+            {
+                SharedPtr<Error> e(new Error(ErrorNullVariance));
+                e->addIntDetail(Column, (int)i);
+                this->_errors->add(e);
+                break;
+            }
+            standardDeviationInverse[i] = one / sSqrt<cpu>(varianceArray[i]);
+        }
+
+        daal_free(varianceArray);
+        if(this->_errors->size() != 0) { daal_free(*meanArray); }
+        return;
+    }
+
     SharedPtr<NumericTable> standardDeviationTable;
     BlockDescriptor<algorithmFPType> standardDeviationBlock;
     algorithmFPType *standardDeviationArray;
 
-    Parameter<algorithmFPType, defaultDense> *parameter = static_cast<Parameter<algorithmFPType, defaultDense> *>(par);
-
     parameter->moments->input.set(low_order_moments::data, inputTable);
     parameter->moments->compute();
-    if(parameter->moments->getErrors()->size() != 0) {this->_errors->add(ErrorMeanAndStandardDeviationComputing);}
+    if(parameter->moments->getErrors()->size() != 0) { this->_errors->add(ErrorMeanAndStandardDeviationComputing); return; }
 
     meanTable = parameter->moments->getResult()->get(low_order_moments::mean);
     standardDeviationTable = parameter->moments->getResult()->get(low_order_moments::standardDeviation);
@@ -74,7 +130,6 @@ void ZScoreKernel<algorithmFPType, defaultDense, cpu>::
     {
         if(varianceArray[i] <= zero)
         {
-            daal_free(standardDeviationInverse);
             standardDeviationTable->releaseBlockOfRows(standardDeviationBlock);
             varianceTable->releaseBlockOfRows(varianceBlock);
             meanTable->releaseBlockOfRows(meanBlock);
@@ -91,10 +146,116 @@ void ZScoreKernel<algorithmFPType, defaultDense, cpu>::
     standardDeviationTable->releaseBlockOfRows(standardDeviationBlock);
 }
 
+template<typename algorithmFPType, CpuType cpu>
+void ZScoreKernel<algorithmFPType, defaultDense, cpu>::
+    computeMeansAndVariances(NumericTable *inputTable, size_t nInputColumns, size_t nBlocks, size_t nRowsInBlock,
+                             size_t nRowsInLastBlock, algorithmFPType *meanArray, algorithmFPType *varianceArray)
+{
+    /* Thread local partial results: number of observations, means, sums of squared differences from the means
+       and the same statistics for the current block of rows */
+    const size_t nPartial = 4 * nInputColumns + 1;
+    daal::tls<algorithmFPType *> tlsPartial( [ = ]()-> algorithmFPType *
+    {
+        return daal::services::internal::service_calloc<algorithmFPType, cpu>(nPartial);
+    } );
+
+    size_t nTotalBlocks = nBlocks + (nRowsInLastBlock > 0);
+    const algorithmFPType zeroValue = zero;
+
+    daal::threader_for(nTotalBlocks, nTotalBlocks, [ =, &tlsPartial](int iBlock)
+    {
+        algorithmFPType *partial = tlsPartial.local();
+        if(!partial) { return; }
+        algorithmFPType *mean       = partial + 1;
+        algorithmFPType *sumSq      = mean  + nInputColumns;
+        algorithmFPType *blockMean  = sumSq + nInputColumns;
+        algorithmFPType *blockSumSq = blockMean + nInputColumns;
+
+        size_t nRowsInCurrentBlock = (iBlock < nBlocks ? nRowsInBlock : nRowsInLastBlock);
+
+        BlockMicroTable<algorithmFPType, readOnly, cpu> mtInput(inputTable);
+        algorithmFPType *inputArray;
+        mtInput.getBlockOfRows(iBlock * nRowsInBlock, nRowsInCurrentBlock, &inputArray);
+
+        for(size_t i = 0; i < nInputColumns; i++)
+        {
+            blockMean[i]  = zeroValue;
+            blockSumSq[i] = zeroValue;
+        }
+
+        for(size_t j = 0; j < nRowsInCurrentBlock; j++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nInputColumns; i++)
+            {
+                blockMean[i] += inputArray[j * nInputColumns + i];
+            }
+        }
+
+        const algorithmFPType invN = (algorithmFPType)1.0 / (algorithmFPType)nRowsInCurrentBlock;
+        for(size_t i = 0; i < nInputColumns; i++)
+        {
+            blockMean[i] *= invN;
+        }
+
+        for(size_t j = 0; j < nRowsInCurrentBlock; j++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nInputColumns; i++)
+            {
+                algorithmFPType delta = inputArray[j * nInputColumns + i] - blockMean[i];
+                blockSumSq[i] += delta * delta;
+            }
+        }
+
+        mtInput.release();
+
+        mergeMoments<algorithmFPType, cpu>(nInputColumns, partial[0], mean, sumSq, (algorithmFPType)nRowsInCurrentBlock, blockMean, blockSumSq);
+        partial[0] += (algorithmFPType)nRowsInCurrentBlock;
+    } );
+
+    algorithmFPType nObservations = zero;
+    bool allocationFailed = false;
+    for(size_t i = 0; i < nInputColumns; i++)
+    {
+        meanArray[i]     = zero;
+        varianceArray[i] = zero;
+    }
+
+    tlsPartial.reduce( [ =, &nObservations, &allocationFailed](algorithmFPType *partial)
+    {
+        if(!partial) { allocationFailed = true; return; }
+        if(partial[0] > zeroValue)
+        {
+            mergeMoments<algorithmFPType, cpu>(nInputColumns, nObservations, meanArray, varianceArray,
+                                               partial[0], partial + 1, partial + 1 + nInputColumns);
+            nObservations += partial[0];
+        }
+        daal_free(partial);
+    } );
+
+    if(allocationFailed) { this->_errors->add(ErrorMemoryAllocationFailed); return; }
+
+    algorithmFPType varianceCoeff = (nObservations > one ? one / (nObservations - one) : zero);
+    for(size_t i = 0; i < nInputColumns; i++)
+    {
+        varianceArray[i] *= varianceCoeff;
+    }
+}
+
 template<typename algorithmFPType, CpuType cpu>
 void ZScoreKernel<algorithmFPType, defaultDense, cpu>::releaseData(algorithmFPType *meanArray)
 {
-    meanTable->releaseBlockOfRows(meanBlock);
+    if(meanTable.get())
+    {
+        meanTable->releaseBlockOfRows(meanBlock);
+    }
+    else
+    {
+        daal_free(meanArray);
+    }
 }
 
 } // namespace daal::internal
@@ -75,6 +75,21 @@ public:
     void releaseData(algorithmFPType *meanArray);
 
 private:
+    /**
+     *  \brief Computes means and variances of the input data in one pass over the data.
+     *         Partial results for blocks of rows are computed in parallel and merged pairwise
+     *
+     *  \param  inputTable[in]         Numeric table containing input data
+     *  \param  nInputColumns[in]      Number of columns in input table
+     *  \param  nBlocks[in]            Number of full data blocks
+     *  \param  nRowsInBlock[in]       Number of rows in full data block
+     *  \param  nRowsInLastBlock[in]   Number of rows in last block
+     *  \param  meanArray[out]         Array of mean values
+     *  \param  varianceArray[out]     Array of variances
+     */
+    void computeMeansAndVariances(NumericTable *inputTable, size_t nInputColumns, size_t nBlocks, size_t nRowsInBlock,
+                                  size_t nRowsInLastBlock, algorithmFPType *meanArray, algorithmFPType *varianceArray);
+
     SharedPtr<NumericTable> meanTable;
     BlockDescriptor<algorithmFPType> meanBlock;
 };
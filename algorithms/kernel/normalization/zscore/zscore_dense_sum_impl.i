@@ -26,6 +26,8 @@
 
 #include "service_micro_table.h"
 #include "service_math.h"
+#include "service_memory.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -51,7 +53,6 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
     SharedPtr<NumericTable> sumTable = inputTable->basicStatistics.get(NumericTableIface::sum);
     if(sumTable.get() == 0)
     {
-        daal_free(standardDeviationInverse);
         this->_errors->add(services::ErrorPrecomputedSumNotAvailable);
         return;
     }
@@ -61,9 +62,9 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
     algorithmFPType *sumArray = sumBlock.getBlockPtr();
 
     *meanArray = (algorithmFPType *) daal_malloc(nInputColumns * sizeof(algorithmFPType));
-    if (!meanArray)
+    if (!*meanArray)
     {
-        daal_free(standardDeviationInverse);
+        sumTable->releaseBlockOfRows(sumBlock);
         this->_errors->add(ErrorMemoryAllocationFailed);
         return;
     }
@@ -71,7 +72,6 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
     standardDeviationArray = (algorithmFPType *) daal_malloc(nInputColumns * sizeof(algorithmFPType));
     if (!standardDeviationArray)
     {
-        daal_free(standardDeviationInverse);
         daal_free(*meanArray);
         sumTable->releaseBlockOfRows(sumBlock);
         this->_errors->add(ErrorMemoryAllocationFailed);
@@ -79,20 +79,19 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
     }
 
     algorithmFPType rowsInverseValue = one / (algorithmFPType)nInputRows;
-    algorithmFPType inverseValue = one / ((algorithmFPType)nInputRows - one);
 
     for(size_t i = 0; i < nInputColumns; i++)
     {
         (*meanArray)[i] = sumArray[i] * rowsInverseValue;
     }
+    sumTable->releaseBlockOfRows(sumBlock);
 
-    for(size_t block = 0; block < nBlocks; block++)
-    {
-        getSumSquaresCentered(inputTable, nInputColumns, block * this->_nRowsInBlock, this->_nRowsInBlock, standardDeviationArray, *meanArray);
-    }
-    if(nRowsInLastBlock > 0)
+    getSumSquaresCentered(inputTable.get(), nInputColumns, nBlocks, this->_nRowsInBlock, nRowsInLastBlock, standardDeviationArray, *meanArray);
+    if(this->_errors->size() != 0)
     {
-        getSumSquaresCentered(inputTable, nInputColumns, nBlocks * this->_nRowsInBlock, nRowsInLastBlock, standardDeviationArray, *meanArray);
+        daal_free(*meanArray);
+        daal_free(standardDeviationArray);
+        return;
     }
 
     algorithmFPType value = sSqrt<cpu>((algorithmFPType)nInputRows - one);
@@ -102,10 +101,8 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
     {
         if(standardDeviationArray[i] <= zero)
         {
-            daal_free(standardDeviationInverse);
             daal_free(*meanArray);
             daal_free(standardDeviationArray);
-            sumTable->releaseBlockOfRows(sumBlock);
 
             SharedPtr<Error> e(new Error(ErrorNullVariance));
             e->addIntDetail(Column, (int)i);
@@ -115,29 +112,63 @@ void ZScoreKernel<algorithmFPType, sumDense, cpu>::
         standardDeviationInverse[i] = value / standardDeviationArray[i];
     }
 
-    sumTable->releaseBlockOfRows(sumBlock);
     daal_free(standardDeviationArray);
 }
 
 template<typename algorithmFPType, CpuType cpu>
 void ZScoreKernel<algorithmFPType, sumDense, cpu>::
-    getSumSquaresCentered(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                          algorithmFPType *standardDeviationArray, algorithmFPType *meanArray)
+    getSumSquaresCentered(NumericTable *inputTable, size_t nInputColumns, size_t nBlocks, size_t nRowsInBlock, size_t nRowsInLastBlock,
+                          algorithmFPType *sumSquaresArray, algorithmFPType *meanArray)
 {
-    BlockDescriptor<algorithmFPType> inputBlock;
-    inputTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, readOnly, inputBlock);
-    algorithmFPType *inputArray = inputBlock.getBlockPtr();
+    daal::tls<algorithmFPType *> tlsSumSquares( [ = ]()-> algorithmFPType *
+    {
+        return daal::services::internal::service_calloc<algorithmFPType, cpu>(nInputColumns);
+    } );
 
-    for(size_t i = 0; i < nInputColumns; i++)
+    size_t nTotalBlocks = nBlocks + (nRowsInLastBlock > 0);
+
+    daal::threader_for(nTotalBlocks, nTotalBlocks, [ =, &tlsSumSquares](int iBlock)
     {
-        standardDeviationArray[i] = zero;
+        algorithmFPType *sumSquares = tlsSumSquares.local();
+        if(!sumSquares) { return; }
+
+        size_t nRowsInCurrentBlock = (iBlock < nBlocks ? nRowsInBlock : nRowsInLastBlock);
+
+        BlockMicroTable<algorithmFPType, readOnly, cpu> mtInput(inputTable);
+        algorithmFPType *inputArray;
+        mtInput.getBlockOfRows(iBlock * nRowsInBlock, nRowsInCurrentBlock, &inputArray);
+
         for(size_t j = 0; j < nRowsInCurrentBlock; j++)
         {
-            standardDeviationArray[i] += (inputArray[i * nInputColumns + j] - meanArray[i]) * (inputArray[i * nInputColumns + j] -
-                                                                                               meanArray[i]);
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < nInputColumns; i++)
+            {
+                algorithmFPType delta = inputArray[j * nInputColumns + i] - meanArray[i];
+                sumSquares[i] += delta * delta;
+            }
         }
+
+        mtInput.release();
+    } );
+
+    bool allocationFailed = false;
+    for(size_t i = 0; i < nInputColumns; i++)
+    {
+        sumSquaresArray[i] = zero;
     }
-    inputTable->releaseBlockOfRows(inputBlock);
+
+    tlsSumSquares.reduce( [ =, &allocationFailed](algorithmFPType *sumSquares)
+    {
+        if(!sumSquares) { allocationFailed = true; return; }
+        for(size_t i = 0; i < nInputColumns; i++)
+        {
+            sumSquaresArray[i] += sumSquares[i];
+        }
+        daal_free(sumSquares);
+    } );
+
+    if(allocationFailed) { this->_errors->add(ErrorMemoryAllocationFailed); }
 }
 
 template<typename algorithmFPType, CpuType cpu>
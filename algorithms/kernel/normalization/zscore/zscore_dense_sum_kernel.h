@@ -69,17 +69,19 @@ public:
                  daal::algorithms::Parameter *par, algorithmFPType **meanArray, algorithmFPType *standardDeviationInverse);
 
     /**
-     *  \brief Gets sum of squared differences from the means
+     *  \brief Computes sums of squared differences from the means over all rows of the input data.
+     *         Blocks of rows are processed in parallel
      *
-     *  \param  inputTable[in]             Numeric table containing input data
-     *  \param  nInputColumns[in]          Number of columns in input table
-     *  \param  nProcessedRows[in]         Number of already processed rows
-     *  \param  nRowsInCurrentBlock[in]    Number of rows to process
-     *  \param  standardDeviationArray[in] Array containing standard deviations of input data
-     *  \param  meanArray[in]              Array containing means of input data
+     *  \param  inputTable[in]          Numeric table containing input data
+     *  \param  nInputColumns[in]       Number of columns in input table
+     *  \param  nBlocks[in]             Number of full data blocks
+     *  \param  nRowsInBlock[in]        Number of rows in full data block
+     *  \param  nRowsInLastBlock[in]    Number of rows in last block
+     *  \param  sumSquaresArray[out]    Array of sums of squared differences from the means
+     *  \param  meanArray[in]           Array containing means of input data
      */
-    void getSumSquaresCentered(SharedPtr<NumericTable> inputTable, size_t nInputColumns, size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                               algorithmFPType *standardDeviationArray, algorithmFPType *meanArray);
+    void getSumSquaresCentered(NumericTable *inputTable, size_t nInputColumns, size_t nBlocks, size_t nRowsInBlock, size_t nRowsInLastBlock,
+                               algorithmFPType *sumSquaresArray, algorithmFPType *meanArray);
 
     /**
     *  \brief Frees allocated arrays
@@ -23,6 +23,7 @@
 #define __ZSCORE_IMPL_I__
 
 #include "zscore_base.h"
+#include "threading.h"
 
 using namespace daal::data_management;
 using namespace daal::services;
@@ -41,7 +42,7 @@ namespace internal
 template<typename algorithmFPType, CpuType cpu>
 void ZScoreKernelBase<algorithmFPType, cpu>::compute(const Input *input, Result *result, daal::algorithms::Parameter *parameter)
 {
-    algorithmFPType *meanArray;
+    algorithmFPType *meanArray = 0;
     algorithmFPType *standardDeviationInverse;
 
     SharedPtr<NumericTable> inputTable  = input->get(data);
@@ -63,17 +64,33 @@ void ZScoreKernelBase<algorithmFPType, cpu>::compute(const Input *input, Result
     if (!standardDeviationInverse) { this->_errors->add(ErrorMemoryAllocationFailed); return; }
 
     computeInternal(inputTable, nInputRows, nInputColumns, nBlocks, nRowsInLastBlock, parameter, &meanArray, standardDeviationInverse);
-
-    for(size_t block = 0; block < nBlocks; block++)
+    if(this->_errors->size() != 0)
     {
-        normalizeDataInBlock(inputTable, nInputColumns, block * _nRowsInBlock, _nRowsInBlock, resultTable, meanArray,
-                             standardDeviationInverse);
+        daal_free(standardDeviationInverse);
+        return;
     }
-    if(nRowsInLastBlock > 0)
+
+    /* Normalize blocks of rows in parallel. In-place normalization updates the input blocks directly */
+    size_t nTotalBlocks = nBlocks + (nRowsInLastBlock > 0);
+    bool inplace = (inputTable.get() == resultTable.get());
+    NumericTable *inTable  = inputTable.get();
+    NumericTable *resTable = resultTable.get();
+    size_t nRowsInBlock = _nRowsInBlock;
+
+    daal::threader_for(nTotalBlocks, nTotalBlocks, [ = ](int iBlock)
     {
-        normalizeDataInBlock(inputTable, nInputColumns, nBlocks * _nRowsInBlock, nRowsInLastBlock, resultTable, meanArray,
-                             standardDeviationInverse);
-    }
+        size_t nRowsInCurrentBlock = (iBlock < nBlocks ? nRowsInBlock : nRowsInLastBlock);
+        if(inplace)
+        {
+            normalizeDataInBlockInplace(resTable, nInputColumns, iBlock * nRowsInBlock, nRowsInCurrentBlock, meanArray,
+                                        standardDeviationInverse);
+        }
+        else
+        {
+            normalizeDataInBlock(inTable, nInputColumns, iBlock * nRowsInBlock, nRowsInCurrentBlock, resTable, meanArray,
+                                 standardDeviationInverse);
+        }
+    } );
 
     resultTable->setNormalizationFlag(NumericTableIface::standardScoreNormalized);
 
@@ -126,9 +143,9 @@ inline void ZScoreKernelBase<algorithmFPType, cpu>::copyDataBlock(SharedPtr<Nume
 }
 
 template<typename algorithmFPType, CpuType cpu>
-inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeDataInBlock(SharedPtr<NumericTable> inputTable, size_t nInputColumns,
+inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeDataInBlock(NumericTable *inputTable, size_t nInputColumns,
                                                                          size_t nProcessedRows, size_t nRowsInCurrentBlock,
-                                                                         SharedPtr<NumericTable> resultTable, algorithmFPType *meanArray,
+                                                                         NumericTable *resultTable, algorithmFPType *meanArray,
                                                                          algorithmFPType *standardDeviationInverse)
 {
     BlockDescriptor<algorithmFPType> inputBlock;
@@ -141,6 +158,8 @@ inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeDataInBlock(SharedP
 
     for(size_t j = 0; j < nRowsInCurrentBlock; j++)
     {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
         for(size_t i = 0; i < nInputColumns; i++)
         {
             resultArray[j * nInputColumns + i] = ( inputArray[j * nInputColumns + i] - meanArray[i] ) * standardDeviationInverse[i];
@@ -151,6 +170,29 @@ inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeDataInBlock(SharedP
     resultTable->releaseBlockOfRows(resultBlock);
 }
 
+template<typename algorithmFPType, CpuType cpu>
+inline void ZScoreKernelBase<algorithmFPType, cpu>::normalizeDataInBlockInplace(NumericTable *dataTable, size_t nInputColumns,
+                                                                                size_t nProcessedRows, size_t nRowsInCurrentBlock,
+                                                                                algorithmFPType *meanArray,
+                                                                                algorithmFPType *standardDeviationInverse)
+{
+    BlockDescriptor<algorithmFPType> dataBlock;
+    dataTable->getBlockOfRows(nProcessedRows, nRowsInCurrentBlock, readWrite, dataBlock);
+    algorithmFPType *dataArray = dataBlock.getBlockPtr();
+
+    for(size_t j = 0; j < nRowsInCurrentBlock; j++)
+    {
+      PRAGMA_IVDEP
+      PRAGMA_VECTOR_ALWAYS
+        for(size_t i = 0; i < nInputColumns; i++)
+        {
+            dataArray[j * nInputColumns + i] = ( dataArray[j * nInputColumns + i] - meanArray[i] ) * standardDeviationInverse[i];
+        }
+    }
+
+    dataTable->releaseBlockOfRows(dataBlock);
+}
+
 } // namespace daal::internal
 } // namespace zscore
 } // namespace normalization
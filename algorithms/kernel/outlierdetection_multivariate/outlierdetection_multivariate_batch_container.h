@@ -51,10 +51,14 @@ void BatchContainer<AlgorithmFPType, method, cpu>::compute()
 
     NumericTable *a = static_cast<NumericTable *>(input->get(data).get());
     NumericTable *r = static_cast<NumericTable *>(result->get(weights).get());
+    NumericTable *locationTable  = static_cast<NumericTable *>(result->get(location).get());
+    NumericTable *scatterTable   = static_cast<NumericTable *>(result->get(scatter).get());
+    NumericTable *thresholdTable = static_cast<NumericTable *>(result->get(threshold).get());
     daal::algorithms::Parameter *par = _par;
     daal::services::Environment::env &env = *_env;
 
-    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(AlgorithmFPType, method), compute, a, r, par);
+    __DAAL_CALL_KERNEL(env, internal::OutlierDetectionKernel, __DAAL_KERNEL_ARGUMENTS(AlgorithmFPType, method), compute, a, r,
+                       locationTable, scatterTable, thresholdTable, par);
 }
 
 } // namespace multivariate_outlier_detection
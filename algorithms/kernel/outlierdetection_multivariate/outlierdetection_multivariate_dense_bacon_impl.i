@@ -30,7 +30,11 @@
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
 #include "service_math.h"
-#include "service_stat.h"
+#include "service_blas.h"
+#include "service_lapack.h"
+#include "service_memory.h"
+#include "service_sort.h"
+#include "threading.h"
 
 #include "outlierdetection_multivariate_dense_bacon_kernel.h"
 
@@ -46,48 +50,576 @@ namespace multivariate_outlier_detection
 namespace internal
 {
 
+/** Size of the initial basic subset per feature */
+const size_t baconSubsetSizeFactor = 4;
+
+/** Maximal number of iterations of the basic subset growth */
+const size_t baconMaxIterations = 100;
+
+/**
+ *  \brief Computes the distribution function and the density of the chi-square distribution
+ *         with the integer number of degrees of freedom
+ */
+template <CpuType cpu>
+double chiSquareDistribution(size_t nDegrees, double x, double *density)
+{
+    const double logPi = 1.1447298858494002;
+    double h = 0.5 * x;
+    double logH = sLog<cpu>(h);
+    double cdf, term, logTerm;
+
+    if (nDegrees % 2 == 0)
+    {
+        /* P(x) = 1 - exp(-h) * sum_{j = 0}^{k/2 - 1} h^j / j! */
+        cdf = 1.0;
+        logTerm = -h;
+        for (size_t j = 0; j < nDegrees / 2; j++)
+        {
+            if (j > 0) { logTerm += logH - sLog<cpu>((double)j); }
+            vExp<cpu>(1, &logTerm, &term);
+            cdf -= term;
+        }
+    }
+    else
+    {
+        /* P(x) = erf(sqrt(h)) - sum_{j = 1}^{(k - 1)/2} h^(j - 1/2) * exp(-h) / Gamma(j + 1/2) */
+        double sqrtH = sSqrt<cpu>(h);
+        vErf<cpu>(1, &sqrtH, &cdf);
+        logTerm = -0.5 * logH - h - 0.5 * logPi;
+        vExp<cpu>(1, &logTerm, &term);
+        for (size_t j = 1; j <= (nDegrees - 1) / 2; j++)
+        {
+            logTerm += logH - sLog<cpu>((double)j - 0.5);
+            vExp<cpu>(1, &logTerm, &term);
+            cdf -= term;
+        }
+    }
+
+    *density = 0.5 * term;
+    return cdf;
+}
+
+/**
+ *  \brief Computes the quantile of the chi-square distribution with the integer number of degrees of freedom.
+ *         Wilson-Hilferty approximation is refined by Newton iterations on the distribution function
+ */
+template <CpuType cpu>
+double chiSquareQuantile(size_t nDegrees, double probability)
+{
+    const double sqrt2 = 1.4142135623730951;
+    double k = (double)nDegrees;
+    double c = 2.0 / (9.0 * k);
+    double z = sqrt2 * sErfInv<cpu>(2.0 * probability - 1.0);
+    double t = 1.0 - c + z * sSqrt<cpu>(c);
+    double x = (t > 0.0 ? k * t * t * t : k);
+
+    for (size_t iter = 0; iter < 100; iter++)
+    {
+        double density;
+        double cdf = chiSquareDistribution<cpu>(nDegrees, x, &density);
+        if (!(density > 0.0)) { break; }
+
+        double xNew = x - (cdf - probability) / density;
+        if (xNew <= 0.0) { xNew = 0.5 * x; }
+        if (sFabs<double, cpu>(xNew - x) <= 1.0e-12 * x) { x = xNew; break; }
+        x = xNew;
+    }
+    return x;
+}
+
+/**
+ *  \brief Computes the squared cut-off value for the Mahalanobis distances
+ *         given the size of the current basic subset
+ */
 template <typename AlgorithmFPType, CpuType cpu>
-void OutlierDetectionKernel<AlgorithmFPType, baconDense, cpu>::compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par)
+AlgorithmFPType baconCutoff(size_t nFeatures, size_t nVectors, size_t nSubset, double chiSquare)
 {
-    const __int64 nBaconParams = 3;
-    AlgorithmFPType baconParams[nBaconParams];
-    Parameter<baconDense> *odPar = static_cast<Parameter<baconDense> *>(const_cast<daal::algorithms::Parameter *>(par));
-    if (odPar == NULL)
+    double n = (double)nVectors;
+    double p = (double)nFeatures;
+    double r = (double)nSubset;
+    double h = (double)((nVectors + nFeatures + 1) / 2);
+
+    double cnp = 1.0 + (p + 1.0) / (n - p);
+    if (n - 1.0 - 3.0 * p > 0.0) { cnp += 2.0 / (n - 1.0 - 3.0 * p); }
+    double chr = (h - r) / (h + r);
+    if (chr < 0.0) { chr = 0.0; }
+    double cnpr = cnp + chr;
+
+    return (AlgorithmFPType)(cnpr * cnpr * chiSquare);
+}
+
+template <typename AlgorithmFPType, CpuType cpu>
+void OutlierDetectionKernel<AlgorithmFPType, baconDense, cpu>::
+    medianDistances(const NumericTable *a, size_t nFeatures, size_t nVectors, AlgorithmFPType *distance)
+{
+    AlgorithmFPType *median = (AlgorithmFPType *)daal::services::daal_malloc(nFeatures * sizeof(AlgorithmFPType));
+    if (median == NULL) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+    /* Medians of the features are computed in parallel */
+    daal::tls<AlgorithmFPType *> tlsColumn( [ = ]()-> AlgorithmFPType *
     {
-        odPar = new Parameter<baconDense>();
+        return (AlgorithmFPType *)daal::services::daal_malloc(nVectors * sizeof(AlgorithmFPType));
+    } );
+
+    daal::threader_for(nFeatures, nFeatures, [ =, &tlsColumn](int j)
+    {
+        AlgorithmFPType *column = tlsColumn.local();
+        if (column == NULL) { return; }
+
+        FeatureMicroTable<AlgorithmFPType, readOnly, cpu> mtA(a);
+        AlgorithmFPType *values;
+        mtA.getBlockOfColumnValues(j, 0, nVectors, &values);
+        for (size_t i = 0; i < nVectors; i++)
+        {
+            column[i] = values[i];
+        }
+        mtA.release();
+
+        size_t k = (nVectors - 1) / 2;
+        AlgorithmFPType med = daal::algorithms::internal::qSelect<AlgorithmFPType, cpu>(nVectors, column, k);
+        if (nVectors % 2 == 0)
+        {
+            AlgorithmFPType upper = column[k + 1];
+            for (size_t i = k + 2; i < nVectors; i++)
+            {
+                if (column[i] < upper) { upper = column[i]; }
+            }
+            med = (AlgorithmFPType)0.5 * (med + upper);
+        }
+        median[j] = med;
+    } );
+
+    bool allocationFailed = false;
+    tlsColumn.reduce( [ &allocationFailed ](AlgorithmFPType *column)
+    {
+        if (column == NULL) { allocationFailed = true; return; }
+        daal::services::daal_free(column);
+    } );
+    if (allocationFailed)
+    {
+        daal::services::daal_free(median);
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
     }
 
-    switch (odPar->initMethod)
+    /* Squared Euclidean distances from the median are computed by blocks of observations */
+    size_t nBlocks = (nVectors + blockSize - 1) / blockSize;
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        size_t startRow = iBlock * blockSize;
+        size_t nRowsInBlock = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+        BlockMicroTable<AlgorithmFPType, readOnly, cpu> mtA(a);
+        AlgorithmFPType *data;
+        mtA.getBlockOfRows(startRow, nRowsInBlock, &data);
+
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+            AlgorithmFPType sum = (AlgorithmFPType)0.0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                AlgorithmFPType diff = data[i * nFeatures + j] - median[j];
+                sum += diff * diff;
+            }
+            distance[startRow + i] = sum;
+        }
+
+        mtA.release();
+    } );
+
+    daal::services::daal_free(median);
+}
+
+template <typename AlgorithmFPType, CpuType cpu>
+size_t OutlierDetectionKernel<AlgorithmFPType, baconDense, cpu>::
+    subsetMoments(const NumericTable *a, size_t nFeatures, size_t nVectors, const AlgorithmFPType *distance,
+                  AlgorithmFPType cutoff, AlgorithmFPType *mean, AlgorithmFPType *cov)
+{
+    AlgorithmFPType zero = (AlgorithmFPType)0.0;
+    AlgorithmFPType one  = (AlgorithmFPType)1.0;
+    size_t nBlocks = (nVectors + blockSize - 1) / blockSize;
+
+    size_t *blockCount = (size_t *)daal::services::daal_malloc(nBlocks * sizeof(size_t));
+    if (blockCount == NULL) { this->_errors->add(services::ErrorMemoryAllocationFailed); return 0; }
+
+    /* First pass: partial sums of the observations in the subset */
+    daal::tls<AlgorithmFPType *> tlsSum( [ = ]()-> AlgorithmFPType *
     {
-    case baconMedian:
-    default:
+        return daal::services::internal::service_calloc<AlgorithmFPType, cpu>(nFeatures);
+    } );
+
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsSum](int iBlock)
+    {
+        AlgorithmFPType *sum = tlsSum.local();
+        blockCount[iBlock] = 0;
+        if (sum == NULL) { return; }
+
+        size_t startRow = iBlock * blockSize;
+        size_t nRowsInBlock = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+        BlockMicroTable<AlgorithmFPType, readOnly, cpu> mtA(a);
+        AlgorithmFPType *data;
+        mtA.getBlockOfRows(startRow, nRowsInBlock, &data);
+
+        size_t count = 0;
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+            if (distance && distance[startRow + i] > cutoff) { continue; }
+            count++;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sum[j] += data[i * nFeatures + j];
+            }
+        }
+        blockCount[iBlock] = count;
+
+        mtA.release();
+    } );
+
+    bool allocationFailed = false;
+    for (size_t j = 0; j < nFeatures; j++)
     {
-        baconParams[0] = (AlgorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MEDIAN_INIT;
-        break;
+        mean[j] = zero;
     }
-    case baconMahalanobis:
+    tlsSum.reduce( [ =, &allocationFailed ](AlgorithmFPType *sum)
+    {
+        if (sum == NULL) { allocationFailed = true; return; }
+        for (size_t j = 0; j < nFeatures; j++)
+        {
+            mean[j] += sum[j];
+        }
+        daal::services::daal_free(sum);
+    } );
+
+    size_t nSubset = 0;
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
     {
-        baconParams[0] = (AlgorithmFPType)__DAAL_VSL_SS_METHOD_BACON_MAHALANOBIS_INIT;
-        break;
+        nSubset += blockCount[iBlock];
     }
+    daal::services::daal_free(blockCount);
+
+    if (allocationFailed) { this->_errors->add(services::ErrorMemoryAllocationFailed); return 0; }
+    if (nSubset == 0) { return 0; }
+
+    AlgorithmFPType invN = one / (AlgorithmFPType)nSubset;
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        mean[j] *= invN;
     }
-    baconParams[1] = (AlgorithmFPType)(odPar->alpha);
-    baconParams[2] = (AlgorithmFPType)(odPar->toleranceToConverge);
 
-    BlockMicroTable<AlgorithmFPType, readOnly, cpu> mtA(a);
-    FeatureMicroTable<AlgorithmFPType, writeOnly, cpu> mtR(r);
-    size_t nFeatures = mtA.getFullNumberOfColumns();
-    size_t nVectors  = mtA.getFullNumberOfRows();
+    /* Second pass: partial cross-products of the centered observations in the subset.
+       Thread local buffer holds the cross-product followed by the gathered block of observations */
+    daal::tls<AlgorithmFPType *> tlsCrossProduct( [ = ]()-> AlgorithmFPType *
+    {
+        return daal::services::internal::service_calloc<AlgorithmFPType, cpu>(nFeatures * nFeatures + nFeatures * blockSize);
+    } );
+
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsCrossProduct](int iBlock)
+    {
+        AlgorithmFPType *crossProduct = tlsCrossProduct.local();
+        if (crossProduct == NULL) { return; }
+        AlgorithmFPType *dataCen = crossProduct + nFeatures * nFeatures;
+
+        size_t startRow = iBlock * blockSize;
+        size_t nRowsInBlock = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+        BlockMicroTable<AlgorithmFPType, readOnly, cpu> mtA(a);
+        AlgorithmFPType *data;
+        mtA.getBlockOfRows(startRow, nRowsInBlock, &data);
 
-    AlgorithmFPType *data, *weight;
-    mtA.getBlockOfRows(0, nVectors, &data);
-    mtR.getBlockOfColumnValues(0, 0, nVectors, &weight);
+        size_t count = 0;
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+            if (distance && distance[startRow + i] > cutoff) { continue; }
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                dataCen[count * nFeatures + j] = data[i * nFeatures + j] - mean[j];
+            }
+            count++;
+        }
 
-    Statistics<AlgorithmFPType, cpu>::xoutlierdetection(data, (__int64)nFeatures, (__int64)nVectors, nBaconParams, baconParams, weight);
+        mtA.release();
+
+        if (count > 0)
+        {
+            char uplo  = 'U';
+            char trans = 'N';
+            MKL_INT dim = (MKL_INT)nFeatures;
+            MKL_INT n   = (MKL_INT)count;
+            AlgorithmFPType alpha = (AlgorithmFPType)1.0;
+            AlgorithmFPType beta  = (AlgorithmFPType)1.0;
+            Blas<AlgorithmFPType, cpu>::xxsyrk(&uplo, &trans, &dim, &n, &alpha, dataCen, &dim, &beta, crossProduct, &dim);
+        }
+    } );
+
+    for (size_t i = 0; i < nFeatures * nFeatures; i++)
+    {
+        cov[i] = zero;
+    }
+    tlsCrossProduct.reduce( [ =, &allocationFailed ](AlgorithmFPType *crossProduct)
+    {
+        if (crossProduct == NULL) { allocationFailed = true; return; }
+        for (size_t i = 0; i < nFeatures * nFeatures; i++)
+        {
+            cov[i] += crossProduct[i];
+        }
+        daal::services::daal_free(crossProduct);
+    } );
+    if (allocationFailed) { this->_errors->add(services::ErrorMemoryAllocationFailed); return 0; }
+
+    /* Normalize and restore the full symmetric matrix from its upper triangle */
+    AlgorithmFPType invNm1 = (nSubset > 1 ? one / (AlgorithmFPType)(nSubset - 1) : one);
+    for (size_t j = 0; j < nFeatures; j++)
+    {
+        for (size_t i = 0; i <= j; i++)
+        {
+            cov[j * nFeatures + i] *= invNm1;
+            cov[i * nFeatures + j]  = cov[j * nFeatures + i];
+        }
+    }
+
+    return nSubset;
+}
+
+template <typename AlgorithmFPType, CpuType cpu>
+size_t OutlierDetectionKernel<AlgorithmFPType, baconDense, cpu>::
+    mahalanobisDistances(const NumericTable *a, size_t nFeatures, size_t nVectors, const AlgorithmFPType *mean,
+                         AlgorithmFPType *cholFactor, AlgorithmFPType cutoff, AlgorithmFPType *distance)
+{
+    size_t nBlocks = (nVectors + blockSize - 1) / blockSize;
+
+    size_t *blockCount = (size_t *)daal::services::daal_malloc(nBlocks * sizeof(size_t));
+    if (blockCount == NULL) { this->_errors->add(services::ErrorMemoryAllocationFailed); return 0; }
+
+    daal::tls<AlgorithmFPType *> tlsBuffer( [ = ]()-> AlgorithmFPType *
+    {
+        return (AlgorithmFPType *)daal::services::daal_malloc(nFeatures * blockSize * sizeof(AlgorithmFPType));
+    } );
+
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsBuffer](int iBlock)
+    {
+        AlgorithmFPType *dataCen = tlsBuffer.local();
+        blockCount[iBlock] = 0;
+        if (dataCen == NULL) { return; }
+
+        size_t startRow = iBlock * blockSize;
+        size_t nRowsInBlock = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+        BlockMicroTable<AlgorithmFPType, readOnly, cpu> mtA(a);
+        AlgorithmFPType *data;
+        mtA.getBlockOfRows(startRow, nRowsInBlock, &data);
+
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                dataCen[i * nFeatures + j] = data[i * nFeatures + j] - mean[j];
+            }
+        }
+
+        mtA.release();
+
+        /* Solve U' * Z = (X - mean)' with the upper triangular Cholesky factor U of the scatter matrix */
+        char uplo  = 'U';
+        char trans = 'T';
+        char diag  = 'N';
+        MKL_INT dim  = (MKL_INT)nFeatures;
+        MKL_INT nrhs = (MKL_INT)nRowsInBlock;
+        MKL_INT info;
+        Lapack<AlgorithmFPType, cpu>::xxtrtrs(&uplo, &trans, &diag, &dim, &nrhs, cholFactor, &dim, dataCen, &dim, &info);
+
+        size_t count = 0;
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+            AlgorithmFPType sum = (AlgorithmFPType)0.0;
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for (size_t j = 0; j < nFeatures; j++)
+            {
+                sum += dataCen[i * nFeatures + j] * dataCen[i * nFeatures + j];
+            }
+            distance[startRow + i] = sum;
+            count += (sum <= cutoff);
+        }
+        blockCount[iBlock] = count;
+    } );
+
+    bool allocationFailed = false;
+    tlsBuffer.reduce( [ &allocationFailed ](AlgorithmFPType *dataCen)
+    {
+        if (dataCen == NULL) { allocationFailed = true; return; }
+        daal::services::daal_free(dataCen);
+    } );
+
+    size_t nSubset = 0;
+    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    {
+        nSubset += blockCount[iBlock];
+    }
+    daal::services::daal_free(blockCount);
+
+    if (allocationFailed) { this->_errors->add(services::ErrorMemoryAllocationFailed); return 0; }
+    return nSubset;
+}
+
+template <typename AlgorithmFPType, CpuType cpu>
+AlgorithmFPType OutlierDetectionKernel<AlgorithmFPType, baconDense, cpu>::
+    initialCutoff(size_t nVectors, const AlgorithmFPType *distance, size_t nSubset, AlgorithmFPType *buffer)
+{
+    size_t nBlocks = (nVectors + blockSize - 1) / blockSize;
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        size_t startRow = iBlock * blockSize;
+        size_t endRow = (startRow + blockSize > nVectors ? nVectors : startRow + blockSize);
+        for (size_t i = startRow; i < endRow; i++)
+        {
+            buffer[i] = distance[i];
+        }
+    } );
+
+    return daal::algorithms::internal::qSelect<AlgorithmFPType, cpu>(nVectors, buffer, nSubset - 1);
+}
+
+template <typename AlgorithmFPType, CpuType cpu>
+void OutlierDetectionKernel<AlgorithmFPType, baconDense, cpu>::
+    computeWeights(size_t nVectors, const AlgorithmFPType *distance, AlgorithmFPType cutoff, NumericTable *r)
+{
+    size_t nBlocks = (nVectors + blockSize - 1) / blockSize;
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        size_t startRow = iBlock * blockSize;
+        size_t nRowsInBlock = (startRow + blockSize > nVectors ? nVectors - startRow : blockSize);
+
+        FeatureMicroTable<AlgorithmFPType, writeOnly, cpu> mtR(r);
+        AlgorithmFPType *weight;
+        mtR.getBlockOfColumnValues(0, startRow, nRowsInBlock, &weight);
+
+        for (size_t i = 0; i < nRowsInBlock; i++)
+        {
+            weight[i] = (distance[startRow + i] <= cutoff ? (AlgorithmFPType)1.0 : (AlgorithmFPType)0.0);
+        }
+
+        mtR.release();
+    } );
+}
+
+template <typename AlgorithmFPType, CpuType cpu>
+void OutlierDetectionKernel<AlgorithmFPType, baconDense, cpu>::
+    compute(const NumericTable *a, NumericTable *r, NumericTable *location, NumericTable *scatter, NumericTable *threshold,
+            const daal::algorithms::Parameter *par)
+{
+    Parameter<baconDense> defaultPar;
+    const Parameter<baconDense> *odPar = (par ? static_cast<const Parameter<baconDense> *>(par) : &defaultPar);
+
+    size_t nFeatures = a->getNumberOfColumns();
+    size_t nVectors  = a->getNumberOfRows();
+    if (nVectors <= nFeatures) { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+
+    double chiSquare = chiSquareQuantile<cpu>(nFeatures, 1.0 - odPar->alpha);
+
+    /* Allocate memory for storing intermediate results */
+    AlgorithmFPType *distance = (AlgorithmFPType *)daal::services::daal_malloc(2 * nVectors * sizeof(AlgorithmFPType));
+    AlgorithmFPType *mean     = (AlgorithmFPType *)daal::services::daal_malloc(nFeatures * sizeof(AlgorithmFPType));
+    AlgorithmFPType *cov      = (AlgorithmFPType *)daal::services::daal_malloc(2 * nFeatures * nFeatures * sizeof(AlgorithmFPType));
+    if (distance == NULL || mean == NULL || cov == NULL)
+    {
+        daal::services::daal_free(distance);
+        daal::services::daal_free(mean);
+        daal::services::daal_free(cov);
+        this->_errors->add(services::ErrorMemoryAllocationFailed);
+        return;
+    }
+    AlgorithmFPType *buffer     = distance + nVectors;
+    AlgorithmFPType *cholFactor = cov + nFeatures * nFeatures;
+
+    char uplo = 'U';
+    MKL_INT dim = (MKL_INT)nFeatures;
+    MKL_INT info = 0;
+    size_t nSubset = baconSubsetSizeFactor * nFeatures;
+    if (nSubset > nVectors) { nSubset = nVectors; }
+
+    /* Distances that define the initial basic subset */
+    if (odPar->initMethod == baconMahalanobis)
+    {
+        subsetMoments(a, nFeatures, nVectors, NULL, (AlgorithmFPType)0.0, mean, cov);
+        if (this->_errors->size() == 0)
+        {
+            for (size_t i = 0; i < nFeatures * nFeatures; i++) { cholFactor[i] = cov[i]; }
+            Lapack<AlgorithmFPType, cpu>::xpotrf(&uplo, &dim, cholFactor, &dim, &info);
+            if (info != 0) { this->_errors->add(services::ErrorOutlierDetectionInternal); }
+        }
+        if (this->_errors->size() == 0)
+        {
+            mahalanobisDistances(a, nFeatures, nVectors, mean, cholFactor, (AlgorithmFPType)0.0, distance);
+        }
+    }
+    else
+    {
+        medianDistances(a, nFeatures, nVectors, distance);
+    }
+
+    /* Select the initial basic subset of the closest observations.
+       The subset is extended while its scatter matrix is singular */
+    size_t nSubsetCur = 0;
+    for (;;)
+    {
+        if (this->_errors->size() != 0) { break; }
+
+        AlgorithmFPType cutoff = initialCutoff(nVectors, distance, nSubset, buffer);
+        nSubsetCur = subsetMoments(a, nFeatures, nVectors, distance, cutoff, mean, cov);
+        if (this->_errors->size() != 0) { break; }
+
+        for (size_t i = 0; i < nFeatures * nFeatures; i++) { cholFactor[i] = cov[i]; }
+        Lapack<AlgorithmFPType, cpu>::xpotrf(&uplo, &dim, cholFactor, &dim, &info);
+        if (info == 0) { break; }
+
+        if (nSubset == nVectors) { this->_errors->add(services::ErrorOutlierDetectionInternal); break; }
+        nSubset += nFeatures;
+        if (nSubset > nVectors) { nSubset = nVectors; }
+    }
+
+    /* Grow the basic subset until its size is stable */
+    AlgorithmFPType cutoff = (AlgorithmFPType)0.0;
+    for (size_t iter = 0; iter < baconMaxIterations && this->_errors->size() == 0; iter++)
+    {
+        cutoff = baconCutoff<AlgorithmFPType, cpu>(nFeatures, nVectors, nSubsetCur, chiSquare);
+        size_t nSubsetNew = mahalanobisDistances(a, nFeatures, nVectors, mean, cholFactor, cutoff, distance);
+        if (this->_errors->size() != 0) { break; }
+
+        size_t change = (nSubsetNew > nSubsetCur ? nSubsetNew - nSubsetCur : nSubsetCur - nSubsetNew);
+        if ((double)change <= odPar->toleranceToConverge * (double)nSubsetCur || iter + 1 == baconMaxIterations) { break; }
+        if (nSubsetNew <= nFeatures) { this->_errors->add(services::ErrorOutlierDetectionInternal); break; }
+
+        nSubsetCur = subsetMoments(a, nFeatures, nVectors, distance, cutoff, mean, cov);
+        if (this->_errors->size() != 0) { break; }
+
+        for (size_t i = 0; i < nFeatures * nFeatures; i++) { cholFactor[i] = cov[i]; }
+        Lapack<AlgorithmFPType, cpu>::xpotrf(&uplo, &dim, cholFactor, &dim, &info);
+        if (info != 0) { this->_errors->add(services::ErrorOutlierDetectionInternal); break; }
+    }
+
+    if (this->_errors->size() == 0)
+    {
+        computeWeights(nVectors, distance, cutoff, r);
+
+        /* Store the fitted model that can be applied to new data with the defaultDense method */
+        AlgorithmFPType thresholdValue = sSqrt<cpu>(cutoff);
+        writeOptionalResult<AlgorithmFPType, cpu>(location,  1,         mean);
+        writeOptionalResult<AlgorithmFPType, cpu>(scatter,   nFeatures, cov);
+        writeOptionalResult<AlgorithmFPType, cpu>(threshold, 1,         &thresholdValue);
+    }
 
-    mtA.release();
-    mtR.release();
-    if (par == NULL) { delete odPar; }
+    daal::services::daal_free(distance);
+    daal::services::daal_free(mean);
+    daal::services::daal_free(cov);
 }
 
 } // namespace internal
@@ -48,7 +48,30 @@ namespace internal
 template <typename AlgorithmFPType, CpuType cpu>
 struct OutlierDetectionKernel<AlgorithmFPType, baconDense, cpu> : public Kernel
 {
-    void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    static const size_t blockSize = 1024;
+
+    void compute(const NumericTable *a, NumericTable *r, NumericTable *location, NumericTable *scatter, NumericTable *threshold,
+                 const daal::algorithms::Parameter *par);
+
+protected:
+    /** \brief Compute squared Euclidean distances from the coordinate-wise median of the data */
+    void medianDistances(const NumericTable *a, size_t nFeatures, size_t nVectors, AlgorithmFPType *distance);
+
+    /** \brief Compute mean and variance-covariance matrix of the observations whose distances do not exceed the cut-off value.
+               Returns the number of such observations */
+    size_t subsetMoments(const NumericTable *a, size_t nFeatures, size_t nVectors, const AlgorithmFPType *distance,
+                         AlgorithmFPType cutoff, AlgorithmFPType *mean, AlgorithmFPType *cov);
+
+    /** \brief Compute squared Mahalanobis distances of all observations using the Cholesky factor of the scatter matrix.
+               Returns the number of observations whose distances do not exceed the cut-off value */
+    size_t mahalanobisDistances(const NumericTable *a, size_t nFeatures, size_t nVectors, const AlgorithmFPType *mean,
+                                AlgorithmFPType *cholFactor, AlgorithmFPType cutoff, AlgorithmFPType *distance);
+
+    /** \brief Compute the cut-off value for the distances that selects the basic subset of size at least nSubset */
+    AlgorithmFPType initialCutoff(size_t nVectors, const AlgorithmFPType *distance, size_t nSubset, AlgorithmFPType *buffer);
+
+    /** \brief Compute weights of the observations: 1 for distances that do not exceed the cut-off value, 0 otherwise */
+    void computeWeights(size_t nVectors, const AlgorithmFPType *distance, AlgorithmFPType cutoff, NumericTable *r);
 };
 
 } // namespace internal
@@ -32,6 +32,7 @@
 #include "service_math.h"
 #include "service_blas.h"
 #include "service_lapack.h"
+#include "threading.h"
 
 #include "outlierdetection_multivariate_dense_default_kernel.h"
 
@@ -49,8 +50,8 @@ namespace internal
 
 template <typename AlgorithmFPType, CpuType cpu>
 inline void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
-    mahalanobisDistance(size_t nFeatures, size_t nVectors, AlgorithmFPType *data,
-                        AlgorithmFPType *location, AlgorithmFPType *invScatter, AlgorithmFPType *distance,
+    mahalanobisDistance(size_t nFeatures, size_t nVectors, const AlgorithmFPType *data,
+                        const AlgorithmFPType *location, AlgorithmFPType *invScatter, AlgorithmFPType *distance,
                         AlgorithmFPType *buffer)
 {
     AlgorithmFPType *dataCen            = buffer;
@@ -62,10 +63,9 @@ inline void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
     char uplo = 'U';
     AlgorithmFPType one  = (AlgorithmFPType)1.0;
     AlgorithmFPType zero = (AlgorithmFPType)0.0;
-    MKL_INT info;
 
-    AlgorithmFPType *dataPtr    = data;
-    AlgorithmFPType *dataCenPtr = dataCen;
+    const AlgorithmFPType *dataPtr = data;
+    AlgorithmFPType *dataCenPtr    = dataCen;
     for (size_t i = 0; i < nVectors; i++, dataPtr += nFeatures, dataCenPtr += nFeatures)
     {
       PRAGMA_IVDEP
@@ -76,7 +76,8 @@ inline void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
         }
     }
 
-    Blas<AlgorithmFPType, cpu>::xsymm(&side, &uplo, &dim, &n, &one, invScatter, &dim, dataCen, &dim, &zero,
+    /* Blocks are processed in parallel, so the sequential version of BLAS function is used */
+    Blas<AlgorithmFPType, cpu>::xxsymm(&side, &uplo, &dim, &n, &one, invScatter, &dim, dataCen, &dim, &zero,
                        dataCenInvScatter, &dim);
 
     dataCenPtr = dataCen;
@@ -95,15 +96,14 @@ inline void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
 
 template <typename AlgorithmFPType, CpuType cpu>
 inline void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
-    computeInternal(size_t nFeatures, size_t nVectors,
-                    BlockMicroTable  <AlgorithmFPType, readOnly,  cpu> &mtA,
-                    FeatureMicroTable<AlgorithmFPType, writeOnly, cpu> &mtR,
-                    AlgorithmFPType *location, AlgorithmFPType *scatter, AlgorithmFPType threshold,
-                    AlgorithmFPType *buffer)
+    computeInternal(size_t nFeatures, size_t nVectors, const NumericTable *a, NumericTable *r,
+                    const AlgorithmFPType *location, const AlgorithmFPType *scatter, AlgorithmFPType threshold)
 {
     AlgorithmFPType one  = (AlgorithmFPType)1.0;
     AlgorithmFPType zero = (AlgorithmFPType)0.0;
-    AlgorithmFPType *invScatter         = buffer;
+
+    AlgorithmFPType *invScatter = (AlgorithmFPType *)daal::services::daal_malloc(nFeatures * nFeatures * sizeof(AlgorithmFPType));
+    if (invScatter == NULL) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
 
     for (size_t i = 0; i < nFeatures * nFeatures; i++)
     {
@@ -115,10 +115,10 @@ inline void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
     char uplo = 'U';
     MKL_INT info;
     Lapack<AlgorithmFPType, cpu>::xpotrf(&uplo, &dim, invScatter, &dim, &info);
-    if (info != 0) { this->_errors->add(services::ErrorOutlierDetectionInternal); return; }
+    if (info != 0) { daal::services::daal_free(invScatter); this->_errors->add(services::ErrorOutlierDetectionInternal); return; }
 
     Lapack<AlgorithmFPType, cpu>::xpotri(&uplo, &dim, invScatter, &dim, &info);
-    if (info != 0) { this->_errors->add(services::ErrorOutlierDetectionInternal); return; }
+    if (info != 0) { daal::services::daal_free(invScatter); this->_errors->add(services::ErrorOutlierDetectionInternal); return; }
 
     size_t nBlocks = nVectors / blockSize;
     if (nBlocks * blockSize < nVectors)
@@ -126,24 +126,33 @@ inline void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
         nBlocks++;
     }
 
+    /* Thread local buffers for centered observations and their products with the inverse scatter matrix */
+    daal::tls<AlgorithmFPType *> tlsBuffer( [ = ]()-> AlgorithmFPType *
+    {
+        return (AlgorithmFPType *)daal::services::daal_malloc(2 * nFeatures * blockSize * sizeof(AlgorithmFPType));
+    } );
+
     /* Process input data table in blocks */
-    for (size_t iBlock = 0; iBlock < nBlocks; iBlock++)
+    daal::threader_for(nBlocks, nBlocks, [ =, &tlsBuffer](int iBlock)
     {
+        AlgorithmFPType *buffer = tlsBuffer.local();
+        if (buffer == NULL) { return; }
+
         size_t startRow = iBlock * blockSize;
         size_t nRowsInBlock = blockSize;
         if (startRow + nRowsInBlock > nVectors)
         {
             nRowsInBlock = nVectors - startRow;
         }
-        MKL_INT n = (MKL_INT)nRowsInBlock;
 
+        BlockMicroTable  <AlgorithmFPType, readOnly,  cpu> mtA(a);
+        FeatureMicroTable<AlgorithmFPType, writeOnly, cpu> mtR(r);
         AlgorithmFPType *data, *weight;
         mtA.getBlockOfRows(startRow, nRowsInBlock, &data);
         mtR.getBlockOfColumnValues(0, startRow, nRowsInBlock, &weight);
 
         /* Calculate mahalanobis distances for a block of observations */
-        mahalanobisDistance(nFeatures, nRowsInBlock, data, location, invScatter, weight,
-                            buffer + nFeatures * nFeatures);
+        mahalanobisDistance(nFeatures, nRowsInBlock, data, location, invScatter, weight, buffer);
 
         for (size_t i = 0; i < nRowsInBlock; i++)
         {
@@ -159,19 +168,26 @@ inline void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
 
         mtA.release();
         mtR.release();
-    }
+    } );
+
+    bool allocationFailed = false;
+    tlsBuffer.reduce( [ &allocationFailed ](AlgorithmFPType *buffer)
+    {
+        if (buffer == NULL) { allocationFailed = true; return; }
+        daal::services::daal_free(buffer);
+    } );
+    if (allocationFailed) { this->_errors->add(services::ErrorMemoryAllocationFailed); }
+
+    daal::services::daal_free(invScatter);
 }
 
 template <typename AlgorithmFPType, CpuType cpu>
 void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
-    compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par)
+    compute(const NumericTable *a, NumericTable *r, NumericTable *location, NumericTable *scatter, NumericTable *threshold,
+            const daal::algorithms::Parameter *par)
 {
-
-    /* Create micro-tables for input data and output results */
-    BlockMicroTable  <AlgorithmFPType, readOnly,  cpu> mtA(a);
-    FeatureMicroTable<AlgorithmFPType, writeOnly, cpu> mtR(r);
-    size_t nFeatures = mtA.getFullNumberOfColumns();
-    size_t nVectors  = mtA.getFullNumberOfRows();
+    size_t nFeatures = a->getNumberOfColumns();
+    size_t nVectors  = a->getNumberOfRows();
 
     /* Check algorithm's parameters */
     bool insideAllocatedParameter = false;
@@ -187,6 +203,18 @@ void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
 
     services::SharedPtr<InitIface> initProcedure = innerPar->initializationProcedure;
 
+    /* Fitted values are supplied by the user and are checked before they are copied */
+    FittedInitialization *fitted = dynamic_cast<FittedInitialization *>(initProcedure.get());
+    if (fitted)
+    {
+        services::ErrorID error = fitted->check(nFeatures);
+        if (error != services::NoErrorMessageFound)
+        {
+            this->_errors->add(error);
+            return;
+        }
+    }
+
     services::SharedPtr<daal::internal::HomogenNumericTableCPU<AlgorithmFPType, cpu> > locationTable(
         new daal::internal::HomogenNumericTableCPU<AlgorithmFPType, cpu>(nFeatures, 1));
 
@@ -198,22 +226,19 @@ void OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu>::
 
     (*initProcedure)(const_cast<NumericTable *>(a), locationTable.get(), scatterTable.get(), thresholdTable.get());
 
-    AlgorithmFPType threshold = (thresholdTable->getArray())[0];
-
-    /* Allocate memory for storing intermediate results */
-    size_t bufferSize = nFeatures * nFeatures + 2 * nFeatures * nVectors;
-    AlgorithmFPType *buffer = (AlgorithmFPType *)daal::services::daal_malloc(bufferSize * sizeof(AlgorithmFPType));
-    if (buffer == NULL) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+    AlgorithmFPType thresholdValue = (thresholdTable->getArray())[0];
 
     /* Calculate results */
-    computeInternal(nFeatures, nVectors, mtA, mtR,
+    computeInternal(nFeatures, nVectors, a, r,
                     locationTable->getArray(),
                     scatterTable->getArray(),
-                    threshold,
-                    buffer);
+                    thresholdValue);
+
+    /* Store the parameters of the outlier region if requested */
+    writeOptionalResult<AlgorithmFPType, cpu>(location,  1,         locationTable->getArray());
+    writeOptionalResult<AlgorithmFPType, cpu>(scatter,   nFeatures, scatterTable->getArray());
+    writeOptionalResult<AlgorithmFPType, cpu>(threshold, 1,         thresholdTable->getArray());
 
-    /* Release memory */
-    daal::services::daal_free(buffer);
     if(insideAllocatedParameter) { delete innerPar; }
 }
 
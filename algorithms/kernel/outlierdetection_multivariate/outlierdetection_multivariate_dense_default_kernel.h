@@ -51,19 +51,18 @@ struct OutlierDetectionKernel<AlgorithmFPType, defaultDense, cpu> : public Kerne
     static const size_t blockSize = 1000;
 
     /** \brief Calculate Mahalanobis distance for a block of observations */
-    inline void mahalanobisDistance(size_t nFeatures, size_t nVectors, AlgorithmFPType *data,
-                                    AlgorithmFPType *location, AlgorithmFPType *invScatter, AlgorithmFPType *distance,
+    inline void mahalanobisDistance(size_t nFeatures, size_t nVectors, const AlgorithmFPType *data,
+                                    const AlgorithmFPType *location, AlgorithmFPType *invScatter, AlgorithmFPType *distance,
                                     AlgorithmFPType *buffer);
 
-    /** \brief Detect outliers in the data from input micro-table
-               and store resulting weights into output micro-table */
-    inline void computeInternal(size_t nFeatures, size_t nVectors,
-                                BlockMicroTable  <AlgorithmFPType, readOnly,  cpu> &mtA,
-                                FeatureMicroTable<AlgorithmFPType, writeOnly, cpu> &mtR,
-                                AlgorithmFPType *location, AlgorithmFPType *scatter, AlgorithmFPType threshold,
-                                AlgorithmFPType *buffer);
+    /** \brief Detect outliers in the data from input numeric table
+               and store resulting weights into output numeric table.
+               Blocks of observations are processed in parallel */
+    inline void computeInternal(size_t nFeatures, size_t nVectors, const NumericTable *a, NumericTable *r,
+                                const AlgorithmFPType *location, const AlgorithmFPType *scatter, AlgorithmFPType threshold);
 
-    void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    void compute(const NumericTable *a, NumericTable *r, NumericTable *location, NumericTable *scatter, NumericTable *threshold,
+                 const daal::algorithms::Parameter *par);
 };
 
 } // namespace internal
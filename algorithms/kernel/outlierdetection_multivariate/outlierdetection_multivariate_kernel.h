@@ -83,9 +83,29 @@ struct TemporaryInitialization : public multivariate_outlier_detection::InitIfac
 template <typename AlgorithmFPType, Method method, CpuType cpu>
 struct OutlierDetectionKernel : public Kernel
 {
-    void compute(const NumericTable *a, NumericTable *r, const daal::algorithms::Parameter *par);
+    void compute(const NumericTable *a, NumericTable *r, NumericTable *location, NumericTable *scatter, NumericTable *threshold,
+                 const daal::algorithms::Parameter *par);
 };
 
+/**
+ *  \brief Copies an array of nRows x nColumns values into the optional result numeric table
+ */
+template <typename AlgorithmFPType, CpuType cpu>
+inline void writeOptionalResult(NumericTable *table, size_t nRows, const AlgorithmFPType *values)
+{
+    if (table == NULL) { return; }
+
+    BlockDescriptor<AlgorithmFPType> block;
+    table->getBlockOfRows(0, nRows, writeOnly, block);
+    AlgorithmFPType *array = block.getBlockPtr();
+    size_t nValues = nRows * table->getNumberOfColumns();
+    for (size_t i = 0; i < nValues; i++)
+    {
+        array[i] = values[i];
+    }
+    table->releaseBlockOfRows(block);
+}
+
 } // namespace internal
 
 } // namespace multivariate_outlier_detection
@@ -27,6 +27,7 @@
 #include "pca_types.h"
 #include "service_lapack.h"
 #include "service_defines.h"
+#include "service_micro_table.h"
 #include "services/error_handling.h"
 
 using namespace daal::internal;
@@ -57,6 +58,8 @@ protected:
 
 private:
     void copyArray(size_t size, algorithmFPType *source, algorithmFPType *destination);
+    void unpackSymmetricMatrix(size_t nFeatures, data_management::NumericTableIface::StorageLayout layout,
+                               const algorithmFPType *packed, algorithmFPType *full);
 };
 
 template <typename algorithmFPType, CpuType cpu>
@@ -71,6 +74,36 @@ void PCACorrelationBase<algorithmFPType, cpu>::copyArray(size_t size, algorithmF
     }
 }
 
+template <typename algorithmFPType, CpuType cpu>
+void PCACorrelationBase<algorithmFPType, cpu>::unpackSymmetricMatrix(size_t nFeatures,
+                                                                     data_management::NumericTableIface::StorageLayout layout,
+                                                                     const algorithmFPType *packed, algorithmFPType *full)
+{
+    size_t index = 0;
+    if (layout == data_management::NumericTableIface::lowerPackedSymmetricMatrix)
+    {
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            for (size_t j = 0; j <= i; j++, index++)
+            {
+                full[i * nFeatures + j] = packed[index];
+                full[j * nFeatures + i] = packed[index];
+            }
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < nFeatures; i++)
+        {
+            for (size_t j = i; j < nFeatures; j++, index++)
+            {
+                full[i * nFeatures + j] = packed[index];
+                full[j * nFeatures + i] = packed[index];
+            }
+        }
+    }
+}
+
 template <typename algorithmFPType, CpuType cpu>
 void PCACorrelationBase<algorithmFPType, cpu>::computeCorrelationEigenvalues(
     const services::SharedPtr<data_management::NumericTable> correlation,
@@ -81,10 +114,6 @@ void PCACorrelationBase<algorithmFPType, cpu>::computeCorrelationEigenvalues(
 
     size_t nFeatures = correlation->getNumberOfColumns();
 
-    BlockDescriptor<algorithmFPType> correlationBlock;
-    correlation->getBlockOfRows(0, nFeatures, data_management::readOnly, correlationBlock);
-    algorithmFPType *correlationArray = correlationBlock.getBlockPtr();
-
     BlockDescriptor<algorithmFPType> eigenvectorsBlock;
     eigenvectors->getBlockOfRows(0, nFeatures, data_management::writeOnly, eigenvectorsBlock);
     algorithmFPType *eigenvectorsArray = eigenvectorsBlock.getBlockPtr();
@@ -93,12 +122,28 @@ void PCACorrelationBase<algorithmFPType, cpu>::computeCorrelationEigenvalues(
     eigenvalues->getBlockOfRows(0, 1, data_management::writeOnly, eigenvaluesBlock);
     algorithmFPType *eigenvaluesArray = eigenvaluesBlock.getBlockPtr();
 
-    copyArray(nFeatures * nFeatures, correlationArray, eigenvectorsArray);
+    data_management::NumericTableIface::StorageLayout layout = correlation->getDataLayout();
+    if (layout == data_management::NumericTableIface::lowerPackedSymmetricMatrix ||
+        layout == data_management::NumericTableIface::upperPackedSymmetricMatrix)
+    {
+        /* Unpack the correlation matrix directly into the eigenvectors */
+        PackedArrayMicroTable<algorithmFPType, data_management::readOnly, cpu> mtCorrelation(correlation.get());
+        algorithmFPType *packedCorrelation;
+        mtCorrelation.getPackedArray(&packedCorrelation);
+        unpackSymmetricMatrix(nFeatures, layout, packedCorrelation, eigenvectorsArray);
+        mtCorrelation.release();
+    }
+    else
+    {
+        BlockDescriptor<algorithmFPType> correlationBlock;
+        correlation->getBlockOfRows(0, nFeatures, data_management::readOnly, correlationBlock);
+        copyArray(nFeatures * nFeatures, correlationBlock.getBlockPtr(), eigenvectorsArray);
+        correlation->releaseBlockOfRows(correlationBlock);
+    }
 
     computeEigenvectorsInplace(nFeatures, eigenvectorsArray, eigenvaluesArray);
     sortEigenvectorsDescending(nFeatures, eigenvectorsArray, eigenvaluesArray);
 
-    correlation->releaseBlockOfRows(correlationBlock);
     eigenvectors->releaseBlockOfRows(eigenvectorsBlock);
     eigenvalues->releaseBlockOfRows(eigenvaluesBlock);
 }
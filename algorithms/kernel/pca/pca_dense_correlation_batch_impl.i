@@ -27,6 +27,7 @@
 #include "service_math.h"
 #include "service_memory.h"
 #include "service_numeric_table.h"
+#include "symmetric_matrix.h"
 #include "pca_dense_correlation_batch_kernel.h"
 
 namespace daal
@@ -48,6 +49,19 @@ void PCACorrelationKernel<batch, algorithmFPType, cpu>::compute(const services::
     services::SharedPtr<data_management::NumericTable> correlation;
     if(!isCorrelation)
     {
+        services::SharedPtr<covariance::Result> covarianceResult = parameter->covariance->getResult();
+        if (!covarianceResult->get(covariance::covariance))
+        {
+            /* The correlation matrix is only used to compute the eigenvectors, so it is stored in the packed format */
+            size_t nFeatures = data->getNumberOfColumns();
+            covarianceResult->set(covariance::covariance, services::SharedPtr<data_management::NumericTable>(
+                new data_management::PackedSymmetricMatrix<data_management::NumericTableIface::lowerPackedSymmetricMatrix, algorithmFPType>(
+                    nFeatures, data_management::NumericTable::doAllocate)));
+            covarianceResult->set(covariance::mean, services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, 1, data_management::NumericTable::doAllocate)));
+            parameter->covariance->setResult(covarianceResult);
+        }
+
         parameter->covariance->input.set(covariance::data, data);
         parameter->covariance->parameter.outputMatrixType = covariance::correlationMatrix;
 
@@ -0,0 +1,574 @@
+/* file: profiler.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the profiler.
+//
+//  Every thread appends the recorded regions to its own log, so the recording
+//  does not take locks. The logs are linked into a list when the thread records
+//  its first region and are kept until the process exits.
+//--
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "tbb/atomic.h"
+#include "tbb/tick_count.h"
+
+#include "daal_profiler.h"
+#include "service_profiler.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+    #define __DAAL_THREAD_LOCAL __declspec(thread)
+#else
+    #define __DAAL_THREAD_LOCAL __thread
+#endif
+
+namespace daal
+{
+namespace internal
+{
+
+volatile int profilerEnabled = 0;
+
+namespace
+{
+
+const size_t eventsInChunk  = 4096;
+const size_t maxCounters    = 64;
+const size_t maxFileNameLen = 1024;
+
+struct Event
+{
+    const char *name;
+    double start;           /* Microseconds since the epoch of the profiler */
+    double duration;        /* Microseconds */
+    size_t allocatedBytes;
+};
+
+struct EventChunk
+{
+    Event events[eventsInChunk];
+    tbb::atomic<size_t> size;
+    tbb::atomic<EventChunk *> next;
+};
+
+struct Counter
+{
+    const char *name;
+    size_t value;
+};
+
+struct ThreadLog
+{
+    int tid;
+    EventChunk *first;
+    EventChunk *last;
+    size_t allocatedBytes;
+    Counter counters[maxCounters];
+    tbb::atomic<size_t> nCounters;
+    ThreadLog *next;
+};
+
+/* Aggregated statistics of the regions with the same name */
+struct RegionStat
+{
+    const char *name;
+    size_t calls;
+    double total;
+    double min;
+    double max;
+    size_t allocatedBytes;
+    size_t nThreads;
+    int lastTid;
+};
+
+struct Interval
+{
+    double start;
+    double end;
+};
+
+tbb::atomic<ThreadLog *> threadLogs;
+tbb::atomic<int> nThreadLogs;
+tbb::tick_count epoch;
+
+__DAAL_THREAD_LOCAL ThreadLog *localLog = 0;
+__DAAL_THREAD_LOCAL int kernelDepth = 0;
+
+EventChunk *newChunk()
+{
+    EventChunk *chunk = (EventChunk *)std::malloc(sizeof(EventChunk));
+    if (chunk)
+    {
+        chunk->size = 0;
+        chunk->next = 0;
+    }
+    return chunk;
+}
+
+ThreadLog *getLocalLog()
+{
+    if (localLog) { return localLog; }
+
+    ThreadLog *log = (ThreadLog *)std::calloc(1, sizeof(ThreadLog));
+    if (!log) { return 0; }
+    log->first = log->last = newChunk();
+    if (!log->first)
+    {
+        std::free(log);
+        return 0;
+    }
+    log->tid = nThreadLogs.fetch_and_increment();
+
+    ThreadLog *head;
+    do
+    {
+        head = threadLogs;
+        log->next = head;
+    }
+    while (threadLogs.compare_and_swap(log, head) != head);
+
+    localLog = log;
+    return log;
+}
+
+bool sameName(const char *a, const char *b)
+{
+    return a == b || std::strcmp(a, b) == 0;
+}
+
+void writeEscaped(FILE *f, const char *str)
+{
+    for (; *str; str++)
+    {
+        if (*str == '"' || *str == '\\') { std::fputc('\\', f); }
+        std::fputc(*str, f);
+    }
+}
+
+int compareIntervals(const void *a, const void *b)
+{
+    double sa = ((const Interval *)a)->start;
+    double sb = ((const Interval *)b)->start;
+    return (sa < sb) ? -1 : (sa > sb);
+}
+
+int compareStats(const void *a, const void *b)
+{
+    double ta = ((const RegionStat *)a)->total;
+    double tb = ((const RegionStat *)b)->total;
+    return (ta > tb) ? -1 : (ta < tb);
+}
+
+/* Returns the time covered by the regions of the thread, nested regions are counted once */
+double getBusyTime(const ThreadLog *log, Interval *intervals)
+{
+    size_t n = 0;
+    for (const EventChunk *chunk = log->first; chunk; chunk = chunk->next)
+    {
+        size_t size = chunk->size;
+        for (size_t i = 0; i < size; i++)
+        {
+            intervals[n].start = chunk->events[i].start;
+            intervals[n].end   = chunk->events[i].start + chunk->events[i].duration;
+            n++;
+        }
+    }
+    if (n == 0) { return 0.0; }
+
+    std::qsort(intervals, n, sizeof(Interval), compareIntervals);
+
+    double busy  = 0.0;
+    double start = intervals[0].start;
+    double end   = intervals[0].end;
+    for (size_t i = 1; i < n; i++)
+    {
+        if (intervals[i].start > end)
+        {
+            busy += end - start;
+            start = intervals[i].start;
+        }
+        if (intervals[i].end > end) { end = intervals[i].end; }
+    }
+    return busy + (end - start);
+}
+
+/* Sums the counter over all threads. Returns false if the counter is already reported with a preceding log */
+bool getCounterTotal(const ThreadLog *log, const char *name, size_t &value)
+{
+    for (const ThreadLog *prev = threadLogs; prev != log; prev = prev->next)
+    {
+        for (size_t j = 0; j < prev->nCounters; j++)
+        {
+            if (sameName(prev->counters[j].name, name)) { return false; }
+        }
+    }
+
+    value = 0;
+    for (const ThreadLog *other = log; other; other = other->next)
+    {
+        for (size_t j = 0; j < other->nCounters; j++)
+        {
+            if (sameName(other->counters[j].name, name)) { value += other->counters[j].value; }
+        }
+    }
+    return true;
+}
+
+size_t getNumberOfThreadEvents(const ThreadLog *log)
+{
+    size_t n = 0;
+    for (const EventChunk *chunk = log->first; chunk; chunk = chunk->next) { n += chunk->size; }
+    return n;
+}
+
+char traceFileName[maxFileNameLen];
+char summaryFileName[maxFileNameLen];
+
+void getFileName(const char *variable, char *fileName)
+{
+    const char *value = std::getenv(variable);
+    if (value && std::strlen(value) < maxFileNameLen) { std::strcpy(fileName, value); }
+}
+
+/* Enables the profiler according to the environment variables and writes the results at exit */
+struct ProfilerEnvironment
+{
+    ProfilerEnvironment()
+    {
+        epoch = tbb::tick_count::now();
+        getFileName("DAAL_PROFILE",         traceFileName);
+        getFileName("DAAL_PROFILE_SUMMARY", summaryFileName);
+        if (traceFileName[0] || summaryFileName[0])
+        {
+            services::Profiler::getInstance()->enable();
+        }
+    }
+
+    ~ProfilerEnvironment()
+    {
+        if (traceFileName[0])   { services::Profiler::getInstance()->writeChromeTrace(traceFileName); }
+        if (summaryFileName[0]) { services::Profiler::getInstance()->writeSummary(summaryFileName); }
+    }
+};
+
+ProfilerEnvironment profilerEnvironment;
+
+} // namespace
+
+double profilerNow()
+{
+    return (tbb::tick_count::now() - epoch).seconds() * 1.0e6;
+}
+
+size_t profilerAllocatedBytes()
+{
+    ThreadLog *log = getLocalLog();
+    return log ? log->allocatedBytes : 0;
+}
+
+void profilerRecordTask(const char *name, double start, size_t allocatedBytes)
+{
+    double end = profilerNow();
+    ThreadLog *log = getLocalLog();
+    if (!log) { return; }
+
+    EventChunk *chunk = log->last;
+    size_t size = chunk->size;
+    if (size == eventsInChunk)
+    {
+        EventChunk *next = newChunk();
+        if (!next) { return; }
+        chunk->next = next;
+        log->last = next;
+        chunk = next;
+        size = 0;
+    }
+
+    Event &event = chunk->events[size];
+    event.name           = name;
+    event.start          = start;
+    event.duration       = end - start;
+    event.allocatedBytes = log->allocatedBytes - allocatedBytes;
+    chunk->size = size + 1;
+}
+
+void profilerCount(const char *name, size_t value)
+{
+    ThreadLog *log = getLocalLog();
+    if (!log) { return; }
+
+    size_t nCounters = log->nCounters;
+    for (size_t i = 0; i < nCounters; i++)
+    {
+        if (sameName(log->counters[i].name, name))
+        {
+            log->counters[i].value += value;
+            return;
+        }
+    }
+    if (nCounters < maxCounters)
+    {
+        log->counters[nCounters].name  = name;
+        log->counters[nCounters].value = value;
+        log->nCounters = nCounters + 1;
+    }
+}
+
+void profilerAllocate(size_t size)
+{
+    ThreadLog *log = getLocalLog();
+    if (log) { log->allocatedBytes += size; }
+}
+
+bool profilerEnterKernel()
+{
+    return kernelDepth++ == 0;
+}
+
+void profilerLeaveKernel()
+{
+    kernelDepth--;
+}
+
+} // namespace internal
+} // namespace daal
+
+using namespace daal::internal;
+
+DAAL_EXPORT daal::services::Profiler *daal::services::Profiler::getInstance()
+{
+    static daal::services::Profiler instance;
+    return &instance;
+}
+
+DAAL_EXPORT daal::services::Profiler::Profiler() {}
+
+DAAL_EXPORT daal::services::Profiler::~Profiler() {}
+
+DAAL_EXPORT void daal::services::Profiler::enable()
+{
+#if !defined(DAAL_DISABLE_PROFILER)
+    profilerEnabled = 1;
+#endif
+}
+
+DAAL_EXPORT void daal::services::Profiler::disable()
+{
+    profilerEnabled = 0;
+}
+
+DAAL_EXPORT bool daal::services::Profiler::isEnabled() const
+{
+    return profilerEnabled != 0;
+}
+
+DAAL_EXPORT void daal::services::Profiler::reset()
+{
+    for (ThreadLog *log = threadLogs; log; log = log->next)
+    {
+        EventChunk *chunk = log->first->next;
+        while (chunk)
+        {
+            EventChunk *next = chunk->next;
+            std::free(chunk);
+            chunk = next;
+        }
+        log->first->size = 0;
+        log->first->next = 0;
+        log->last = log->first;
+        log->allocatedBytes = 0;
+        log->nCounters = 0;
+    }
+    epoch = tbb::tick_count::now();
+}
+
+DAAL_EXPORT size_t daal::services::Profiler::getNumberOfEvents() const
+{
+    size_t n = 0;
+    for (const ThreadLog *log = threadLogs; log; log = log->next) { n += getNumberOfThreadEvents(log); }
+    return n;
+}
+
+DAAL_EXPORT bool daal::services::Profiler::writeChromeTrace(const char *fileName) const
+{
+    FILE *f = std::fopen(fileName, "w");
+    if (!f) { return false; }
+
+    std::fprintf(f, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    std::fprintf(f, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"Intel(R) DAAL\"}}");
+
+    double traceEnd = 0.0;
+    for (const ThreadLog *log = threadLogs; log; log = log->next)
+    {
+        std::fprintf(f, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+                     log->tid, log->tid);
+        for (const EventChunk *chunk = log->first; chunk; chunk = chunk->next)
+        {
+            size_t size = chunk->size;
+            for (size_t i = 0; i < size; i++)
+            {
+                const Event &event = chunk->events[i];
+                std::fprintf(f, ",\n{\"name\":\"");
+                writeEscaped(f, event.name);
+                std::fprintf(f, "\",\"cat\":\"daal\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,"
+                             "\"args\":{\"allocated_bytes\":%lu}}",
+                             log->tid, event.start, event.duration, (unsigned long)event.allocatedBytes);
+                if (event.start + event.duration > traceEnd) { traceEnd = event.start + event.duration; }
+            }
+        }
+    }
+
+    /* Counters are reported once with the totals over all threads */
+    for (const ThreadLog *log = threadLogs; log; log = log->next)
+    {
+        size_t nCounters = log->nCounters;
+        for (size_t i = 0; i < nCounters; i++)
+        {
+            const char *name = log->counters[i].name;
+            size_t value;
+            if (!getCounterTotal(log, name, value)) { continue; }
+
+            std::fprintf(f, ",\n{\"name\":\"");
+            writeEscaped(f, name);
+            std::fprintf(f, "\",\"cat\":\"daal\",\"ph\":\"C\",\"pid\":0,\"tid\":0,\"ts\":%.3f,\"args\":{\"value\":%lu}}",
+                         traceEnd, (unsigned long)value);
+        }
+    }
+
+    std::fprintf(f, "\n]}\n");
+    return std::fclose(f) == 0;
+}
+
+DAAL_EXPORT bool daal::services::Profiler::writeSummary(const char *fileName) const
+{
+    size_t nStats = 0;
+    size_t maxStats = 64;
+    size_t maxThreadEvents = 0;
+    RegionStat *stats = (RegionStat *)std::malloc(maxStats * sizeof(RegionStat));
+    if (!stats) { return false; }
+
+    double traceStart = 0.0, traceEnd = 0.0;
+    bool first = true;
+    for (const ThreadLog *log = threadLogs; log; log = log->next)
+    {
+        size_t nThreadEvents = getNumberOfThreadEvents(log);
+        if (nThreadEvents > maxThreadEvents) { maxThreadEvents = nThreadEvents; }
+
+        for (const EventChunk *chunk = log->first; chunk; chunk = chunk->next)
+        {
+            size_t size = chunk->size;
+            for (size_t i = 0; i < size; i++)
+            {
+                const Event &event = chunk->events[i];
+                if (first || event.start < traceStart) { traceStart = event.start; }
+                if (first || event.start + event.duration > traceEnd) { traceEnd = event.start + event.duration; }
+                first = false;
+
+                size_t k = 0;
+                while (k < nStats && !sameName(stats[k].name, event.name)) { k++; }
+                if (k == nStats)
+                {
+                    if (nStats == maxStats)
+                    {
+                        RegionStat *newStats = (RegionStat *)std::realloc(stats, 2 * maxStats * sizeof(RegionStat));
+                        if (!newStats) { std::free(stats); return false; }
+                        stats = newStats;
+                        maxStats *= 2;
+                    }
+                    RegionStat &stat = stats[nStats++];
+                    stat.name           = event.name;
+                    stat.calls          = 0;
+                    stat.total          = 0.0;
+                    stat.min            = event.duration;
+                    stat.max            = event.duration;
+                    stat.allocatedBytes = 0;
+                    stat.nThreads       = 0;
+                    stat.lastTid        = -1;
+                }
+
+                RegionStat &stat = stats[k];
+                stat.calls++;
+                stat.total          += event.duration;
+                stat.allocatedBytes += event.allocatedBytes;
+                if (event.duration < stat.min) { stat.min = event.duration; }
+                if (event.duration > stat.max) { stat.max = event.duration; }
+                if (stat.lastTid != log->tid)
+                {
+                    stat.nThreads++;
+                    stat.lastTid = log->tid;
+                }
+            }
+        }
+    }
+
+    FILE *f = std::fopen(fileName, "w");
+    if (!f) { std::free(stats); return false; }
+
+    std::qsort(stats, nStats, sizeof(RegionStat), compareStats);
+
+    std::fprintf(f, "%-56s %10s %12s %12s %12s %12s %8s %14s\n",
+                 "Region", "Calls", "Total, ms", "Mean, ms", "Min, ms", "Max, ms", "Threads", "Allocated, KB");
+    for (size_t k = 0; k < nStats; k++)
+    {
+        const RegionStat &stat = stats[k];
+        std::fprintf(f, "%-56s %10lu %12.3f %12.3f %12.3f %12.3f %8lu %14lu\n", stat.name, (unsigned long)stat.calls,
+                     stat.total * 1.0e-3, stat.total * 1.0e-3 / stat.calls, stat.min * 1.0e-3, stat.max * 1.0e-3,
+                     (unsigned long)stat.nThreads, (unsigned long)(stat.allocatedBytes / 1024));
+    }
+    std::free(stats);
+
+    std::fprintf(f, "\n%-56s %14s\n", "Counter", "Value");
+    for (const ThreadLog *log = threadLogs; log; log = log->next)
+    {
+        for (size_t i = 0; i < log->nCounters; i++)
+        {
+            const char *name = log->counters[i].name;
+            size_t value;
+            if (!getCounterTotal(log, name, value)) { continue; }
+
+            std::fprintf(f, "%-56s %14lu\n", name, (unsigned long)value);
+        }
+    }
+
+    /* Utilization is the share of the time from the first to the last region that the thread spent in regions */
+    double wall = traceEnd - traceStart;
+    Interval *intervals = (Interval *)std::malloc((maxThreadEvents ? maxThreadEvents : 1) * sizeof(Interval));
+    if (intervals && wall > 0.0)
+    {
+        double totalBusy = 0.0;
+        size_t nThreads = 0;
+        std::fprintf(f, "\n%-10s %12s %12s\n", "Thread", "Busy, ms", "Busy, %");
+        for (const ThreadLog *log = threadLogs; log; log = log->next)
+        {
+            double busy = getBusyTime(log, intervals);
+            if (busy == 0.0) { continue; }
+            std::fprintf(f, "%-10d %12.3f %12.1f\n", log->tid, busy * 1.0e-3, 100.0 * busy / wall);
+            totalBusy += busy;
+            nThreads++;
+        }
+        std::fprintf(f, "\nWall time %.3f ms, %lu threads, utilization %.1f%%\n",
+                     wall * 1.0e-3, (unsigned long)nThreads, 100.0 * totalBusy / (wall * nThreads));
+    }
+    std::free(intervals);
+
+    return std::fclose(f) == 0;
+}
@@ -65,6 +65,41 @@ void QRBatchKernel<interm, method, cpu>::compute(const size_t na, const NumericT
     MKL_INT ldAi = m;
     MKL_INT ldRi = n;
 
+    size_t nBlocks = getNumberOfTSQRBlocks<cpu>( m, n );
+    if ( nBlocks > 1 )
+    {
+        interm *RiT = (interm *)daal::services::daal_malloc(n * n * sizeof(interm));
+        if ( !RiT ) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        ServiceStatus status = compute_TSQR<interm, cpu>( nBlocks, ntAi, r[0], RiT, ldRi );
+        if ( status != SERV_ERR_OK )
+        {
+            daal::services::daal_free(RiT);
+            this->_errors->add(status == SERV_ERR_MALLOC ? services::ErrorMemoryAllocationFailed : services::ErrorQRInternal);
+            return;
+        }
+
+        BlockDescriptor<interm> riBlock;
+        ntRi->getBlockOfRows( 0, n, writeOnly, riBlock ); /* Ri = Ri [n][n] */
+        interm *Ri = riBlock.getBlockPtr();
+
+        for ( i = 0 ; i < n ; i++ )
+        {
+            for ( j = 0 ; j <= i; j++ )
+            {
+                Ri[i + j * n] = RiT[i * n + j];
+            }
+            for (     ; j < n; j++ )
+            {
+                Ri[i + j * n] = 0.0;
+            }
+        }
+
+        ntRi->releaseBlockOfRows( riBlock );
+        daal::services::daal_free(RiT);
+        return;
+    }
+
     interm *QiT = (interm *)daal::services::daal_malloc(n * m * sizeof(interm));
     interm *RiT = (interm *)daal::services::daal_malloc(n * n * sizeof(interm));
 
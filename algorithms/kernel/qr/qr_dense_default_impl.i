@@ -113,6 +113,249 @@ ServiceStatus compute_QR_on_one_node( MKL_INT m, MKL_INT n, interm *a_q, MKL_INT
     return SERV_ERR_OK;
 }
 
+/*
+    Sequential version of compute_QR_on_one_node, safe to call from inside a parallel region.
+    Formation of Q is skipped if computeQ is false.
+*/
+template <typename interm, CpuType cpu>
+ServiceStatus compute_QR_on_one_node_seq( MKL_INT m, MKL_INT n, interm *a_q, MKL_INT lda_q, interm *r,
+                                          MKL_INT ldr, bool computeQ = true )
+{
+    typedef Lapack<interm, cpu> lapack;
+
+    interm *tau = (interm *)daal::services::daal_malloc( sizeof(interm) * n );
+    if ( !tau ) { return SERV_ERR_MALLOC; }
+
+    interm  workQuery[2];
+
+    MKL_INT mklStatus =  0;
+    MKL_INT workDim   = -1;
+
+    lapack::xxgeqrf( m, n, a_q, lda_q, tau, workQuery, workDim, &mklStatus );
+    workDim = workQuery[0];
+
+    interm *work = (interm *)daal::services::daal_malloc( sizeof(interm) * workDim );
+    if ( !work )
+    {
+        daal::services::daal_free(tau);
+        return SERV_ERR_MALLOC;
+    }
+
+    lapack::xxgeqrf( m, n, a_q, lda_q, tau, work, workDim, &mklStatus );
+
+    if ( mklStatus != 0 )
+    {
+        daal::services::daal_free(tau);
+        daal::services::daal_free(work);
+        return SERV_ERR_MKL_QR_ITH_PARAM_ILLEGAL_VALUE;
+    }
+
+    MKL_INT i, j;
+    for ( i = 1; i <= n; i++ )
+    {
+        for ( j = 0; j < i; j++ )
+        {
+            r[(i - 1)*ldr + j] = a_q[(i - 1) * lda_q + j];
+        }
+    }
+
+    if ( computeQ )
+    {
+        lapack::xxorgqr( m, n, n, a_q, lda_q, tau, work, workDim, &mklStatus );
+    }
+
+    daal::services::daal_free(tau);
+    daal::services::daal_free(work);
+
+    if ( mklStatus != 0 )
+    {
+        return SERV_ERR_MKL_QR_ITH_PARAM_ILLEGAL_VALUE;
+    }
+
+    return SERV_ERR_OK;
+}
+
+/* Minimal number of rows in one block of the tall-skinny QR decomposition */
+const size_t tsqrMinRowsInBlock = 4096;
+
+/*
+    Number of row blocks the tall-skinny QR decomposition splits the m x n matrix into.
+    Value 1 means that the matrix is too small to benefit from the splitting.
+*/
+template <CpuType cpu>
+size_t getNumberOfTSQRBlocks( size_t m, size_t n )
+{
+    size_t minRowsInBlock = 2 * n;
+    if ( minRowsInBlock < tsqrMinRowsInBlock ) { minRowsInBlock = tsqrMinRowsInBlock; }
+
+    size_t nBlocks  = m / minRowsInBlock;
+    size_t nThreads = threader_get_threads_number();
+    if ( nBlocks > nThreads ) { nBlocks = nThreads; }
+
+    return ( nBlocks > 0 ? nBlocks : 1 );
+}
+
+/*
+    Tall-skinny QR decomposition (TSQR) of the matrix A split into nBlocks row blocks.
+    Blocks are factored in parallel (step 1), R factors of the blocks are stacked and factored
+    once more (step 2), and the n x n pieces of the second Q are applied to the Q factors
+    of the blocks in parallel (step 3). Blocks are transposed into per-block buffers only,
+    so no full-size copy of A or Q is created.
+  Input:
+    ntA : A (m x n), m >= nBlocks * n
+  Output:
+    ntQ : Qn(m x n) = n leading columns of orthogonal Q, not computed if ntQ is NULL
+    r   : r[n][ldr] -> R (n x n) = upper triangular matrix written in lower triangular
+*/
+template <typename interm, CpuType cpu>
+ServiceStatus compute_TSQR( size_t nBlocks, const NumericTable *ntA, NumericTable *ntQ, interm *r, MKL_INT ldr )
+{
+    const size_t n   = ntA->getNumberOfColumns();
+    const size_t m   = ntA->getNumberOfRows();
+    const size_t nxb = n * nBlocks;
+    const size_t rowsInBlock = m / nBlocks;
+
+    /* Stacked R factors of the blocks, column-major (nxb x n) */
+    interm *RStack = (interm *)daal::services::daal_malloc( sizeof(interm) * n * nxb );
+    /* n x n pieces of the Q factor of RStack, row-major */
+    interm *Q2     = (interm *)daal::services::daal_malloc( sizeof(interm) * n * nxb );
+
+    /* Status of every block, reduced after each parallel step */
+    ServiceStatus *blockStatus = (ServiceStatus *)daal::services::daal_malloc( sizeof(ServiceStatus) * nBlocks );
+
+    if ( !RStack || !Q2 || !blockStatus )
+    {
+        if ( RStack )      { daal::services::daal_free( RStack ); }
+        if ( Q2 )          { daal::services::daal_free( Q2 ); }
+        if ( blockStatus ) { daal::services::daal_free( blockStatus ); }
+        return SERV_ERR_MALLOC;
+    }
+
+    /* Step 1: QR decomposition of each row block */
+    daal::threader_for( nBlocks, nBlocks, [=](int k)
+    {
+        const size_t row0 = k * rowsInBlock;
+        const size_t mk   = ( k == nBlocks - 1 ) ? m - row0 : rowsInBlock;
+
+        interm *QkT = (interm *)daal::services::daal_malloc( sizeof(interm) * n * mk );
+        interm *RkT = (interm *)daal::services::daal_malloc( sizeof(interm) * n * n  );
+        if ( !QkT || !RkT )
+        {
+            if ( QkT ) { daal::services::daal_free( QkT ); }
+            if ( RkT ) { daal::services::daal_free( RkT ); }
+            blockStatus[k] = SERV_ERR_MALLOC;
+            return;
+        }
+
+        interm *Ak;
+        BlockMicroTable<interm, readOnly, cpu> mtA( ntA );
+        mtA.getBlockOfRows( row0, mk, &Ak );
+        for ( size_t i = 0 ; i < mk ; i++ )
+        {
+            for ( size_t j = 0 ; j < n ; j++ )
+            {
+                QkT[j * mk + i] = Ak[i * n + j];
+            }
+        }
+        mtA.release();
+
+        blockStatus[k] = compute_QR_on_one_node_seq<interm, cpu>( mk, n, QkT, mk, RkT, n, ntQ != 0 );
+
+        for ( size_t j = 0 ; j < n ; j++ )
+        {
+            for ( size_t i = 0 ; i <= j ; i++ )
+            {
+                RStack[j * nxb + k * n + i] = RkT[j * n + i];
+            }
+            for ( size_t i = j + 1 ; i < n ; i++ )
+            {
+                RStack[j * nxb + k * n + i] = 0.0;
+            }
+        }
+
+        if ( ntQ )
+        {
+            interm *Qk;
+            BlockMicroTable<interm, writeOnly, cpu> mtQ( ntQ );
+            mtQ.getBlockOfRows( row0, mk, &Qk );
+            for ( size_t i = 0 ; i < mk ; i++ )
+            {
+                for ( size_t j = 0 ; j < n ; j++ )
+                {
+                    Qk[i * n + j] = QkT[j * mk + i];
+                }
+            }
+            mtQ.release();
+        }
+
+        daal::services::daal_free( QkT );
+        daal::services::daal_free( RkT );
+    } );
+
+    ServiceStatus status = SERV_ERR_OK;
+    for ( size_t k = 0 ; k < nBlocks ; k++ )
+    {
+        if ( blockStatus[k] != SERV_ERR_OK ) { status = blockStatus[k]; }
+    }
+
+    /* Step 2: QR decomposition of the stacked R factors */
+    if ( status == SERV_ERR_OK )
+    {
+        status = compute_QR_on_one_node<interm, cpu>( nxb, n, RStack, nxb, r, ldr );
+    }
+
+    /* Step 3: Qk = Qk * Q2k for each row block */
+    if ( status == SERV_ERR_OK && ntQ )
+    {
+        daal::threader_for( nBlocks, nBlocks, [=](int k)
+        {
+            interm *Q2k = Q2 + k * n * n;
+            for ( size_t i = 0 ; i < n ; i++ )
+            {
+                for ( size_t j = 0 ; j < n ; j++ )
+                {
+                    Q2k[i * n + j] = RStack[j * nxb + k * n + i];
+                }
+            }
+
+            const size_t row0 = k * rowsInBlock;
+            const size_t mk   = ( k == nBlocks - 1 ) ? m - row0 : rowsInBlock;
+
+            interm *QkNew = (interm *)daal::services::daal_malloc( sizeof(interm) * n * mk );
+            if ( !QkNew ) { blockStatus[k] = SERV_ERR_MALLOC; return; }
+
+            interm *Qk;
+            BlockMicroTable<interm, readWrite, cpu> mtQ( ntQ );
+            mtQ.getBlockOfRows( row0, mk, &Qk );
+
+            /* Row-major Qk * Q2k is computed as column-major Q2k' * Qk' */
+            char notrans = 'N';
+            interm one  = interm(1.0);
+            interm zero = interm(0.0);
+            MKL_INT nn  = n;
+            MKL_INT mkk = mk;
+            Blas<interm, cpu>::xxgemm( &notrans, &notrans, &nn, &mkk, &nn, &one, Q2k, &nn, Qk, &nn, &zero, QkNew, &nn );
+
+            daal::services::daal_memcpy_s( Qk, sizeof(interm) * n * mk, QkNew, sizeof(interm) * n * mk );
+
+            mtQ.release();
+
+            daal::services::daal_free( QkNew );
+        } );
+
+        for ( size_t k = 0 ; k < nBlocks ; k++ )
+        {
+            if ( blockStatus[k] != SERV_ERR_OK ) { status = blockStatus[k]; }
+        }
+    }
+
+    daal::services::daal_free( blockStatus );
+    daal::services::daal_free( RStack );
+    daal::services::daal_free( Q2 );
+
+    return status;
+}
+
 template <typename interm, CpuType cpu>
 ServiceStatus compute_gemm_on_one_node( MKL_INT m, MKL_INT n, interm *a, MKL_INT lda, interm *b, MKL_INT ldb,
                                         interm *c, MKL_INT ldc)
@@ -0,0 +1,42 @@
+/* file: quantiles_dense_default_distr_step1_fpt_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of quantiles kernel for the first step of the distributed processing mode.
+//--
+*/
+
+#include "quantiles_distributed_container.h"
+#include "quantiles_kernel.h"
+#include "quantiles_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace interface1
+{
+
+template class DistributedContainer<step1Local, DAAL_FPTYPE, defaultDense, DAAL_CPU>;
+
+}
+} // namespace daal::algorithms::quantiles
+} // namespace daal::algorithms
+} // namespace daal
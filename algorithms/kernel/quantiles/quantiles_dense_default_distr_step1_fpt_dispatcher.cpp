@@ -0,0 +1,35 @@
+/* file: quantiles_dense_default_distr_step1_fpt_dispatcher.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of quantiles DistributedContainer for the first step of the distributed processing mode.
+//--
+*/
+
+#include "quantiles_distributed_container.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace interface1
+{
+__DAAL_INSTANTIATE_DISPATCH_CONATINER(quantiles::DistributedContainer, distributed, step1Local, DAAL_FPTYPE, quantiles::defaultDense)
+}
+} // namespace daal::algorithms
+} // namespace daal
@@ -0,0 +1,154 @@
+/* file: quantiles_distributed_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the quantiles algorithm in the distributed processing mode.
+//  The sketches computed on local nodes are merged one by one into the sketch of the master node.
+//--
+*/
+
+#ifndef __QUANTILES_DISTRIBUTED_IMPL_I__
+#define __QUANTILES_DISTRIBUTED_IMPL_I__
+
+#include "quantiles_online_impl.i"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesDistributedKernel<method, algorithmFPType, cpu>::compute(DataCollection *partialResultsCollection,
+                                                                       PartialResult *partialResult, const Parameter *par)
+{
+    const size_t nBlocks = partialResultsCollection->size();
+    const size_t nFeatures = partialResult->getNumberOfFeatures();
+    const algorithmFPType compression = (algorithmFPType)par->compression;
+
+    BlockMicroTable<algorithmFPType, readWrite, cpu> nObsMicroTable(partialResult->get(nObservations).get());
+    BlockMicroTable<algorithmFPType, readWrite, cpu> meansMicroTable(partialResult->get(partialCentroidMeans).get());
+    BlockMicroTable<algorithmFPType, readWrite, cpu> weightsMicroTable(partialResult->get(partialCentroidWeights).get());
+    BlockMicroTable<int,             readWrite, cpu> nCentroidsMicroTable(partialResult->get(partialNCentroids).get());
+    BlockMicroTable<algorithmFPType, readWrite, cpu> minMicroTable(partialResult->get(partialMinimum).get());
+    BlockMicroTable<algorithmFPType, readWrite, cpu> maxMicroTable(partialResult->get(partialMaximum).get());
+
+    const size_t sketchSize = meansMicroTable.getFullNumberOfColumns();
+
+    algorithmFPType *nObs, *sketchMeans, *sketchWeights, *minimums, *maximums;
+    int *sketchNCentroids;
+    nObsMicroTable.getBlockOfRows(0, 1, &nObs);
+    meansMicroTable.getBlockOfRows(0, nFeatures, &sketchMeans);
+    weightsMicroTable.getBlockOfRows(0, nFeatures, &sketchWeights);
+    nCentroidsMicroTable.getBlockOfRows(0, nFeatures, &sketchNCentroids);
+    minMicroTable.getBlockOfRows(0, nFeatures, &minimums);
+    maxMicroTable.getBlockOfRows(0, nFeatures, &maximums);
+
+    for(size_t iBlock = 0; iBlock < nBlocks && this->_errors->size() == 0; iBlock++)
+    {
+        PartialResult *localPartialResult = static_cast<PartialResult *>((*partialResultsCollection)[iBlock].get());
+
+        BlockMicroTable<algorithmFPType, readOnly, cpu> localNObsMicroTable(localPartialResult->get(nObservations).get());
+        BlockMicroTable<algorithmFPType, readOnly, cpu> localMeansMicroTable(localPartialResult->get(partialCentroidMeans).get());
+        BlockMicroTable<algorithmFPType, readOnly, cpu> localWeightsMicroTable(localPartialResult->get(partialCentroidWeights).get());
+        BlockMicroTable<int,             readOnly, cpu> localNCentroidsMicroTable(localPartialResult->get(partialNCentroids).get());
+        BlockMicroTable<algorithmFPType, readOnly, cpu> localMinMicroTable(localPartialResult->get(partialMinimum).get());
+        BlockMicroTable<algorithmFPType, readOnly, cpu> localMaxMicroTable(localPartialResult->get(partialMaximum).get());
+
+        const size_t localSketchSize = localMeansMicroTable.getFullNumberOfColumns();
+
+        algorithmFPType *localNObs, *localMeans, *localWeights, *localMinimums, *localMaximums;
+        int *localNCentroids;
+        localNObsMicroTable.getBlockOfRows(0, 1, &localNObs);
+        localMeansMicroTable.getBlockOfRows(0, nFeatures, &localMeans);
+        localWeightsMicroTable.getBlockOfRows(0, nFeatures, &localWeights);
+        localNCentroidsMicroTable.getBlockOfRows(0, nFeatures, &localNCentroids);
+        localMinMicroTable.getBlockOfRows(0, nFeatures, &localMinimums);
+        localMaxMicroTable.getBlockOfRows(0, nFeatures, &localMaximums);
+
+        const algorithmFPType nObservationsValue = nObs[0];
+        const algorithmFPType nLocalObservations = localNObs[0];
+
+        if(nLocalObservations > (algorithmFPType)0.0)
+        {
+            const bool isEmpty = !(nObservationsValue > (algorithmFPType)0.0);
+            const size_t bufferSize = 2 * (sketchSize + localSketchSize);
+            daal::tls<algorithmFPType *> tlsBuffer( [ = ]()-> algorithmFPType *
+            {
+                return (algorithmFPType *)daal_malloc(bufferSize * sizeof(algorithmFPType));
+            } );
+
+            daal::threader_flag allocationFailed;
+            daal::threader_for(nFeatures, nFeatures, [ =, &tlsBuffer, &allocationFailed](int j)
+            {
+                algorithmFPType *buffer = tlsBuffer.local();
+                if(!buffer) { allocationFailed.set(); return; }
+
+                if(isEmpty || localMinimums[j] < minimums[j]) { minimums[j] = localMinimums[j]; }
+                if(isEmpty || localMaximums[j] > maximums[j]) { maximums[j] = localMaximums[j]; }
+                if(isEmpty) { sketchNCentroids[j] = 0; }
+
+                updateSketch<algorithmFPType, cpu>(nObservationsValue, sketchMeans + j * sketchSize, sketchWeights + j * sketchSize,
+                                                   sketchNCentroids[j], sketchSize, nLocalObservations, (size_t)localNCentroids[j],
+                                                   localMeans + j * localSketchSize, localWeights + j * localSketchSize,
+                                                   compression, buffer);
+            } );
+
+            tlsBuffer.reduce( [ = ](algorithmFPType *buffer)
+            {
+                if(buffer) { daal_free(buffer); }
+            } );
+
+            if(allocationFailed.isSet())
+            {
+                this->_errors->add(ErrorMemoryAllocationFailed);
+            }
+            else
+            {
+                nObs[0] += nLocalObservations;
+            }
+        }
+
+        localNObsMicroTable.release();
+        localMeansMicroTable.release();
+        localWeightsMicroTable.release();
+        localNCentroidsMicroTable.release();
+        localMinMicroTable.release();
+        localMaxMicroTable.release();
+    }
+
+    nObsMicroTable.release();
+    meansMicroTable.release();
+    weightsMicroTable.release();
+    nCentroidsMicroTable.release();
+    minMicroTable.release();
+    maxMicroTable.release();
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -25,7 +25,10 @@
 #define __QUANTILES_KERNEL_H__
 
 #include "numeric_table.h"
+#include "data_collection.h"
 #include "quantiles_batch.h"
+#include "quantiles_online.h"
+#include "quantiles_distributed.h"
 
 #include "service_defines.h"
 #include "service_micro_table.h"
@@ -48,6 +51,34 @@ struct QuantilesKernel : public Kernel
     void compute(const NumericTable *a, NumericTable *r, const Parameter *par);
 };
 
+/**
+ *  \brief Kernel that maintains quantile sketches of the features in the online processing mode
+ *         and on local nodes in the distributed processing mode
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesOnlineKernel : public Kernel
+{
+    virtual ~QuantilesOnlineKernel() {}
+
+    /** Adds a block of observations to the sketches stored in the partial result */
+    void compute(const NumericTable *dataTable, PartialResult *partialResult, const Parameter *par);
+
+    /** Computes quantiles of the given orders from the sketches stored in the partial result */
+    void finalizeCompute(PartialResult *partialResult, NumericTable *quantilesTable, const Parameter *par);
+};
+
+/**
+ *  \brief Kernel that merges quantile sketches computed on local nodes in the distributed processing mode
+ */
+template<Method method, typename algorithmFPType, CpuType cpu>
+struct QuantilesDistributedKernel : public QuantilesOnlineKernel<method, algorithmFPType, cpu>
+{
+    virtual ~QuantilesDistributedKernel() {}
+
+    /** Merges the sketches from the collection of local partial results into the partial result */
+    void compute(DataCollection *partialResultsCollection, PartialResult *partialResult, const Parameter *par);
+};
+
 } // namespace daal::algorithms::quantiles::internal
 
 } // namespace daal::algorithms::quantiles
@@ -0,0 +1,407 @@
+/* file: quantiles_online_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the quantiles algorithm in the online processing mode.
+//
+//  Every feature is summarized by a sketch of weighted centroids sorted by their means.
+//  The weight of a centroid is limited with the scale function
+//  k(q) = compression / 4 * (sqrt(q) - sqrt(1 - q)): one centroid spans at most one unit of k.
+//  So the sketch keeps at most compression + 2 centroids, and the centroids near the tails
+//  of the distribution are small, which keeps the extreme quantiles accurate.
+//  Two sketches are merged by joining their centroids and compressing the result again.
+//--
+*/
+
+#ifndef __QUANTILES_ONLINE_IMPL_I__
+#define __QUANTILES_ONLINE_IMPL_I__
+
+#include "service_micro_table.h"
+#include "service_memory.h"
+#include "service_math.h"
+#include "service_sort.h"
+#include "threading.h"
+
+using namespace daal::internal;
+using namespace daal::services::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+namespace internal
+{
+
+/**
+ * Returns the position of the quantile order q on the scale of the sketch
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline algorithmFPType sketchScale(algorithmFPType q, algorithmFPType compression)
+{
+    const algorithmFPType zero = 0.0;
+    const algorithmFPType one  = 1.0;
+    if(q < zero) { q = zero; }
+    if(q > one)  { q = one;  }
+    return (algorithmFPType)0.25 * compression *
+           (Math<algorithmFPType, cpu>::sSqrt(q) - Math<algorithmFPType, cpu>::sSqrt(one - q));
+}
+
+/**
+ * Returns the quantile order that corresponds to the position k on the scale of the sketch
+ */
+template<typename algorithmFPType, CpuType cpu>
+inline algorithmFPType sketchScaleInverse(algorithmFPType k, algorithmFPType compression)
+{
+    const algorithmFPType one = 1.0;
+    /* sqrt(q) - sqrt(1 - q) = c and q + (1 - q) = 1 give sqrt(q) = (c + sqrt(2 - c^2)) / 2 */
+    algorithmFPType c = (algorithmFPType)4.0 * k / compression;
+    if(c < -one) { c = -one; }
+    if(c >  one) { c =  one; }
+    algorithmFPType sqrtQ = (algorithmFPType)0.5 * (c + Math<algorithmFPType, cpu>::sSqrt((algorithmFPType)2.0 - c * c));
+    return sqrtQ * sqrtQ;
+}
+
+/**
+ * Merges two sequences of centroids sorted by their means into one sorted sequence
+ *
+ * \param[in]  n1        Number of centroids in the first sequence
+ * \param[in]  means1    Means of the centroids in the first sequence
+ * \param[in]  weights1  Weights of the centroids in the first sequence
+ * \param[in]  n2        Number of centroids in the second sequence
+ * \param[in]  means2    Means of the centroids in the second sequence
+ * \param[in]  weights2  Weights of the centroids in the second sequence, NULL if all weights are equal to one
+ * \param[out] means     Means of the merged sequence of n1 + n2 centroids
+ * \param[out] weights   Weights of the merged sequence of n1 + n2 centroids
+ */
+template<typename algorithmFPType, CpuType cpu>
+void mergeSortedCentroids(size_t n1, const algorithmFPType *means1, const algorithmFPType *weights1,
+                          size_t n2, const algorithmFPType *means2, const algorithmFPType *weights2,
+                          algorithmFPType *means, algorithmFPType *weights)
+{
+    const algorithmFPType one = 1.0;
+    size_t i1 = 0, i2 = 0, i = 0;
+    while(i1 < n1 && i2 < n2)
+    {
+        if(means1[i1] <= means2[i2])
+        {
+            means[i] = means1[i1]; weights[i] = weights1[i1]; i1++;
+        }
+        else
+        {
+            means[i] = means2[i2]; weights[i] = (weights2 ? weights2[i2] : one); i2++;
+        }
+        i++;
+    }
+    for(; i1 < n1; i1++, i++)
+    {
+        means[i] = means1[i1]; weights[i] = weights1[i1];
+    }
+    for(; i2 < n2; i2++, i++)
+    {
+        means[i] = means2[i2]; weights[i] = (weights2 ? weights2[i2] : one);
+    }
+}
+
+/**
+ * Compresses a sorted sequence of centroids into at most sketchSize centroids
+ *
+ * \param[in]  n            Number of centroids in the sequence
+ * \param[in]  means        Means of the centroids
+ * \param[in]  weights      Weights of the centroids
+ * \param[in]  totalWeight  Sum of the weights of the centroids
+ * \param[in]  compression  Compression of the sketch
+ * \param[in]  sketchSize   Maximal number of centroids in the compressed sketch
+ * \param[out] outMeans     Means of the compressed centroids
+ * \param[out] outWeights   Weights of the compressed centroids
+ * \return Number of centroids in the compressed sketch
+ */
+template<typename algorithmFPType, CpuType cpu>
+size_t compressCentroids(size_t n, const algorithmFPType *means, const algorithmFPType *weights,
+                         algorithmFPType totalWeight, algorithmFPType compression, size_t sketchSize,
+                         algorithmFPType *outMeans, algorithmFPType *outWeights)
+{
+    if(n == 0) { return 0; }
+
+    const algorithmFPType one = 1.0;
+    const algorithmFPType invTotalWeight = one / totalWeight;
+
+    algorithmFPType currentMean   = means[0];
+    algorithmFPType currentWeight = weights[0];
+    /* Weight of the centroids to the left of the current one and the weight the current one may grow to */
+    algorithmFPType weightSoFar = 0.0;
+    algorithmFPType weightLimit = totalWeight *
+        sketchScaleInverse<algorithmFPType, cpu>(sketchScale<algorithmFPType, cpu>(0.0, compression) + one, compression);
+
+    size_t nOut = 0;
+    for(size_t i = 1; i < n; i++)
+    {
+        algorithmFPType mergedWeight = currentWeight + weights[i];
+        if(weightSoFar + mergedWeight <= weightLimit || nOut + 1 >= sketchSize)
+        {
+            currentMean  += (means[i] - currentMean) * weights[i] / mergedWeight;
+            currentWeight = mergedWeight;
+        }
+        else
+        {
+            outMeans[nOut]   = currentMean;
+            outWeights[nOut] = currentWeight;
+            nOut++;
+
+            weightSoFar += currentWeight;
+            weightLimit = totalWeight * sketchScaleInverse<algorithmFPType, cpu>(
+                              sketchScale<algorithmFPType, cpu>(weightSoFar * invTotalWeight, compression) + one, compression);
+
+            currentMean   = means[i];
+            currentWeight = weights[i];
+        }
+    }
+    outMeans[nOut]   = currentMean;
+    outWeights[nOut] = currentWeight;
+    return nOut + 1;
+}
+
+/**
+ * Adds a sorted sequence of centroids to the sketch of one feature
+ *
+ * \param[in]     nObservations     Number of observations summarized by the sketch
+ * \param[in,out] sketchMeans       Means of the centroids of the sketch
+ * \param[in,out] sketchWeights     Weights of the centroids of the sketch
+ * \param[in,out] sketchNCentroids  Number of centroids of the sketch
+ * \param[in]     sketchSize        Maximal number of centroids of the sketch
+ * \param[in]     nNewObservations  Number of observations summarized by the new centroids
+ * \param[in]     nNewCentroids     Number of new centroids
+ * \param[in]     newMeans          Means of the new centroids
+ * \param[in]     newWeights        Weights of the new centroids, NULL if all weights are equal to one
+ * \param[in]     compression       Compression of the sketch
+ * \param[out]    buffer            Buffer of size 2 * (sketchSize + nNewCentroids)
+ */
+template<typename algorithmFPType, CpuType cpu>
+void updateSketch(algorithmFPType nObservations, algorithmFPType *sketchMeans, algorithmFPType *sketchWeights,
+                  int &sketchNCentroids, size_t sketchSize, algorithmFPType nNewObservations,
+                  size_t nNewCentroids, const algorithmFPType *newMeans, const algorithmFPType *newWeights,
+                  algorithmFPType compression, algorithmFPType *buffer)
+{
+    size_t nMerged = (size_t)sketchNCentroids + nNewCentroids;
+    algorithmFPType *mergedMeans   = buffer;
+    algorithmFPType *mergedWeights = buffer + nMerged;
+
+    mergeSortedCentroids<algorithmFPType, cpu>((size_t)sketchNCentroids, sketchMeans, sketchWeights,
+                                               nNewCentroids, newMeans, newWeights, mergedMeans, mergedWeights);
+
+    sketchNCentroids = (int)compressCentroids<algorithmFPType, cpu>(nMerged, mergedMeans, mergedWeights,
+                                                                   nObservations + nNewObservations, compression, sketchSize,
+                                                                   sketchMeans, sketchWeights);
+}
+
+/**
+ * Computes the quantile of the given order from the sketch of one feature
+ */
+template<typename algorithmFPType, CpuType cpu>
+algorithmFPType sketchQuantile(size_t nCentroids, const algorithmFPType *means, const algorithmFPType *weights,
+                               algorithmFPType totalWeight, algorithmFPType minimum, algorithmFPType maximum,
+                               algorithmFPType quantileOrder)
+{
+    const algorithmFPType half = 0.5;
+    if(nCentroids == 1)
+    {
+        return (weights[0] <= (algorithmFPType)1.0 ? means[0] : minimum + quantileOrder * (maximum - minimum));
+    }
+
+    /* Centroid i is placed at the rank of its center */
+    algorithmFPType rank = quantileOrder * totalWeight;
+    algorithmFPType center = half * weights[0];
+    if(rank <= center)
+    {
+        return minimum + (means[0] - minimum) * rank / center;
+    }
+
+    for(size_t i = 0; i + 1 < nCentroids; i++)
+    {
+        algorithmFPType nextCenter = center + half * (weights[i] + weights[i + 1]);
+        if(rank <= nextCenter)
+        {
+            return means[i] + (means[i + 1] - means[i]) * (rank - center) / (nextCenter - center);
+        }
+        center = nextCenter;
+    }
+
+    algorithmFPType lastHalfWeight = half * weights[nCentroids - 1];
+    algorithmFPType value = means[nCentroids - 1] + (maximum - means[nCentroids - 1]) * (rank - center) / lastHalfWeight;
+    return (value > maximum ? maximum : value);
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesOnlineKernel<method, algorithmFPType, cpu>::compute(const NumericTable *dataTable, PartialResult *partialResult,
+                                                                  const Parameter *par)
+{
+    const size_t nFeatures = dataTable->getNumberOfColumns();
+    const size_t nVectors  = dataTable->getNumberOfRows();
+    const algorithmFPType compression = (algorithmFPType)par->compression;
+
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> dataMicroTable(const_cast<NumericTable *>(dataTable));
+    BlockMicroTable<algorithmFPType, readWrite, cpu> nObsMicroTable(partialResult->get(nObservations).get());
+    BlockMicroTable<algorithmFPType, readWrite, cpu> meansMicroTable(partialResult->get(partialCentroidMeans).get());
+    BlockMicroTable<algorithmFPType, readWrite, cpu> weightsMicroTable(partialResult->get(partialCentroidWeights).get());
+    BlockMicroTable<int,             readWrite, cpu> nCentroidsMicroTable(partialResult->get(partialNCentroids).get());
+    BlockMicroTable<algorithmFPType, readWrite, cpu> minMicroTable(partialResult->get(partialMinimum).get());
+    BlockMicroTable<algorithmFPType, readWrite, cpu> maxMicroTable(partialResult->get(partialMaximum).get());
+
+    const size_t sketchSize = meansMicroTable.getFullNumberOfColumns();
+
+    algorithmFPType *data, *nObs, *sketchMeans, *sketchWeights, *minimums, *maximums;
+    int *sketchNCentroids;
+    dataMicroTable.getBlockOfRows(0, nVectors, &data);
+    nObsMicroTable.getBlockOfRows(0, 1, &nObs);
+    meansMicroTable.getBlockOfRows(0, nFeatures, &sketchMeans);
+    weightsMicroTable.getBlockOfRows(0, nFeatures, &sketchWeights);
+    nCentroidsMicroTable.getBlockOfRows(0, nFeatures, &sketchNCentroids);
+    minMicroTable.getBlockOfRows(0, nFeatures, &minimums);
+    maxMicroTable.getBlockOfRows(0, nFeatures, &maximums);
+
+    const algorithmFPType nObservationsValue = nObs[0];
+    const bool isEmpty = !(nObservationsValue > (algorithmFPType)0.0);
+
+    /* Thread local buffers: values of one feature in the block and the merged sequence of centroids */
+    const size_t bufferSize = nVectors + 2 * (sketchSize + nVectors);
+    daal::tls<algorithmFPType *> tlsBuffer( [ = ]()-> algorithmFPType *
+    {
+        return (algorithmFPType *)daal_malloc(bufferSize * sizeof(algorithmFPType));
+    } );
+
+    daal::threader_flag allocationFailed;
+    daal::threader_for(nFeatures, nFeatures, [ =, &tlsBuffer, &allocationFailed](int j)
+    {
+        algorithmFPType *values = tlsBuffer.local();
+        if(!values) { allocationFailed.set(); return; }
+
+        for(size_t i = 0; i < nVectors; i++)
+        {
+            values[i] = data[i * nFeatures + j];
+        }
+        daal::algorithms::internal::qSort<algorithmFPType, cpu>(nVectors, values);
+
+        if(isEmpty || values[0] < minimums[j])            { minimums[j] = values[0]; }
+        if(isEmpty || values[nVectors - 1] > maximums[j]) { maximums[j] = values[nVectors - 1]; }
+        if(isEmpty) { sketchNCentroids[j] = 0; }
+
+        updateSketch<algorithmFPType, cpu>(nObservationsValue, sketchMeans + j * sketchSize, sketchWeights + j * sketchSize,
+                                           sketchNCentroids[j], sketchSize, (algorithmFPType)nVectors, nVectors, values, NULL,
+                                           compression, values + nVectors);
+    } );
+
+    tlsBuffer.reduce( [ = ](algorithmFPType *buffer)
+    {
+        if(buffer) { daal_free(buffer); }
+    } );
+
+    if(allocationFailed.isSet())
+    {
+        this->_errors->add(ErrorMemoryAllocationFailed);
+    }
+    else
+    {
+        nObs[0] += (algorithmFPType)nVectors;
+    }
+
+    dataMicroTable.release();
+    nObsMicroTable.release();
+    meansMicroTable.release();
+    weightsMicroTable.release();
+    nCentroidsMicroTable.release();
+    minMicroTable.release();
+    maxMicroTable.release();
+}
+
+template<Method method, typename algorithmFPType, CpuType cpu>
+void QuantilesOnlineKernel<method, algorithmFPType, cpu>::finalizeCompute(PartialResult *partialResult, NumericTable *quantilesTable,
+                                                                          const Parameter *par)
+{
+    const size_t nFeatures = quantilesTable->getNumberOfRows();
+    const size_t nQuantileOrders = quantilesTable->getNumberOfColumns();
+
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> ordersMicroTable(par->quantileOrders.get());
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> nObsMicroTable(partialResult->get(nObservations).get());
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> meansMicroTable(partialResult->get(partialCentroidMeans).get());
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> weightsMicroTable(partialResult->get(partialCentroidWeights).get());
+    BlockMicroTable<int,             readOnly,  cpu> nCentroidsMicroTable(partialResult->get(partialNCentroids).get());
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> minMicroTable(partialResult->get(partialMinimum).get());
+    BlockMicroTable<algorithmFPType, readOnly,  cpu> maxMicroTable(partialResult->get(partialMaximum).get());
+    BlockMicroTable<algorithmFPType, writeOnly, cpu> quantilesMicroTable(quantilesTable);
+
+    const size_t sketchSize = meansMicroTable.getFullNumberOfColumns();
+
+    algorithmFPType *quantileOrders, *nObs, *sketchMeans, *sketchWeights, *minimums, *maximums, *quants;
+    int *sketchNCentroids;
+    ordersMicroTable.getBlockOfRows(0, 1, &quantileOrders);
+    nObsMicroTable.getBlockOfRows(0, 1, &nObs);
+    meansMicroTable.getBlockOfRows(0, nFeatures, &sketchMeans);
+    weightsMicroTable.getBlockOfRows(0, nFeatures, &sketchWeights);
+    nCentroidsMicroTable.getBlockOfRows(0, nFeatures, &sketchNCentroids);
+    minMicroTable.getBlockOfRows(0, nFeatures, &minimums);
+    maxMicroTable.getBlockOfRows(0, nFeatures, &maximums);
+    quantilesMicroTable.getBlockOfRows(0, nFeatures, &quants);
+
+    bool isOrderValid = true;
+    for(size_t k = 0; k < nQuantileOrders; k++)
+    {
+        if(quantileOrders[k] < (algorithmFPType)0.0 || quantileOrders[k] > (algorithmFPType)1.0) { isOrderValid = false; }
+    }
+
+    if(!isOrderValid)
+    {
+        this->_errors->add(ErrorQuantileOrderValueIsInvalid);
+    }
+    else if(!(nObs[0] > (algorithmFPType)0.0))
+    {
+        this->_errors->add(ErrorIncorrectNumberOfObservations);
+    }
+    else
+    {
+        for(size_t j = 0; j < nFeatures; j++)
+        {
+            for(size_t k = 0; k < nQuantileOrders; k++)
+            {
+                quants[j * nQuantileOrders + k] = sketchQuantile<algorithmFPType, cpu>(
+                    (size_t)sketchNCentroids[j], sketchMeans + j * sketchSize, sketchWeights + j * sketchSize,
+                    nObs[0], minimums[j], maximums[j], quantileOrders[k]);
+            }
+        }
+    }
+
+    ordersMicroTable.release();
+    nObsMicroTable.release();
+    meansMicroTable.release();
+    weightsMicroTable.release();
+    nCentroidsMicroTable.release();
+    minMicroTable.release();
+    maxMicroTable.release();
+    quantilesMicroTable.release();
+}
+
+} // namespace daal::algorithms::quantiles::internal
+
+} // namespace daal::algorithms::quantiles
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
@@ -50,7 +50,8 @@ enum ServiceStatus
     SERV_ERR_MKL_SVD_ITH_PARAM_ILLEGAL_VALUE,
     SERV_ERR_MKL_SVD_XBDSQR_DID_NOT_CONVERGE,
     SERV_ERR_MKL_QR_ITH_PARAM_ILLEGAL_VALUE,
-    SERV_ERR_MKL_QR_XBDSQR_DID_NOT_CONVERGE
+    SERV_ERR_MKL_QR_XBDSQR_DID_NOT_CONVERGE,
+    SERV_ERR_MALLOC
 };
 
 /** Data storage format */
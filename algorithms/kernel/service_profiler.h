@@ -0,0 +1,136 @@
+/* file: service_profiler.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the instrumentation used by the profiler.
+//
+//  DAAL_PROFILER_TASK(name) records the time spent from the point of declaration
+//  to the end of the enclosing scope, and the memory allocated by daal_malloc in
+//  the calling thread during that time.
+//  DAAL_PROFILER_KERNEL_TASK(name) does the same for the call of the kernel of an
+//  algorithm, unless the call is nested in the kernel of another algorithm, such as
+//  kernel functions computed by SVM training for every pair of vectors.
+//  DAAL_PROFILER_COUNT(name, value) adds the value to the counter of the calling thread.
+//  The names must be string literals. When the profiler is disabled the cost of
+//  each of them is a single load and a branch. With DAAL_DISABLE_PROFILER they are empty.
+//--
+*/
+
+#ifndef __SERVICE_PROFILER_H__
+#define __SERVICE_PROFILER_H__
+
+#include "daal_defines.h"
+
+namespace daal
+{
+namespace internal
+{
+
+extern volatile int profilerEnabled;
+
+double profilerNow();
+size_t profilerAllocatedBytes();
+void profilerRecordTask(const char *name, double start, size_t allocatedBytes);
+void profilerCount(const char *name, size_t value);
+void profilerAllocate(size_t size);
+bool profilerEnterKernel();
+void profilerLeaveKernel();
+
+/* Records the region from the construction to the destruction of the object */
+class ProfilerTask
+{
+public:
+    ProfilerTask(const char *name) : _name(profilerEnabled ? name : 0), _start(0.0), _allocatedBytes(0)
+    {
+        if (_name)
+        {
+            _allocatedBytes = profilerAllocatedBytes();
+            _start = profilerNow();
+        }
+    }
+
+    ~ProfilerTask()
+    {
+        if (_name) { profilerRecordTask(_name, _start, _allocatedBytes); }
+    }
+
+private:
+    const char *_name;
+    double _start;
+    size_t _allocatedBytes;
+
+    ProfilerTask(const ProfilerTask &);
+    ProfilerTask &operator=(const ProfilerTask &);
+};
+
+/* Records the call of the kernel of an algorithm if it is not nested in another kernel */
+class ProfilerKernelTask
+{
+public:
+    ProfilerKernelTask(const char *name) : _name(0), _entered(profilerEnabled != 0), _start(0.0), _allocatedBytes(0)
+    {
+        if (_entered && profilerEnterKernel())
+        {
+            _name = name;
+            _allocatedBytes = profilerAllocatedBytes();
+            _start = profilerNow();
+        }
+    }
+
+    ~ProfilerKernelTask()
+    {
+        if (_name)    { profilerRecordTask(_name, _start, _allocatedBytes); }
+        if (_entered) { profilerLeaveKernel(); }
+    }
+
+private:
+    const char *_name;
+    bool _entered;
+    double _start;
+    size_t _allocatedBytes;
+
+    ProfilerKernelTask(const ProfilerKernelTask &);
+    ProfilerKernelTask &operator=(const ProfilerKernelTask &);
+};
+
+} // namespace internal
+} // namespace daal
+
+#if defined(DAAL_DISABLE_PROFILER)
+
+#define DAAL_PROFILER_TASK(name)
+#define DAAL_PROFILER_KERNEL_TASK(name)
+#define DAAL_PROFILER_COUNT(name, value)
+
+#else
+
+#define __DAAL_PROFILER_CONCAT2(a, b) a##b
+#define __DAAL_PROFILER_CONCAT(a, b)  __DAAL_PROFILER_CONCAT2(a, b)
+
+#define DAAL_PROFILER_TASK(name)                                                                        \
+    daal::internal::ProfilerTask __DAAL_PROFILER_CONCAT(__daal_profiler_task_, __LINE__)(name)
+
+#define DAAL_PROFILER_KERNEL_TASK(name)                                                                 \
+    daal::internal::ProfilerKernelTask __DAAL_PROFILER_CONCAT(__daal_profiler_task_, __LINE__)(name)
+
+#define DAAL_PROFILER_COUNT(name, value)                                                                \
+    { if (daal::internal::profilerEnabled) { daal::internal::profilerCount(name, (size_t)(value)); } }
+
+#endif
+
+#endif
@@ -410,6 +410,228 @@ void qSort(size_t n, algorithmFPtype *x, wType *w, zType *z)
     }
 }
 
+/**
+ * \brief Selection function that finds the k-th smallest element of array x.
+ *        On exit, x[k] contains the k-th smallest element, elements x[0], ..., x[k - 1] are not greater than x[k],
+ *        and elements x[k + 1], ..., x[n - 1] are not less than x[k]
+ *
+ * \param n[in]       Length of input array
+ * \param x[in,out]   Array to partially reorder
+ * \param k[in]       Zero-based rank of the element to find
+ *
+ * \return The k-th smallest element of array x
+ */
+template <typename algorithmDataType, CpuType cpu>
+algorithmDataType qSelect(size_t n, algorithmDataType *x, size_t k)
+{
+    size_t i, j, l = 0, ir = n - 1;
+    algorithmDataType a;
+
+    for(;;)
+    {
+        if(ir <= l + 1)
+        {
+            if(ir == l + 1 && x[ir] < x[l])
+            {
+                daal::swap<algorithmDataType, cpu>(x[l], x[ir]);
+            }
+            return x[k];
+        }
+
+        daal::swap<algorithmDataType, cpu>(x[(l + ir) >> 1], x[l + 1]);
+        if(x[l] > x[ir])
+        {
+            daal::swap<algorithmDataType, cpu>(x[l], x[ir]);
+        }
+        if(x[l + 1] > x[ir])
+        {
+            daal::swap<algorithmDataType, cpu>(x[l + 1], x[ir]);
+        }
+        if(x[l] > x[l + 1])
+        {
+            daal::swap<algorithmDataType, cpu>(x[l], x[l + 1]);
+        }
+        i = l + 1;
+        j = ir;
+        a = x[l + 1];
+        for(;;)
+        {
+            while(x[++i] < a);
+            while(x[--j] > a);
+            if(j < i) { break; }
+            daal::swap<algorithmDataType, cpu>(x[i], x[j]);
+        }
+        x[l + 1] = x[j];
+        x[j] = a;
+
+        if(j >= k) { ir = j - 1; }
+        if(j <= k) { l = i; }
+    }
+}
+
+/**
+ * \brief Unsigned integer type of the same size as the floating-point type, used as the key of radix sort
+ */
+template <typename algorithmFPType>
+struct RadixSortKey {};
+
+template <>
+struct RadixSortKey<float>
+{
+    typedef unsigned int type;
+};
+
+template <>
+struct RadixSortKey<double>
+{
+    typedef unsigned long long type;
+};
+
+/**
+ * \brief Least significant digit radix sort function that sorts floating-point array x in ascending order.
+ *        Falls back to quick sort for short arrays
+ *
+ * \param n[in]          Length of input array
+ * \param x[in,out]      Array to sort
+ * \param workspace[in]  Buffer of size 2 * n * sizeof(algorithmFPType) bytes
+ */
+template <typename algorithmFPType, CpuType cpu>
+void radixSort(size_t n, algorithmFPType *x, void *workspace)
+{
+    typedef typename RadixSortKey<algorithmFPType>::type KeyType;
+    union KeyValue
+    {
+        algorithmFPType value;
+        KeyType key;
+    };
+
+    if(n < 256)
+    {
+        qSort<algorithmFPType, cpu>(n, x);
+        return;
+    }
+
+    const size_t nBits = 8 * sizeof(KeyType);
+    const size_t nDigitBits = 8;
+    const size_t nBuckets = (size_t)1 << nDigitBits;
+    const KeyType signBit = (KeyType)1 << (nBits - 1);
+
+    KeyType *keys = (KeyType *)workspace;
+    KeyType *tmp  = keys + n;
+
+    /* Map the values onto unsigned keys with the same order: negative values are inverted, positive ones get the sign bit */
+    for(size_t i = 0; i < n; i++)
+    {
+        KeyValue kv;
+        kv.value = x[i];
+        keys[i] = ((kv.key & signBit) ? ~kv.key : (kv.key | signBit));
+    }
+
+    size_t counts[nBuckets];
+    for(size_t shift = 0; shift < nBits; shift += nDigitBits)
+    {
+        for(size_t b = 0; b < nBuckets; b++)
+        {
+            counts[b] = 0;
+        }
+        for(size_t i = 0; i < n; i++)
+        {
+            counts[(keys[i] >> shift) & (nBuckets - 1)]++;
+        }
+
+        /* Skip the pass if all the keys have the same digit */
+        if(counts[keys[0] >> shift & (nBuckets - 1)] == n) { continue; }
+
+        size_t offset = 0;
+        for(size_t b = 0; b < nBuckets; b++)
+        {
+            size_t count = counts[b];
+            counts[b] = offset;
+            offset += count;
+        }
+        for(size_t i = 0; i < n; i++)
+        {
+            tmp[counts[(keys[i] >> shift) & (nBuckets - 1)]++] = keys[i];
+        }
+        daal::swap<KeyType *, cpu>(keys, tmp);
+    }
+
+    for(size_t i = 0; i < n; i++)
+    {
+        KeyValue kv;
+        kv.key = ((keys[i] & signBit) ? (keys[i] & ~signBit) : ~keys[i]);
+        x[i] = kv.value;
+    }
+}
+
+/**
+ * \brief Places value into the root of the heap of size heapSize and restores the heap property.
+ *        The root of the heap is the element that goes last in the output order of partialSort
+ */
+template <typename algorithmDataType, bool largest, CpuType cpu>
+inline void heapSiftDown(algorithmDataType *heap, size_t heapSize, algorithmDataType value)
+{
+    size_t parent = 0;
+    for(;;)
+    {
+        size_t child = 2 * parent + 1;
+        if(child >= heapSize) { break; }
+        if(child + 1 < heapSize && (largest ? heap[child + 1] < heap[child] : heap[child] < heap[child + 1])) { child++; }
+        if(largest ? !(heap[child] < value) : !(value < heap[child])) { break; }
+        heap[parent] = heap[child];
+        parent = child;
+    }
+    heap[parent] = value;
+}
+
+/**
+ * \brief Partial sort function that selects the k smallest (or largest) elements of strided array x
+ *        in O(n log k) time using a binary heap of size k
+ *
+ * \tparam largest   If true, the k largest elements are selected and returned in descending order,
+ *                   otherwise the k smallest elements are returned in ascending order
+ *
+ * \param n[in]      Number of elements in array x
+ * \param x[in]      Input array
+ * \param incx[in]   Stride between consecutive elements of array x
+ * \param k[in]      Number of elements to select, 0 < k <= n
+ * \param res[out]   Array of size k with the selected elements
+ */
+template <typename algorithmDataType, bool largest, CpuType cpu>
+void partialSort(size_t n, const algorithmDataType *x, size_t incx, size_t k, algorithmDataType *res)
+{
+    for(size_t i = 0; i < k; i++)
+    {
+        algorithmDataType value = x[i * incx];
+        size_t child = i;
+        while(child > 0)
+        {
+            size_t parent = (child - 1) >> 1;
+            if(largest ? !(value < res[parent]) : !(res[parent] < value)) { break; }
+            res[child] = res[parent];
+            child = parent;
+        }
+        res[child] = value;
+    }
+
+    for(size_t i = k; i < n; i++)
+    {
+        algorithmDataType value = x[i * incx];
+        if(largest ? (value > res[0]) : (value < res[0]))
+        {
+            heapSiftDown<algorithmDataType, largest, cpu>(res, k, value);
+        }
+    }
+
+    /* Heap sort of the selected elements */
+    for(size_t heapSize = k; heapSize > 1; heapSize--)
+    {
+        algorithmDataType value = res[heapSize - 1];
+        res[heapSize - 1] = res[0];
+        heapSiftDown<algorithmDataType, largest, cpu>(res, heapSize - 1, value);
+    }
+}
+
 }
 }
 }
@@ -39,7 +39,7 @@ template<typename algorithmFPType, Method method, CpuType cpu>
 BatchContainer<algorithmFPType, method, cpu>::BatchContainer(daal::services::Environment::env *daalEnv)
 {
 
-    __DAAL_INTIALIZE_KERNELS(internal::SortingKernel, defaultDense, algorithmFPType);
+    __DAAL_INTIALIZE_KERNELS(internal::SortingKernel, method, algorithmFPType);
 }
 
 template<typename algorithmFPType, Method method, CpuType cpu>
@@ -53,9 +53,10 @@ void BatchContainer<algorithmFPType, method, cpu>::compute()
 {
     Result *result = static_cast<Result *>(_res);
     Input *input   = static_cast<Input *>(_in);
+    Parameter *parameter = static_cast<Parameter *>(_par);
 
     daal::services::Environment::env &env = *_env;
-    __DAAL_CALL_KERNEL(env, internal::SortingKernel, __DAAL_KERNEL_ARGUMENTS(defaultDense, algorithmFPType), compute, input, result);
+    __DAAL_CALL_KERNEL(env, internal::SortingKernel, __DAAL_KERNEL_ARGUMENTS(method, algorithmFPType), compute, input, result, parameter);
 }
 
 } // namespace daal::algorithms::sorting
@@ -27,7 +27,8 @@
 #include "service_micro_table.h"
 #include "service_memory.h"
 #include "service_math.h"
-#include "service_stat.h"
+#include "service_sort.h"
+#include "threading.h"
 
 using namespace daal::internal;
 using namespace daal::services;
@@ -40,29 +41,135 @@ namespace sorting
 {
 namespace internal
 {
-template<Method method, typename AlgorithmFPType, CpuType cpu>
-void SortingKernel<method, AlgorithmFPType, cpu>::compute(const Input *input, Result *output)
+
+/* Minimal number of observations in a part of the feature that is sorted by one thread */
+const size_t minSortingChunkSize = 4096;
+
+/**
+ *  Merges two sorted sequences a and b into the sequence res of size na + nb
+ */
+template<typename algorithmFPType, CpuType cpu>
+void mergeSorted(size_t na, const algorithmFPType *a, size_t nb, const algorithmFPType *b, algorithmFPType *res)
+{
+    size_t ia = 0, ib = 0, i = 0;
+    while(ia < na && ib < nb)
+    {
+        res[i++] = (b[ib] < a[ia] ? b[ib++] : a[ia++]);
+    }
+    for(; ia < na; ia++) { res[i++] = a[ia]; }
+    for(; ib < nb; ib++) { res[i++] = b[ib]; }
+}
+
+template<typename algorithmFPType, CpuType cpu>
+void SortingKernel<defaultDense, algorithmFPType, cpu>::compute(const Input *input, Result *output, const Parameter *parameter)
 {
     SharedPtr<NumericTable> inputTable = input->get(data);
     SharedPtr<NumericTable> outputTable = output->get(sortedData);
 
-    size_t nFeatures = inputTable->getNumberOfColumns();
-    size_t nVectors  = inputTable->getNumberOfRows();
-
-    BlockDescriptor<AlgorithmFPType> inputBlock;
+    const size_t nFeatures = inputTable->getNumberOfColumns();
+    const size_t nVectors  = inputTable->getNumberOfRows();
+
+    /* Split the features into chunks if there are not enough features to load all the threads */
+    const size_t nThreads = daal::threader_get_threads_number();
+    size_t nChunks = 1;
+    if(nFeatures < nThreads && nVectors >= 2 * minSortingChunkSize)
+    {
+        nChunks = (nThreads + nFeatures - 1) / nFeatures;
+        if(nChunks > nVectors / minSortingChunkSize) { nChunks = nVectors / minSortingChunkSize; }
+    }
+    const size_t chunkSize = (nVectors + nChunks - 1) / nChunks;
+
+    /* Features are sorted in the column major buffer; the second buffer is used to merge the sorted chunks */
+    const size_t nMergeBuffers = (nChunks > 1 ? 2 : 1);
+    algorithmFPType *columns = (algorithmFPType *)daal_malloc(nMergeBuffers * nFeatures * nVectors * sizeof(algorithmFPType));
+    if(!columns) { this->_errors->add(ErrorMemoryAllocationFailed); return; }
+    algorithmFPType *mergeBuffer = columns + (nMergeBuffers - 1) * nFeatures * nVectors;
+
+    BlockDescriptor<algorithmFPType> inputBlock;
     inputTable->getBlockOfRows((size_t)0, nVectors, readOnly, inputBlock);
-    AlgorithmFPType *data = inputBlock.getBlockPtr();
-
-    BlockDescriptor<AlgorithmFPType> otputBlock;
-    outputTable->getBlockOfRows((size_t)0, nVectors, writeOnly, otputBlock);
-    AlgorithmFPType *sortedData = otputBlock.getBlockPtr();
-
-    int errorcode = Statistics<AlgorithmFPType, cpu>::xSort(data, nFeatures, nVectors, sortedData);
+    const algorithmFPType *data = inputBlock.getBlockPtr();
+
+    daal::tls<algorithmFPType *> tlsWorkspace( [ = ]()-> algorithmFPType *
+    {
+        return (algorithmFPType *)daal_malloc(2 * chunkSize * sizeof(algorithmFPType));
+    } );
+
+    daal::threader_flag allocationFailed;
+    daal::threader_for(nFeatures * nChunks, nFeatures * nChunks, [ =, &tlsWorkspace, &allocationFailed](int task)
+    {
+        algorithmFPType *workspace = tlsWorkspace.local();
+        if(!workspace) { allocationFailed.set(); return; }
+
+        const size_t j = task / nChunks;
+        const size_t iStart = (task % nChunks) * chunkSize;
+        const size_t iEnd = (iStart + chunkSize < nVectors ? iStart + chunkSize : nVectors);
+
+        algorithmFPType *column = columns + j * nVectors;
+        for(size_t i = iStart; i < iEnd; i++)
+        {
+            column[i] = data[i * nFeatures + j];
+        }
+        daal::algorithms::internal::radixSort<algorithmFPType, cpu>(iEnd - iStart, column + iStart, workspace);
+    } );
+
+    tlsWorkspace.reduce( [ = ](algorithmFPType *workspace)
+    {
+        if(workspace) { daal_free(workspace); }
+    } );
 
     inputTable->releaseBlockOfRows(inputBlock);
-    outputTable->releaseBlockOfRows(otputBlock);
 
-    if(errorcode) {this->_errors->add(services::ErrorSortingInternal);}
+    if(allocationFailed.isSet())
+    {
+        daal_free(columns);
+        this->_errors->add(ErrorMemoryAllocationFailed);
+        return;
+    }
+
+    /* Merge the sorted chunks of every feature pairwise */
+    algorithmFPType *sorted = columns;
+    for(size_t runSize = chunkSize; runSize < nVectors; runSize *= 2)
+    {
+        const size_t nRuns  = (nVectors + runSize - 1) / runSize;
+        const size_t nPairs = (nRuns + 1) / 2;
+        algorithmFPType *src = sorted;
+        algorithmFPType *dst = (sorted == columns ? mergeBuffer : columns);
+
+        daal::threader_for(nFeatures * nPairs, nFeatures * nPairs, [ = ](int task)
+        {
+            const size_t j = task / nPairs;
+            const size_t aStart = (task % nPairs) * 2 * runSize;
+            const size_t bStart = (aStart + runSize < nVectors ? aStart + runSize : nVectors);
+            const size_t bEnd   = (bStart + runSize < nVectors ? bStart + runSize : nVectors);
+
+            mergeSorted<algorithmFPType, cpu>(bStart - aStart, src + j * nVectors + aStart, bEnd - bStart, src + j * nVectors + bStart,
+                                              dst + j * nVectors + aStart);
+        } );
+        sorted = dst;
+    }
+
+    BlockDescriptor<algorithmFPType> outputBlock;
+    outputTable->getBlockOfRows((size_t)0, nVectors, writeOnly, outputBlock);
+    algorithmFPType *sortedData = outputBlock.getBlockPtr();
+
+    /* Copy the sorted features into the row major output table by blocks of rows */
+    const size_t blockSize = 256;
+    const size_t nBlocks = (nVectors + blockSize - 1) / blockSize;
+    daal::threader_for(nBlocks, nBlocks, [ = ](int iBlock)
+    {
+        const size_t iStart = iBlock * blockSize;
+        const size_t iEnd = (iStart + blockSize < nVectors ? iStart + blockSize : nVectors);
+        for(size_t i = iStart; i < iEnd; i++)
+        {
+            for(size_t j = 0; j < nFeatures; j++)
+            {
+                sortedData[i * nFeatures + j] = sorted[j * nVectors + i];
+            }
+        }
+    } );
+
+    outputTable->releaseBlockOfRows(outputBlock);
+    daal_free(columns);
 }
 
 } // namespace daal::algorithms::sorting::internal
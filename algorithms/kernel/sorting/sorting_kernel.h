@@ -42,10 +42,27 @@ namespace internal
 {
 
 template<Method method, typename algorithmFPType, CpuType cpu>
-struct SortingKernel : public Kernel
+struct SortingKernel {};
+
+/**
+ * Sorts every feature of the data set with the radix method.
+ * Features are sorted in parallel; long features are split into chunks that are sorted in parallel and then merged
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct SortingKernel<defaultDense, algorithmFPType, cpu> : public Kernel
+{
+    virtual ~SortingKernel() {}
+    void compute(const Input *input, Result *result, const Parameter *parameter);
+};
+
+/**
+ * Selects k smallest or k largest observations of every feature of the data set
+ */
+template<typename algorithmFPType, CpuType cpu>
+struct SortingKernel<topKDense, algorithmFPType, cpu> : public Kernel
 {
     virtual ~SortingKernel() {}
-    void compute(const Input *input, Result *result);
+    void compute(const Input *input, Result *result, const Parameter *parameter);
 };
 
 } // namespace daal::algorithms::sorting::internal
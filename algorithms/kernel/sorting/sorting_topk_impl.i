@@ -0,0 +1,108 @@
+/* file: sorting_topk_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the partial sort method of the sorting algorithm
+//--
+*/
+
+#ifndef __SORTING_TOPK_IMPL__
+#define __SORTING_TOPK_IMPL__
+
+#include "service_micro_table.h"
+#include "service_memory.h"
+#include "service_sort.h"
+#include "threading.h"
+
+using namespace daal::internal;
+using namespace daal::services;
+
+namespace daal
+{
+namespace algorithms
+{
+namespace sorting
+{
+namespace internal
+{
+
+template<typename algorithmFPType, CpuType cpu>
+void SortingKernel<topKDense, algorithmFPType, cpu>::compute(const Input *input, Result *output, const Parameter *parameter)
+{
+    SharedPtr<NumericTable> inputTable = input->get(data);
+    SharedPtr<NumericTable> outputTable = output->get(sortedData);
+
+    const size_t nFeatures = inputTable->getNumberOfColumns();
+    const size_t nVectors  = inputTable->getNumberOfRows();
+    const size_t k = parameter->k;
+    const bool largest = parameter->largest;
+
+    BlockDescriptor<algorithmFPType> inputBlock;
+    inputTable->getBlockOfRows((size_t)0, nVectors, readOnly, inputBlock);
+    const algorithmFPType *data = inputBlock.getBlockPtr();
+
+    BlockDescriptor<algorithmFPType> outputBlock;
+    outputTable->getBlockOfRows((size_t)0, k, writeOnly, outputBlock);
+    algorithmFPType *topK = outputBlock.getBlockPtr();
+
+    daal::tls<algorithmFPType *> tlsBuffer( [ = ]()-> algorithmFPType *
+    {
+        return (algorithmFPType *)daal_malloc(k * sizeof(algorithmFPType));
+    } );
+
+    daal::threader_flag allocationFailed;
+    daal::threader_for(nFeatures, nFeatures, [ =, &tlsBuffer, &allocationFailed](int j)
+    {
+        algorithmFPType *selected = tlsBuffer.local();
+        if(!selected) { allocationFailed.set(); return; }
+
+        if(largest)
+        {
+            daal::algorithms::internal::partialSort<algorithmFPType, true, cpu>(nVectors, data + j, nFeatures, k, selected);
+        }
+        else
+        {
+            daal::algorithms::internal::partialSort<algorithmFPType, false, cpu>(nVectors, data + j, nFeatures, k, selected);
+        }
+
+        for(size_t i = 0; i < k; i++)
+        {
+            topK[i * nFeatures + j] = selected[i];
+        }
+    } );
+
+    tlsBuffer.reduce( [ = ](algorithmFPType *buffer)
+    {
+        if(buffer) { daal_free(buffer); }
+    } );
+
+    inputTable->releaseBlockOfRows(inputBlock);
+    outputTable->releaseBlockOfRows(outputBlock);
+
+    if(allocationFailed.isSet()) { this->_errors->add(ErrorMemoryAllocationFailed); }
+}
+
+} // namespace daal::algorithms::sorting::internal
+
+} // namespace daal::algorithms::sorting
+
+} // namespace daal::algorithms
+
+} // namespace daal
+
+#endif
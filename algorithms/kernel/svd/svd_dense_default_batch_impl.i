@@ -31,6 +31,7 @@
 #include "service_numeric_table.h"
 
 #include "svd_dense_default_impl.i"
+#include "qr_dense_default_impl.i"
 
 #include "threading.h"
 
@@ -68,6 +69,13 @@ void SVDBatchKernel<interm, method, cpu>::compute(const size_t na, const Numeric
     size_t n = mtA.getFullNumberOfColumns();
     size_t m = mtA.getFullNumberOfRows();
 
+    size_t nBlocks = qr::internal::getNumberOfTSQRBlocks<cpu>( m, n );
+    if ( nBlocks > 1 )
+    {
+        computeTallSkinny( nBlocks, a[0], r, svdPar );
+        return;
+    }
+
     interm *A;
     interm *Sigma;
 
@@ -126,6 +134,116 @@ void SVDBatchKernel<interm, method, cpu>::compute(const size_t na, const Numeric
     daal::services::daal_free(VT);
 }
 
+/**
+ *  \brief SVD of the tall-skinny matrix A = Q * R computed as SVD of R:
+ *         A = (Q * Ur) * Sigma * V', where R = Ur * Sigma * V'
+ */
+template <typename interm, daal::algorithms::svd::Method method, CpuType cpu>
+void SVDBatchKernel<interm, method, cpu>::computeTallSkinny(size_t nBlocks, const NumericTable *ntA, NumericTable *r[],
+                                                            const svd::Parameter *svdPar)
+{
+    size_t i, j;
+
+    size_t n = ntA->getNumberOfColumns();
+    size_t m = ntA->getNumberOfRows();
+
+    bool computeU = (svdPar->leftSingularMatrix == requiredInPackedForm);
+
+    /* Q factor of A is kept in the output table of left singular vectors */
+    NumericTable *ntQ = (computeU ? r[1] : 0);
+
+    interm *RT = (interm *)daal::services::daal_malloc(n * n * sizeof(interm));
+    interm *UT = (interm *)daal::services::daal_malloc(n * n * sizeof(interm));
+    interm *VT = (interm *)daal::services::daal_malloc(n * n * sizeof(interm));
+    ServiceStatus *blockStatus = (ServiceStatus *)daal::services::daal_malloc(nBlocks * sizeof(ServiceStatus));
+
+    ServiceStatus status = SERV_ERR_OK;
+    if ( !RT || !UT || !VT || !blockStatus )
+    {
+        status = SERV_ERR_MALLOC;
+    }
+
+    if ( status == SERV_ERR_OK )
+    {
+        for ( i = 0 ; i < n * n ; i++ ) { RT[i] = 0.0; }
+
+        status = qr::internal::compute_TSQR<interm, cpu>( nBlocks, ntA, ntQ, RT, n );
+    }
+
+    if ( status == SERV_ERR_OK )
+    {
+        BlockMicroTable<interm, writeOnly, cpu> mtSigma(r[0]);
+        interm *Sigma;
+        mtSigma.getBlockOfRows( 0, 1, &Sigma );
+
+        status = compute_svd_on_one_node<interm, cpu>( n, n, RT, n, Sigma, UT, n, VT, n );
+
+        mtSigma.release();
+    }
+
+    if ( status == SERV_ERR_OK && computeU )
+    {
+        size_t rowsInBlock = m / nBlocks;
+
+        /* U = Q * Ur computed block by block in place of Q */
+        daal::threader_for( nBlocks, nBlocks, [=](int k)
+        {
+            const size_t row0 = k * rowsInBlock;
+            const size_t mk   = ( k == nBlocks - 1 ) ? m - row0 : rowsInBlock;
+
+            interm *Uk = (interm *)daal::services::daal_malloc( sizeof(interm) * n * mk );
+            blockStatus[k] = ( Uk ? SERV_ERR_OK : SERV_ERR_MALLOC );
+            if ( !Uk ) { return; }
+
+            interm *Qk;
+            BlockMicroTable<interm, readWrite, cpu> mtQ( ntQ );
+            mtQ.getBlockOfRows( row0, mk, &Qk );
+
+            /* Row-major Qk * Ur is computed as column-major Ur' * Qk' */
+            char trans   = 'T';
+            char notrans = 'N';
+            interm one  = interm(1.0);
+            interm zero = interm(0.0);
+            MKL_INT nn  = n;
+            MKL_INT mkk = mk;
+            Blas<interm, cpu>::xxgemm( &trans, &notrans, &nn, &mkk, &nn, &one, UT, &nn, Qk, &nn, &zero, Uk, &nn );
+
+            daal::services::daal_memcpy_s( Qk, sizeof(interm) * n * mk, Uk, sizeof(interm) * n * mk );
+
+            mtQ.release();
+
+            daal::services::daal_free( Uk );
+        } );
+
+        for ( size_t k = 0 ; k < nBlocks ; k++ )
+        {
+            if ( blockStatus[k] != SERV_ERR_OK ) { status = blockStatus[k]; }
+        }
+    }
+
+    if ( status == SERV_ERR_OK && svdPar->rightSingularMatrix == requiredInPackedForm)
+    {
+        BlockMicroTable<interm, writeOnly, cpu> mtV(r[2]);
+        interm *V;
+        mtV.getBlockOfRows( 0, n, &V );
+        for ( i = 0 ; i < n ; i++ )
+        {
+            for ( j = 0 ; j < n; j++ )
+            {
+                V[i + j * n] = VT[i * n + j];
+            }
+        }
+        mtV.release();
+    }
+
+    if ( RT )          { daal::services::daal_free(RT); }
+    if ( UT )          { daal::services::daal_free(UT); }
+    if ( VT )          { daal::services::daal_free(VT); }
+    if ( blockStatus ) { daal::services::daal_free(blockStatus); }
+
+    if ( status != SERV_ERR_OK ) { this->_errors->add(getSvdErrorId(status)); }
+}
+
 } // namespace daal::internal
 }
 }
@@ -46,6 +46,14 @@ namespace svd
 namespace internal
 {
 
+/* Identifier of the error that corresponds to the status of the internal computations of SVD */
+inline services::ErrorID getSvdErrorId( ServiceStatus status )
+{
+    if ( status == SERV_ERR_MALLOC )                         { return services::ErrorMemoryAllocationFailed; }
+    if ( status == SERV_ERR_MKL_SVD_XBDSQR_DID_NOT_CONVERGE ) { return services::ErrorSvdXBDSQRDidNotConverge; }
+    return services::ErrorSvdIthParamIllegalValue;
+}
+
 template <typename interm, CpuType cpu>
 ServiceStatus compute_svd_on_one_node( MKL_INT m, MKL_INT n, interm *a, MKL_INT lda,
                                        interm *s, interm *u, MKL_INT ldu, interm *vt, MKL_INT ldvt )
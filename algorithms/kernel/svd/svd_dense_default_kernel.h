@@ -45,6 +45,9 @@ class SVDBatchKernel : public Kernel
 public:
     void compute(const size_t na, const NumericTable *const *a,
                  const size_t nr, NumericTable *r[], const daal::algorithms::Parameter *par = 0);
+
+private:
+    void computeTallSkinny(size_t nBlocks, const NumericTable *ntA, NumericTable *r[], const svd::Parameter *svdPar);
 };
 
 template<typename interm, daal::algorithms::svd::Method method, CpuType cpu>
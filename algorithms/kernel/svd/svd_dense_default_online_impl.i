@@ -32,6 +32,7 @@
 
 #include "svd_dense_default_impl.i"
 #include "svd_dense_default_distr_impl.i"
+#include "qr_dense_default_impl.i"
 
 #include "threading.h"
 
@@ -69,6 +70,39 @@ void SVDOnlineKernel<interm, method, cpu>::compute(const size_t na, const Numeri
     size_t  n = mtAi.getFullNumberOfColumns();
     size_t  m = mtAi.getFullNumberOfRows();
 
+    size_t nBlocks = qr::internal::getNumberOfTSQRBlocks<cpu>( m, n );
+    if ( nBlocks > 1 )
+    {
+        interm *Aux2iT = (interm *)daal::services::daal_malloc(n * n * sizeof(interm));
+        if ( !Aux2iT ) { this->_errors->add(services::ErrorMemoryAllocationFailed); return; }
+
+        NumericTable *ntAux1i = (svdPar->leftSingularMatrix == requiredInPackedForm ? r[0] : 0);
+        ServiceStatus status = qr::internal::compute_TSQR<interm, cpu>( nBlocks, a[0], ntAux1i, Aux2iT, n );
+        if ( status != SERV_ERR_OK )
+        {
+            daal::services::daal_free(Aux2iT);
+            this->_errors->add(getSvdErrorId(status));
+            return;
+        }
+
+        mtAux2i.getBlockOfRows( 0, n, &Aux2i ); /* Aux2i = Ri [n][n] */
+        for ( i = 0 ; i < n ; i++ )
+        {
+            for ( j = 0 ; j <= i; j++ )
+            {
+                Aux2i[i + j * n] = Aux2iT[i * n + j];
+            }
+            for (     ; j < n; j++ )
+            {
+                Aux2i[i + j * n] = 0.0;
+            }
+        }
+        mtAux2i.release();
+
+        daal::services::daal_free(Aux2iT);
+        return;
+    }
+
     interm *Aux1iT = (interm *)daal::services::daal_malloc(n * m * sizeof(interm));
     interm *Aux2iT = (interm *)daal::services::daal_malloc(n * n * sizeof(interm));
 
@@ -28,6 +28,7 @@
 #include "service_memory.h"
 #include "service_micro_table.h"
 #include "service_numeric_table.h"
+#include "service_profiler.h"
 using namespace daal::services::internal;
 
 namespace daal
@@ -89,6 +90,7 @@ struct SVMCacheRowGetter<simpleCache, true, algorithmFPType, cpu>:
                 algorithmFPType *_cache, services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable,
                 size_t *shrinkingRowIndices)
     {
+        DAAL_PROFILER_COUNT("svm.cache.hit", blockSize);
         return _cache + rowIndex * _lineSize + startColIndex;
     }
 
@@ -107,6 +109,7 @@ struct SVMCacheRowGetter<simpleCache, false, algorithmFPType, cpu>:
                 algorithmFPType *_cache, services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable,
                 size_t *shrinkingRowIndices)
     {
+        DAAL_PROFILER_COUNT("svm.cache.hit", blockSize);
         return _cache + rowIndex * _lineSize + startColIndex;
     }
 
@@ -124,6 +127,7 @@ struct SVMCacheRowGetter<noCache, true, algorithmFPType, cpu>:
                 algorithmFPType *_cache, services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable,
                 size_t *shrinkingRowIndices)
     {
+        DAAL_PROFILER_COUNT("svm.cache.miss", blockSize);
         _cacheTable->setArray(_cache + cacheOffset);
         kernel->parameterBase->rowIndexY = shrinkingRowIndices[rowIndex];
         for (size_t i = 0; i < blockSize; i++)
@@ -148,6 +152,7 @@ struct SVMCacheRowGetter<noCache, false, algorithmFPType, cpu>:
                 algorithmFPType *_cache, services::SharedPtr<HomogenNumericTableCPU<algorithmFPType, cpu> > _cacheTable,
                 size_t *shrinkingRowIndices)
     {
+        DAAL_PROFILER_COUNT("svm.cache.miss", blockSize);
         _cacheTable->setArray(_cache + cacheOffset);
         kernel->parameterBase->rowIndexY = rowIndex;
         for (size_t i = 0; i < blockSize; i++)
@@ -320,7 +325,10 @@ public:
         shRes->set(kernel_function::values, _cacheTable);
         _kernel->setResult(shRes);
 
-        _kernel->compute();
+        {
+            DAAL_PROFILER_TASK("svm.cache.init");
+            _kernel->compute();
+        }
     }
 
     /**
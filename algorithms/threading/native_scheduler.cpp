@@ -0,0 +1,646 @@
+/* file: native_scheduler.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the self-contained work-stealing scheduler used by
+//  the native threading layer.
+//--
+*/
+
+#if defined(__DO_NATIVE_LAYER__)
+
+#include "native_scheduler.h"
+#include "numa_topology.h"
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <utility>
+#include <cstdlib>
+#include <cstring>
+#include <emmintrin.h>
+
+namespace daal
+{
+namespace threading_native
+{
+namespace
+{
+
+const size_t maxMasterThreads = 16;  /* Number of external threads that may run parallel loops concurrently */
+const size_t tlsFastSlots     = 256; /* Number of threads served by TLS objects without locking */
+const int    defaultSpinCount = 1024;
+const int    splitFactor      = 4;   /* Number of ranges per thread a parallel loop is split into */
+
+/* Index of the deque owned by the current thread, -1 if the thread does not participate in parallel loops */
+thread_local int threadSlot = -1;
+
+/* Unique index of the current thread used to address TLS values */
+std::atomic<size_t> nextThreadIndex(0);
+thread_local size_t threadIndex = (size_t)-1;
+
+size_t getThreadIndex()
+{
+    if (threadIndex == (size_t)-1)
+    {
+        threadIndex = nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+    }
+    return threadIndex;
+}
+
+enum AffinityType
+{
+    affinityNone    = 0,
+    affinityCompact = 1,
+    affinityNode    = 2
+};
+
+class SpinLock
+{
+public:
+    SpinLock() { _flag.clear(); }
+
+    void lock()
+    {
+        while (_flag.test_and_set(std::memory_order_acquire))
+        {
+            _mm_pause();
+        }
+    }
+
+    void unlock() { _flag.clear(std::memory_order_release); }
+
+private:
+    std::atomic_flag _flag;
+};
+
+struct Job
+{
+    const void *a;
+    daal::functype func;
+    daal::functype2 func2;
+    int grain;
+    std::atomic<int> remaining; /* Number of iterations not yet executed */
+};
+
+/* Loop which iterations are statically distributed across the workers ordered by NUMA nodes */
+struct NumaJob
+{
+    const void *a;
+    daal::functype2 func;
+    int n;
+    std::atomic<size_t> pending; /* Number of workers that have not processed their parts yet */
+};
+
+struct Task
+{
+    Job *job;
+    int begin;
+    int end;
+};
+
+/* Bounded deque of tasks. The owner pushes and pops at the bottom,
+   thieves steal from the top, so that the largest ranges are stolen first */
+class TaskDeque
+{
+public:
+    static const size_t capacity = 256;
+
+    TaskDeque() : _head(0), _tail(0), _size(0) {}
+
+    bool push(const Task &task)
+    {
+        std::lock_guard<SpinLock> lock(_lock);
+        if (_tail - _head == capacity) { return false; }
+        _tasks[_tail % capacity] = task;
+        _tail++;
+        _size.store(_tail - _head, std::memory_order_seq_cst);
+        return true;
+    }
+
+    bool pop(Task &task)
+    {
+        if (_size.load(std::memory_order_relaxed) == 0) { return false; }
+        std::lock_guard<SpinLock> lock(_lock);
+        if (_tail == _head) { return false; }
+        _tail--;
+        task = _tasks[_tail % capacity];
+        _size.store(_tail - _head, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool steal(Task &task)
+    {
+        if (_size.load(std::memory_order_relaxed) == 0) { return false; }
+        std::lock_guard<SpinLock> lock(_lock);
+        if (_tail == _head) { return false; }
+        task = _tasks[_head % capacity];
+        _head++;
+        _size.store(_tail - _head, std::memory_order_relaxed);
+        return true;
+    }
+
+    bool empty() const { return _size.load(std::memory_order_seq_cst) == 0; }
+
+private:
+    SpinLock _lock;
+    size_t _head;
+    size_t _tail;
+    std::atomic<size_t> _size;
+    Task _tasks[capacity];
+    char _padding[64]; /* Keeps the locks of neighboring deques in different cache lines */
+};
+
+int getEnvInt(const char *name, int defaultValue)
+{
+    const char *value = std::getenv(name);
+    if (!value || !*value) { return defaultValue; }
+    char *end = 0;
+    long result = std::strtol(value, &end, 10);
+    return (end && *end == '\0' && result >= 0) ? (int)result : defaultValue;
+}
+
+class Scheduler
+{
+public:
+    static Scheduler &instance()
+    {
+        /* Never destroyed: joining the workers from a static destructor may deadlock on library unload */
+        static Scheduler *scheduler = new Scheduler();
+        return *scheduler;
+    }
+
+    int getNumberOfThreads() const { return (int)_nWorkers + 1; }
+
+    size_t setNumberOfThreads(size_t numThreads)
+    {
+        std::lock_guard<std::mutex> lock(_configMutex);
+        stop();
+        start(numThreads);
+        return numThreads;
+    }
+
+    void parallelFor(int n, const void *a, daal::functype func, daal::functype2 func2)
+    {
+        if (n <= 0) { return; }
+
+        int slot = threadSlot;
+        bool isMaster = false;
+        if (slot < 0 && n > 1 && _nWorkers > 0)
+        {
+            slot = acquireMasterSlot();
+            isMaster = (slot >= 0);
+            threadSlot = slot;
+        }
+        if (slot < 0 || n == 1)
+        {
+            if (func) { for (int i = 0; i < n; i++) { func(i, a); } }
+            else { func2(0, n, a); }
+            return;
+        }
+
+        Job job;
+        job.a     = a;
+        job.func  = func;
+        job.func2 = func2;
+        job.grain = n / (getNumberOfThreads() * splitFactor);
+        if (job.grain < 1) { job.grain = 1; }
+        job.remaining.store(n, std::memory_order_relaxed);
+
+        Task root = { &job, 0, n };
+        execute(slot, root);
+
+        /* Help executing the outstanding tasks until the whole range is processed */
+        unsigned int seed = (unsigned int)slot + 1;
+        int idle = 0;
+        while (job.remaining.load(std::memory_order_acquire) > 0)
+        {
+            if (executeOne(slot, seed)) { idle = 0; continue; }
+            if (++idle < _spinCount) { _mm_pause(); }
+            else { std::this_thread::yield(); }
+        }
+
+        if (isMaster)
+        {
+            threadSlot = -1;
+            releaseMasterSlot(slot);
+        }
+    }
+
+    void parallelForNuma(int n, const void *a, daal::functype2 func)
+    {
+        if (n <= 0) { return; }
+        if (_nWorkers == 0 || n == 1 || daal::numa::Topology::instance().getNumberOfNodes() < 2)
+        {
+            parallelFor(n, a, 0, func);
+            return;
+        }
+
+        NumaJob job;
+        job.a    = a;
+        job.func = func;
+        job.n    = n;
+        job.pending.store(_nWorkers, std::memory_order_relaxed);
+
+        /* The calling thread is not pinned, so only the workers take part in the loop.
+           A worker that calls the loop processes its own part while waiting */
+        const int slot = threadSlot;
+        unsigned int seed = (unsigned int)(slot + 1);
+        for (size_t i = 0; i < _nWorkers; i++)
+        {
+            NumaJob *expected = 0;
+            while (!_mailboxes[i].compare_exchange_weak(expected, &job, std::memory_order_acq_rel))
+            {
+                expected = 0;
+                if (slot < 0 || !executeOne(slot, seed)) { _mm_pause(); }
+            }
+        }
+        notifyAll();
+
+        int idle = 0;
+        while (job.pending.load(std::memory_order_acquire) > 0)
+        {
+            if (slot >= 0 && executeOne(slot, seed)) { idle = 0; continue; }
+            if (++idle < _spinCount) { _mm_pause(); }
+            else { std::this_thread::yield(); }
+        }
+    }
+
+private:
+    Scheduler() : _deques(0), _mailboxes(0), _nWorkers(0), _nDeques(0), _shutdown(false), _sleepers(0), _epoch(0)
+    {
+        for (size_t i = 0; i < maxMasterThreads; i++) { _masterBusy[i].store(false, std::memory_order_relaxed); }
+
+        /* CPUs are listed node by node, so consecutive workers share a node */
+        const daal::numa::Topology &topology = daal::numa::Topology::instance();
+        for (size_t node = 0; node < topology.getNumberOfNodes(); node++)
+        {
+            _cpus.insert(_cpus.end(), topology.getNodeCpus(node).begin(), topology.getNodeCpus(node).end());
+        }
+        _spinCount = getEnvInt("DAAL_NATIVE_SPIN_COUNT", defaultSpinCount);
+
+        const char *affinity = std::getenv("DAAL_NATIVE_AFFINITY");
+        if (affinity && std::strcmp(affinity, "compact") == 0)   { _affinity = affinityCompact; }
+        else if (affinity && std::strcmp(affinity, "node") == 0) { _affinity = affinityNode; }
+        else if (affinity && std::strcmp(affinity, "none") == 0) { _affinity = affinityNone; }
+        else { _affinity = (topology.getNumberOfNodes() > 1 ? affinityNode : affinityNone); }
+
+        start((size_t)getEnvInt("DAAL_NATIVE_NUM_THREADS", (int)_cpus.size()));
+    }
+
+    void start(size_t numThreads)
+    {
+        _nWorkers = (numThreads > 1 ? numThreads - 1 : 0);
+        _nDeques  = _nWorkers + maxMasterThreads;
+        _deques   = new TaskDeque[_nDeques];
+        _shutdown.store(false, std::memory_order_relaxed);
+
+        _mailboxes = new std::atomic<NumaJob *>[_nWorkers + 1];
+        for (size_t i = 0; i < _nWorkers; i++) { _mailboxes[i].store(0, std::memory_order_relaxed); }
+
+        /* Worker i runs on CPU (i + 1), CPU 0 is left for the thread that starts the parallel loops.
+           Parts of NUMA loops are assigned in the order of the nodes of the workers */
+        const daal::numa::Topology &topology = daal::numa::Topology::instance();
+        _workerNodes.resize(_nWorkers);
+        _workerPositions.resize(_nWorkers);
+        for (size_t i = 0; i < _nWorkers; i++)
+        {
+            _workerNodes[i] = topology.getNodeOfCpu(_cpus[(i + 1) % _cpus.size()]);
+        }
+        size_t position = 0;
+        for (size_t node = 0; node < topology.getNumberOfNodes(); node++)
+        {
+            for (size_t i = 0; i < _nWorkers; i++)
+            {
+                if (_workerNodes[i] == node) { _workerPositions[i] = position++; }
+            }
+        }
+
+        _workers.reserve(_nWorkers);
+        for (size_t i = 0; i < _nWorkers; i++)
+        {
+            _workers.push_back(std::thread(&Scheduler::workerLoop, this, (int)i));
+        }
+    }
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sleepMutex);
+            _shutdown.store(true, std::memory_order_seq_cst);
+            _epoch.fetch_add(1, std::memory_order_seq_cst);
+        }
+        _sleepCv.notify_all();
+
+        for (size_t i = 0; i < _workers.size(); i++) { _workers[i].join(); }
+        _workers.clear();
+
+        delete[] _deques;
+        _deques = 0;
+        delete[] _mailboxes;
+        _mailboxes = 0;
+    }
+
+    void workerLoop(int slot)
+    {
+        threadSlot = slot;
+        if (_affinity == affinityCompact)
+        {
+            daal::numa::bindCurrentThread(std::vector<int>(1, _cpus[(slot + 1) % _cpus.size()]));
+        }
+        else if (_affinity == affinityNode)
+        {
+            daal::numa::bindCurrentThread(daal::numa::Topology::instance().getNodeCpus(_workerNodes[slot]));
+        }
+
+        unsigned int seed = (unsigned int)slot + 1;
+        int idle = 0;
+        while (!_shutdown.load(std::memory_order_acquire))
+        {
+            if (executeOne(slot, seed)) { idle = 0; continue; }
+            if (++idle < _spinCount) { _mm_pause(); continue; }
+            idle = 0;
+            sleep();
+        }
+        threadSlot = -1;
+    }
+
+    /* Blocks the calling worker until new tasks are published or the pool is stopped */
+    void sleep()
+    {
+        /* The counter is incremented before the final check for work so that
+           a concurrent push either is seen by the check or sees the sleeper */
+        _sleepers.fetch_add(1, std::memory_order_seq_cst);
+        unsigned long long epoch = _epoch.load(std::memory_order_seq_cst);
+
+        if (!hasWork())
+        {
+            std::unique_lock<std::mutex> lock(_sleepMutex);
+            while (_epoch.load(std::memory_order_seq_cst) == epoch && !_shutdown.load(std::memory_order_seq_cst))
+            {
+                _sleepCv.wait(lock);
+            }
+        }
+        _sleepers.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    void notifyAll()
+    {
+        if (_sleepers.load(std::memory_order_seq_cst) > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _epoch.fetch_add(1, std::memory_order_seq_cst);
+            }
+            _sleepCv.notify_all();
+        }
+    }
+
+    void notify()
+    {
+        if (_sleepers.load(std::memory_order_seq_cst) > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_sleepMutex);
+                _epoch.fetch_add(1, std::memory_order_seq_cst);
+            }
+            _sleepCv.notify_one();
+        }
+    }
+
+    bool hasWork() const
+    {
+        for (size_t i = 0; i < _nDeques; i++)
+        {
+            if (!_deques[i].empty()) { return true; }
+        }
+        for (size_t i = 0; i < _nWorkers; i++)
+        {
+            if (_mailboxes[i].load(std::memory_order_seq_cst)) { return true; }
+        }
+        return false;
+    }
+
+    /* Splits the range of the task in halves pushing the upper ones to the deque
+       of the calling thread, then processes the rest of the range */
+    void execute(int slot, Task task)
+    {
+        Job &job = *task.job;
+        while (task.end - task.begin > job.grain)
+        {
+            int middle = task.begin + (task.end - task.begin) / 2;
+            Task upper = { task.job, middle, task.end };
+            if (!_deques[slot].push(upper)) { break; }
+            notify();
+            task.end = middle;
+        }
+
+        if (job.func)
+        {
+            for (int i = task.begin; i < task.end; i++) { job.func(i, job.a); }
+        }
+        else
+        {
+            job.func2(task.begin, task.end - task.begin, job.a);
+        }
+        /* The job may be destroyed by its owner right after the last decrement */
+        job.remaining.fetch_sub(task.end - task.begin, std::memory_order_acq_rel);
+    }
+
+    /* Processes the part of the NUMA loop assigned to the worker */
+    void executeNuma(size_t worker, NumaJob *job)
+    {
+        const size_t position = _workerPositions[worker];
+        int begin = (int)((long long)job->n * position / _nWorkers);
+        int end   = (int)((long long)job->n * (position + 1) / _nWorkers);
+        if (end > begin) { job->func(begin, end - begin, job->a); }
+        job->pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    /* Executes the part of a NUMA loop posted to the worker, or one task
+       taken from the own deque or stolen from a random victim */
+    bool executeOne(int slot, unsigned int &seed)
+    {
+        if ((size_t)slot < _nWorkers)
+        {
+            /* Only the owner clears its mailbox */
+            NumaJob *numaJob = _mailboxes[slot].load(std::memory_order_acquire);
+            if (numaJob)
+            {
+                _mailboxes[slot].store(0, std::memory_order_release);
+                executeNuma(slot, numaJob);
+                return true;
+            }
+        }
+
+        Task task;
+        if (_deques[slot].pop(task))
+        {
+            execute(slot, task);
+            return true;
+        }
+
+        seed = seed * 1103515245u + 12345u;
+        size_t first = (seed >> 16) % _nDeques;
+        for (size_t i = 0; i < _nDeques; i++)
+        {
+            size_t victim = (first + i) % _nDeques;
+            if (victim != (size_t)slot && _deques[victim].steal(task))
+            {
+                execute(slot, task);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int acquireMasterSlot()
+    {
+        for (size_t i = 0; i < maxMasterThreads; i++)
+        {
+            bool expected = false;
+            if (!_masterBusy[i].load(std::memory_order_relaxed) &&
+                _masterBusy[i].compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                return (int)(_nWorkers + i);
+            }
+        }
+        return -1;
+    }
+
+    void releaseMasterSlot(int slot)
+    {
+        _masterBusy[slot - _nWorkers].store(false, std::memory_order_release);
+    }
+
+    std::vector<std::thread> _workers;
+    TaskDeque *_deques;              /* Deques of the workers followed by the deques of the master threads */
+    std::atomic<NumaJob *> *_mailboxes; /* Parts of NUMA loops posted to the workers */
+    std::vector<size_t> _workerNodes;
+    std::vector<size_t> _workerPositions;
+    size_t _nWorkers;
+    size_t _nDeques;
+    std::atomic<bool> _masterBusy[maxMasterThreads];
+
+    std::atomic<bool> _shutdown;
+    std::atomic<int> _sleepers;
+    std::atomic<unsigned long long> _epoch;
+    std::mutex _sleepMutex;
+    std::condition_variable _sleepCv;
+    std::mutex _configMutex;
+
+    std::vector<int> _cpus;
+    int _spinCount;
+    AffinityType _affinity;
+};
+
+/* Per-thread values created on demand. Values of the first tlsFastSlots threads
+   are stored in a plain array addressed by the thread index, the rest under a lock */
+class TlsStorage
+{
+public:
+    TlsStorage(void *a, daal::tls_functype func) : _a(a), _func(func)
+    {
+        for (size_t i = 0; i < tlsFastSlots; i++) { _fast[i] = 0; }
+    }
+
+    void *local()
+    {
+        size_t index = getThreadIndex();
+        if (index < tlsFastSlots)
+        {
+            if (!_fast[index]) { _fast[index] = _func(_a); }
+            return _fast[index];
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < _overflow.size(); i++)
+        {
+            if (_overflow[i].first == index) { return _overflow[i].second; }
+        }
+        void *value = _func(_a);
+        _overflow.push_back(std::make_pair(index, value));
+        return value;
+    }
+
+    void reduce(void *a, daal::tls_reduce_functype func)
+    {
+        for (size_t i = 0; i < tlsFastSlots; i++)
+        {
+            if (_fast[i]) { func(_fast[i], a); }
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (size_t i = 0; i < _overflow.size(); i++) { func(_overflow[i].second, a); }
+    }
+
+private:
+    void *_a;
+    daal::tls_functype _func;
+    void *_fast[tlsFastSlots];
+    std::mutex _mutex;
+    std::vector<std::pair<size_t, void *> > _overflow;
+};
+
+} // namespace
+
+size_t setNumberOfThreads(size_t numThreads)
+{
+    return Scheduler::instance().setNumberOfThreads(numThreads);
+}
+
+int getMaxThreads()
+{
+    return Scheduler::instance().getNumberOfThreads();
+}
+
+void parallelFor(int n, const void *a, daal::functype func, daal::functype2 func2)
+{
+    Scheduler::instance().parallelFor(n, a, func, func2);
+}
+
+void parallelForNuma(int n, const void *a, daal::functype2 func)
+{
+    Scheduler::instance().parallelForNuma(n, a, func);
+}
+
+void *createTls(void *a, daal::tls_functype func)
+{
+    return new TlsStorage(a, func);
+}
+
+void *localTls(void *tlsPtr)
+{
+    return static_cast<TlsStorage *>(tlsPtr)->local();
+}
+
+void reduceTls(void *tlsPtr, void *a, daal::tls_reduce_functype func)
+{
+    static_cast<TlsStorage *>(tlsPtr)->reduce(a, func);
+}
+
+void deleteTls(void *tlsPtr)
+{
+    delete static_cast<TlsStorage *>(tlsPtr);
+}
+
+} // namespace threading_native
+} // namespace daal
+
+#endif
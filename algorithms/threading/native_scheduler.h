@@ -0,0 +1,74 @@
+/* file: native_scheduler.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the self-contained work-stealing scheduler used by
+//  the native threading layer.
+//
+//  The scheduler runs a pool of std::thread workers, each owning a deque of
+//  index ranges. Owners split ranges and take work from the bottom of their
+//  deques, idle threads steal from the top of the others. The thread calling
+//  a parallel loop participates in its execution.
+//
+//  The behavior is controlled with the environment variables:
+//    DAAL_NATIVE_NUM_THREADS - number of threads including the calling one,
+//                              defaults to the number of available CPUs
+//    DAAL_NATIVE_SPIN_COUNT  - number of unsuccessful attempts to find work
+//                              an idle worker makes before it goes to sleep,
+//                              0 makes workers sleep right away
+//    DAAL_NATIVE_AFFINITY    - "compact" pins the workers to consecutive
+//                              available CPUs, "node" binds each worker to
+//                              all CPUs of its NUMA node, "none" does not pin.
+//                              Defaults to "node" on NUMA systems and to
+//                              "none" otherwise
+//--
+*/
+
+#ifndef __NATIVE_SCHEDULER_H__
+#define __NATIVE_SCHEDULER_H__
+
+#include "threading.h"
+
+namespace daal
+{
+namespace threading_native
+{
+
+/* Sets the number of threads used by the scheduler including the calling one.
+   Must not be called while parallel computations are in progress */
+size_t setNumberOfThreads(size_t numThreads);
+
+int getMaxThreads();
+
+/* Runs func(i, a) for i in [0, n) if func is not null, otherwise
+   runs func2(begin, size, a) over the subranges covering [0, n) */
+void parallelFor(int n, const void *a, daal::functype func, daal::functype2 func2);
+
+/* Runs func(begin, size, a) over the contiguous parts of [0, n) statically
+   assigned to the workers in the order of their NUMA nodes */
+void parallelForNuma(int n, const void *a, daal::functype2 func);
+
+void *createTls(void *a, daal::tls_functype func);
+void *localTls(void *tlsPtr);
+void reduceTls(void *tlsPtr, void *a, daal::tls_reduce_functype func);
+void deleteTls(void *tlsPtr);
+
+} // namespace threading_native
+} // namespace daal
+
+#endif
@@ -0,0 +1,326 @@
+/* file: numa_topology.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the NUMA topology detection and memory placement
+//  utilities used by the threading layers.
+//--
+*/
+
+#include "numa_topology.h"
+
+#include <thread>
+#include <utility>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+    #include <dirent.h>
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+    #include <sys/syscall.h>
+#elif defined(_WIN32)
+    #include <windows.h>
+#endif
+
+namespace daal
+{
+namespace numa
+{
+namespace
+{
+
+#if defined(__linux__)
+
+/* Memory policies of the mbind system call, see linux/mempolicy.h */
+const int mpolPreferred  = 1;
+const int mpolInterleave = 3;
+const unsigned mpolMoveFlag = (1 << 1);
+
+void setNodeMaskBit(std::vector<unsigned long> &mask, int nodeId)
+{
+    const size_t bitsPerWord = sizeof(unsigned long) * 8;
+    size_t word = (size_t)nodeId / bitsPerWord;
+    if (mask.size() <= word) { mask.resize(word + 1, 0); }
+    mask[word] |= 1UL << ((size_t)nodeId % bitsPerWord);
+}
+
+/* Errors are ignored: placement is an optimization and may be prohibited in restricted environments */
+void bindMemory(void *ptr, size_t size, int mode, const std::vector<unsigned long> &mask)
+{
+    syscall(SYS_mbind, ptr, size, mode, &mask[0], mask.size() * sizeof(unsigned long) * 8 + 1, mpolMoveFlag);
+}
+
+/* Parses CPU list of the form "0-3,8,10-11" */
+std::vector<int> parseCpuList(const char *list)
+{
+    std::vector<int> cpus;
+    const char *p = list;
+    while (*p)
+    {
+        char *end = 0;
+        long first = std::strtol(p, &end, 10);
+        if (end == p) { break; }
+        long last = first;
+        p = end;
+        if (*p == '-')
+        {
+            last = std::strtol(p + 1, &end, 10);
+            p = end;
+        }
+        for (long cpu = first; cpu <= last; cpu++) { cpus.push_back((int)cpu); }
+        if (*p == ',') { p++; }
+        else { break; }
+    }
+    return cpus;
+}
+
+#endif
+
+/* Returns the aligned to page boundaries part of [ptr, ptr + size), size of the result is 0 if there is no such part */
+char *alignToPages(void *ptr, size_t size, size_t &alignedSize)
+{
+    const size_t pageSize = getPageSize();
+    size_t begin = ((size_t)ptr + pageSize - 1) / pageSize * pageSize;
+    size_t end   = ((size_t)ptr + size) / pageSize * pageSize;
+    alignedSize = (end > begin ? end - begin : 0);
+    return (char *)begin;
+}
+
+} // namespace
+
+Topology::Topology()
+{
+#if defined(__linux__)
+    cpu_set_t processMask;
+    CPU_ZERO(&processMask);
+    bool hasProcessMask = (sched_getaffinity(0, sizeof(processMask), &processMask) == 0);
+
+    DIR *dir = opendir("/sys/devices/system/node");
+    if (dir)
+    {
+        std::vector<std::pair<int, std::vector<int> > > nodes;
+        struct dirent *entry;
+        while ((entry = readdir(dir)) != 0)
+        {
+            int nodeId = 0;
+            if (std::strncmp(entry->d_name, "node", 4) != 0 || std::sscanf(entry->d_name + 4, "%d", &nodeId) != 1) { continue; }
+
+            char path[320];
+            std::snprintf(path, sizeof(path), "/sys/devices/system/node/%s/cpulist", entry->d_name);
+            FILE *file = std::fopen(path, "r");
+            if (!file) { continue; }
+            char list[4096] = { 0 };
+            bool isRead = (std::fgets(list, sizeof(list), file) != 0);
+            std::fclose(file);
+            if (!isRead) { continue; }
+
+            std::vector<int> cpus;
+            std::vector<int> nodeCpus = parseCpuList(list);
+            for (size_t i = 0; i < nodeCpus.size(); i++)
+            {
+                if (nodeCpus[i] < CPU_SETSIZE && (!hasProcessMask || CPU_ISSET(nodeCpus[i], &processMask)))
+                {
+                    cpus.push_back(nodeCpus[i]);
+                }
+            }
+            if (!cpus.empty()) { nodes.push_back(std::make_pair(nodeId, cpus)); }
+        }
+        closedir(dir);
+
+        /* Directory entries are not ordered */
+        for (size_t i = 1; i < nodes.size(); i++)
+        {
+            for (size_t j = i; j > 0 && nodes[j - 1].first > nodes[j].first; j--) { std::swap(nodes[j - 1], nodes[j]); }
+        }
+        for (size_t i = 0; i < nodes.size(); i++)
+        {
+            _nodeIds.push_back(nodes[i].first);
+            _nodeCpus.push_back(nodes[i].second);
+        }
+    }
+
+    if (_nodeCpus.empty() && hasProcessMask)
+    {
+        std::vector<int> cpus;
+        for (int i = 0; i < CPU_SETSIZE; i++)
+        {
+            if (CPU_ISSET(i, &processMask)) { cpus.push_back(i); }
+        }
+        if (!cpus.empty())
+        {
+            _nodeIds.push_back(0);
+            _nodeCpus.push_back(cpus);
+        }
+    }
+#elif defined(_WIN32)
+    DWORD_PTR processMask = 0, systemMask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+    {
+        std::vector<int> cpus;
+        for (int i = 0; i < (int)(sizeof(DWORD_PTR) * 8); i++)
+        {
+            if (processMask & ((DWORD_PTR)1 << i)) { cpus.push_back(i); }
+        }
+        if (!cpus.empty())
+        {
+            _nodeIds.push_back(0);
+            _nodeCpus.push_back(cpus);
+        }
+    }
+#endif
+
+    if (_nodeCpus.empty())
+    {
+        unsigned int n = std::thread::hardware_concurrency();
+        std::vector<int> cpus;
+        for (unsigned int i = 0; i < (n ? n : 1); i++) { cpus.push_back((int)i); }
+        _nodeIds.push_back(0);
+        _nodeCpus.push_back(cpus);
+    }
+}
+
+const Topology &Topology::instance()
+{
+    static Topology topology;
+    return topology;
+}
+
+size_t Topology::getNodeOfCpu(int cpu) const
+{
+    for (size_t node = 0; node < _nodeCpus.size(); node++)
+    {
+        for (size_t i = 0; i < _nodeCpus[node].size(); i++)
+        {
+            if (_nodeCpus[node][i] == cpu) { return node; }
+        }
+    }
+    return 0;
+}
+
+size_t Topology::getCurrentNode() const
+{
+    if (_nodeCpus.size() == 1) { return 0; }
+#if defined(__linux__)
+    return getNodeOfCpu(sched_getcpu());
+#else
+    return 0;
+#endif
+}
+
+void bindCurrentThread(const std::vector<int> &cpus)
+{
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (size_t i = 0; i < cpus.size(); i++)
+    {
+        if (cpus[i] < CPU_SETSIZE) { CPU_SET(cpus[i], &mask); }
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask);
+#elif defined(_WIN32)
+    DWORD_PTR mask = 0;
+    for (size_t i = 0; i < cpus.size(); i++)
+    {
+        if (cpus[i] < (int)(sizeof(DWORD_PTR) * 8)) { mask |= (DWORD_PTR)1 << cpus[i]; }
+    }
+    if (mask) { SetThreadAffinityMask(GetCurrentThread(), mask); }
+#endif
+}
+
+std::vector<int> getCurrentThreadCpus()
+{
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(mask), &mask) == 0)
+    {
+        for (int i = 0; i < CPU_SETSIZE; i++)
+        {
+            if (CPU_ISSET(i, &mask)) { cpus.push_back(i); }
+        }
+    }
+#endif
+    if (cpus.empty())
+    {
+        const Topology &topology = Topology::instance();
+        for (size_t node = 0; node < topology.getNumberOfNodes(); node++)
+        {
+            cpus.insert(cpus.end(), topology.getNodeCpus(node).begin(), topology.getNodeCpus(node).end());
+        }
+    }
+    return cpus;
+}
+
+void placeOnCurrentNode(void *ptr, size_t size)
+{
+    size_t alignedSize = 0;
+    char *aligned = alignToPages(ptr, size, alignedSize);
+    if (alignedSize == 0) { return; }
+
+#if defined(__linux__)
+    const Topology &topology = Topology::instance();
+    if (topology.getNumberOfNodes() > 1)
+    {
+        std::vector<unsigned long> mask;
+        setNodeMaskBit(mask, topology.getNodeId(topology.getCurrentNode()));
+        bindMemory(aligned, alignedSize, mpolPreferred, mask);
+    }
+#endif
+
+    /* Pages not yet backed by physical memory are allocated on the first write.
+       Writing the value back keeps the content of the pages that are already in use */
+    const size_t pageSize = getPageSize();
+    for (size_t offset = 0; offset < alignedSize; offset += pageSize)
+    {
+        volatile char *page = aligned + offset;
+        *page = *page;
+    }
+}
+
+void interleave(void *ptr, size_t size)
+{
+#if defined(__linux__)
+    const Topology &topology = Topology::instance();
+    if (topology.getNumberOfNodes() < 2) { return; }
+
+    size_t alignedSize = 0;
+    char *aligned = alignToPages(ptr, size, alignedSize);
+    if (alignedSize == 0) { return; }
+
+    std::vector<unsigned long> mask;
+    for (size_t node = 0; node < topology.getNumberOfNodes(); node++) { setNodeMaskBit(mask, topology.getNodeId(node)); }
+    bindMemory(aligned, alignedSize, mpolInterleave, mask);
+#endif
+}
+
+size_t getPageSize()
+{
+#if defined(__linux__)
+    static const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+    return pageSize;
+#else
+    return 4096;
+#endif
+}
+
+} // namespace numa
+} // namespace daal
@@ -0,0 +1,82 @@
+/* file: numa_topology.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the NUMA topology detection and memory placement
+//  utilities used by the threading layers.
+//--
+*/
+
+#ifndef __NUMA_TOPOLOGY_H__
+#define __NUMA_TOPOLOGY_H__
+
+#include <stddef.h>
+#include <vector>
+
+namespace daal
+{
+namespace numa
+{
+
+/* NUMA nodes the process may run on, as seen at the first call of instance().
+   Nodes without CPUs available to the process are omitted. On systems without
+   NUMA information all available CPUs form a single node */
+class Topology
+{
+public:
+    static const Topology &instance();
+
+    size_t getNumberOfNodes() const { return _nodeCpus.size(); }
+
+    /* CPUs of the node available to the process */
+    const std::vector<int> &getNodeCpus(size_t node) const { return _nodeCpus[node]; }
+
+    /* Operating system identifier of the node */
+    int getNodeId(size_t node) const { return _nodeIds[node]; }
+
+    /* Index of the node the CPU belongs to, 0 if the CPU is unknown */
+    size_t getNodeOfCpu(int cpu) const;
+
+    /* Index of the node the calling thread is running on */
+    size_t getCurrentNode() const;
+
+private:
+    Topology();
+
+    std::vector<std::vector<int> > _nodeCpus;
+    std::vector<int> _nodeIds;
+};
+
+/* Restricts the calling thread to the given CPUs */
+void bindCurrentThread(const std::vector<int> &cpus);
+
+/* CPUs the calling thread is allowed to run on */
+std::vector<int> getCurrentThreadCpus();
+
+/* Places the pages that lie entirely in [ptr, ptr + size) on the node the calling thread runs on */
+void placeOnCurrentNode(void *ptr, size_t size);
+
+/* Interleaves the pages that lie entirely in [ptr, ptr + size) across all nodes of the topology */
+void interleave(void *ptr, size_t size);
+
+size_t getPageSize();
+
+} // namespace numa
+} // namespace daal
+
+#endif
@@ -23,12 +23,110 @@
 
 #include "threading.h"
 #include "env_detect.h"
+#include "daal_memory.h"
+#include "numa_topology.h"
 
 #if defined(__DO_TBB_LAYER__)
+    #define TBB_PREVIEW_LOCAL_OBSERVER 1
     #include <tbb/tbb.h>
     #include <tbb/spin_mutex.h>
+    #include <tbb/task_arena.h>
+    #include <tbb/task_scheduler_observer.h>
+#elif defined(__DO_NATIVE_LAYER__)
+    #include "native_scheduler.h"
 #endif
 
+#if defined(__DO_TBB_LAYER__)
+namespace
+{
+
+/* Index of the NUMA node arena the current thread works in, -1 outside of the node arenas */
+thread_local int numaArenaNode = -1;
+
+/* CPUs the current thread was allowed to run on before it joined the node arena */
+thread_local std::vector<int> *numaSavedCpus = 0;
+
+/* Binds the threads that join the arena of a NUMA node to the CPUs of that node */
+class NumaNodeObserver : public tbb::task_scheduler_observer
+{
+public:
+    NumaNodeObserver(tbb::task_arena &arena, int node) : tbb::task_scheduler_observer(arena), _node(node)
+    {
+        observe(true);
+    }
+
+    virtual void on_scheduler_entry(bool)
+    {
+        if (!numaSavedCpus) { numaSavedCpus = new std::vector<int>(); }
+        *numaSavedCpus = daal::numa::getCurrentThreadCpus();
+        daal::numa::bindCurrentThread(daal::numa::Topology::instance().getNodeCpus(_node));
+        numaArenaNode = _node;
+    }
+
+    virtual void on_scheduler_exit(bool)
+    {
+        if (numaSavedCpus && !numaSavedCpus->empty()) { daal::numa::bindCurrentThread(*numaSavedCpus); }
+        numaArenaNode = -1;
+    }
+
+private:
+    int _node;
+};
+
+/* Task arenas with the concurrency equal to the number of CPUs of the NUMA node */
+class NumaArenas
+{
+public:
+    static NumaArenas &instance()
+    {
+        /* Never destroyed: the arenas must not outlive the TBB scheduler */
+        static NumaArenas *arenas = new NumaArenas();
+        return *arenas;
+    }
+
+    tbb::task_arena &get(size_t node) { return *_arenas[node]; }
+
+private:
+    NumaArenas()
+    {
+        const daal::numa::Topology &topology = daal::numa::Topology::instance();
+        for (size_t node = 0; node < topology.getNumberOfNodes(); node++)
+        {
+            _arenas.push_back(new tbb::task_arena((int)topology.getNodeCpus(node).size()));
+            _observers.push_back(new NumaNodeObserver(*_arenas.back(), (int)node));
+        }
+    }
+
+    std::vector<tbb::task_arena *> _arenas;
+    std::vector<NumaNodeObserver *> _observers;
+};
+
+} // namespace
+#endif
+
+namespace
+{
+
+struct NumaPlaceTask
+{
+    char *begin;    /* Start of the buffer rounded down to the page boundary */
+    char *ptr;
+    size_t size;
+    size_t pageSize;
+};
+
+void numaPlaceBlock(int i0, int in, const void *a)
+{
+    const NumaPlaceTask &task = *static_cast<const NumaPlaceTask *>(a);
+    char *begin = task.begin + (size_t)i0 * task.pageSize;
+    char *end   = begin + (size_t)in * task.pageSize;
+    if (begin < task.ptr)             { begin = task.ptr; }
+    if (end > task.ptr + task.size)   { end = task.ptr + task.size; }
+    if (end > begin) { daal::numa::placeOnCurrentNode(begin, end - begin); }
+}
+
+} // namespace
+
 DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void** init)
 {
   #if defined(__DO_TBB_LAYER__)
@@ -43,6 +141,11 @@ DAAL_EXPORT size_t _setNumberOfThreads(const size_t numThreads, void** init)
         *init = (void *)(new tbb::task_scheduler_init(numThreads));
         return numThreads;
     }
+  #elif defined(__DO_NATIVE_LAYER__)
+    if(numThreads != 0)
+    {
+        return daal::threading_native::setNumberOfThreads(numThreads);
+    }
   #endif
     return 1;
 }
@@ -64,6 +167,8 @@ DAAL_EXPORT void _daal_threader_for(int n, int threads_request, const void* a, d
     {
         func(i, a);
     }
+  #elif defined(__DO_NATIVE_LAYER__)
+    daal::threading_native::parallelFor(n, a, func, 0);
   #endif
 }
 
@@ -76,15 +181,89 @@ DAAL_EXPORT void _daal_threader_for_blocked(int n, int threads_request, const vo
     } );
   #elif defined(__DO_SEQ_LAYER__)
     func(0, n, a);
+  #elif defined(__DO_NATIVE_LAYER__)
+    daal::threading_native::parallelFor(n, a, 0, func);
   #endif
 }
 
+DAAL_EXPORT void _daal_threader_for_numa(int n, int threads_request, const void* a, daal::functype2 func)
+{
+  #if defined(__DO_TBB_LAYER__)
+    const daal::numa::Topology &topology = daal::numa::Topology::instance();
+    const size_t nNodes = topology.getNumberOfNodes();
+
+    /* Nested loops stay on the node of the enclosing one */
+    if( nNodes < 2 || n < 2 || numaArenaNode >= 0 )
+    {
+        _daal_threader_for_blocked(n, threads_request, a, func);
+        return;
+    }
+
+    size_t nCpus = 0;
+    for( size_t node = 0; node < nNodes; node++ )
+    {
+        nCpus += topology.getNodeCpus(node).size();
+    }
+
+    NumaArenas &arenas = NumaArenas::instance();
+    tbb::task_group group;
+    size_t cpusBefore = 0;
+    for( size_t node = 0; node < nNodes; node++ )
+    {
+        const int begin = (int)((long long)n * cpusBefore / nCpus);
+        cpusBefore += topology.getNodeCpus(node).size();
+        const int end = (int)((long long)n * cpusBefore / nCpus);
+        if( begin == end ) { continue; }
+
+        tbb::task_arena *arena = &arenas.get(node);
+        group.run( [=]()
+        {
+            arena->execute( [=]()
+            {
+                tbb::parallel_for( tbb::blocked_range<int>(begin,end,1), [=](tbb::blocked_range<int> r)
+                {
+                    func(r.begin(), r.end()-r.begin(), a);
+                } );
+            } );
+        } );
+    }
+    group.wait();
+  #elif defined(__DO_SEQ_LAYER__)
+    func(0, n, a);
+  #elif defined(__DO_NATIVE_LAYER__)
+    daal::threading_native::parallelForNuma(n, a, func);
+  #endif
+}
+
+DAAL_EXPORT void _daal_numa_place(void* ptr, size_t size, int placement)
+{
+    if( !ptr || size == 0 ) { return; }
+
+    if( placement == daal::services::numaInterleave )
+    {
+        daal::numa::interleave(ptr, size);
+    }
+    else if( placement == daal::services::numaPartition )
+    {
+        /* Pages are distributed the same way as the iterations of threader_for_numa */
+        NumaPlaceTask task;
+        task.pageSize = daal::numa::getPageSize();
+        task.begin    = (char *)((size_t)ptr / task.pageSize * task.pageSize);
+        task.ptr      = (char *)ptr;
+        task.size     = size;
+        const size_t nPages = ((char *)ptr + size - task.begin + task.pageSize - 1) / task.pageSize;
+        _daal_threader_for_numa((int)nPages, (int)nPages, &task, numaPlaceBlock);
+    }
+}
+
 DAAL_EXPORT int _daal_threader_get_max_threads()
 {
   #if defined(__DO_TBB_LAYER__)
     return tbb::task_scheduler_init::default_num_threads();
   #elif defined(__DO_SEQ_LAYER__)
     return 1;
+  #elif defined(__DO_NATIVE_LAYER__)
+    return daal::threading_native::getMaxThreads();
   #endif
 }
 
@@ -96,6 +275,8 @@ DAAL_EXPORT void* _daal_get_tls_ptr(void* a, daal::tls_functype func)
     return (void*)p;
   #elif defined(__DO_SEQ_LAYER__)
     return func(a);
+  #elif defined(__DO_NATIVE_LAYER__)
+    return daal::threading_native::createTls(a, func);
   #endif
 }
 
@@ -106,6 +287,8 @@ DAAL_EXPORT void _daal_del_tls_ptr(void* tlsPtr)
         static_cast<tbb::enumerable_thread_specific<void*>*>(tlsPtr);
     delete p;
   #elif defined(__DO_SEQ_LAYER__)
+  #elif defined(__DO_NATIVE_LAYER__)
+    daal::threading_native::deleteTls(tlsPtr);
   #endif
 }
 
@@ -117,6 +300,8 @@ DAAL_EXPORT void* _daal_get_tls_local(void* tlsPtr)
     return p->local();
   #elif defined(__DO_SEQ_LAYER__)
     return tlsPtr;
+  #elif defined(__DO_NATIVE_LAYER__)
+    return daal::threading_native::localTls(tlsPtr);
   #endif
 }
 
@@ -132,5 +317,7 @@ DAAL_EXPORT void _daal_reduce_tls(void* tlsPtr, void* a, daal::tls_reduce_functy
     }
   #elif defined(__DO_SEQ_LAYER__)
     func( tlsPtr, a );
+  #elif defined(__DO_NATIVE_LAYER__)
+    daal::threading_native::reduceTls(tlsPtr, a, func);
   #endif
 }
@@ -25,6 +25,7 @@
 #define __THREADING_H__
 
 #include "daal_defines.h"
+#include "daal_atomic_int.h"
 
 namespace daal
 {
@@ -41,6 +42,8 @@ extern "C" {
     DAAL_EXPORT int   _daal_threader_get_max_threads();
     DAAL_EXPORT void  _daal_threader_for(int n, int threads_request, const void *a, daal::functype func);
     DAAL_EXPORT void  _daal_threader_for_blocked(int n, int threads_request, const void *a, daal::functype2 func);
+    DAAL_EXPORT void  _daal_threader_for_numa(int n, int threads_request, const void *a, daal::functype2 func);
+    DAAL_EXPORT void  _daal_numa_place(void *ptr, size_t size, int placement);
     DAAL_EXPORT void *_daal_get_tls_ptr( void *a, daal::tls_functype func );
     DAAL_EXPORT void *_daal_get_tls_local( void *tlsPtr );
     DAAL_EXPORT void  _daal_reduce_tls( void *tlsPtr, void *a, daal::tls_reduce_functype func );
@@ -92,6 +95,55 @@ inline void threader_for_blocked(int n, int threads_request, const F &lambda)
     _daal_threader_for_blocked(n, threads_request, a, threader_func_b<F>);
 }
 
+template<typename F>
+inline void threader_func_numa(int i0, int in, const void *a)
+{
+    const F &lambda = *static_cast<const F *>(a);
+    for (int i = i0; i < i0 + in; i++)
+    {
+        lambda(i);
+    }
+}
+
+/* Runs the loop so that contiguous parts of [0, n) proportional to the number of threads
+   on each NUMA node are processed by the threads of that node. The same n-independent
+   partitioning is used by _daal_numa_place, so the loops over the blocks of a buffer
+   placed with services::numaPartition access node-local memory */
+template<typename F>
+inline void threader_for_numa(int n, int threads_request, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_numa(n, threads_request, a, threader_func_numa<F>);
+}
+
+template<typename F>
+inline void threader_for_numa_blocked(int n, int threads_request, const F &lambda)
+{
+    const void *a = static_cast<const void *>(&lambda);
+
+    _daal_threader_for_numa(n, threads_request, a, threader_func_b<F>);
+}
+
+/* Flag raised by the iterations of a parallel loop, for example when a thread-local buffer
+   cannot be allocated, and checked after the loop. Unlike a plain bool, it can be set
+   from several threads at once. It is captured by reference */
+class threader_flag
+{
+public:
+    threader_flag() : _value(0) {}
+
+    void set() { _value.set(1); }
+
+    bool isSet() const { return (_value.get() != 0); }
+
+private:
+    threader_flag(const threader_flag &);
+    threader_flag &operator=(const threader_flag &);
+
+    services::Atomic<int> _value;
+};
+
 template<typename lambdaType>
 inline void *tls_func(const void *a)
 {
@@ -0,0 +1,96 @@
+/* file: apriori_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of association rules mining with the Apriori and FP-Growth
+!    methods for --rows transactions of items chosen from --cols items
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+/* Association rules algorithm parameters */
+const size_t itemsInTransaction = 10;
+const double minSupport         = 0.01;
+const double minConfidence      = 0.6;
+
+/* Table of (transaction, item) pairs, one row per item in a transaction */
+template <typename FPType>
+NumericTablePtr makeTransactions(size_t nTransactions, size_t nItems, unsigned int seed)
+{
+    size_t nItemsInTransaction = (itemsInTransaction < nItems ? itemsInTransaction : nItems);
+    HomogenNumericTable<FPType> *table = new HomogenNumericTable<FPType>(2, nTransactions * nItemsInTransaction, NumericTable::doAllocate);
+    FPType *data = table->getArray();
+    Random random(seed);
+    for (size_t t = 0, k = 0; t < nTransactions; t++)
+    {
+        /* One item in each of nItemsInTransaction equal parts of the items range keeps the items unique */
+        for (size_t j = 0; j < nItemsInTransaction; j++, k++)
+        {
+            size_t first = j * nItems / nItemsInTransaction;
+            size_t last  = (j + 1) * nItems / nItemsInTransaction;
+            data[2 * k]     = (FPType)t;
+            data[2 * k + 1] = (FPType)(first + random.index(last - first));
+        }
+    }
+    return NumericTablePtr(table);
+}
+
+template <typename FPType, association_rules::Method method>
+class AssociationRulesBatch : public Benchmark
+{
+public:
+    AssociationRulesBatch(const char *name) : Benchmark(name, "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTransactions<FPType>(opt.nRows, opt.nCols, opt.seed);
+    }
+
+    void run()
+    {
+        association_rules::Batch<FPType, method> algorithm;
+        algorithm.parameter.minSupport    = minSupport;
+        algorithm.parameter.minConfidence = minConfidence;
+        algorithm.input.set(association_rules::data, data);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+};
+
+int main(int argc, char *argv[])
+{
+    Options defaults;
+    defaults.nRows = 10000;
+    Suite suite(argc, argv, defaults);
+
+    suite.add(new AssociationRulesBatch<float,  association_rules::apriori>("apriori"));
+    suite.add(new AssociationRulesBatch<double, association_rules::apriori>("apriori"));
+    suite.add(new AssociationRulesBatch<float,  association_rules::fpGrowth>("fpgrowth"));
+    suite.add(new AssociationRulesBatch<double, association_rules::fpGrowth>("fpgrowth"));
+
+    return suite.run();
+}
@@ -0,0 +1,163 @@
+/* file: boosting_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of AdaBoost, BrownBoost and LogitBoost training and prediction
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+/* Boosting parameters */
+const size_t maxIterations = 20;
+const size_t nClasses      = 5;
+
+/* Creates the training and prediction algorithms of a boosting method */
+template <typename FPType> struct AdaBoost
+{
+    static const size_t nLabels = 2;
+    static const bool signedLabels = true;
+    typedef adaboost::training::Batch<FPType>   Training;
+    typedef adaboost::prediction::Batch<FPType> Prediction;
+    static Training *training()
+    {
+        Training *algorithm = new Training();
+        algorithm->parameter.maxIterations = maxIterations;
+        return algorithm;
+    }
+    static Prediction *prediction() { return new Prediction(); }
+};
+
+template <typename FPType> struct BrownBoost
+{
+    static const size_t nLabels = 2;
+    static const bool signedLabels = true;
+    typedef brownboost::training::Batch<FPType>   Training;
+    typedef brownboost::prediction::Batch<FPType> Prediction;
+    static Training *training()
+    {
+        Training *algorithm = new Training();
+        algorithm->parameter.maxIterations = maxIterations;
+        return algorithm;
+    }
+    static Prediction *prediction() { return new Prediction(); }
+};
+
+template <typename FPType> struct LogitBoost
+{
+    static const size_t nLabels = nClasses;
+    static const bool signedLabels = false;
+    typedef logitboost::training::Batch<FPType>   Training;
+    typedef logitboost::prediction::Batch<FPType> Prediction;
+    static Training *training()
+    {
+        Training *algorithm = new Training(nClasses);
+        algorithm->parameter.maxIterations = maxIterations;
+        return algorithm;
+    }
+    static Prediction *prediction() { return new Prediction(nClasses); }
+};
+
+template <typename FPType, typename Method>
+class BoostingTrainingBatch : public Benchmark
+{
+public:
+    BoostingTrainingBatch(const char *name) : Benchmark(name, "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+        labels = makeLabels<FPType>(data, Method::nLabels, Method::signedLabels);
+    }
+
+    void run()
+    {
+        typename Method::Training *algorithm = Method::training();
+        algorithm->input.set(classifier::training::data,   data);
+        algorithm->input.set(classifier::training::labels, labels);
+        algorithm->compute();
+        delete algorithm;
+    }
+
+    void tearDown() { data = NumericTablePtr(); labels = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+    NumericTablePtr labels;
+};
+
+template <typename FPType, typename Method>
+class BoostingPredictionBatch : public Benchmark
+{
+public:
+    BoostingPredictionBatch(const char *name) : Benchmark(name, "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+
+        typename Method::Training *algorithm = Method::training();
+        algorithm->input.set(classifier::training::data,   data);
+        algorithm->input.set(classifier::training::labels, makeLabels<FPType>(data, Method::nLabels, Method::signedLabels));
+        algorithm->compute();
+        model = algorithm->getResult()->get(classifier::training::model);
+        delete algorithm;
+    }
+
+    void run()
+    {
+        typename Method::Prediction *algorithm = Method::prediction();
+        algorithm->input.set(classifier::prediction::data,  data);
+        algorithm->input.set(classifier::prediction::model, model);
+        algorithm->compute();
+        delete algorithm;
+    }
+
+    void tearDown() { data = NumericTablePtr(); model = services::SharedPtr<classifier::Model>(); }
+
+private:
+    NumericTablePtr data;
+    services::SharedPtr<classifier::Model> model;
+};
+
+int main(int argc, char *argv[])
+{
+    Options defaults;
+    defaults.nRows = 10000;
+    defaults.nCols = 20;
+    Suite suite(argc, argv, defaults);
+
+    suite.add(new BoostingTrainingBatch<float,  AdaBoost<float > >("adaboost_training"));
+    suite.add(new BoostingTrainingBatch<double, AdaBoost<double> >("adaboost_training"));
+    suite.add(new BoostingTrainingBatch<float,  BrownBoost<float > >("brownboost_training"));
+    suite.add(new BoostingTrainingBatch<double, BrownBoost<double> >("brownboost_training"));
+    suite.add(new BoostingTrainingBatch<float,  LogitBoost<float > >("logitboost_training"));
+    suite.add(new BoostingTrainingBatch<double, LogitBoost<double> >("logitboost_training"));
+    suite.add(new BoostingPredictionBatch<float,  AdaBoost<float > >("adaboost_prediction"));
+    suite.add(new BoostingPredictionBatch<double, AdaBoost<double> >("adaboost_prediction"));
+    suite.add(new BoostingPredictionBatch<float,  BrownBoost<float > >("brownboost_prediction"));
+    suite.add(new BoostingPredictionBatch<double, BrownBoost<double> >("brownboost_prediction"));
+    suite.add(new BoostingPredictionBatch<float,  LogitBoost<float > >("logitboost_prediction"));
+    suite.add(new BoostingPredictionBatch<double, LogitBoost<double> >("logitboost_prediction"));
+
+    return suite.run();
+}
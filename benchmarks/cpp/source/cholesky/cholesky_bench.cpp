@@ -0,0 +1,66 @@
+/* file: cholesky_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of Cholesky decomposition of a symmetric positive-definite
+!    matrix of --cols rows and columns
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+template <typename FPType>
+class CholeskyBatch : public BatchBenchmark<FPType, cholesky::Batch<FPType>, cholesky::InputId, cholesky::data>
+{
+public:
+    CholeskyBatch() : BatchBenchmark<FPType, cholesky::Batch<FPType>, cholesky::InputId, cholesky::data>("cholesky") {}
+
+    size_t getNumberOfRows(const Options &opt) const { return opt.nCols; }
+
+protected:
+    /* Symmetric matrix with the diagonal dominating the rows is positive-definite */
+    NumericTablePtr makeData(const Options &opt)
+    {
+        size_t n = opt.nCols;
+        HomogenNumericTable<FPType> *table = new HomogenNumericTable<FPType>(n, n, NumericTable::doAllocate);
+        FPType *a = table->getArray();
+        Random random(opt.seed);
+        for (size_t i = 0; i < n; i++)
+        {
+            for (size_t j = 0; j < i; j++) { a[i * n + j] = a[j * n + i] = (FPType)random.uniform(); }
+            a[i * n + i] = (FPType)n;
+        }
+        return NumericTablePtr(table);
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    Options defaults;
+    defaults.nCols = 2000;
+    Suite suite(argc, argv, defaults);
+
+    suite.add(new CholeskyBatch<float>());
+    suite.add(new CholeskyBatch<double>());
+
+    return suite.run();
+}
@@ -0,0 +1,132 @@
+/* file: covariance_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of variance-covariance matrix computation in the batch,
+!    online and distributed processing modes
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+template <typename FPType, covariance::Method method>
+class CovarianceBatch : public Benchmark
+{
+public:
+    CovarianceBatch() : Benchmark("covariance", "batch", method == covariance::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+    }
+
+    void run()
+    {
+        covariance::Batch<FPType, method> algorithm;
+        algorithm.input.set(covariance::data, data);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+};
+
+template <typename FPType, covariance::Method method>
+class CovarianceOnline : public Benchmark
+{
+public:
+    CovarianceOnline() : Benchmark("covariance", "online", method == covariance::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        covariance::Online<FPType, method> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(covariance::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+template <typename FPType, covariance::Method method>
+class CovarianceDistributed : public Benchmark
+{
+public:
+    CovarianceDistributed() : Benchmark("covariance", "distributed", method == covariance::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        covariance::Distributed<step2Master, FPType, method> masterAlgorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            covariance::Distributed<step1Local, FPType, method> localAlgorithm;
+            localAlgorithm.input.set(covariance::data, blocks[i]);
+            localAlgorithm.compute();
+            masterAlgorithm.input.add(covariance::partialResults, localAlgorithm.getPartialResult());
+        }
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new CovarianceBatch<float,  covariance::defaultDense>());
+    suite.add(new CovarianceBatch<double, covariance::defaultDense>());
+    suite.add(new CovarianceBatch<float,  covariance::fastCSR>());
+    suite.add(new CovarianceBatch<double, covariance::fastCSR>());
+    suite.add(new CovarianceOnline<float,  covariance::defaultDense>());
+    suite.add(new CovarianceOnline<double, covariance::defaultDense>());
+    suite.add(new CovarianceOnline<float,  covariance::fastCSR>());
+    suite.add(new CovarianceOnline<double, covariance::fastCSR>());
+    suite.add(new CovarianceDistributed<float,  covariance::defaultDense>());
+    suite.add(new CovarianceDistributed<double, covariance::defaultDense>());
+    suite.add(new CovarianceDistributed<float,  covariance::fastCSR>());
+    suite.add(new CovarianceDistributed<double, covariance::fastCSR>());
+
+    return suite.run();
+}
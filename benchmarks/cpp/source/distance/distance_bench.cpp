@@ -0,0 +1,42 @@
+/* file: distance_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the cosine and correlation distance matrix computation
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+int main(int argc, char *argv[])
+{
+    Options defaults;
+    defaults.nRows = 10000;
+    Suite suite(argc, argv, defaults);
+
+    suite.add(new BatchBenchmark<float,  cosine_distance::Batch<float >, cosine_distance::InputId, cosine_distance::data>("cosine_distance"));
+    suite.add(new BatchBenchmark<double, cosine_distance::Batch<double>, cosine_distance::InputId, cosine_distance::data>("cosine_distance"));
+    suite.add(new BatchBenchmark<float,  correlation_distance::Batch<float >, correlation_distance::InputId, correlation_distance::data>("correlation_distance"));
+    suite.add(new BatchBenchmark<double, correlation_distance::Batch<double>, correlation_distance::InputId, correlation_distance::data>("correlation_distance"));
+
+    return suite.run();
+}
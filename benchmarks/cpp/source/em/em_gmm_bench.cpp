@@ -0,0 +1,77 @@
+/* file: em_gmm_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the expectation-maximization (EM) algorithm for the
+!    Gaussian mixture model (GMM)
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+/* EM algorithm parameters */
+const size_t nComponents = 4;
+const size_t maxIterations = 10;
+
+template <typename FPType>
+class EmGmmBatch : public Benchmark
+{
+public:
+    EmGmmBatch() : Benchmark("em_gmm", "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+
+        em_gmm::init::Batch<FPType> initAlgorithm(nComponents);
+        initAlgorithm.input.set(em_gmm::init::data, data);
+        initAlgorithm.compute();
+        initialValues = initAlgorithm.getResult();
+    }
+
+    void run()
+    {
+        em_gmm::Batch<FPType> algorithm(nComponents);
+        algorithm.parameter.maxIterations = maxIterations;
+        algorithm.input.set(em_gmm::data,        data);
+        algorithm.input.set(em_gmm::inputValues, initialValues);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); initialValues = services::SharedPtr<em_gmm::init::Result>(); }
+
+private:
+    NumericTablePtr data;
+    services::SharedPtr<em_gmm::init::Result> initialValues;
+};
+
+int main(int argc, char *argv[])
+{
+    Options defaults;
+    defaults.nCols = 10;
+    Suite suite(argc, argv, defaults);
+
+    suite.add(new EmGmmBatch<float>());
+    suite.add(new EmGmmBatch<double>());
+
+    return suite.run();
+}
@@ -0,0 +1,122 @@
+/* file: implicit_als_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of implicit alternating least squares (implicit ALS)
+!    training for the ratings of --rows users for --cols items, and of ratings
+!    prediction
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::implicit_als;
+using namespace bench;
+
+/* Implicit ALS parameters */
+const size_t nFactors = 10;
+
+template <typename FPType, training::Method method>
+services::SharedPtr<implicit_als::Model> initModel(const NumericTablePtr &data)
+{
+    training::init::Batch<FPType, (method == training::fastCSR ? training::init::fastCSR : training::init::defaultDense)> initAlgorithm;
+    initAlgorithm.parameter.nFactors = nFactors;
+    initAlgorithm.input.set(training::init::data, data);
+    initAlgorithm.compute();
+    return initAlgorithm.getResult()->get(training::init::model);
+}
+
+template <typename FPType, training::Method method>
+class ImplicitAlsTrainingBatch : public Benchmark
+{
+public:
+    ImplicitAlsTrainingBatch() : Benchmark("implicit_als_training", "batch", method == training::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+        initialModel = initModel<FPType, method>(data);
+    }
+
+    void run()
+    {
+        training::Batch<FPType, method> algorithm;
+        algorithm.parameter.nFactors = nFactors;
+        algorithm.input.set(training::data,       data);
+        algorithm.input.set(training::inputModel, initialModel);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); initialModel = services::SharedPtr<implicit_als::Model>(); }
+
+private:
+    NumericTablePtr data;
+    services::SharedPtr<implicit_als::Model> initialModel;
+};
+
+template <typename FPType>
+class ImplicitAlsPredictionBatch : public Benchmark
+{
+public:
+    ImplicitAlsPredictionBatch() : Benchmark("implicit_als_ratings_prediction", "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        NumericTablePtr data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+
+        training::Batch<FPType> algorithm;
+        algorithm.parameter.nFactors = nFactors;
+        algorithm.input.set(training::data,       data);
+        algorithm.input.set(training::inputModel, initModel<FPType, training::defaultDense>(data));
+        algorithm.compute();
+        model = algorithm.getResult()->get(training::model);
+    }
+
+    void run()
+    {
+        prediction::ratings::Batch<FPType> algorithm;
+        algorithm.parameter.nFactors = nFactors;
+        algorithm.input.set(prediction::ratings::model, model);
+        algorithm.compute();
+    }
+
+    void tearDown() { model = services::SharedPtr<implicit_als::Model>(); }
+
+private:
+    services::SharedPtr<implicit_als::Model> model;
+};
+
+int main(int argc, char *argv[])
+{
+    Options defaults;
+    defaults.nRows   = 10000;
+    defaults.nCols   = 1000;
+    defaults.density = 0.01;
+    Suite suite(argc, argv, defaults);
+
+    suite.add(new ImplicitAlsTrainingBatch<float,  training::defaultDense>());
+    suite.add(new ImplicitAlsTrainingBatch<double, training::defaultDense>());
+    suite.add(new ImplicitAlsTrainingBatch<float,  training::fastCSR>());
+    suite.add(new ImplicitAlsTrainingBatch<double, training::fastCSR>());
+    suite.add(new ImplicitAlsPredictionBatch<float>());
+    suite.add(new ImplicitAlsPredictionBatch<double>());
+
+    return suite.run();
+}
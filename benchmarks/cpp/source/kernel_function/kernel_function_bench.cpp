@@ -0,0 +1,78 @@
+/* file: kernel_function_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the linear and RBF kernel functions computed for all
+!    pairs of vectors of two data sets
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+/* Number of vectors in the right data set */
+const size_t nRowsY = 1000;
+
+template <typename FPType, typename Kernel>
+class KernelFunctionBatch : public Benchmark
+{
+public:
+    KernelFunctionBatch(const char *name, bool isCsr) : Benchmark(name, "batch", isCsr, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        x = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+        y = makeTable<FPType>(isCsr(), nRowsY,    opt.nCols, opt.density, opt.seed + 1);
+    }
+
+    void run()
+    {
+        Kernel algorithm;
+        algorithm.parameter.computationMode = kernel_function::matrixMatrix;
+        algorithm.input.set(kernel_function::X, x);
+        algorithm.input.set(kernel_function::Y, y);
+        algorithm.compute();
+    }
+
+    void tearDown() { x = NumericTablePtr(); y = NumericTablePtr(); }
+
+private:
+    NumericTablePtr x;
+    NumericTablePtr y;
+};
+
+int main(int argc, char *argv[])
+{
+    Options defaults;
+    defaults.nRows = 10000;
+    Suite suite(argc, argv, defaults);
+
+    suite.add(new KernelFunctionBatch<float,  kernel_function::linear::Batch<float > >("kernel_function_linear", false));
+    suite.add(new KernelFunctionBatch<double, kernel_function::linear::Batch<double> >("kernel_function_linear", false));
+    suite.add(new KernelFunctionBatch<float,  kernel_function::linear::Batch<float,  kernel_function::linear::fastCSR> >("kernel_function_linear", true));
+    suite.add(new KernelFunctionBatch<double, kernel_function::linear::Batch<double, kernel_function::linear::fastCSR> >("kernel_function_linear", true));
+    suite.add(new KernelFunctionBatch<float,  kernel_function::rbf::Batch<float > >("kernel_function_rbf", false));
+    suite.add(new KernelFunctionBatch<double, kernel_function::rbf::Batch<double> >("kernel_function_rbf", false));
+    suite.add(new KernelFunctionBatch<float,  kernel_function::rbf::Batch<float,  kernel_function::rbf::fastCSR> >("kernel_function_rbf", true));
+    suite.add(new KernelFunctionBatch<double, kernel_function::rbf::Batch<double, kernel_function::rbf::fastCSR> >("kernel_function_rbf", true));
+
+    return suite.run();
+}
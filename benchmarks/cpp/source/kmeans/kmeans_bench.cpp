@@ -0,0 +1,123 @@
+/* file: kmeans_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of K-Means clustering in the batch and distributed processing modes
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+/* K-Means algorithm parameters */
+const size_t nClusters   = 20;
+const size_t nIterations = 5;
+
+template <typename FPType, kmeans::init::Method initMethod>
+NumericTablePtr initCentroids(const NumericTablePtr &data)
+{
+    kmeans::init::Batch<FPType, initMethod> init(nClusters);
+    init.input.set(kmeans::init::data, data);
+    init.compute();
+    return init.getResult()->get(kmeans::init::centroids);
+}
+
+template <typename FPType, kmeans::Method method, kmeans::init::Method initMethod>
+class KMeansBatch : public Benchmark
+{
+public:
+    KMeansBatch() : Benchmark("kmeans", "batch", method == kmeans::lloydCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+        centroids = initCentroids<FPType, initMethod>(data);
+    }
+
+    void run()
+    {
+        kmeans::Batch<FPType, method> algorithm(nClusters, nIterations);
+        algorithm.input.set(kmeans::data,           data);
+        algorithm.input.set(kmeans::inputCentroids, centroids);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); centroids = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+    NumericTablePtr centroids;
+};
+
+template <typename FPType, kmeans::Method method, kmeans::init::Method initMethod>
+class KMeansDistributed : public Benchmark
+{
+public:
+    KMeansDistributed() : Benchmark("kmeans", "distributed", method == kmeans::lloydCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+        centroids = initCentroids<FPType, initMethod>(blocks[0]);
+    }
+
+    void run()
+    {
+        NumericTablePtr currentCentroids = centroids;
+        for (size_t it = 0; it < nIterations; it++)
+        {
+            kmeans::Distributed<step2Master, FPType, method> masterAlgorithm(nClusters);
+            for (size_t i = 0; i < blocks.size(); i++)
+            {
+                kmeans::Distributed<step1Local, FPType, method> localAlgorithm(nClusters);
+                localAlgorithm.input.set(kmeans::data,           blocks[i]);
+                localAlgorithm.input.set(kmeans::inputCentroids, currentCentroids);
+                localAlgorithm.compute();
+                masterAlgorithm.input.add(kmeans::partialResults, localAlgorithm.getPartialResult());
+            }
+            masterAlgorithm.compute();
+            masterAlgorithm.finalizeCompute();
+            currentCentroids = masterAlgorithm.getResult()->get(kmeans::centroids);
+        }
+    }
+
+    void tearDown() { blocks.clear(); centroids = NumericTablePtr(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+    NumericTablePtr centroids;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new KMeansBatch<float,  kmeans::lloydDense, kmeans::init::deterministicDense>());
+    suite.add(new KMeansBatch<double, kmeans::lloydDense, kmeans::init::deterministicDense>());
+    suite.add(new KMeansBatch<float,  kmeans::lloydCSR,   kmeans::init::deterministicCSR>());
+    suite.add(new KMeansBatch<double, kmeans::lloydCSR,   kmeans::init::deterministicCSR>());
+    suite.add(new KMeansDistributed<float,  kmeans::lloydDense, kmeans::init::deterministicDense>());
+    suite.add(new KMeansDistributed<double, kmeans::lloydDense, kmeans::init::deterministicDense>());
+    suite.add(new KMeansDistributed<float,  kmeans::lloydCSR,   kmeans::init::deterministicCSR>());
+    suite.add(new KMeansDistributed<double, kmeans::lloydCSR,   kmeans::init::deterministicCSR>());
+
+    return suite.run();
+}
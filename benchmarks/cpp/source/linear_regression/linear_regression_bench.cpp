@@ -0,0 +1,185 @@
+/* file: linear_regression_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of multiple linear regression training with the normal
+!    equations and QR methods in the batch, online and distributed processing
+!    modes, and of linear regression prediction
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::linear_regression;
+using namespace bench;
+
+/* Linear regression parameters */
+const size_t nResponses = 2;
+
+inline const char *trainingName(training::Method method)
+{
+    return (method == training::qrDense ? "linear_regression_qr_training" : "linear_regression_norm_eq_training");
+}
+
+template <typename FPType, training::Method method>
+class LinearRegressionTrainingBatch : public Benchmark
+{
+public:
+    LinearRegressionTrainingBatch() : Benchmark(trainingName(method), "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+        responses = makeResponses<FPType>(data, nResponses, opt.seed);
+    }
+
+    void run()
+    {
+        training::Batch<FPType, method> algorithm;
+        algorithm.input.set(training::data,               data);
+        algorithm.input.set(training::dependentVariables, responses);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); responses = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+    NumericTablePtr responses;
+};
+
+template <typename FPType, training::Method method>
+class LinearRegressionTrainingOnline : public Benchmark
+{
+public:
+    LinearRegressionTrainingOnline() : Benchmark(trainingName(method), "online", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(false, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+        for (size_t i = 0; i < blocks.size(); i++) { responses.push_back(makeResponses<FPType>(blocks[i], nResponses, opt.seed)); }
+    }
+
+    void run()
+    {
+        training::Online<FPType, method> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(training::data,               blocks[i]);
+            algorithm.input.set(training::dependentVariables, responses[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); responses.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+    vector<NumericTablePtr> responses;
+};
+
+template <typename FPType, training::Method method>
+class LinearRegressionTrainingDistributed : public Benchmark
+{
+public:
+    LinearRegressionTrainingDistributed() : Benchmark(trainingName(method), "distributed", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(false, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+        for (size_t i = 0; i < blocks.size(); i++) { responses.push_back(makeResponses<FPType>(blocks[i], nResponses, opt.seed)); }
+    }
+
+    void run()
+    {
+        training::Distributed<step2Master, FPType, method> masterAlgorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            training::Distributed<step1Local, FPType, method> localAlgorithm;
+            localAlgorithm.input.set(training::data,               blocks[i]);
+            localAlgorithm.input.set(training::dependentVariables, responses[i]);
+            localAlgorithm.compute();
+            masterAlgorithm.input.add(training::partialModels, localAlgorithm.getPartialResult());
+        }
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); responses.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+    vector<NumericTablePtr> responses;
+};
+
+template <typename FPType>
+class LinearRegressionPredictionBatch : public Benchmark
+{
+public:
+    LinearRegressionPredictionBatch() : Benchmark("linear_regression_prediction", "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+
+        training::Batch<FPType, training::normEqDense> algorithm;
+        algorithm.input.set(training::data,               data);
+        algorithm.input.set(training::dependentVariables, makeResponses<FPType>(data, nResponses, opt.seed));
+        algorithm.compute();
+        model = algorithm.getResult()->get(training::model);
+    }
+
+    void run()
+    {
+        prediction::Batch<FPType> algorithm;
+        algorithm.input.set(prediction::data,  data);
+        algorithm.input.set(prediction::model, model);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); model = services::SharedPtr<linear_regression::Model>(); }
+
+private:
+    NumericTablePtr data;
+    services::SharedPtr<linear_regression::Model> model;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new LinearRegressionTrainingBatch<float,  training::normEqDense>());
+    suite.add(new LinearRegressionTrainingBatch<double, training::normEqDense>());
+    suite.add(new LinearRegressionTrainingBatch<float,  training::qrDense>());
+    suite.add(new LinearRegressionTrainingBatch<double, training::qrDense>());
+    suite.add(new LinearRegressionTrainingOnline<float,  training::normEqDense>());
+    suite.add(new LinearRegressionTrainingOnline<double, training::normEqDense>());
+    suite.add(new LinearRegressionTrainingOnline<float,  training::qrDense>());
+    suite.add(new LinearRegressionTrainingOnline<double, training::qrDense>());
+    suite.add(new LinearRegressionTrainingDistributed<float,  training::normEqDense>());
+    suite.add(new LinearRegressionTrainingDistributed<double, training::normEqDense>());
+    suite.add(new LinearRegressionTrainingDistributed<float,  training::qrDense>());
+    suite.add(new LinearRegressionTrainingDistributed<double, training::qrDense>());
+    suite.add(new LinearRegressionPredictionBatch<float>());
+    suite.add(new LinearRegressionPredictionBatch<double>());
+
+    return suite.run();
+}
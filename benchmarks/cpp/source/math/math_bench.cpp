@@ -0,0 +1,55 @@
+/* file: math_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the element-wise math functions
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::math;
+using namespace bench;
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new BatchBenchmark<float,  abs::Batch<float >, abs::InputId, abs::data>("abs"));
+    suite.add(new BatchBenchmark<double, abs::Batch<double>, abs::InputId, abs::data>("abs"));
+    suite.add(new BatchBenchmark<float,  abs::Batch<float,  abs::fastCSR>, abs::InputId, abs::data>("abs", true));
+    suite.add(new BatchBenchmark<double, abs::Batch<double, abs::fastCSR>, abs::InputId, abs::data>("abs", true));
+    suite.add(new BatchBenchmark<float,  relu::Batch<float >, relu::InputId, relu::data>("relu"));
+    suite.add(new BatchBenchmark<double, relu::Batch<double>, relu::InputId, relu::data>("relu"));
+    suite.add(new BatchBenchmark<float,  relu::Batch<float,  relu::fastCSR>, relu::InputId, relu::data>("relu", true));
+    suite.add(new BatchBenchmark<double, relu::Batch<double, relu::fastCSR>, relu::InputId, relu::data>("relu", true));
+    suite.add(new BatchBenchmark<float,  tanh::Batch<float >, tanh::InputId, tanh::data>("tanh"));
+    suite.add(new BatchBenchmark<double, tanh::Batch<double>, tanh::InputId, tanh::data>("tanh"));
+    suite.add(new BatchBenchmark<float,  tanh::Batch<float,  tanh::fastCSR>, tanh::InputId, tanh::data>("tanh", true));
+    suite.add(new BatchBenchmark<double, tanh::Batch<double, tanh::fastCSR>, tanh::InputId, tanh::data>("tanh", true));
+    suite.add(new BatchBenchmark<float,  logistic::Batch<float >, logistic::InputId, logistic::data>("logistic"));
+    suite.add(new BatchBenchmark<double, logistic::Batch<double>, logistic::InputId, logistic::data>("logistic"));
+    suite.add(new BatchBenchmark<float,  smoothrelu::Batch<float >, smoothrelu::InputId, smoothrelu::data>("smoothrelu"));
+    suite.add(new BatchBenchmark<double, smoothrelu::Batch<double>, smoothrelu::InputId, smoothrelu::data>("smoothrelu"));
+    suite.add(new BatchBenchmark<float,  softmax::Batch<float >, softmax::InputId, softmax::data>("softmax"));
+    suite.add(new BatchBenchmark<double, softmax::Batch<double>, softmax::InputId, softmax::data>("softmax"));
+
+    return suite.run();
+}
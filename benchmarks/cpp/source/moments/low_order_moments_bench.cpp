@@ -0,0 +1,132 @@
+/* file: low_order_moments_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of low order moments computation in the batch,
+!    online and distributed processing modes
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+template <typename FPType, low_order_moments::Method method>
+class LowOrderMomentsBatch : public Benchmark
+{
+public:
+    LowOrderMomentsBatch() : Benchmark("low_order_moments", "batch", method == low_order_moments::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+    }
+
+    void run()
+    {
+        low_order_moments::Batch<FPType, method> algorithm;
+        algorithm.input.set(low_order_moments::data, data);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+};
+
+template <typename FPType, low_order_moments::Method method>
+class LowOrderMomentsOnline : public Benchmark
+{
+public:
+    LowOrderMomentsOnline() : Benchmark("low_order_moments", "online", method == low_order_moments::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        low_order_moments::Online<FPType, method> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(low_order_moments::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+template <typename FPType, low_order_moments::Method method>
+class LowOrderMomentsDistributed : public Benchmark
+{
+public:
+    LowOrderMomentsDistributed() : Benchmark("low_order_moments", "distributed", method == low_order_moments::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        low_order_moments::Distributed<step2Master, FPType, method> masterAlgorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            low_order_moments::Distributed<step1Local, FPType, method> localAlgorithm;
+            localAlgorithm.input.set(low_order_moments::data, blocks[i]);
+            localAlgorithm.compute();
+            masterAlgorithm.input.add(low_order_moments::partialResults, localAlgorithm.getPartialResult());
+        }
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new LowOrderMomentsBatch<float,  low_order_moments::defaultDense>());
+    suite.add(new LowOrderMomentsBatch<double, low_order_moments::defaultDense>());
+    suite.add(new LowOrderMomentsBatch<float,  low_order_moments::fastCSR>());
+    suite.add(new LowOrderMomentsBatch<double, low_order_moments::fastCSR>());
+    suite.add(new LowOrderMomentsOnline<float,  low_order_moments::defaultDense>());
+    suite.add(new LowOrderMomentsOnline<double, low_order_moments::defaultDense>());
+    suite.add(new LowOrderMomentsOnline<float,  low_order_moments::fastCSR>());
+    suite.add(new LowOrderMomentsOnline<double, low_order_moments::fastCSR>());
+    suite.add(new LowOrderMomentsDistributed<float,  low_order_moments::defaultDense>());
+    suite.add(new LowOrderMomentsDistributed<double, low_order_moments::defaultDense>());
+    suite.add(new LowOrderMomentsDistributed<float,  low_order_moments::fastCSR>());
+    suite.add(new LowOrderMomentsDistributed<double, low_order_moments::fastCSR>());
+
+    return suite.run();
+}
@@ -0,0 +1,181 @@
+/* file: multinomial_naive_bayes_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of Naive Bayes classifier training in the batch, online and
+!    distributed processing modes, and of Naive Bayes prediction
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::multinomial_naive_bayes;
+using namespace bench;
+
+/* Naive Bayes parameters */
+const size_t nClasses = 20;
+
+template <typename FPType, training::Method method>
+class NaiveBayesTrainingBatch : public Benchmark
+{
+public:
+    NaiveBayesTrainingBatch() : Benchmark("naive_bayes_training", "batch", method == training::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+        labels = makeLabels<FPType>(data, nClasses);
+    }
+
+    void run()
+    {
+        training::Batch<FPType, method> algorithm(nClasses);
+        algorithm.input.set(classifier::training::data,   data);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); labels = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+    NumericTablePtr labels;
+};
+
+template <typename FPType, training::Method method>
+class NaiveBayesTrainingOnline : public Benchmark
+{
+public:
+    NaiveBayesTrainingOnline() : Benchmark("naive_bayes_training", "online", method == training::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+        for (size_t i = 0; i < blocks.size(); i++) { labels.push_back(makeLabels<FPType>(blocks[i], nClasses)); }
+    }
+
+    void run()
+    {
+        training::Online<FPType, method> algorithm(nClasses);
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(classifier::training::data,   blocks[i]);
+            algorithm.input.set(classifier::training::labels, labels[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); labels.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+    vector<NumericTablePtr> labels;
+};
+
+template <typename FPType, training::Method method>
+class NaiveBayesTrainingDistributed : public Benchmark
+{
+public:
+    NaiveBayesTrainingDistributed() : Benchmark("naive_bayes_training", "distributed", method == training::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+        for (size_t i = 0; i < blocks.size(); i++) { labels.push_back(makeLabels<FPType>(blocks[i], nClasses)); }
+    }
+
+    void run()
+    {
+        training::Distributed<step2Master, FPType, method> masterAlgorithm(nClasses);
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            training::Distributed<step1Local, FPType, method> localAlgorithm(nClasses);
+            localAlgorithm.input.set(classifier::training::data,   blocks[i]);
+            localAlgorithm.input.set(classifier::training::labels, labels[i]);
+            localAlgorithm.compute();
+            masterAlgorithm.input.add(classifier::training::partialModels, localAlgorithm.getPartialResult());
+        }
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); labels.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+    vector<NumericTablePtr> labels;
+};
+
+template <typename FPType, prediction::Method method>
+class NaiveBayesPredictionBatch : public Benchmark
+{
+public:
+    NaiveBayesPredictionBatch() : Benchmark("naive_bayes_prediction", "batch", method == prediction::fastCSR, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+
+        training::Batch<FPType, (method == prediction::fastCSR ? training::fastCSR : training::defaultDense)> algorithm(nClasses);
+        algorithm.input.set(classifier::training::data,   data);
+        algorithm.input.set(classifier::training::labels, makeLabels<FPType>(data, nClasses));
+        algorithm.compute();
+        model = algorithm.getResult()->get(classifier::training::model);
+    }
+
+    void run()
+    {
+        prediction::Batch<FPType, method> algorithm(nClasses);
+        algorithm.input.set(classifier::prediction::data,  data);
+        algorithm.input.set(classifier::prediction::model, model);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); model = services::SharedPtr<classifier::Model>(); }
+
+private:
+    NumericTablePtr data;
+    services::SharedPtr<classifier::Model> model;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new NaiveBayesTrainingBatch<float,  training::defaultDense>());
+    suite.add(new NaiveBayesTrainingBatch<double, training::defaultDense>());
+    suite.add(new NaiveBayesTrainingBatch<float,  training::fastCSR>());
+    suite.add(new NaiveBayesTrainingBatch<double, training::fastCSR>());
+    suite.add(new NaiveBayesTrainingOnline<float,  training::defaultDense>());
+    suite.add(new NaiveBayesTrainingOnline<double, training::defaultDense>());
+    suite.add(new NaiveBayesTrainingOnline<float,  training::fastCSR>());
+    suite.add(new NaiveBayesTrainingOnline<double, training::fastCSR>());
+    suite.add(new NaiveBayesTrainingDistributed<float,  training::defaultDense>());
+    suite.add(new NaiveBayesTrainingDistributed<double, training::defaultDense>());
+    suite.add(new NaiveBayesTrainingDistributed<float,  training::fastCSR>());
+    suite.add(new NaiveBayesTrainingDistributed<double, training::fastCSR>());
+    suite.add(new NaiveBayesPredictionBatch<float,  prediction::defaultDense>());
+    suite.add(new NaiveBayesPredictionBatch<double, prediction::defaultDense>());
+    suite.add(new NaiveBayesPredictionBatch<float,  prediction::fastCSR>());
+    suite.add(new NaiveBayesPredictionBatch<double, prediction::fastCSR>());
+
+    return suite.run();
+}
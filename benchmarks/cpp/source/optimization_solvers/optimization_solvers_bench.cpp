@@ -0,0 +1,111 @@
+/* file: optimization_solvers_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of the stochastic gradient descent and limited memory BFGS
+!    solvers minimizing the mean squared error objective function
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::optimization_solver;
+using namespace bench;
+
+/* Solver parameters. Zero accuracy threshold makes the solvers perform all the iterations */
+const size_t nIterations  = 1000;
+const size_t batchSize    = 16;
+const double learningRate = 0.001;
+
+template <typename FPType, typename Solver>
+class SolverBatch : public Benchmark
+{
+public:
+    SolverBatch(const char *name) : Benchmark(name, "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+        responses = makeResponses<FPType>(data, 1, opt.seed);
+    }
+
+    void run()
+    {
+        services::SharedPtr<mse::Batch<FPType> > objectiveFunction(new mse::Batch<FPType>(data->getNumberOfRows()));
+        objectiveFunction->input.set(mse::data,               data);
+        objectiveFunction->input.set(mse::dependentVariables, responses);
+
+        Solver algorithm(objectiveFunction);
+        configure(algorithm.parameter);
+        setStartPoint(algorithm.input, NumericTablePtr(
+            new HomogenNumericTable<FPType>(1, data->getNumberOfColumns() + 1, NumericTable::doAllocate, (FPType)0)));
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); responses = NumericTablePtr(); }
+
+private:
+    NumericTablePtr learningRateTable()
+    {
+        return NumericTablePtr(new HomogenNumericTable<FPType>(1, 1, NumericTable::doAllocate, (FPType)learningRate));
+    }
+
+    void setStartPoint(sgd::Input &input,   const NumericTablePtr &start) { input.set(sgd::inputArgument,   start); }
+    void setStartPoint(lbfgs::Input &input, const NumericTablePtr &start) { input.set(lbfgs::inputArgument, start); }
+
+    void configure(sgd::Parameter<sgd::defaultDense> &parameter)
+    {
+        parameter.nIterations          = nIterations;
+        parameter.accuracyThreshold    = 0.0;
+        parameter.learningRateSequence = learningRateTable();
+    }
+
+    void configure(sgd::Parameter<sgd::miniBatch> &parameter)
+    {
+        parameter.nIterations          = nIterations;
+        parameter.accuracyThreshold    = 0.0;
+        parameter.batchSize            = batchSize;
+        parameter.learningRateSequence = learningRateTable();
+    }
+
+    void configure(lbfgs::Parameter &parameter)
+    {
+        parameter.nIterations        = nIterations;
+        parameter.accuracyThreshold  = 0.0;
+        parameter.stepLengthSequence = learningRateTable();
+    }
+
+    NumericTablePtr data;
+    NumericTablePtr responses;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new SolverBatch<float,  sgd::Batch<float > >("sgd"));
+    suite.add(new SolverBatch<double, sgd::Batch<double> >("sgd"));
+    suite.add(new SolverBatch<float,  sgd::Batch<float,  sgd::miniBatch> >("sgd_mini_batch"));
+    suite.add(new SolverBatch<double, sgd::Batch<double, sgd::miniBatch> >("sgd_mini_batch"));
+    suite.add(new SolverBatch<float,  lbfgs::Batch<float > >("lbfgs"));
+    suite.add(new SolverBatch<double, lbfgs::Batch<double> >("lbfgs"));
+
+    return suite.run();
+}
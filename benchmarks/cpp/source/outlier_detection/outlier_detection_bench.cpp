@@ -0,0 +1,48 @@
+/* file: outlier_detection_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of univariate and multivariate outlier detection
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new BatchBenchmark<float,  univariate_outlier_detection::Batch<float >,
+                                 univariate_outlier_detection::InputId, univariate_outlier_detection::data>("univariate_outlier_detection"));
+    suite.add(new BatchBenchmark<double, univariate_outlier_detection::Batch<double>,
+                                 univariate_outlier_detection::InputId, univariate_outlier_detection::data>("univariate_outlier_detection"));
+    suite.add(new BatchBenchmark<float,  multivariate_outlier_detection::Batch<float,  multivariate_outlier_detection::defaultDense>,
+                                 multivariate_outlier_detection::InputId, multivariate_outlier_detection::data>("multivariate_outlier_detection"));
+    suite.add(new BatchBenchmark<double, multivariate_outlier_detection::Batch<double, multivariate_outlier_detection::defaultDense>,
+                                 multivariate_outlier_detection::InputId, multivariate_outlier_detection::data>("multivariate_outlier_detection"));
+    suite.add(new BatchBenchmark<float,  multivariate_outlier_detection::Batch<float,  multivariate_outlier_detection::baconDense>,
+                                 multivariate_outlier_detection::InputId, multivariate_outlier_detection::data>("multivariate_outlier_detection_bacon"));
+    suite.add(new BatchBenchmark<double, multivariate_outlier_detection::Batch<double, multivariate_outlier_detection::baconDense>,
+                                 multivariate_outlier_detection::InputId, multivariate_outlier_detection::data>("multivariate_outlier_detection_bacon"));
+
+    return suite.run();
+}
@@ -0,0 +1,198 @@
+/* file: pca_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of principal component analysis (PCA) with the correlation
+!    and SVD methods in the batch, online and distributed processing modes
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+inline const char *pcaName(pca::Method method)
+{
+    return (method == pca::svdDense ? "pca_svd" : "pca_correlation");
+}
+
+template <typename FPType, pca::Method method>
+class PcaBatch : public Benchmark
+{
+public:
+    PcaBatch() : Benchmark(pcaName(method), "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+    }
+
+    void run()
+    {
+        pca::Batch<FPType, method> algorithm;
+        algorithm.input.set(pca::data, data);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+};
+
+template <typename FPType, pca::Method method>
+class PcaOnline : public Benchmark
+{
+public:
+    PcaOnline() : Benchmark(pcaName(method), "online", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(false, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        pca::Online<FPType, method> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(pca::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+template <typename FPType, pca::Method method>
+class PcaDistributed : public Benchmark
+{
+public:
+    PcaDistributed() : Benchmark(pcaName(method), "distributed", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(false, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        pca::Distributed<step2Master, FPType, method> masterAlgorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            pca::Distributed<step1Local, FPType, method> localAlgorithm;
+            localAlgorithm.input.set(pca::data, blocks[i]);
+            localAlgorithm.compute();
+            masterAlgorithm.input.add(pca::partialResults, localAlgorithm.getPartialResult());
+        }
+        masterAlgorithm.compute();
+        masterAlgorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+/* The correlation method processes CSR data with the covariance algorithm for sparse data */
+template <typename FPType>
+class PcaCorrelationCsrBatch : public Benchmark
+{
+public:
+    PcaCorrelationCsrBatch() : Benchmark("pca_correlation", "batch", true, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeCsrTable<FPType>(opt.nRows, opt.nCols, opt.density, opt.seed);
+    }
+
+    void run()
+    {
+        pca::Batch<FPType, pca::correlationDense> algorithm;
+        algorithm.parameter.covariance = services::SharedPtr<covariance::Batch<FPType, covariance::fastCSR> >
+                                         (new covariance::Batch<FPType, covariance::fastCSR>());
+        algorithm.input.set(pca::data, data);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+};
+
+template <typename FPType>
+class PcaCorrelationCsrOnline : public Benchmark
+{
+public:
+    PcaCorrelationCsrOnline() : Benchmark("pca_correlation", "online", true, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(true, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        pca::Online<FPType, pca::correlationDense> algorithm;
+        algorithm.parameter.covariance = services::SharedPtr<covariance::Online<FPType, covariance::fastCSR> >
+                                         (new covariance::Online<FPType, covariance::fastCSR>());
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(pca::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new PcaBatch<float,  pca::correlationDense>());
+    suite.add(new PcaBatch<double, pca::correlationDense>());
+    suite.add(new PcaBatch<float,  pca::svdDense>());
+    suite.add(new PcaBatch<double, pca::svdDense>());
+    suite.add(new PcaCorrelationCsrBatch<float>());
+    suite.add(new PcaCorrelationCsrBatch<double>());
+    suite.add(new PcaOnline<float,  pca::correlationDense>());
+    suite.add(new PcaOnline<double, pca::correlationDense>());
+    suite.add(new PcaOnline<float,  pca::svdDense>());
+    suite.add(new PcaOnline<double, pca::svdDense>());
+    suite.add(new PcaCorrelationCsrOnline<float>());
+    suite.add(new PcaCorrelationCsrOnline<double>());
+    suite.add(new PcaDistributed<float,  pca::correlationDense>());
+    suite.add(new PcaDistributed<double, pca::correlationDense>());
+    suite.add(new PcaDistributed<float,  pca::svdDense>());
+    suite.add(new PcaDistributed<double, pca::svdDense>());
+
+    return suite.run();
+}
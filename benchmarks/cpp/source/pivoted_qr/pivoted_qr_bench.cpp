@@ -0,0 +1,38 @@
+/* file: pivoted_qr_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of pivoted QR decomposition
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new BatchBenchmark<float,  pivoted_qr::Batch<float >, pivoted_qr::InputId, pivoted_qr::data>("pivoted_qr"));
+    suite.add(new BatchBenchmark<double, pivoted_qr::Batch<double>, pivoted_qr::InputId, pivoted_qr::data>("pivoted_qr"));
+
+    return suite.run();
+}
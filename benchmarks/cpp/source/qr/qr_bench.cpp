@@ -0,0 +1,141 @@
+/* file: qr_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of QR decomposition in the batch, online
+!    and distributed processing modes
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+template <typename FPType>
+class QrBatch : public Benchmark
+{
+public:
+    QrBatch() : Benchmark("qr", "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+    }
+
+    void run()
+    {
+        qr::Batch<FPType> algorithm;
+        algorithm.input.set(qr::data, data);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+};
+
+template <typename FPType>
+class QrOnline : public Benchmark
+{
+public:
+    QrOnline() : Benchmark("qr", "online", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(false, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        qr::Online<FPType> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(qr::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+template <typename FPType>
+class QrDistributed : public Benchmark
+{
+public:
+    QrDistributed() : Benchmark("qr", "distributed", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(false, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        size_t nBlocks = blocks.size();
+        vector<services::SharedPtr<DataCollection> > dataFromStep1ForStep3(nBlocks);
+
+        qr::Distributed<step2Master, FPType> masterAlgorithm;
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            qr::Distributed<step1Local, FPType> localAlgorithm;
+            localAlgorithm.input.set(qr::data, blocks[i]);
+            localAlgorithm.compute();
+            masterAlgorithm.input.add(qr::inputOfStep2FromStep1, i, localAlgorithm.getPartialResult()->get(qr::outputOfStep1ForStep2));
+            dataFromStep1ForStep3[i] = localAlgorithm.getPartialResult()->get(qr::outputOfStep1ForStep3);
+        }
+        masterAlgorithm.compute();
+
+        services::SharedPtr<KeyValueDataCollection> inputForStep3FromStep2 =
+            masterAlgorithm.getPartialResult()->get(qr::outputOfStep2ForStep3);
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            qr::Distributed<step3Local, FPType> localAlgorithm;
+            localAlgorithm.input.set(qr::inputOfStep3FromStep1, dataFromStep1ForStep3[i]);
+            localAlgorithm.input.set(qr::inputOfStep3FromStep2,
+                services::staticPointerCast<DataCollection, SerializationIface>((*inputForStep3FromStep2)[i]));
+            localAlgorithm.compute();
+            localAlgorithm.finalizeCompute();
+        }
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new QrBatch<float>());
+    suite.add(new QrBatch<double>());
+    suite.add(new QrOnline<float>());
+    suite.add(new QrOnline<double>());
+    suite.add(new QrDistributed<float>());
+    suite.add(new QrDistributed<double>());
+
+    return suite.run();
+}
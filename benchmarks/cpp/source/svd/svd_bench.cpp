@@ -0,0 +1,141 @@
+/* file: svd_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of singular value decomposition (SVD) in the batch, online
+!    and distributed processing modes
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+template <typename FPType>
+class SvdBatch : public Benchmark
+{
+public:
+    SvdBatch() : Benchmark("svd", "batch", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeDenseTable<FPType>(opt.nRows, opt.nCols, opt.seed);
+    }
+
+    void run()
+    {
+        svd::Batch<FPType> algorithm;
+        algorithm.input.set(svd::data, data);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+};
+
+template <typename FPType>
+class SvdOnline : public Benchmark
+{
+public:
+    SvdOnline() : Benchmark("svd", "online", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(false, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        svd::Online<FPType> algorithm;
+        for (size_t i = 0; i < blocks.size(); i++)
+        {
+            algorithm.input.set(svd::data, blocks[i]);
+            algorithm.compute();
+        }
+        algorithm.finalizeCompute();
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+template <typename FPType>
+class SvdDistributed : public Benchmark
+{
+public:
+    SvdDistributed() : Benchmark("svd", "distributed", false, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        blocks = makeBlocks<FPType>(false, opt.nRows, opt.nCols, opt.density, opt.nBlocks, opt.seed);
+    }
+
+    void run()
+    {
+        size_t nBlocks = blocks.size();
+        vector<services::SharedPtr<DataCollection> > dataFromStep1ForStep3(nBlocks);
+
+        svd::Distributed<step2Master, FPType> masterAlgorithm;
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            svd::Distributed<step1Local, FPType> localAlgorithm;
+            localAlgorithm.input.set(svd::data, blocks[i]);
+            localAlgorithm.compute();
+            masterAlgorithm.input.add(svd::inputOfStep2FromStep1, i, localAlgorithm.getPartialResult()->get(svd::outputOfStep1ForStep2));
+            dataFromStep1ForStep3[i] = localAlgorithm.getPartialResult()->get(svd::outputOfStep1ForStep3);
+        }
+        masterAlgorithm.compute();
+
+        services::SharedPtr<KeyValueDataCollection> inputForStep3FromStep2 =
+            masterAlgorithm.getPartialResult()->get(svd::outputOfStep2ForStep3);
+        for (size_t i = 0; i < nBlocks; i++)
+        {
+            svd::Distributed<step3Local, FPType> localAlgorithm;
+            localAlgorithm.input.set(svd::inputOfStep3FromStep1, dataFromStep1ForStep3[i]);
+            localAlgorithm.input.set(svd::inputOfStep3FromStep2,
+                services::staticPointerCast<DataCollection, SerializationIface>((*inputForStep3FromStep2)[i]));
+            localAlgorithm.compute();
+            localAlgorithm.finalizeCompute();
+        }
+    }
+
+    void tearDown() { blocks.clear(); }
+
+private:
+    vector<NumericTablePtr> blocks;
+};
+
+int main(int argc, char *argv[])
+{
+    Suite suite(argc, argv);
+
+    suite.add(new SvdBatch<float>());
+    suite.add(new SvdBatch<double>());
+    suite.add(new SvdOnline<float>());
+    suite.add(new SvdOnline<double>());
+    suite.add(new SvdDistributed<float>());
+    suite.add(new SvdDistributed<double>());
+
+    return suite.run();
+}
@@ -0,0 +1,124 @@
+/* file: svm_bench.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ benchmark of two-class support vector machine (SVM) training and
+!    prediction with the linear and RBF kernels
+!******************************************************************************/
+
+#include "bench.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace bench;
+
+/* SVM parameters */
+const size_t maxIterations = 100000;
+
+template <typename Kernel>
+services::SharedPtr<kernel_function::KernelIface> makeKernel()
+{
+    return services::SharedPtr<kernel_function::KernelIface>(new Kernel());
+}
+
+template <typename FPType, typename Kernel>
+class SvmTrainingBatch : public Benchmark
+{
+public:
+    SvmTrainingBatch(const char *name, bool isCsr) : Benchmark(name, "batch", isCsr, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+        labels = makeLabels<FPType>(data, 2, true);
+    }
+
+    void run()
+    {
+        svm::training::Batch<FPType> algorithm;
+        algorithm.parameter.kernel = makeKernel<Kernel>();
+        algorithm.parameter.maxIterations = maxIterations;
+        algorithm.input.set(classifier::training::data,   data);
+        algorithm.input.set(classifier::training::labels, labels);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); labels = NumericTablePtr(); }
+
+private:
+    NumericTablePtr data;
+    NumericTablePtr labels;
+};
+
+template <typename FPType, typename Kernel>
+class SvmPredictionBatch : public Benchmark
+{
+public:
+    SvmPredictionBatch(const char *name, bool isCsr) : Benchmark(name, "batch", isCsr, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+
+        svm::training::Batch<FPType> algorithm;
+        algorithm.parameter.kernel = makeKernel<Kernel>();
+        algorithm.parameter.maxIterations = maxIterations;
+        algorithm.input.set(classifier::training::data,   data);
+        algorithm.input.set(classifier::training::labels, makeLabels<FPType>(data, 2, true));
+        algorithm.compute();
+        model = algorithm.getResult()->get(classifier::training::model);
+    }
+
+    void run()
+    {
+        svm::prediction::Batch<FPType> algorithm;
+        algorithm.parameter.kernel = makeKernel<Kernel>();
+        algorithm.input.set(classifier::prediction::data,  data);
+        algorithm.input.set(classifier::prediction::model, model);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); model = services::SharedPtr<classifier::Model>(); }
+
+private:
+    NumericTablePtr data;
+    services::SharedPtr<classifier::Model> model;
+};
+
+int main(int argc, char *argv[])
+{
+    Options defaults;
+    defaults.nRows = 10000;
+    Suite suite(argc, argv, defaults);
+
+    suite.add(new SvmTrainingBatch<float,  kernel_function::linear::Batch<float > >("svm_linear_training", false));
+    suite.add(new SvmTrainingBatch<double, kernel_function::linear::Batch<double> >("svm_linear_training", false));
+    suite.add(new SvmTrainingBatch<float,  kernel_function::rbf::Batch<float > >("svm_rbf_training", false));
+    suite.add(new SvmTrainingBatch<double, kernel_function::rbf::Batch<double> >("svm_rbf_training", false));
+    suite.add(new SvmTrainingBatch<float,  kernel_function::linear::Batch<float,  kernel_function::linear::fastCSR> >("svm_linear_training", true));
+    suite.add(new SvmTrainingBatch<double, kernel_function::linear::Batch<double, kernel_function::linear::fastCSR> >("svm_linear_training", true));
+    suite.add(new SvmPredictionBatch<float,  kernel_function::linear::Batch<float > >("svm_linear_prediction", false));
+    suite.add(new SvmPredictionBatch<double, kernel_function::linear::Batch<double> >("svm_linear_prediction", false));
+    suite.add(new SvmPredictionBatch<float,  kernel_function::rbf::Batch<float > >("svm_rbf_prediction", false));
+    suite.add(new SvmPredictionBatch<double, kernel_function::rbf::Batch<double> >("svm_rbf_prediction", false));
+    suite.add(new SvmPredictionBatch<float,  kernel_function::linear::Batch<float,  kernel_function::linear::fastCSR> >("svm_linear_prediction", true));
+    suite.add(new SvmPredictionBatch<double, kernel_function::linear::Batch<double, kernel_function::linear::fastCSR> >("svm_linear_prediction", true));
+
+    return suite.run();
+}
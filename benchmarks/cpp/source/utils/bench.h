@@ -0,0 +1,577 @@
+/* file: bench.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Auxiliary classes and functions used in C++ benchmarks: synthetic data
+!    generation, timing, memory measurement and reporting of the results
+!
+!    Every benchmark executable accepts the options:
+!      --rows=N           number of observations in the synthetic data set
+!      --cols=N           number of features in the synthetic data set
+!      --density=F        fraction of non-zero values in CSR data sets
+!      --blocks=N         number of blocks in the online and distributed modes
+!      --iterations=N     number of measured runs
+!      --warmup=N         number of runs made before the measurements
+!      --threads=N,M,...  numbers of threads to measure with, defaults to
+!                         powers of two up to the number of available threads
+!      --filter=STR       runs only the benchmarks whose names contain STR
+!      --seed=N           seed of the synthetic data generator
+!      --output=FILE      appends the results to FILE instead of writing them
+!                         to the standard output
+!      --list             prints the names of the benchmarks and exits
+!
+!    Results are written one JSON object per line per benchmark and number of
+!    threads. Times are in milliseconds, memory is in kilobytes
+!******************************************************************************/
+
+#ifndef _BENCH_H
+#define _BENCH_H
+
+#include "daal.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+
+#include <sys/time.h>
+#include <sys/resource.h>
+#if defined(__APPLE__)
+    #include <mach/mach_time.h>
+#else
+    #include <time.h>
+#endif
+
+namespace bench
+{
+
+using namespace daal;
+using namespace daal::data_management;
+
+typedef services::SharedPtr<NumericTable> NumericTablePtr;
+
+/* Options shared by all benchmarks */
+struct Options
+{
+    Options() : nRows(100000), nCols(50), density(0.05), nBlocks(4), nIterations(10), nWarmup(2), seed(777), list(false) {}
+
+    size_t nRows;
+    size_t nCols;
+    double density;
+    size_t nBlocks;
+    size_t nIterations;
+    size_t nWarmup;
+    unsigned int seed;
+    bool list;
+    std::vector<size_t> threads;
+    std::string filter;
+    std::string output;
+};
+
+inline void usageError(const char *arg)
+{
+    std::fprintf(stderr, "Unknown or malformed option: %s\n", arg);
+    std::fprintf(stderr, "Options: --rows=N --cols=N --density=F --blocks=N --iterations=N --warmup=N "
+                         "--threads=N,M,... --filter=STR --seed=N --output=FILE --list\n");
+    std::exit(-1);
+}
+
+inline bool matchOption(const char *arg, const char *name, const char **value)
+{
+    size_t len = std::strlen(name);
+    if (std::strncmp(arg, name, len) != 0 || arg[len] != '=') { return false; }
+    *value = arg + len + 1;
+    return true;
+}
+
+inline size_t parseSize(const char *arg, const char *value)
+{
+    char *end = 0;
+    long result = std::strtol(value, &end, 10);
+    if (end == value || *end != '\0' || result <= 0) { usageError(arg); }
+    return (size_t)result;
+}
+
+inline std::vector<size_t> defaultThreads()
+{
+    size_t maxThreads = services::Environment::getInstance()->getNumberOfThreads();
+    std::vector<size_t> threads;
+    for (size_t t = 1; t < maxThreads; t *= 2) { threads.push_back(t); }
+    threads.push_back(maxThreads);
+    return threads;
+}
+
+inline Options parseOptions(int argc, char *argv[], const Options &defaults = Options())
+{
+    Options opt = defaults;
+    for (int i = 1; i < argc; i++)
+    {
+        const char *arg = argv[i];
+        const char *value = 0;
+        if      (matchOption(arg, "--rows",       &value)) { opt.nRows       = parseSize(arg, value); }
+        else if (matchOption(arg, "--cols",       &value)) { opt.nCols       = parseSize(arg, value); }
+        else if (matchOption(arg, "--blocks",     &value)) { opt.nBlocks     = parseSize(arg, value); }
+        else if (matchOption(arg, "--iterations", &value)) { opt.nIterations = parseSize(arg, value); }
+        else if (matchOption(arg, "--seed",       &value)) { opt.seed        = (unsigned int)parseSize(arg, value); }
+        else if (matchOption(arg, "--filter",     &value)) { opt.filter      = value; }
+        else if (matchOption(arg, "--output",     &value)) { opt.output      = value; }
+        else if (matchOption(arg, "--warmup",     &value))
+        {
+            char *end = 0;
+            long warmup = std::strtol(value, &end, 10);
+            if (end == value || *end != '\0' || warmup < 0) { usageError(arg); }
+            opt.nWarmup = (size_t)warmup;
+        }
+        else if (matchOption(arg, "--density",    &value))
+        {
+            char *end = 0;
+            opt.density = std::strtod(value, &end);
+            if (end == value || *end != '\0' || opt.density <= 0.0 || opt.density > 1.0) { usageError(arg); }
+        }
+        else if (matchOption(arg, "--threads",    &value))
+        {
+            opt.threads.clear();
+            std::string list(value);
+            size_t pos = 0;
+            while (pos <= list.size())
+            {
+                size_t next = list.find(',', pos);
+                if (next == std::string::npos) { next = list.size(); }
+                opt.threads.push_back(parseSize(arg, list.substr(pos, next - pos).c_str()));
+                pos = next + 1;
+            }
+        }
+        else if (std::strcmp(arg, "--list") == 0) { opt.list = true; }
+        else { usageError(arg); }
+    }
+    if (opt.nBlocks > opt.nRows) { opt.nBlocks = opt.nRows; }
+    if (opt.threads.empty()) { opt.threads = defaultThreads(); }
+    return opt;
+}
+
+/* Deterministic generator of pseudo-random numbers, independent of the C++ runtime */
+class Random
+{
+public:
+    Random(unsigned int seed) : _state(seed * 2654435761ULL + 1) {}
+
+    unsigned long long next()
+    {
+        _state ^= _state >> 12;
+        _state ^= _state << 25;
+        _state ^= _state >> 27;
+        return _state * 2685821657736338717ULL;
+    }
+
+    /* Uniformly distributed value from [0, 1) */
+    double uniform() { return (double)(next() >> 11) / 9007199254740992.0; }
+
+    /* Uniformly distributed integer from [0, n) */
+    size_t index(size_t n) { return (size_t)(next() % n); }
+
+private:
+    unsigned long long _state;
+};
+
+/* Dense table of nRows x nCols values uniformly distributed in [0, 1) */
+template <typename FPType>
+NumericTablePtr makeDenseTable(size_t nRows, size_t nCols, unsigned int seed)
+{
+    HomogenNumericTable<FPType> *table = new HomogenNumericTable<FPType>(nCols, nRows, NumericTable::doAllocate);
+    FPType *data = table->getArray();
+    Random random(seed);
+    for (size_t i = 0; i < nRows * nCols; i++) { data[i] = (FPType)random.uniform(); }
+    return NumericTablePtr(table);
+}
+
+/* CSR table of nRows x nCols with round(density * nCols) non-zero values in every row.
+   The columns of the non-zero values are spread over the row, the values are uniformly distributed in (0, 1] */
+template <typename FPType>
+NumericTablePtr makeCsrTable(size_t nRows, size_t nCols, double density, unsigned int seed)
+{
+    size_t nNonZerosInRow = (size_t)(density * nCols + 0.5);
+    if (nNonZerosInRow == 0) { nNonZerosInRow = 1; }
+    if (nNonZerosInRow > nCols) { nNonZerosInRow = nCols; }
+
+    FPType *values = 0;
+    size_t *colIndices = 0, *rowOffsets = 0;
+    CSRNumericTable *table = new CSRNumericTable(values, colIndices, rowOffsets, nCols, nRows);
+    table->allocateDataMemory(nRows * nNonZerosInRow);
+    table->getArrays((void **)&values, &colIndices, &rowOffsets);
+
+    Random random(seed);
+    size_t k = 0;
+    for (size_t i = 0; i < nRows; i++)
+    {
+        rowOffsets[i] = k + 1;
+        /* One non-zero value in each of nNonZerosInRow equal parts of the row keeps the indices sorted and unique */
+        for (size_t j = 0; j < nNonZerosInRow; j++, k++)
+        {
+            size_t first = j * nCols / nNonZerosInRow;
+            size_t last  = (j + 1) * nCols / nNonZerosInRow;
+            colIndices[k] = first + random.index(last - first) + 1;
+            values[k] = (FPType)(1.0 - random.uniform());
+        }
+    }
+    rowOffsets[nRows] = k + 1;
+    return NumericTablePtr(table);
+}
+
+template <typename FPType>
+NumericTablePtr makeTable(bool isCsr, size_t nRows, size_t nCols, double density, unsigned int seed)
+{
+    return (isCsr ? makeCsrTable<FPType>(nRows, nCols, density, seed) : makeDenseTable<FPType>(nRows, nCols, seed));
+}
+
+/* Splits nRows observations into nBlocks tables generated independently */
+template <typename FPType>
+std::vector<NumericTablePtr> makeBlocks(bool isCsr, size_t nRows, size_t nCols, double density, size_t nBlocks, unsigned int seed)
+{
+    std::vector<NumericTablePtr> blocks;
+    for (size_t i = 0; i < nBlocks; i++)
+    {
+        size_t begin = i * nRows / nBlocks, end = (i + 1) * nRows / nBlocks;
+        blocks.push_back(makeTable<FPType>(isCsr, end - begin, nCols, density, seed + (unsigned int)i));
+    }
+    return blocks;
+}
+
+/* Number of rows read at once from the tables the labels and responses are computed for */
+const size_t rowsInBlock = 1024;
+
+/* Class labels of a data set. Every observation gets the class with the largest
+   sum of the features assigned to the class, so that the labels are learnable.
+   Labels are 0, 1, ... nClasses - 1, or -1 and 1 if signedLabels is true */
+template <typename FPType>
+NumericTablePtr makeLabels(const NumericTablePtr &data, size_t nClasses, bool signedLabels = false)
+{
+    size_t nRows = data->getNumberOfRows();
+    size_t nCols = data->getNumberOfColumns();
+    HomogenNumericTable<FPType> *table = new HomogenNumericTable<FPType>(1, nRows, NumericTable::doAllocate);
+    FPType *labels = table->getArray();
+
+    std::vector<double> sums(nClasses);
+    for (size_t begin = 0; begin < nRows; begin += rowsInBlock)
+    {
+        size_t end = std::min(begin + rowsInBlock, nRows);
+        BlockDescriptor<FPType> block;
+        data->getBlockOfRows(begin, end - begin, readOnly, block);
+        const FPType *x = block.getBlockPtr();
+        for (size_t i = begin; i < end; i++, x += nCols)
+        {
+            std::fill(sums.begin(), sums.end(), 0.0);
+            for (size_t j = 0; j < nCols; j++) { sums[j % nClasses] += x[j]; }
+            size_t label = std::max_element(sums.begin(), sums.end()) - sums.begin();
+            labels[i] = (signedLabels ? (label ? (FPType)1 : (FPType)-1) : (FPType)label);
+        }
+        data->releaseBlockOfRows(block);
+    }
+    return NumericTablePtr(table);
+}
+
+/* Dependent variables of a regression data set: nResponses noisy linear functions of the features */
+template <typename FPType>
+NumericTablePtr makeResponses(const NumericTablePtr &data, size_t nResponses, unsigned int seed)
+{
+    size_t nRows = data->getNumberOfRows();
+    size_t nCols = data->getNumberOfColumns();
+    HomogenNumericTable<FPType> *table = new HomogenNumericTable<FPType>(nResponses, nRows, NumericTable::doAllocate);
+    FPType *y = table->getArray();
+
+    Random random(seed);
+    std::vector<double> beta((nCols + 1) * nResponses);
+    for (size_t i = 0; i < beta.size(); i++) { beta[i] = 2.0 * random.uniform() - 1.0; }
+
+    for (size_t begin = 0; begin < nRows; begin += rowsInBlock)
+    {
+        size_t end = std::min(begin + rowsInBlock, nRows);
+        BlockDescriptor<FPType> block;
+        data->getBlockOfRows(begin, end - begin, readOnly, block);
+        const FPType *x = block.getBlockPtr();
+        for (size_t i = begin; i < end; i++, x += nCols)
+        {
+            for (size_t k = 0; k < nResponses; k++)
+            {
+                const double *b = &beta[k * (nCols + 1)];
+                double sum = b[nCols] + 0.01 * (random.uniform() - 0.5);
+                for (size_t j = 0; j < nCols; j++) { sum += b[j] * x[j]; }
+                y[i * nResponses + k] = (FPType)sum;
+            }
+        }
+        data->releaseBlockOfRows(block);
+    }
+    return NumericTablePtr(table);
+}
+
+/* Monotonic wall clock time in milliseconds */
+inline double now()
+{
+#if defined(__APPLE__)
+    static mach_timebase_info_data_t timebase;
+    if (timebase.denom == 0) { mach_timebase_info(&timebase); }
+    return (double)mach_absolute_time() * timebase.numer / timebase.denom * 1.0e-6;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1.0e3 + (double)ts.tv_nsec * 1.0e-6;
+#endif
+}
+
+/* Resident memory of the process in kilobytes: the current value if peak is false, the highest value otherwise */
+inline size_t getResidentMemory(bool peak)
+{
+#if defined(__linux__)
+    FILE *file = std::fopen("/proc/self/status", "r");
+    if (file)
+    {
+        const char *key = (peak ? "VmHWM:" : "VmRSS:");
+        char line[256];
+        size_t result = 0;
+        while (std::fgets(line, sizeof(line), file))
+        {
+            if (std::strncmp(line, key, std::strlen(key)) == 0)
+            {
+                result = (size_t)std::strtoul(line + std::strlen(key), 0, 10);
+                break;
+            }
+        }
+        std::fclose(file);
+        if (result) { return result; }
+    }
+#endif
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#if defined(__APPLE__)
+    return (size_t)usage.ru_maxrss / 1024;
+#else
+    return (size_t)usage.ru_maxrss;
+#endif
+}
+
+/* Makes the peak resident memory equal to the current one where the system allows that */
+inline void resetPeakMemory()
+{
+#if defined(__linux__)
+    FILE *file = std::fopen("/proc/self/clear_refs", "w");
+    if (file)
+    {
+        std::fputs("5", file);
+        std::fclose(file);
+    }
+#endif
+}
+
+/* Value below which the given fraction of the sorted values falls, interpolated linearly */
+inline double percentile(const std::vector<double> &sorted, double fraction)
+{
+    if (sorted.empty()) { return 0.0; }
+    double pos = fraction * (sorted.size() - 1);
+    size_t lower = (size_t)pos;
+    size_t upper = std::min(lower + 1, sorted.size() - 1);
+    return sorted[lower] + (sorted[upper] - sorted[lower]) * (pos - lower);
+}
+
+/* Name of a benchmark of the form <algorithm>_<layout>_<mode> */
+inline std::string makeName(const char *algorithm, bool isCsr, const char *mode)
+{
+    return std::string(algorithm) + (isCsr ? "_csr_" : "_dense_") + mode;
+}
+
+template <typename FPType> inline const char *fptName();
+template <> inline const char *fptName<float>()  { return "float"; }
+template <> inline const char *fptName<double>() { return "double"; }
+
+/* Base class of the benchmarks.
+   setUp() generates the input data and is not measured, run() is measured */
+class Benchmark
+{
+public:
+    Benchmark(const char *algorithm, const char *mode, bool isCsr, const char *fpt) :
+        _name(makeName(algorithm, isCsr, mode)), _mode(mode), _isCsr(isCsr), _fpt(fpt) {}
+
+    virtual ~Benchmark() {}
+
+    virtual void setUp(const Options &opt) = 0;
+    virtual void run() = 0;
+    virtual void tearDown() {}
+
+    /* Number of observations processed by one run */
+    virtual size_t getNumberOfRows(const Options &opt) const { return opt.nRows; }
+
+    const std::string &getName() const { return _name; }
+    const char *getMode() const { return _mode; }
+    const char *getLayout() const { return (_isCsr ? "csr" : "dense"); }
+    const char *getFPType() const { return _fpt; }
+    bool isCsr() const { return _isCsr; }
+
+private:
+    std::string _name;
+    const char *_mode;
+    bool _isCsr;
+    const char *_fpt;
+};
+
+/* Benchmark of an algorithm in the batch processing mode with a single input table */
+template <typename FPType, typename Algorithm, typename InputId, InputId inputId>
+class BatchBenchmark : public Benchmark
+{
+public:
+    BatchBenchmark(const char *algorithm, bool isCsr = false) : Benchmark(algorithm, "batch", isCsr, fptName<FPType>()) {}
+
+    void setUp(const Options &opt)
+    {
+        data = makeData(opt);
+    }
+
+    void run()
+    {
+        Algorithm algorithm;
+        algorithm.input.set(inputId, data);
+        algorithm.compute();
+    }
+
+    void tearDown() { data = NumericTablePtr(); }
+
+protected:
+    virtual NumericTablePtr makeData(const Options &opt)
+    {
+        return makeTable<FPType>(isCsr(), opt.nRows, opt.nCols, opt.density, opt.seed);
+    }
+
+private:
+    NumericTablePtr data;
+};
+
+/* Collection of the benchmarks of one executable */
+class Suite
+{
+public:
+    Suite(int argc, char *argv[], const Options &defaults = Options()) : _opt(parseOptions(argc, argv, defaults)) {}
+
+    ~Suite()
+    {
+        for (size_t i = 0; i < _benchmarks.size(); i++) { delete _benchmarks[i]; }
+    }
+
+    const Options &getOptions() const { return _opt; }
+
+    void add(Benchmark *benchmark) { _benchmarks.push_back(benchmark); }
+
+    int run()
+    {
+        if (_opt.list)
+        {
+            for (size_t i = 0; i < _benchmarks.size(); i++) { std::printf("%s\n", _benchmarks[i]->getName().c_str()); }
+            return 0;
+        }
+
+        FILE *out = stdout;
+        if (!_opt.output.empty())
+        {
+            out = std::fopen(_opt.output.c_str(), "a");
+            if (!out)
+            {
+                std::fprintf(stderr, "Cannot open %s\n", _opt.output.c_str());
+                return -1;
+            }
+        }
+
+        int status = 0;
+        for (size_t i = 0; i < _benchmarks.size(); i++)
+        {
+            Benchmark *b = _benchmarks[i];
+            if (!_opt.filter.empty() && b->getName().find(_opt.filter) == std::string::npos) { continue; }
+            try
+            {
+                measure(b, out);
+            }
+            catch (services::Exception &e)
+            {
+                std::fprintf(stderr, "%s: %s\n", b->getName().c_str(), e.what());
+                status = -1;
+            }
+        }
+
+        if (out != stdout) { std::fclose(out); }
+        return status;
+    }
+
+private:
+    void measure(Benchmark *b, FILE *out)
+    {
+        b->setUp(_opt);
+        double firstMedian = 0.0;
+        size_t firstThreads = 1;
+        for (size_t t = 0; t < _opt.threads.size(); t++)
+        {
+            services::Environment::getInstance()->setNumberOfThreads(_opt.threads[t]);
+            size_t nThreads = services::Environment::getInstance()->getNumberOfThreads();
+
+            for (size_t i = 0; i < _opt.nWarmup; i++) { b->run(); }
+
+            resetPeakMemory();
+            size_t baseMemory = getResidentMemory(false);
+            std::vector<double> times(_opt.nIterations);
+            for (size_t i = 0; i < _opt.nIterations; i++)
+            {
+                double start = now();
+                b->run();
+                times[i] = now() - start;
+            }
+            size_t peakMemory = std::max(getResidentMemory(true), baseMemory);
+
+            std::sort(times.begin(), times.end());
+            double sum = 0.0;
+            for (size_t i = 0; i < times.size(); i++) { sum += times[i]; }
+            double median = percentile(times, 0.5);
+            if (t == 0)
+            {
+                firstMedian  = median;
+                firstThreads = nThreads;
+            }
+            double speedup = (median > 0.0 ? firstMedian / median : 0.0);
+
+            services::LibraryVersionInfo version;
+            std::fprintf(out, "{\"benchmark\":\"%s\",\"mode\":\"%s\",\"layout\":\"%s\",\"fpt\":\"%s\","
+                              "\"version\":\"%d.%d.%d\",\"build\":\"%s\","
+                              "\"rows\":%lu,\"cols\":%lu,\"density\":%g,\"blocks\":%lu,\"threads\":%lu,\"iterations\":%lu,"
+                              "\"min_ms\":%.4f,\"median_ms\":%.4f,\"mean_ms\":%.4f,\"p90_ms\":%.4f,\"p99_ms\":%.4f,\"max_ms\":%.4f,"
+                              "\"rows_per_s\":%.1f,\"speedup\":%.3f,\"efficiency\":%.3f,\"base_rss_kb\":%lu,\"peak_rss_kb\":%lu}\n",
+                         b->getName().c_str(), b->getMode(), b->getLayout(), b->getFPType(),
+                         version.majorVersion, version.minorVersion, version.updateVersion, version.build,
+                         (unsigned long)_opt.nRows, (unsigned long)_opt.nCols, (b->isCsr() ? _opt.density : 1.0),
+                         (unsigned long)_opt.nBlocks, (unsigned long)nThreads, (unsigned long)_opt.nIterations,
+                         times.front(), median, sum / times.size(), percentile(times, 0.9), percentile(times, 0.99), times.back(),
+                         (median > 0.0 ? b->getNumberOfRows(_opt) * 1.0e3 / median : 0.0),
+                         speedup, speedup * firstThreads / nThreads,
+                         (unsigned long)baseMemory, (unsigned long)peakMemory);
+            std::fflush(out);
+        }
+        b->tearDown();
+    }
+
+    Options _opt;
+    std::vector<Benchmark *> _benchmarks;
+};
+
+} // namespace bench
+
+#endif
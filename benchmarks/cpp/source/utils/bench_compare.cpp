@@ -0,0 +1,193 @@
+/* file: bench_compare.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    Compares two files of benchmark results written by the benchmarks and
+!    reports the regressions
+!
+!    Usage: bench_compare BASELINE CURRENT [--tolerance=F] [--metric=NAME]
+!      --tolerance=F   allowed relative change of the metric, 0.10 by default
+!      --metric=NAME   compared field of the results, median_ms by default.
+!                      Fields ending with _ms or _kb are better when lower,
+!                      other fields are better when higher
+!
+!    Results are matched by benchmark, mode, layout, precision, data set sizes
+!    and number of threads. Returns non-zero if any result regressed
+!******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+typedef map<string, string> Record;
+
+/* Fields that identify a measurement */
+static const char *keyFields[] = { "benchmark", "mode", "layout", "fpt", "rows", "cols", "density", "blocks", "threads" };
+static const size_t nKeyFields = sizeof(keyFields) / sizeof(keyFields[0]);
+
+/* Parses one line of flat JSON written by the benchmarks */
+static bool parseRecord(const string &line, Record &record)
+{
+    size_t pos = line.find('{');
+    if (pos == string::npos) { return false; }
+    pos++;
+
+    while (pos < line.size())
+    {
+        size_t nameBegin = line.find('"', pos);
+        if (nameBegin == string::npos) { break; }
+        size_t nameEnd = line.find('"', nameBegin + 1);
+        size_t colon   = line.find(':', nameEnd);
+        if (nameEnd == string::npos || colon == string::npos) { return false; }
+        string name = line.substr(nameBegin + 1, nameEnd - nameBegin - 1);
+
+        size_t valueBegin = colon + 1;
+        size_t valueEnd;
+        string value;
+        if (line[valueBegin] == '"')
+        {
+            valueEnd = line.find('"', valueBegin + 1);
+            if (valueEnd == string::npos) { return false; }
+            value = line.substr(valueBegin + 1, valueEnd - valueBegin - 1);
+            valueEnd++;
+        }
+        else
+        {
+            valueEnd = line.find_first_of(",}", valueBegin);
+            if (valueEnd == string::npos) { return false; }
+            value = line.substr(valueBegin, valueEnd - valueBegin);
+        }
+        record[name] = value;
+        pos = valueEnd + 1;
+    }
+    return !record.empty();
+}
+
+static string makeKey(Record &record)
+{
+    string key;
+    for (size_t i = 0; i < nKeyFields; i++)
+    {
+        if (i) { key += " "; }
+        key += record[keyFields[i]];
+    }
+    return key;
+}
+
+static bool readResults(const char *fileName, map<string, Record> &results, vector<string> &order)
+{
+    ifstream file(fileName);
+    if (!file.is_open())
+    {
+        fprintf(stderr, "Cannot open %s\n", fileName);
+        return false;
+    }
+
+    string line;
+    while (getline(file, line))
+    {
+        Record record;
+        if (!parseRecord(line, record)) { continue; }
+        string key = makeKey(record);
+        if (results.find(key) == results.end()) { order.push_back(key); }
+        results[key] = record;
+    }
+    return true;
+}
+
+static bool endsWith(const string &str, const char *suffix)
+{
+    size_t len = strlen(suffix);
+    return str.size() >= len && str.compare(str.size() - len, len, suffix) == 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *files[2] = { 0, 0 };
+    size_t nFiles = 0;
+    double tolerance = 0.10;
+    string metric = "median_ms";
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (!strncmp(argv[i], "--tolerance=", 12))   { tolerance = atof(argv[i] + 12); }
+        else if (!strncmp(argv[i], "--metric=", 9)) { metric = argv[i] + 9; }
+        else if (nFiles < 2)                        { files[nFiles++] = argv[i]; }
+    }
+    if (nFiles != 2)
+    {
+        fprintf(stderr, "Usage: %s BASELINE CURRENT [--tolerance=F] [--metric=NAME]\n", argv[0]);
+        return 2;
+    }
+
+    map<string, Record> baseline, current;
+    vector<string> baselineOrder, currentOrder;
+    if (!readResults(files[0], baseline, baselineOrder) || !readResults(files[1], current, currentOrder)) { return 2; }
+
+    const bool lowerIsBetter = endsWith(metric, "_ms") || endsWith(metric, "_kb");
+    size_t nRegressions = 0;
+
+    printf("%-12s %10s %10s %8s  %s\n", "status", "baseline", "current", "change", "benchmark mode layout fpt rows cols density blocks threads");
+    for (size_t i = 0; i < currentOrder.size(); i++)
+    {
+        const string &key = currentOrder[i];
+        Record &cur = current[key];
+        double curValue = atof(cur[metric].c_str());
+
+        map<string, Record>::iterator it = baseline.find(key);
+        if (it == baseline.end())
+        {
+            printf("%-12s %10s %10.4g %8s  %s\n", "new", "-", curValue, "-", key.c_str());
+            continue;
+        }
+
+        double baseValue = atof(it->second[metric].c_str());
+        double change = (baseValue != 0.0) ? (curValue - baseValue) / baseValue : 0.0;
+        double worse  = lowerIsBetter ? change : -change;
+
+        const char *status = "ok";
+        if (worse > tolerance)
+        {
+            status = "REGRESSION";
+            nRegressions++;
+        }
+        else if (worse < -tolerance)
+        {
+            status = "improved";
+        }
+        printf("%-12s %10.4g %10.4g %+7.1f%%  %s\n", status, baseValue, curValue, change * 100.0, key.c_str());
+    }
+
+    for (size_t i = 0; i < baselineOrder.size(); i++)
+    {
+        if (current.find(baselineOrder[i]) == current.end())
+        {
+            printf("%-12s %10.4g %10s %8s  %s\n", "missing", atof(baseline[baselineOrder[i]][metric].c_str()), "-", "-",
+                   baselineOrder[i].c_str());
+        }
+    }
+
+    printf("\n%lu regression(s) of %s beyond %.1f%% tolerance\n", (unsigned long)nRegressions, metric.c_str(), tolerance * 100.0);
+    return nRegressions ? 1 : 0;
+}
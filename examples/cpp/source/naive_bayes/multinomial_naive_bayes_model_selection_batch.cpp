@@ -0,0 +1,128 @@
+/* file: multinomial_naive_bayes_model_selection_batch.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+!  Content:
+!    C++ example of the selection of the parameters of Naive Bayes classification
+!    with k-fold cross-validation in the batch processing mode.
+!
+!    The program compares the Naive Bayes models trained with several values of
+!    the imagined occurrences of the features on a supplied data set in dense format.
+!******************************************************************************/
+
+/**
+ * <a name="DAAL-EXAMPLE-CPP-MULTINOMIAL_NAIVE_BAYES_MODEL_SELECTION_BATCH"></a>
+ * \example multinomial_naive_bayes_model_selection_batch.cpp
+ */
+
+#include "daal.h"
+#include "service.h"
+
+using namespace std;
+using namespace daal;
+using namespace daal::algorithms;
+using namespace daal::algorithms::multinomial_naive_bayes;
+
+/* Input data set parameters */
+string trainDatasetFileName     = "../data/batch/naivebayes_train_dense.csv";
+
+const size_t nFeatures          = 20;
+const size_t nClasses           = 20;
+const size_t nFolds             = 5;
+
+/* Values of the imagined occurrences of the features to compare */
+const size_t nConfigurations    = 3;
+const double alphaValues[nConfigurations] = { 0.1, 1.0, 10.0 };
+
+services::SharedPtr<NumericTable> alphaTables[nConfigurations];
+services::SharedPtr<classifier::model_selection::Result> modelSelectionResult;
+
+void selectModel();
+void printResults();
+
+int main(int argc, char *argv[])
+{
+    checkArguments(argc, argv, 1, &trainDatasetFileName);
+
+    selectModel();
+
+    printResults();
+
+    return 0;
+}
+
+void selectModel()
+{
+    /* Initialize FileDataSource<CSVFeatureManager> to retrieve the input data from a .csv file */
+    FileDataSource<CSVFeatureManager> trainDataSource(trainDatasetFileName,
+                                                      DataSource::notAllocateNumericTable,
+                                                      DataSource::doDictionaryFromContext);
+
+    /* Create Numeric Tables for training data and labels */
+    services::SharedPtr<NumericTable> trainData(new HomogenNumericTable<double>(nFeatures, 0, NumericTable::notAllocate));
+    services::SharedPtr<NumericTable> trainGroundTruth(new HomogenNumericTable<double>(1, 0, NumericTable::notAllocate));
+    services::SharedPtr<NumericTable> mergedData(new MergedNumericTable(trainData, trainGroundTruth));
+
+    /* Retrieve the data from the input file */
+    trainDataSource.loadDataBlock(mergedData.get());
+
+    /* Create an algorithm object to compare the configurations of Naive Bayes with 5-fold cross-validation */
+    classifier::model_selection::Batch<> algorithm(nClasses, nFolds);
+
+    /* Add a training algorithm for every configuration of the parameters */
+    for (size_t i = 0; i < nConfigurations; i++)
+    {
+        alphaTables[i] = services::SharedPtr<NumericTable>(
+            new HomogenNumericTable<double>(nFeatures, 1, NumericTable::doAllocate, alphaValues[i]));
+
+        services::SharedPtr<training::Batch<> > trainingAlgorithm(new training::Batch<>(nClasses));
+        trainingAlgorithm->parameter.alpha = alphaTables[i].get();
+
+        algorithm.parameter.training.push_back(trainingAlgorithm);
+    }
+
+    /* The same prediction algorithm is used with the models of all configurations */
+    algorithm.parameter.prediction.push_back(
+        services::SharedPtr<classifier::prediction::Batch>(new prediction::Batch<>(nClasses)));
+
+    /* Pass a data set and labels to the algorithm */
+    algorithm.input.set(classifier::model_selection::data,   trainData);
+    algorithm.input.set(classifier::model_selection::labels, trainGroundTruth);
+
+    /* Train and validate the models of all configurations on all folds */
+    algorithm.compute();
+
+    /* Retrieve the algorithm results */
+    modelSelectionResult = algorithm.getResult();
+}
+
+void printResults()
+{
+    printNumericTable(modelSelectionResult->getTable(classifier::model_selection::errorRates),
+                      "Error rates of the configurations (rows) on the validation folds (columns):");
+
+    services::SharedPtr<DataCollection> qualityMetrics = modelSelectionResult->get(classifier::model_selection::qualityMetrics);
+    for (size_t i = 0; i < nConfigurations; i++)
+    {
+        services::SharedPtr<classifier::quality_metric::multiclass_confusion_matrix::Result> metrics =
+            services::staticPointerCast<classifier::quality_metric::multiclass_confusion_matrix::Result, SerializationIface>((*qualityMetrics)[i]);
+
+        cout << "alpha = " << alphaValues[i] << endl;
+        printNumericTable(metrics->get(classifier::quality_metric::multiclass_confusion_matrix::multiClassMetrics),
+                          "Multi-class metrics:");
+    }
+}
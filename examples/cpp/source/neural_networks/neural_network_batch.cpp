@@ -76,6 +76,12 @@ int main()
     predictionNet.input.set(prediction::model, predictionModel);
     predictionNet.input.set(prediction::data, predictionData);
 
+    /* Set the number of samples processed by the neural network in one forward pass */
+    predictionNet.parameter.batchSize = 100;
+
+    /* Let the layers share memory buffers for their values */
+    predictionNet.parameter.reuseActivationMemory = true;
+
     /* Run the neural network prediction */
     predictionNet.compute();
 
@@ -49,6 +49,12 @@ struct Blas
         _impl<fpType,cpu>::xsyrk(uplo, trans, p, n, alpha, a, lda, beta, ata, ldata);
     }
 
+    static void xxsyrk(char *uplo, char *trans, SizeType *p, SizeType *n, fpType *alpha, fpType *a, SizeType *lda,
+               fpType *beta, fpType *ata, SizeType *ldata)
+    {
+        _impl<fpType,cpu>::xxsyrk(uplo, trans, p, n, alpha, a, lda, beta, ata, ldata);
+    }
+
     static void xsyr(const char *uplo, const SizeType *n, const fpType *alpha,
               const fpType *x, const SizeType *incx, fpType *a, const SizeType *lda)
     {
@@ -73,6 +79,12 @@ struct Blas
         _impl<fpType,cpu>::xsymm(side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
     }
 
+    static void xxsymm(char *side, char *uplo, SizeType *m, SizeType *n, fpType *alpha, fpType *a, SizeType *lda,
+               fpType *b, SizeType *ldb, fpType *beta, fpType *c, SizeType *ldc)
+    {
+        _impl<fpType,cpu>::xxsymm(side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc);
+    }
+
     static void xgemv(char *trans, SizeType *m, SizeType *n, fpType *alpha, fpType *a, SizeType *lda, fpType *x,
                SizeType *incx, fpType *beta, fpType *y, SizeType *incy)
     {
@@ -142,6 +142,12 @@ struct MklBlas<double, cpu>
         __DAAL_MKLFN_CALL(blas_, dsyrk, (uplo, trans, p, n, alpha, a, lda, beta, ata, ldata));
     }
 
+    static void xxsyrk(char *uplo, char *trans, MKL_INT *p, MKL_INT *n, double *alpha, double *a, MKL_INT *lda,
+               double *beta, double *ata, MKL_INT *ldata)
+    {
+        __DAAL_MKLFN_CALL(blas_, xdsyrk, (uplo, trans, p, n, alpha, a, lda, beta, ata, ldata));
+    }
+
     static void xsyr(const char *uplo, const MKL_INT *n, const double *alpha,
               const double *x, const MKL_INT *incx, double *a, const MKL_INT *lda)
     {
@@ -166,6 +172,12 @@ struct MklBlas<double, cpu>
         __DAAL_MKLFN_CALL(blas_, dsymm, (side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc));
     }
 
+    static void xxsymm(char *side, char *uplo, MKL_INT *m, MKL_INT *n, double *alpha, double *a, MKL_INT *lda, double *b,
+               MKL_INT *ldb, double *beta, double *c, MKL_INT *ldc)
+    {
+        __DAAL_MKLFN_CALL(blas_, xdsymm, (side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc));
+    }
+
     static void xgemv(char *trans, MKL_INT *m, MKL_INT *n, double *alpha, double *a, MKL_INT *lda, double *x,
                MKL_INT *incx, double *beta, double *y, MKL_INT *incy)
     {
@@ -193,6 +205,12 @@ struct MklBlas<float, cpu>
         __DAAL_MKLFN_CALL(blas_, ssyrk, (uplo, trans, p, n, alpha, a, lda, beta, ata, ldata));
     }
 
+    static void xxsyrk(char *uplo, char *trans, MKL_INT *p, MKL_INT *n, float *alpha, float *a, MKL_INT *lda, float *beta,
+               float *ata, MKL_INT *ldata)
+    {
+        __DAAL_MKLFN_CALL(blas_, xssyrk, (uplo, trans, p, n, alpha, a, lda, beta, ata, ldata));
+    }
+
     static void xsyr(const char *uplo, const MKL_INT *n, const float *alpha,
               const float *x, const MKL_INT *incx, float *a, const MKL_INT *lda)
     {
@@ -217,6 +235,12 @@ struct MklBlas<float, cpu>
         __DAAL_MKLFN_CALL(blas_, ssymm, (side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc));
     }
 
+    static void xxsymm(char *side, char *uplo, MKL_INT *m, MKL_INT *n, float *alpha, float *a, MKL_INT *lda, float *b,
+               MKL_INT *ldb, float *beta, float *c, MKL_INT *ldc)
+    {
+        __DAAL_MKLFN_CALL(blas_, xssymm, (side, uplo, m, n, alpha, a, lda, b, ldb, beta, c, ldc));
+    }
+
     static void xgemv(char *trans, MKL_INT *m, MKL_INT *n, float *alpha, float *a, MKL_INT *lda, float *x, MKL_INT *incx,
                float *beta, float *y, MKL_INT *incy)
     {
@@ -65,18 +65,36 @@ struct Lapack
         _impl<fpType,cpu>::xgerqf(m, n, a, lda, tau, work, lwork, info);
     }
 
+    static void xxgerqf(SizeType *m, SizeType *n, fpType *a, SizeType *lda, fpType *tau, fpType *work, SizeType *lwork,
+                SizeType *info)
+    {
+        _impl<fpType,cpu>::xxgerqf(m, n, a, lda, tau, work, lwork, info);
+    }
+
     static void xormrq(char *side, char *trans, SizeType *m, SizeType *n, SizeType *k, fpType *a, SizeType *lda,
                 fpType *tau, fpType *c, SizeType *ldc, fpType *work, SizeType *lwork, SizeType *info)
     {
         _impl<fpType,cpu>::xormrq(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info);
     }
 
+    static void xxormrq(char *side, char *trans, SizeType *m, SizeType *n, SizeType *k, fpType *a, SizeType *lda,
+                fpType *tau, fpType *c, SizeType *ldc, fpType *work, SizeType *lwork, SizeType *info)
+    {
+        _impl<fpType,cpu>::xxormrq(side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info);
+    }
+
     static void xtrtrs(char *uplo, char *trans, char *diag, SizeType *n, SizeType *nrhs,
                 fpType *a, SizeType *lda, fpType *b, SizeType *ldb, SizeType *info)
     {
         _impl<fpType,cpu>::xtrtrs(uplo, trans, diag, n, nrhs, a, lda, b, ldb, info);
     }
 
+    static void xxtrtrs(char *uplo, char *trans, char *diag, SizeType *n, SizeType *nrhs,
+                fpType *a, SizeType *lda, fpType *b, SizeType *ldb, SizeType *info)
+    {
+        _impl<fpType,cpu>::xxtrtrs(uplo, trans, diag, n, nrhs, a, lda, b, ldb, info);
+    }
+
     static void xpptrf(char *uplo, SizeType *n, fpType *ap, SizeType *info)
     {
         _impl<fpType,cpu>::xpptrf(uplo, n, ap, info);
@@ -88,6 +106,12 @@ struct Lapack
         _impl<fpType,cpu>::xgeqrf(m, n, a, lda, tau, work, lwork, info);
     }
 
+    static void xxgeqrf(SizeType m, SizeType n, fpType *a,
+                SizeType lda, fpType *tau, fpType *work, SizeType lwork, SizeType *info)
+    {
+        _impl<fpType,cpu>::xxgeqrf(m, n, a, lda, tau, work, lwork, info);
+    }
+
     static void xgeqp3(SizeType m, SizeType n, fpType *a,
                 SizeType lda, SizeType *jpvt, fpType *tau, fpType *work, SizeType lwork, SizeType *info)
     {
@@ -100,6 +124,12 @@ struct Lapack
         _impl<fpType,cpu>::xorgqr(m, n, k, a, lda, tau, work, lwork, info);
     }
 
+    static void xxorgqr(SizeType m, SizeType n, SizeType k,
+                fpType *a, SizeType lda, fpType *tau, fpType *work, SizeType lwork, SizeType *info)
+    {
+        _impl<fpType,cpu>::xxorgqr(m, n, k, a, lda, tau, work, lwork, info);
+    }
+
     static void xgesvd(char jobu, char jobvt, SizeType m, SizeType n,
                 fpType *a, SizeType lda, fpType *s, fpType *u, SizeType ldu, fpType *vt, SizeType ldvt,
                 fpType *work, SizeType lwork, SizeType *info)
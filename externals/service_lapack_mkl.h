@@ -158,18 +158,42 @@ struct MklLapack<double, cpu>
         __DAAL_MKLFN_CALL(lapack_, dgerqf, (m, n, a, lda, tau, work, lwork, info));
     }
 
+    static void xxgerqf(MKL_INT *m, MKL_INT *n, double *a, MKL_INT *lda, double *tau, double *work, MKL_INT *lwork,
+                MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, dgerqf, (m, n, a, lda, tau, work, lwork, info));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xormrq(char *side, char *trans, MKL_INT *m, MKL_INT *n, MKL_INT *k, double *a, MKL_INT *lda,
                 double *tau, double *c, MKL_INT *ldc, double *work, MKL_INT *lwork, MKL_INT *info)
     {
         __DAAL_MKLFN_CALL(lapack_, dormrq, (side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info, 1, 1));
     }
 
+    static void xxormrq(char *side, char *trans, MKL_INT *m, MKL_INT *n, MKL_INT *k, double *a, MKL_INT *lda,
+                double *tau, double *c, MKL_INT *ldc, double *work, MKL_INT *lwork, MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, dormrq, (side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info, 1, 1));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xtrtrs(char *uplo, char *trans, char *diag, MKL_INT *n, MKL_INT *nrhs,
                 double *a, MKL_INT *lda, double *b, MKL_INT *ldb, MKL_INT *info)
     {
         __DAAL_MKLFN_CALL(lapack_, dtrtrs, (uplo, trans, diag, n, nrhs, a, lda, b, ldb, info));
     }
 
+    static void xxtrtrs(char *uplo, char *trans, char *diag, MKL_INT *n, MKL_INT *nrhs,
+                double *a, MKL_INT *lda, double *b, MKL_INT *ldb, MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, dtrtrs, (uplo, trans, diag, n, nrhs, a, lda, b, ldb, info));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xpptrf(char *uplo, MKL_INT *n, double *ap, MKL_INT *info)
     {
         __DAAL_MKLFN_CALL(lapack_, dpptrf, (uplo, n, ap, info));
@@ -181,6 +205,14 @@ struct MklLapack<double, cpu>
         __DAAL_MKLFN_CALL(lapack_, dgeqrf, (&m, &n, a, &lda, tau, work, &lwork, info));
     }
 
+    static void xxgeqrf(MKL_INT m, MKL_INT n, double *a,
+                MKL_INT lda, double *tau, double *work, MKL_INT lwork, MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, dgeqrf, (&m, &n, a, &lda, tau, work, &lwork, info));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xgeqp3(MKL_INT m, MKL_INT n, double *a,
                 MKL_INT lda, MKL_INT *jpvt, double *tau, double *work, MKL_INT lwork, MKL_INT *info)
     {
@@ -193,6 +225,14 @@ struct MklLapack<double, cpu>
         __DAAL_MKLFN_CALL(lapack_, dorgqr, (&m, &n, &k, a, &lda, tau, work, &lwork, info));
     }
 
+    static void xxorgqr(MKL_INT m, MKL_INT n, MKL_INT k,
+                double *a, MKL_INT lda, double *tau, double *work, MKL_INT lwork, MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, dorgqr, (&m, &n, &k, a, &lda, tau, work, &lwork, info));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xgesvd(char jobu, char jobvt, MKL_INT m, MKL_INT n,
                 double *a, MKL_INT lda, double *s, double *u, MKL_INT ldu, double *vt, MKL_INT ldvt,
                 double *work, MKL_INT lwork, MKL_INT *info)
@@ -239,18 +279,42 @@ struct MklLapack<float, cpu>
         __DAAL_MKLFN_CALL(lapack_, sgerqf, (m, n, a, lda, tau, work, lwork, info));
     }
 
+    static void xxgerqf(MKL_INT *m, MKL_INT *n, float *a, MKL_INT *lda, float *tau, float *work, MKL_INT *lwork,
+                MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, sgerqf, (m, n, a, lda, tau, work, lwork, info));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xormrq(char *side, char *trans, MKL_INT *m, MKL_INT *n, MKL_INT *k, float *a, MKL_INT *lda,
                 float *tau, float *c, MKL_INT *ldc, float *work, MKL_INT *lwork, MKL_INT *info)
     {
         __DAAL_MKLFN_CALL(lapack_, sormrq, (side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info, 1, 1));
     }
 
+    static void xxormrq(char *side, char *trans, MKL_INT *m, MKL_INT *n, MKL_INT *k, float *a, MKL_INT *lda,
+                float *tau, float *c, MKL_INT *ldc, float *work, MKL_INT *lwork, MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, sormrq, (side, trans, m, n, k, a, lda, tau, c, ldc, work, lwork, info, 1, 1));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xtrtrs(char *uplo, char *trans, char *diag, MKL_INT *n, MKL_INT *nrhs,
                 float *a, MKL_INT *lda, float *b, MKL_INT *ldb, MKL_INT *info)
     {
         __DAAL_MKLFN_CALL(lapack_, strtrs, (uplo, trans, diag, n, nrhs, a, lda, b, ldb, info));
     }
 
+    static void xxtrtrs(char *uplo, char *trans, char *diag, MKL_INT *n, MKL_INT *nrhs,
+                float *a, MKL_INT *lda, float *b, MKL_INT *ldb, MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, strtrs, (uplo, trans, diag, n, nrhs, a, lda, b, ldb, info));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xpptrf(char *uplo, MKL_INT *n, float *ap, MKL_INT *info)
     {
         __DAAL_MKLFN_CALL(lapack_, spptrf, (uplo, n, ap, info));
@@ -262,6 +326,14 @@ struct MklLapack<float, cpu>
         __DAAL_MKLFN_CALL(lapack_, sgeqrf, (&m, &n, a, &lda, tau, work, &lwork, info));
     }
 
+    static void xxgeqrf(MKL_INT m, MKL_INT n, float *a,
+                MKL_INT lda, float *tau, float *work, MKL_INT lwork, MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, sgeqrf, (&m, &n, a, &lda, tau, work, &lwork, info));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xgeqp3(MKL_INT m, MKL_INT n, float *a,
                 MKL_INT lda, MKL_INT *jpvt, float *tau, float *work, MKL_INT lwork, MKL_INT *info)
     {
@@ -274,6 +346,14 @@ struct MklLapack<float, cpu>
         __DAAL_MKLFN_CALL(lapack_, sorgqr, (&m, &n, &k, a, &lda, tau, work, &lwork, info));
     }
 
+    static void xxorgqr(MKL_INT m, MKL_INT n, MKL_INT k,
+                float *a, MKL_INT lda, float *tau, float *work, MKL_INT lwork, MKL_INT *info)
+    {
+        int old_threads = fpk_serv_set_num_threads_local(1);
+        __DAAL_MKLFN_CALL(lapack_, sorgqr, (&m, &n, &k, a, &lda, tau, work, &lwork, info));
+        fpk_serv_set_num_threads_local(old_threads);
+    }
+
     static void xgesvd(char jobu, char jobvt, MKL_INT m, MKL_INT n,
                 float *a, MKL_INT lda, float *s, float *u, MKL_INT ldu, float *vt, MKL_INT ldvt,
                 float *work, MKL_INT lwork, MKL_INT *info)
@@ -23,12 +23,32 @@
 
 #include "mkl_daal.h"
 #include "service_memory.h"
+#include "threading.h"
+#include "service_profiler.h"
 
 void *daal::services::daal_malloc(size_t size, size_t alignment)
 {
+#if !defined(DAAL_DISABLE_PROFILER)
+    if (daal::internal::profilerEnabled) { daal::internal::profilerAllocate(size); }
+#endif
     return fpk_serv_malloc(size, alignment);
 }
 
+void *daal::services::daal_numa_malloc(size_t size, NumaPlacement placement, size_t alignment)
+{
+    void *ptr = daal_malloc(size, alignment);
+    daal_numa_place(ptr, size, placement);
+    return ptr;
+}
+
+void daal::services::daal_numa_place(void *ptr, size_t size, NumaPlacement placement)
+{
+    if (placement != numaDefault)
+    {
+        _daal_numa_place(ptr, size, (int)placement);
+    }
+}
+
 void daal::services::daal_free(void *ptr)
 {
     fpk_serv_free(ptr);
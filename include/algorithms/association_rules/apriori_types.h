@@ -43,7 +43,9 @@ namespace association_rules
  */
 enum Method
 {
-    apriori = 0     /*!< Apriori method */
+    apriori  = 0,   /*!< Apriori method */
+    fpGrowth = 1    /*!< FP-Growth method: "large" itemsets are mined from the prefix tree of the transactions
+                         without generation of candidate itemsets */
 };
 
 /**
@@ -0,0 +1,181 @@
+/* file: classifier_model_selection_batch.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the classifier model selection algorithm in the batch processing mode.
+//--
+*/
+
+#ifndef __CLASSIFIER_MODEL_SELECTION_BATCH_H__
+#define __CLASSIFIER_MODEL_SELECTION_BATCH_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/classifier/classifier_model_selection_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+namespace model_selection
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__MODEL_SELECTION__BATCHCONTAINER"></a>
+ * \brief Provides methods to run implementations of the classifier model selection algorithm.
+ *        It is associated with the daal::algorithms::classifier::model_selection::Batch class
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the model selection, double or float
+ * \tparam method           Computation method of the model selection, \ref daal::algorithms::classifier::model_selection::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT BatchContainer : public daal::algorithms::AnalysisContainerIface<batch>
+{
+public:
+    BatchContainer(daal::services::Environment::env *daalEnv);
+    virtual ~BatchContainer();
+    /**
+     * Runs an implementation of the classifier model selection algorithm in the batch processing mode
+     */
+    virtual void compute();
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__MODEL_SELECTION__BATCH"></a>
+ * \brief Compares the configurations of the parameters of a classification algorithm with k-fold cross-validation.
+ *        Every configuration is given by a training algorithm with its parameters set and the prediction algorithm
+ *        that uses the trained models. The models of all configurations and folds are trained concurrently,
+ *        and the data of every fold is prepared once and shared by all configurations
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations of the model selection, double or float
+ * \tparam method           Computation method of the model selection, \ref daal::algorithms::classifier::model_selection::Method
+ *
+ * \par Enumerations
+ *      - \ref Method   Computation methods of the model selection
+ *      - \ref InputId  Identifiers of input objects of the model selection
+ *      - \ref ResultId Identifiers of results of the model selection
+ *
+ * \par References
+ *      - Input class
+ *      - Parameter class
+ *      - Result class
+ */
+template<typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
+{
+public:
+    Input input;            /*!< %Input data structure */
+    Parameter parameter;    /*!< Parameters of the model selection */
+
+    /**
+     * Constructs the model selection algorithm
+     * \param[in] nClasses  Number of classes
+     * \param[in] nFolds    Number of folds of the cross-validation
+     */
+    Batch(size_t nClasses = 2, size_t nFolds = 5) : parameter(nClasses, nFolds)
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs the model selection algorithm by copying input objects and parameters
+     * of another model selection algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Batch(const Batch<algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data,   other.input.get(data));
+        input.set(labels, other.input.get(labels));
+        parameter = other.parameter;
+    }
+
+    virtual ~Batch() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the model selection
+     * \return Structure that contains computed results of the model selection
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the model selection
+     * \param[in] result Structure to store results of the model selection
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns a pointer to the newly allocated model selection algorithm
+     * with a copy of input objects and parameters of this model selection algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Batch<algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Batch<algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Batch<algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Batch<algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(&input, &parameter, method);
+        _res = _result.get();
+    }
+
+    void initialize()
+    {
+        Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+    }
+
+    services::SharedPtr<Result> _result;
+};
+} // namespace interface1
+using interface1::BatchContainer;
+using interface1::Batch;
+
+} // namespace daal::algorithms::classifier::model_selection
+} // namespace daal::algorithms::classifier
+} // namespace daal::algorithms
+} // namespace daal
+#endif
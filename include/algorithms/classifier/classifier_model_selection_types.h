@@ -0,0 +1,301 @@
+/* file: classifier_model_selection_types.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Definition of common types of the classifier model selection algorithm.
+//--
+*/
+
+#ifndef __CLASSIFIER_MODEL_SELECTION_TYPES_H__
+#define __CLASSIFIER_MODEL_SELECTION_TYPES_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
+#include "services/daal_defines.h"
+#include "algorithms/classifier/classifier_model.h"
+#include "algorithms/classifier/classifier_training_batch.h"
+#include "algorithms/classifier/classifier_predict.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace classifier
+{
+/**
+ * \brief Contains classes to select the parameters of the classification algorithms with cross-validation
+ */
+namespace model_selection
+{
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__MODEL_SELECTION__METHOD"></a>
+ * Available methods of the classifier model selection algorithm
+ */
+enum Method
+{
+    defaultDense = 0    /*!< Default: k-fold cross-validation */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__MODEL_SELECTION__INPUTID"></a>
+ * Available identifiers of input objects of the classifier model selection algorithm
+ */
+enum InputId
+{
+    data   = 0,         /*!< %Input data table */
+    labels = 1          /*!< Labels of the input data */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__CLASSIFIER__MODEL_SELECTION__RESULTID"></a>
+ * Available identifiers of results of the classifier model selection algorithm
+ */
+enum ResultId
+{
+    qualityMetrics = 0, /*!< Collection of the results of the confusion matrix algorithm, one for every configuration */
+    errorRates     = 1  /*!< Table of the error rates of every configuration (rows) on every validation fold (columns) */
+};
+
+/**
+ * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
+ */
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__MODEL_SELECTION__PARAMETER"></a>
+ * \brief Parameters of the classifier model selection algorithm
+ *
+ * \snippet classifier/classifier_model_selection_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public daal::algorithms::classifier::Parameter
+{
+    Parameter(size_t nClasses = 2, size_t nFolds = 5) :
+        daal::algorithms::classifier::Parameter(nClasses), nFolds(nFolds), training(), prediction() {}
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    void check() const DAAL_C11_OVERRIDE
+    {
+        if (nClasses < 2 || nFolds < 2 || training.size() == 0)
+        {
+            this->_errors->add(services::ErrorIncorrectParameter); return;
+        }
+        if (prediction.size() != 1 && prediction.size() != training.size())
+        {
+            this->_errors->add(services::ErrorIncorrectParameter); return;
+        }
+        for (size_t i = 0; i < training.size(); i++)
+        {
+            if (!training[i]) { this->_errors->add(services::ErrorNullParameterNotSupported); return; }
+        }
+        for (size_t i = 0; i < prediction.size(); i++)
+        {
+            if (!prediction[i]) { this->_errors->add(services::ErrorNullParameterNotSupported); return; }
+        }
+    }
+
+    size_t nFolds;      /*!< Number of folds of the cross-validation. Observation i belongs to the validation fold i mod nFolds */
+    services::Collection<services::SharedPtr<classifier::training::Batch> >   training;
+                        /*!< Training algorithms, one for every compared configuration of the parameters */
+    services::Collection<services::SharedPtr<classifier::prediction::Batch> > prediction;
+                        /*!< Prediction algorithms, one for every configuration, or a single one used with all of them */
+};
+/* [Parameter source code] */
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__MODEL_SELECTION__INPUT"></a>
+ * \brief %Input objects of the classifier model selection algorithm
+ */
+class Input : public daal::algorithms::Input
+{
+public:
+    Input() : daal::algorithms::Input(2) {}
+
+    virtual ~Input() {}
+
+    /**
+     * Returns the input object of the classifier model selection algorithm
+     * \param[in] id    Identifier of the input object
+     * \return          %Input object that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(InputId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets the input object of the classifier model selection algorithm
+     * \param[in] id    Identifier of the input object
+     * \param[in] ptr   Pointer to the input object
+     */
+    void set(InputId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Checks the correctness of the input objects
+     * \param[in] par     Pointer to the parameters of the algorithm
+     * \param[in] method  Computation method of the algorithm
+     */
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::NumericTable> dataTable   = get(data);
+        services::SharedPtr<data_management::NumericTable> labelsTable = get(labels);
+        if (!dataTable || !labelsTable) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+
+        size_t nRows = dataTable->getNumberOfRows();
+        if (dataTable->getNumberOfColumns() == 0 || nRows == 0)
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return;
+        }
+        if (labelsTable->getNumberOfColumns() != 1 || labelsTable->getNumberOfRows() != nRows)
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return;
+        }
+
+        const Parameter *parameter = static_cast<const Parameter *>(par);
+        if (parameter == 0) { this->_errors->add(services::ErrorNullParameterNotSupported); return; }
+        if (parameter->nFolds > nRows) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__CLASSIFIER__MODEL_SELECTION__RESULT"></a>
+ * \brief Provides methods to access the results obtained with the compute() method
+ *        of the classifier model selection algorithm
+ */
+class Result : public daal::algorithms::Result
+{
+public:
+    Result() : daal::algorithms::Result(2) {}
+
+    virtual ~Result() {}
+
+    /**
+     * Allocates memory to store the results of the classifier model selection algorithm
+     * \param[in] input     %Input objects of the algorithm
+     * \param[in] parameter Parameters of the algorithm
+     * \param[in] method    Computation method of the algorithm
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const Parameter *par = static_cast<const Parameter *>(parameter);
+        size_t nConfigurations = par->training.size();
+
+        Argument::set(qualityMetrics, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::DataCollection(nConfigurations)));
+        Argument::set(errorRates, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(par->nFolds, nConfigurations,
+                                                                                    data_management::NumericTable::doAllocate)));
+    }
+
+    /**
+     * Returns the collection of the quality metrics of the configurations.
+     * Element i of the collection is binary_confusion_matrix::Result for two classes
+     * and multiclass_confusion_matrix::Result otherwise, computed on the predictions of
+     * configuration i for every observation made by the model trained without its fold
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::DataCollection> get(ResultId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Returns the table of the error rates of the configurations on the validation folds
+     * \param[in] id    Identifier of the result
+     * \return          Result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> getTable(ResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets the result of the classifier model selection algorithm
+     * \param[in] id    Identifier of the result
+     * \param[in] ptr   Pointer to the result
+     */
+    void set(ResultId id, const services::SharedPtr<data_management::SerializationIface> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] in     Pointer to the input objects
+     * \param[in] par    Pointer to the parameters of the algorithm
+     * \param[in] method Computation method of the algorithm
+     */
+    void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        const Parameter *parameter = static_cast<const Parameter *>(par);
+        size_t nConfigurations = parameter->training.size();
+
+        services::SharedPtr<data_management::DataCollection> metricsCollection = get(qualityMetrics);
+        if (!metricsCollection) { this->_errors->add(services::ErrorNullOutputNumericTable); return; }
+        if (metricsCollection->size() != nConfigurations) { this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable); return; }
+
+        services::SharedPtr<data_management::NumericTable> errorRatesTable = getTable(errorRates);
+        if (!errorRatesTable) { this->_errors->add(services::ErrorNullOutputNumericTable); return; }
+        if (errorRatesTable->getNumberOfRows() != nConfigurations || errorRatesTable->getNumberOfColumns() != parameter->nFolds)
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable); return;
+        }
+    }
+
+    int getSerializationTag() { return SERIALIZATION_CLASSIFIER_MODEL_SELECTION_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+};
+} // namespace interface1
+using interface1::Parameter;
+using interface1::Input;
+using interface1::Result;
+
+} // namespace daal::algorithms::classifier::model_selection
+} // namespace daal::algorithms::classifier
+} // namespace daal::algorithms
+} // namespace daal
+#endif
@@ -34,6 +34,18 @@ namespace algorithms
 namespace implicit_als
 {
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__NORMAL_EQUATIONS_SOLVER"></a>
+ * Available methods to solve the systems of normal equations for the factors of the users and items
+ */
+enum NormalEquationsSolver
+{
+    choleskySolver          = 0,    /*!< Default: Cholesky decomposition of the matrix of every system */
+    conjugateGradientSolver = 1     /*!< Fixed number of conjugate gradient iterations started from the current factors.
+                                         The matrix of a system is never formed, so the cost per row is linear
+                                         in the number of factors and in the number of ratings of the row */
+};
+
 /**
  * \brief Contains version 1.0 of the Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface
  */
@@ -51,7 +63,7 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     Parameter(size_t nFactors = 10, size_t maxIterations = 5, double alpha = 40.0, double lambda = 0.01,
               double preferenceThreshold = 0.0, size_t seed = 777777) :
         nFactors(nFactors), maxIterations(maxIterations), alpha(alpha), lambda(lambda),
-        preferenceThreshold(preferenceThreshold)
+        preferenceThreshold(preferenceThreshold), solver(choleskySolver), nCGIterations(3)
     {}
 
     size_t nFactors;            /*!< Number of factors */
@@ -59,6 +71,8 @@ struct DAAL_EXPORT Parameter : public daal::algorithms::Parameter
     double alpha;               /*!< Confidence parameter of the implicit ALS training algorithm */
     double lambda;              /*!< Regularization parameter */
     double preferenceThreshold; /*!< Threshold used to define preference values */
+    NormalEquationsSolver solver; /*!< Method used to solve the systems of normal equations */
+    size_t nCGIterations;       /*!< Number of iterations of the conjugate gradient solver per row */
 };
 /* [Parameter source code] */
 
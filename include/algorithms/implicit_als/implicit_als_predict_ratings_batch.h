@@ -68,7 +68,7 @@ public:
  *
  * \par References
  *      - <a href="DAAL-REF-IMPLICIT_ALS-ALGORITHM">Implicit ALS algorithm description and usage models</a>
- *      - \ref implicit_als::interface1::Parameter "implicit_als::Parameter" class
+ *      - \ref interface1::Parameter "Parameter" class
  *      - \ref Input class
  *      - \ref Result class
  */
@@ -97,6 +97,7 @@ public:
     {
         initialize();
         input.set(model, other.input.get(model));
+        input.set(ratedItems, other.input.get(ratedItems));
         parameter = other.parameter;
     }
 
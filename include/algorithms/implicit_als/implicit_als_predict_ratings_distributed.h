@@ -85,7 +85,7 @@ public:
  *
  * \par References
  *      - <a href="DAAL-REF-IMPLICIT_ALS-ALGORITHM">Implicit ALS algorithm description and usage models</a>
- *      - \ref implicit_als::interface1::Parameter "implicit_als::Parameter" class
+ *      - \ref interface1::Parameter "Parameter" class
  *      - \ref Distributed class
  */
 template<ComputeStep step, typename algorithmFPType = double, Method method = defaultDense>
@@ -103,7 +103,7 @@ class Distributed : public daal::algorithms::DistributedPrediction {};
  *
  * \par References
  *      - <a href="DAAL-REF-IMPLICIT_ALS-ALGORITHM">Implicit ALS algorithm description and usage models</a>
- *      - \ref implicit_als::interface1::Parameter "implicit_als::Parameter" class
+ *      - \ref interface1::Parameter "Parameter" class
  *      - \ref DistributedInput<step1Local> class
  *      - \ref PartialResult class
  *      - \ref Result class
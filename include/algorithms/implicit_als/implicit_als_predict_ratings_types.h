@@ -53,7 +53,9 @@ namespace ratings
 enum Method
 {
     defaultDense = 0,       /*!< Default: predicts ratings based on the ALS model and input data in the dense format */
-    allUsersAllItems = 0    /*!< Predicts ratings for all users and items based on the ALS model and input data in the dense format */
+    allUsersAllItems = 0,   /*!< Predicts ratings for all users and items based on the ALS model and input data in the dense format */
+    topNItems = 1           /*!< Predicts the ratings of the items with the highest ratings for every user
+                                 without computing the full matrix of ratings */
 };
 
 /**
@@ -66,6 +68,18 @@ enum ModelInputId
     model = 0           /*!< %Input model trained by the ALS algorithm */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__NUMERICTABLEINPUTID"></a>
+ * Available identifiers of input numeric tables for the rating prediction stage
+ * of the implicit ALS algorithm
+ */
+enum NumericTableInputId
+{
+    ratedItems = 1      /*!< Optional %input numeric table in the CSR format with the known ratings of the users.
+                             Items rated by a user are excluded from the items predicted by the topNItems method.
+                             Column indices in every row must be in ascending order */
+};
+
 /**
  * <a name="DAAL-ENUM-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__PARTIALMODELINPUTID"></a>
  * Available identifiers of input PartialModel objects for the rating prediction stage
@@ -95,7 +109,10 @@ enum PartialResultId
  */
 enum ResultId
 {
-    prediction = 0        /*!< Numeric table with the predicted ratings */
+    prediction = 0,       /*!< Numeric table with the predicted ratings. For the topNItems method, the ratings
+                               of the predicted items for every user in descending order */
+    itemsIndices = 1      /*!< Numeric table of integers with the indices of the items predicted by the topNItems method.
+                               If a user has less than nTopItems unrated items, the remaining indices are -1 */
 };
 
 /**
@@ -104,6 +121,33 @@ enum ResultId
 namespace interface1
 {
 
+/**
+ * <a name="DAAL-STRUCT-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__PARAMETER"></a>
+ * \brief Parameters for the rating prediction stage of the implicit ALS algorithm
+ *
+ * \snippet implicit_als/implicit_als_predict_ratings_types.h Parameter source code
+ */
+/* [Parameter source code] */
+struct DAAL_EXPORT Parameter : public implicit_als::Parameter
+{
+    Parameter(size_t nFactors = 10, size_t nTopItems = 10) :
+        implicit_als::Parameter(nFactors), nTopItems(nTopItems)
+    {}
+
+    /**
+     * Constructs the parameters of the rating prediction stage from the parameters of the training stage
+     * \param[in] parameter    Parameters of the implicit ALS training algorithm
+     * \param[in] nTopItems    Number of the items predicted for every user by the topNItems method
+     */
+    Parameter(const implicit_als::Parameter &parameter, size_t nTopItems = 10) :
+        implicit_als::Parameter(parameter), nTopItems(nTopItems)
+    {}
+
+    size_t nTopItems;           /*!< Number of the items with the highest ratings predicted for every user
+                                     by the topNItems method */
+};
+/* [Parameter source code] */
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__IMPLICIT_ALS__PREDICTION__RATINGS__INPUTIFACE"></a>
  * \brief %Input interface for the rating prediction stage of the implicit ALS algorithm
@@ -134,7 +178,7 @@ public:
 class Input : public InputIface
 {
 public:
-    Input() : InputIface(1) {}
+    Input() : InputIface(2) {}
     virtual ~Input() {}
 
     /**
@@ -157,6 +201,26 @@ public:
         Argument::set(id, ptr);
     }
 
+    /**
+     * Returns an input numeric table for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input numeric table
+     * \return          Input numeric table that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(NumericTableInputId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets an input numeric table for the rating prediction stage of the implicit ALS algorithm
+     * \param[in] id    Identifier of the input numeric table
+     * \param[in] ptr   Pointer to the input numeric table
+     */
+    void set(NumericTableInputId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
     /**
      * Returns the number of rows in the input numeric table
      * \return Number of rows in the input numeric table
@@ -194,7 +258,7 @@ public:
      */
     void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
     {
-        if (size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInInputCollection); return; }
+        if (size() != 2) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInInputCollection); return; }
 
         if(!parameter) { this->_errors->add(services::ErrorNullParameterNotSupported); return; }
         const Parameter *alsParameter = static_cast<const Parameter *>(parameter);
@@ -213,6 +277,18 @@ public:
         if(!itemsFactors) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
         if(itemsFactors->getNumberOfColumns() != nFactors) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
         if(itemsFactors->getNumberOfRows() < 1) { this->_errors->add(services::ErrorNullInputNumericTable); return; }
+
+        if (method != topNItems) { return; }
+        if (alsParameter->nTopItems < 1) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+
+        services::SharedPtr<data_management::NumericTable> ratedItemsTable = get(ratedItems);
+        if (!ratedItemsTable) { return; }
+        if (ratedItemsTable->getDataLayout() != data_management::NumericTableIface::csrArray)
+        { this->_errors->add(services::ErrorIncorrectTypeOfInputNumericTable); return; }
+        if (ratedItemsTable->getNumberOfRows() != usersFactors->getNumberOfRows())
+        { this->_errors->add(services::ErrorIncorrectNumberOfObservations); return; }
+        if (ratedItemsTable->getNumberOfColumns() != itemsFactors->getNumberOfRows())
+        { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
     }
 };
 
@@ -327,7 +403,7 @@ public:
 class DAAL_EXPORT Result : public daal::algorithms::Result
 {
 public:
-    Result() : daal::algorithms::Result(1)
+    Result() : daal::algorithms::Result(2)
     {}
 
     virtual ~Result()
@@ -367,6 +443,17 @@ public:
 
         size_t nUsers = algInput->getNumberOfUsers();
         size_t nItems = algInput->getNumberOfItems();
+        if (method == topNItems)
+        {
+            size_t nTopItems = getNumberOfTopItems(algParameter, nItems);
+            set(prediction, services::SharedPtr<data_management::NumericTable>(
+                    new data_management::HomogenNumericTable<algorithmFPType>(
+                        nTopItems, nUsers, data_management::NumericTableIface::doAllocate)));
+            set(itemsIndices, services::SharedPtr<data_management::NumericTable>(
+                    new data_management::HomogenNumericTable<int>(
+                        nTopItems, nUsers, data_management::NumericTableIface::doAllocate)));
+            return;
+        }
         set(prediction, services::SharedPtr<data_management::NumericTable>(
                 new data_management::HomogenNumericTable<algorithmFPType>(
                     nItems, nUsers, data_management::NumericTableIface::doAllocate)));
@@ -380,18 +467,30 @@ public:
      */
     void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
     {
-        if (size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInResultCollection); return; }
+        if (size() != 2) { this->_errors->add(services::ErrorIncorrectNumberOfElementsInResultCollection); return; }
         const InputIface *algInput = static_cast<const InputIface *>(input);
 
         size_t nUsers = algInput->getNumberOfUsers();
         size_t nItems = algInput->getNumberOfItems();
+        size_t nColumns = nItems;
+        if (method == topNItems)
+        {
+            nColumns = getNumberOfTopItems(static_cast<const Parameter *>(parameter), nItems);
+
+            services::SharedPtr<data_management::NumericTable> indicesTable = get(itemsIndices);
+            if (!indicesTable) { this->_errors->add(services::ErrorNullOutputNumericTable); return; }
+            if (indicesTable->getNumberOfRows() != nUsers)
+            { this->_errors->add(services::ErrorIncorrectNumberOfRowsInOutputNumericTable); return; }
+            if (indicesTable->getNumberOfColumns() != nColumns)
+            { this->_errors->add(services::ErrorIncorrectNumberOfColumnsInOutputNumericTable); return; }
+        }
 
         services::SharedPtr<data_management::NumericTable> ratingsTable = get(prediction);
         if (!ratingsTable) { this->_errors->add(services::ErrorNullOutputNumericTable); return; }
 
         if (ratingsTable->getNumberOfRows() != nUsers)
         { this->_errors->add(services::ErrorIncorrectNumberOfRowsInOutputNumericTable); return; }
-        if (ratingsTable->getNumberOfColumns() != nItems)
+        if (ratingsTable->getNumberOfColumns() != nColumns)
         { this->_errors->add(services::ErrorIncorrectNumberOfColumnsInOutputNumericTable); return; }
     }
 
@@ -422,6 +521,12 @@ protected:
     {
         daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
+
+    /** \private */
+    static size_t getNumberOfTopItems(const Parameter *parameter, size_t nItems)
+    {
+        return (parameter->nTopItems < nItems ? parameter->nTopItems : nItems);
+    }
 };
 
 /**
@@ -513,6 +618,7 @@ protected:
 };
 
 } // interface1
+using interface1::Parameter;
 using interface1::InputIface;
 using interface1::Input;
 using interface1::DistributedInput;
@@ -30,6 +30,7 @@
 #include "services/daal_defines.h"
 #include "algorithms/neural_networks/layers/layer.h"
 #include "algorithms/neural_networks/layers/layer_types.h"
+#include "algorithms/neural_networks/neural_networks_types.h"
 
 namespace daal
 {
@@ -46,6 +47,18 @@ namespace neural_networks
 {
 namespace prediction
 {
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__NEURAL_NETWORKS__PREDICTION__LAYERACTIVATION"></a>
+ * \brief Elementwise activation functions that can be fused into the forward layer that produces their input
+ */
+enum LayerActivation
+{
+    noActivation       = 0,  /*!< No activation function is applied to the value of the layer */
+    reluActivation     = 1,  /*!< Rectified linear function f(x) = max(0, x) */
+    tanhActivation     = 2,  /*!< Hyperbolic tangent function */
+    logisticActivation = 3   /*!< Logistic function f(x) = 1 / (1 + exp(-x)) */
+};
+
 namespace interface1
 {
 
@@ -54,26 +67,53 @@ namespace interface1
  *  \brief Class representing the parameters of neural network prediction
  */
 class Parameter : public daal::algorithms::Parameter
-{};
+{
+public:
+    /**
+     * Constructs the parameters of neural network prediction
+     * \param[in] batchSize_              Number of samples processed by the neural network in one forward pass
+     * \param[in] reuseActivationMemory_  Flag that specifies whether the values of the layers share memory buffers
+     */
+    Parameter(size_t batchSize_ = 1, bool reuseActivationMemory_ = false) :
+        batchSize(batchSize_), reuseActivationMemory(reuseActivationMemory_) {};
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    void check() const DAAL_C11_OVERRIDE
+    {
+        if(batchSize == 0) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
+
+    size_t batchSize; /*!< Number of samples processed by the neural network in one forward pass.
+                           The layers are computed on blocks of batchSize contiguous samples of the input data */
+    bool reuseActivationMemory; /*!< Flag that specifies whether the values of the layers share memory buffers.
+                                     If the flag is set, the values of the layers that are not used at the same time
+                                     are placed into the same buffer and the elementwise layers are computed in place,
+                                     so the values of the intermediate layers are overwritten during the prediction */
+};
 
 /**
 * <a name="DAAL-CLASS-ALGORITHMS__NEURAL_NETWORKS__PREDICTION__MODEL"></a>
 * \brief Class Model object for the prediction stage of neural network algorithm
 */
-class Model : public daal::algorithms::Model
+class DAAL_EXPORT Model : public daal::algorithms::Model
 {
 public:
     /** \brief Default constructor */
     Model() : _forwardLayers(new neural_networks::ForwardLayers),
-        _nextLayers(new services::Collection<layers::NextLayers>) {};
+        _nextLayers(new services::Collection<layers::NextLayers>),
+        _fusedActivations(new services::Collection<LayerActivation>), _isOptimized(false) {};
 
     /** \brief Constructor */
     Model(const services::SharedPtr<neural_networks::ForwardLayers> &forwardLayers,
           const services::SharedPtr<services::Collection<layers::NextLayers> > &nextLayers) :
-        _forwardLayers(forwardLayers), _nextLayers(nextLayers) {};
+        _forwardLayers(forwardLayers), _nextLayers(nextLayers), _fusedActivations(new services::Collection<LayerActivation>),
+        _isOptimized(false) {};
 
     /** \brief Copy constructor */
-    Model(const Model &model) : _forwardLayers(model.getLayers()), _nextLayers(model.getNextLayers()) {};
+    Model(const Model &model) : _forwardLayers(model.getLayers()), _nextLayers(model.getNextLayers()),
+        _fusedActivations(model.getFusedActivations()), _isOptimized(model.isOptimized()) {};
 
     /** \brief Destructor */
     virtual ~Model() {};
@@ -160,6 +200,37 @@ public:
         return _parameters;
     }
 
+    /**
+     * Returns the activation functions fused into the layers of the network by optimize()
+     * \return Collection of activation functions applied to the value of the layer with corresponding index.
+     *         The collection is empty if the model is not optimized
+     */
+    const services::SharedPtr<services::Collection<LayerActivation> > getFusedActivations() const
+    {
+        return _fusedActivations;
+    }
+
+    /**
+     * Optimizes the network for the prediction. The method
+     *  - removes the dropout layers, which are the identity at the prediction stage,
+     *  - folds the batch normalization layers into the weights and biases of the preceding fully-connected
+     *    or 2D convolution layers using the population mean and variance from the input of the batch normalization layer,
+     *  - fuses the relu, tanh and logistic layers into the layers that produce their input.
+     * The layers that are changed are replaced with their copies, so the layers shared with the training model stay intact.
+     * The last layer of the network is not removed.
+     * The prediction algorithm calls the method before its first computation with the model; repeated calls do nothing
+     */
+    void optimize();
+
+    /**
+     * Returns true if the network is optimized for the prediction by optimize()
+     * \return true if the network is optimized
+     */
+    bool isOptimized() const
+    {
+        return _isOptimized;
+    }
+
     /**
      * Returns the serialization tag of the neural network model
      * \return         Serialization tag of the neural network model
@@ -193,9 +264,11 @@ protected:
 private:
     services::SharedPtr<neural_networks::ForwardLayers> _forwardLayers; /*!< List of forward layers of the network */
     services::SharedPtr<services::Collection<layers::NextLayers> > _nextLayers; /*!< List of edges connecting the layers in the network */
+    services::SharedPtr<services::Collection<LayerActivation> > _fusedActivations; /*!< Activation functions fused into the layers of the network */
     services::SharedPtr<services::Collection<services::SharedPtr<layers::Parameter> > > _parameters; /*!< List of parameters of the layers */
 
     services::SharedPtr<data_management::NumericTable> _weightsAndBiases; /*!< Weights and biases of all the layers in the network */
+    bool _isOptimized; /*!< True if the network is optimized for the prediction */
 };
 } // namespace interface1
 using interface1::Model;
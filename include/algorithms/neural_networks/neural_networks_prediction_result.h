@@ -47,7 +47,12 @@ namespace prediction
  */
 enum ResultId
 {
-    prediction = 0       /*!< Prediction results */
+    prediction       = 0, /*!< Prediction results */
+    activationMemory = 1  /*!< Tensor of size 2 with the memory in bytes used for the values of the layers
+                               and the memory needed for these values without buffer reuse.
+                               The values are stored as double regardless of the algorithm floating-point type,
+                               so the byte counts are exact.
+                               The tensor is optional and is allocated only if reuseActivationMemory is set */
 };
 
 /**
@@ -72,6 +77,7 @@ public:
     services::SharedPtr<data_management::Tensor> get(const ResultId &id) const
     {
         using namespace data_management;
+        if((size_t)id >= Argument::size()) { return services::SharedPtr<data_management::Tensor>(); }
         return services::staticPointerCast<data_management::Tensor, SerializationIface>(Argument::get(id));
     }
 
@@ -82,6 +88,7 @@ public:
      */
     void set(const ResultId &id, const services::SharedPtr<data_management::Tensor> &value)
     {
+        while(Argument::size() <= (size_t)id) { *this << services::SharedPtr<data_management::SerializationIface>(); }
         Argument::set(id, value);
     }
 
@@ -103,6 +110,14 @@ public:
 
         set(prediction::prediction, services::SharedPtr<data_management::Tensor>(
                 new data_management::HomogenTensor<algorithmFPType>(resultDimensions, data_management::Tensor::doAllocate)));
+
+        const Parameter *par = static_cast<const Parameter *>(parameter);
+        if(!par || !par->reuseActivationMemory) { return; }
+
+        services::Collection<size_t> activationMemoryDimensions(1);
+        activationMemoryDimensions[0] = 2;
+        set(prediction::activationMemory, services::SharedPtr<data_management::Tensor>(
+                new data_management::HomogenTensor<double>(activationMemoryDimensions, data_management::Tensor::doAllocate)));
     }
 
     /**
@@ -113,10 +128,17 @@ public:
      */
     void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
     {
-        if(Argument::size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
+        if(Argument::size() != 1 && Argument::size() != 2) { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
 
         services::SharedPtr<data_management::Tensor> predictionObject = get(neural_networks::prediction::prediction);
         if(predictionObject.get() == NULL) { this->_errors->add(services::ErrorNullOutputNumericTable); return; }
+
+        /* The footprint of the activations is optional */
+        services::SharedPtr<data_management::Tensor> activationMemoryObject = get(neural_networks::prediction::activationMemory);
+        if(activationMemoryObject && activationMemoryObject->getSize() < 2)
+        {
+            this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable); return;
+        }
     }
 
     /**
@@ -79,8 +79,18 @@ public:
                   services::SharedPtr<optimization_solver::mse::Batch<modelFPType> >(new optimization_solver::mse::Batch<modelFPType>(1))) :
         batchSize(batchSize_), nIterations(nIterations_), optimizationSolver(optimizationSolver_), objectiveFunction(objectiveFunction_) {};
 
-    size_t batchSize; /*!< Size of the batch to be processed by the neural network. */
-    size_t nIterations; /*!< Maximal number of iterations of the algorithm. */
+    /**
+     * Checks the correctness of the parameter
+     */
+    void check() const DAAL_C11_OVERRIDE
+    {
+        if(batchSize == 0) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
+
+    size_t batchSize; /*!< Size of the batch to be processed by the neural network. The samples of the batch are split
+                           between the threads, each thread runs its own copy of the layers, and the weights and biases
+                           are updated once per batch with the derivatives averaged over the batch */
+    size_t nIterations; /*!< Maximal number of iterations of the algorithm. One batch of samples is processed on each iteration */
 
     services::SharedPtr<optimization_solver::sgd::Batch<modelFPType> > optimizationSolver; /*!< Optimization solver used in the neural network*/
     services::SharedPtr<optimization_solver::mse::Batch<modelFPType> > objectiveFunction; /*!< Objective function used in the neural network. */
@@ -148,7 +148,7 @@ protected:
 
     virtual void allocateResult() DAAL_C11_OVERRIDE
     {
-        _result->allocate<algorithmFPType>(&input, method);
+        _result->allocate<algorithmFPType>(&input, &parameter, method);
         _res = _result.get();
     }
 
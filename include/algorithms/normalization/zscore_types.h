@@ -78,27 +78,52 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__ZSCORE__BASEPARAMETER"></a>
+ * \brief Class that specifies the parameters common for all methods of the z-score normalization
+ */
+class BaseParameter : public daal::algorithms::Parameter
+{
+public:
+    /**
+     * Constructs z-score normalization parameters
+     * \param[in] doInPlace  Flag that enables in-place normalization
+     */
+    BaseParameter(bool doInPlace = false) : doInPlace(doInPlace) {}
+
+    bool doInPlace; /*!< If true, the input data table is normalized in place and
+                         returned as the normalizedData result instead of allocating a new table */
+};
+
 /**
 * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__ZSCORE__PARAMETER"></a>
 * \brief Class that specifies the parameters of the algorithm in the batch computing mode
 */
 template<typename algorithmFPType, Method method>
-class Parameter : public daal::algorithms::Parameter {};
+class Parameter : public BaseParameter {};
 
 // /**
 //  * <a name="DAAL-CLASS-ALGORITHMS__NORMALIZATION__ZSCORE__PARAMETER"></a>
 //  * \brief Class that specifies the parameters of the default algorithm in the batch computing mode
 //  */
 template<typename algorithmFPType>
-class Parameter<algorithmFPType, defaultDense> : public daal::algorithms::Parameter
+class Parameter<algorithmFPType, defaultDense> : public BaseParameter
 {
 public:
-    /** Constructs z-score normalization parameters */
+    /**
+     * Constructs z-score normalization parameters
+     * \param[in] moments    Pointer to the algorithm that computes the low order moments.
+     *                       By default, the low order moments algorithm with the default dense method is used
+     * \param[in] doInPlace  Flag that enables in-place normalization
+     */
     Parameter(const services::SharedPtr<low_order_moments::BatchIface> &moments =
                   services::SharedPtr<low_order_moments::Batch<algorithmFPType, low_order_moments::defaultDense> >
-              (new low_order_moments::Batch<algorithmFPType, low_order_moments::defaultDense>())) : moments(moments) {};
+              (new low_order_moments::Batch<algorithmFPType, low_order_moments::defaultDense>()),
+              bool doInPlace = false) : BaseParameter(doInPlace), moments(moments) {};
 
-    services::SharedPtr<low_order_moments::BatchIface> moments; /*!< Pointer to the algorithm that computes the low order moments */
+    services::SharedPtr<low_order_moments::BatchIface> moments; /*!< Pointer to the algorithm that computes the low order moments.
+                                                                     If it is set to an empty pointer, means and variances
+                                                                     of the input data are computed by the built-in threaded kernel */
 };
 
 /**
@@ -180,6 +205,27 @@ public:
                                                                                     data_management::NumericTable::doAllocate)));
     }
 
+    /**
+     * Allocates memory to store final results of the z-score normalization algorithms.
+     * If in-place normalization is requested, the input data table is used as the result
+     * \param[in] input     Input objects for the z-score normalization algorithm
+     * \param[in] parameter Parameters of the z-score normalization algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const BaseParameter *par = static_cast<const BaseParameter *>(parameter);
+        if(par && par->doInPlace)
+        {
+            const Input *in = static_cast<const Input *>(input);
+            Argument::set(normalizedData, services::staticPointerCast<data_management::SerializationIface, data_management::NumericTable>(
+                              in->get(data)));
+            return;
+        }
+        allocate<algorithmFPType>(input, method);
+    }
+
     /**
      * Returns the final result of the z-score normalization algorithm
      * \param[in] id   Identifier of the final result, daal::algorithms::normalization::zscore::ResultId
@@ -245,6 +291,7 @@ protected:
     }
 };
 } // namespace interface1
+using interface1::BaseParameter;
 using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
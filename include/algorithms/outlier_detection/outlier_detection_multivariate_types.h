@@ -71,7 +71,10 @@ enum InputId
  */
 enum ResultId
 {
-    weights = 0             /*!< Outlier detection results */
+    weights   = 0,          /*!< Outlier detection results */
+    location  = 1,          /*!< Vector of mean estimates used to compute the results */
+    scatter   = 2,          /*!< Variance-covariance matrix used to compute the results */
+    threshold = 3           /*!< Limit that defines the outlier region used to compute the results */
 };
 
 /**
@@ -100,6 +103,85 @@ struct InitIface
     virtual ~InitIface() {}
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__MULTIVARIATE_OUTLIER_DETECTION__FITTEDINITIALIZATION"></a>
+ * \brief Initialization procedure that sets the location, scatter, and threshold of the outlier region
+ *        to the given values, for example, to the results of the BACON method computed on the reference data.
+ *        Used with the defaultDense method to score new blocks of data against a previously fitted model
+ */
+struct FittedInitialization : public InitIface
+{
+    /**
+     * Constructs the initialization procedure
+     * \param[in] location    Vector of mean estimates of size 1 x p
+     * \param[in] scatter     Variance-covariance matrix of size p x p
+     * \param[in] threshold   Limit that defines the outlier region, the array of size 1 x 1
+     */
+    FittedInitialization(const services::SharedPtr<data_management::NumericTable> &location,
+                         const services::SharedPtr<data_management::NumericTable> &scatter,
+                         const services::SharedPtr<data_management::NumericTable> &threshold) :
+        fittedLocation(location), fittedScatter(scatter), fittedThreshold(threshold) {}
+
+    virtual void operator()(data_management::NumericTable *data,
+                            data_management::NumericTable *location,
+                            data_management::NumericTable *scatter,
+                            data_management::NumericTable *threshold)
+    {
+        if (check(data->getNumberOfColumns()) != services::NoErrorMessageFound) { return; }
+        copyTable(fittedLocation.get(), location);
+        copyTable(fittedScatter.get(), scatter);
+        copyTable(fittedThreshold.get(), threshold);
+    }
+
+    /**
+     * Checks that the fitted values are set and match the number of features of the data
+     * \param[in] nFeatures   Number of features in the data
+     * \return NoErrorMessageFound if the fitted values are correct, otherwise the identifier of the error
+     */
+    services::ErrorID check(size_t nFeatures) const
+    {
+        if (!fittedLocation.get() || !fittedScatter.get() || !fittedThreshold.get())
+        {
+            return services::ErrorNullInputNumericTable;
+        }
+        if (!hasSize(fittedLocation.get(), 1, nFeatures) || !hasSize(fittedScatter.get(), nFeatures, nFeatures) ||
+            !hasSize(fittedThreshold.get(), 1, 1))
+        {
+            return services::ErrorIncorrectSizeOfInputNumericTable;
+        }
+        return services::NoErrorMessageFound;
+    }
+
+    services::SharedPtr<data_management::NumericTable> fittedLocation;  /*!< Vector of mean estimates */
+    services::SharedPtr<data_management::NumericTable> fittedScatter;   /*!< Variance-covariance matrix */
+    services::SharedPtr<data_management::NumericTable> fittedThreshold; /*!< Limit that defines the outlier region */
+
+protected:
+    static bool hasSize(const data_management::NumericTable *table, size_t nRows, size_t nCols)
+    {
+        return table->getNumberOfRows() == nRows && table->getNumberOfColumns() == nCols;
+    }
+
+    static void copyTable(data_management::NumericTable *src, data_management::NumericTable *dst)
+    {
+        size_t nRows = dst->getNumberOfRows();
+        size_t nCols = dst->getNumberOfColumns();
+        if (!src || !hasSize(src, nRows, nCols)) { return; }
+
+        data_management::BlockDescriptor<double> srcBlock, dstBlock;
+        src->getBlockOfRows(0, nRows, data_management::readOnly, srcBlock);
+        dst->getBlockOfRows(0, nRows, data_management::writeOnly, dstBlock);
+        double *srcArray = srcBlock.getBlockPtr();
+        double *dstArray = dstBlock.getBlockPtr();
+        for(size_t i = 0; i < nRows * nCols; i++)
+        {
+            dstArray[i] = srcArray[i];
+        }
+        src->releaseBlockOfRows(srcBlock);
+        dst->releaseBlockOfRows(dstBlock);
+    }
+};
+
 template <Method method>
 struct Parameter : public daal::algorithms::Parameter {};
 
@@ -193,12 +275,14 @@ public:
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__MULTIVARIATE_OUTLIER_DETECTION__RESULT"></a>
- * \brief Results obtained with the compute() method of the multivariate outlier detection algorithm in the %batch processing mode
+ * \brief Results obtained with the compute() method of the multivariate outlier detection algorithm in the %batch processing mode.
+ *        The location, scatter, and threshold are optional: results that contain the weights only,
+ *        such as the results serialized by the previous versions of the library, are accepted
  */
 class Result : public daal::algorithms::Result
 {
 public:
-    Result() : daal::algorithms::Result(1) {}
+    Result() : daal::algorithms::Result(4) {}
 
     virtual ~Result() {};
 
@@ -213,9 +297,16 @@ public:
     void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
     {
         Input *algInput = static_cast<Input *>(const_cast<daal::algorithms::Input *>(input));
-        size_t nVectors = algInput->get(data)->getNumberOfRows();
-        Argument::set(weights, services::SharedPtr<data_management::SerializationIface>(
-                          new data_management::HomogenNumericTable<algorithmFPType>(1, nVectors, data_management::NumericTable::doAllocate)));
+        size_t nVectors  = algInput->get(data)->getNumberOfRows();
+        size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+        set(weights, services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<algorithmFPType>(1, nVectors, data_management::NumericTable::doAllocate)));
+        set(location, services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, 1, data_management::NumericTable::doAllocate)));
+        set(scatter, services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nFeatures, data_management::NumericTable::doAllocate)));
+        set(threshold, services::SharedPtr<data_management::NumericTable>(
+                new data_management::HomogenNumericTable<algorithmFPType>(1, 1, data_management::NumericTable::doAllocate)));
     }
 
     /**
@@ -225,6 +316,7 @@ public:
      */
     services::SharedPtr<data_management::NumericTable> get(ResultId id) const
     {
+        if((size_t)id >= Argument::size()) { return services::SharedPtr<data_management::NumericTable>(); }
         return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
     }
 
@@ -235,6 +327,7 @@ public:
      */
     void set(ResultId id, const services::SharedPtr<data_management::NumericTable> &ptr)
     {
+        while(Argument::size() <= (size_t)id) { *this << services::SharedPtr<data_management::SerializationIface>(); }
         Argument::set(id, ptr);
     }
 
@@ -247,7 +340,7 @@ public:
     void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *par,
                int method) const DAAL_C11_OVERRIDE
     {
-        if(Argument::size() != 1) { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
+        if(Argument::size() != 1 && Argument::size() != 4) { this->_errors->add(services::ErrorIncorrectNumberOfOutputNumericTables); return; }
 
         services::SharedPtr<data_management::NumericTable> resTable = get(weights);
 
@@ -260,6 +353,22 @@ public:
         if(resTable->getNumberOfRows() != algInput->get(data)->getNumberOfRows() ||
            resTable->getNumberOfColumns() != 1)
         { this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable); return; }
+
+        /* Location, scatter and threshold are optional results */
+        size_t nFeatures = algInput->get(data)->getNumberOfColumns();
+        services::SharedPtr<data_management::NumericTable> locationTable  = get(location);
+        services::SharedPtr<data_management::NumericTable> scatterTable   = get(scatter);
+        services::SharedPtr<data_management::NumericTable> thresholdTable = get(threshold);
+
+        if(locationTable.get() &&
+           (locationTable->getNumberOfRows() != 1 || locationTable->getNumberOfColumns() != nFeatures))
+        { this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable); return; }
+        if(scatterTable.get() &&
+           (scatterTable->getNumberOfRows() != nFeatures || scatterTable->getNumberOfColumns() != nFeatures))
+        { this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable); return; }
+        if(thresholdTable.get() &&
+           (thresholdTable->getNumberOfRows() != 1 || thresholdTable->getNumberOfColumns() != 1))
+        { this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable); return; }
     }
 
     int getSerializationTag() { return SERIALIZATION_OUTLIER_DETECTION_MULTIVARIATE_RESULT_ID; }
@@ -288,6 +397,7 @@ protected:
 };
 } // namespace interface1
 using interface1::InitIface;
+using interface1::FittedInitialization;
 using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
@@ -754,7 +754,14 @@ public:
                        services::SharedPtr<covariance::Batch<algorithmFPType, covariance::defaultDense> >
                    (new covariance::Batch<algorithmFPType, covariance::defaultDense>())) : covariance(covariance) {};
 
-    services::SharedPtr<covariance::BatchIface> covariance; /*!< Pointer to batch covariance */
+    /**
+     * Pointer to batch covariance.
+     * If the covariance matrix of its result is not set before the PCA computation, the PCA algorithm allocates
+     * the correlation matrix as a PackedSymmetricMatrix with the lower packed layout and the mean as a 1 x p
+     * HomogenNumericTable, and leaves them in the result of this algorithm after the computation.
+     * To get the correlation matrix in a different layout, set the covariance result before calling compute().
+     */
+    services::SharedPtr<covariance::BatchIface> covariance;
 };
 
 /**
@@ -0,0 +1,404 @@
+/* file: quantiles_distributed.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of the interface of the quantiles algorithm in the distributed processing mode.
+//--
+*/
+
+#ifndef __QUANTILES_DISTRIBUTED_H__
+#define __QUANTILES_DISTRIBUTED_H__
+
+#include "algorithms/algorithm.h"
+#include "data_management/data/numeric_table.h"
+#include "services/daal_defines.h"
+#include "algorithms/quantiles/quantiles_types.h"
+
+namespace daal
+{
+namespace algorithms
+{
+namespace quantiles
+{
+
+namespace interface1
+{
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDCONTAINER"></a>
+ * \brief Provides methods to run implementations of the quantiles algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template<ComputeStep step, typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer
+{};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDCONTAINER_STEP1LOCAL_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Provides methods to run implementations of the first step of the quantiles algorithm
+ *        in the distributed processing mode.
+ *        It is associated with the daal::algorithms::quantiles::Distributed class
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step1Local, algorithmFPType, method, cpu> : public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    virtual ~DistributedContainer();
+    /**
+     * Updates the quantile sketches of the local node with a block of the input data
+     */
+    virtual void compute();
+    /**
+     * Computes the quantiles from the sketches in the distributed processing mode
+     */
+    virtual void finalizeCompute();
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDCONTAINER_STEP2MASTER_ALGORITHMFPTYPE_METHOD_CPU"></a>
+ * \brief Provides methods to run implementations of the second step of the quantiles algorithm
+ *        in the distributed processing mode.
+ *        It is associated with the daal::algorithms::quantiles::Distributed class
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template<typename algorithmFPType, Method method, CpuType cpu>
+class DAAL_EXPORT DistributedContainer<step2Master, algorithmFPType, method, cpu> : public daal::algorithms::AnalysisContainerIface<distributed>
+{
+public:
+    DistributedContainer(daal::services::Environment::env *daalEnv);
+    virtual ~DistributedContainer();
+    /**
+     * Merges the quantile sketches computed on local nodes
+     */
+    virtual void compute();
+    /**
+     * Computes the quantiles from the sketches in the distributed processing mode
+     */
+    virtual void finalizeCompute();
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED"></a>
+ * \brief Computes approximate values of quantiles in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ */
+template<ComputeStep step, typename algorithmFPType = double, Method method = defaultDense>
+class DAAL_EXPORT Distributed : public daal::algorithms::Analysis<distributed> {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED_STEP1LOCAL_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Computes the quantile sketches of the local data in the first step of the quantiles algorithm
+ *        in the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Quantiles computation methods
+ *      - \ref InputId          Identifiers of quantiles input objects
+ *      - \ref MasterInputId    Identifiers of quantiles input objects on the master node
+ *      - \ref PartialResultId  Identifiers of quantiles partial results
+ *      - \ref ResultId         Identifiers of quantiles results
+ *
+ * \par References
+ *      - <a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a>
+ *      - DistributedInput class
+ *      - Parameter class
+ *      - PartialResult class
+ *      - Result class
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step1Local, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step1Local> input;     /*!< %Input data structure */
+    Parameter parameter;                    /*!< Quantiles parameters structure */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs algorithm that computes quantiles by copying input objects and parameters
+     * of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step1Local, algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(data, other.input.get(data));
+        parameter = other.parameter;
+    }
+
+    virtual ~Distributed() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the quantile algorithms
+     * \return Structure that contains computed results of the quantile algorithms
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the quantile algorithms
+     * \param[in] result Structure to store results of the quantile algorithms
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains the quantile sketches of the local node
+     * \return Structure that contains partial results
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store the quantile sketches
+     * \param[in] partialResult    Structure for storing partial results of the quantiles algorithm
+     * \param[in] initFlag         Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult> &partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes quantiles
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step1Local, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step1Local, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step1Local, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step1Local, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step1Local, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+    }
+
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTED_STEP2MASTER_ALGORITHMFPTYPE_METHOD"></a>
+ * \brief Merges the quantile sketches computed on local nodes and computes approximate values of quantiles
+ *        in the second step of the quantiles algorithm in the distributed processing mode
+ *
+ * \tparam algorithmFPType  Data type to use in intermediate computations for the quantile algorithms, double or float
+ * \tparam method           Quantiles computation method, \ref daal::algorithms::quantiles::Method
+ *
+ * \par Enumerations
+ *      - \ref Method           Quantiles computation methods
+ *      - \ref InputId          Identifiers of quantiles input objects
+ *      - \ref MasterInputId    Identifiers of quantiles input objects on the master node
+ *      - \ref PartialResultId  Identifiers of quantiles partial results
+ *      - \ref ResultId         Identifiers of quantiles results
+ *
+ * \par References
+ *      - <a href="DAAL-REF-QUANTILES-ALGORITHM">Quantiles algorithm description and usage models</a>
+ *      - DistributedInput class
+ *      - Parameter class
+ *      - PartialResult class
+ *      - Result class
+ */
+template<typename algorithmFPType, Method method>
+class DAAL_EXPORT Distributed<step2Master, algorithmFPType, method> : public daal::algorithms::Analysis<distributed>
+{
+public:
+    DistributedInput<step2Master> input;    /*!< %Input data structure */
+    Parameter parameter;                    /*!< Quantiles parameters structure */
+
+    /** Default constructor */
+    Distributed()
+    {
+        initialize();
+    }
+
+    /**
+     * Constructs algorithm that computes quantiles by copying input objects and parameters
+     * of another algorithm
+     * \param[in] other An algorithm to be used as the source to initialize the input objects
+     *                  and parameters of the algorithm
+     */
+    Distributed(const Distributed<step2Master, algorithmFPType, method> &other)
+    {
+        initialize();
+        input.set(partialResults, other.input.get(partialResults));
+        parameter = other.parameter;
+    }
+
+    virtual ~Distributed() {}
+
+    /**
+    * Returns method of the algorithm
+    * \return Method of the algorithm
+    */
+    virtual int getMethod() const DAAL_C11_OVERRIDE { return(int)method; }
+
+    /**
+     * Returns the structure that contains computed results of the quantile algorithms
+     * \return Structure that contains computed results of the quantile algorithms
+     */
+    services::SharedPtr<Result> getResult()
+    {
+        return _result;
+    }
+
+    /**
+     * Registers user-allocated memory to store results of the quantile algorithms
+     * \param[in] result Structure to store results of the quantile algorithms
+     */
+    void setResult(const services::SharedPtr<Result> &result)
+    {
+        _result = result;
+        _res = _result.get();
+    }
+
+    /**
+     * Returns the structure that contains the quantile sketches merged on the master node
+     * \return Structure that contains partial results
+     */
+    services::SharedPtr<PartialResult> getPartialResult()
+    {
+        return _partialResult;
+    }
+
+    /**
+     * Registers user-allocated memory to store the quantile sketches
+     * \param[in] partialResult    Structure for storing partial results of the quantiles algorithm
+     * \param[in] initFlag         Flag that specifies whether the partial results are initialized
+     */
+    void setPartialResult(const services::SharedPtr<PartialResult> &partialResult, bool initFlag = false)
+    {
+        _partialResult = partialResult;
+        _pres = _partialResult.get();
+        setInitFlag(initFlag);
+    }
+
+    /**
+     * Returns a pointer to the newly allocated algorithm that computes quantiles
+     * with a copy of input objects and parameters of this algorithm
+     * \return Pointer to the newly allocated algorithm
+     */
+    services::SharedPtr<Distributed<step2Master, algorithmFPType, method> > clone() const
+    {
+        return services::SharedPtr<Distributed<step2Master, algorithmFPType, method> >(cloneImpl());
+    }
+
+protected:
+    virtual Distributed<step2Master, algorithmFPType, method> * cloneImpl() const DAAL_C11_OVERRIDE
+    {
+        return new Distributed<step2Master, algorithmFPType, method>(*this);
+    }
+
+    virtual void allocateResult() DAAL_C11_OVERRIDE
+    {
+        _result->allocate<algorithmFPType>(_pres, &parameter, method);
+        _res = _result.get();
+    }
+
+    virtual void allocatePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->allocate<algorithmFPType>(&input, &parameter, method);
+        _pres = _partialResult.get();
+    }
+
+    virtual void initializePartialResult() DAAL_C11_OVERRIDE
+    {
+        _partialResult->initialize();
+    }
+
+    void initialize()
+    {
+        Analysis<distributed>::_ac = new __DAAL_ALGORITHM_CONTAINER(distributed, DistributedContainer, step2Master, algorithmFPType, method)(&_env);
+        _in  = &input;
+        _par = &parameter;
+        _result = services::SharedPtr<Result>(new Result());
+        _partialResult = services::SharedPtr<PartialResult>(new PartialResult());
+    }
+
+    services::SharedPtr<PartialResult> _partialResult;
+    services::SharedPtr<Result> _result;
+};
+} // namespace interface1
+using interface1::DistributedContainer;
+using interface1::Distributed;
+
+} // namespace daal::algorithms::quantiles
+} // namespace daal::algorithms
+} // namespace daal
+#endif
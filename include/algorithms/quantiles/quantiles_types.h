@@ -24,7 +24,9 @@
 #ifndef __QUANTILES_TYPES_H__
 #define __QUANTILES_TYPES_H__
 
+#include "algorithms/algorithm.h"
 #include "data_management/data/homogen_numeric_table.h"
+#include "data_management/data/data_collection.h"
 
 namespace daal
 {
@@ -62,6 +64,29 @@ enum ResultId
     quantiles = 0       /*!< Values of quantiles */
 };
 
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__PARTIALRESULTID"></a>
+ * Available identifiers of partial results of the quantiles algorithm in the online and distributed processing modes
+ */
+enum PartialResultId
+{
+    nObservations          = 0, /*!< Number of observations processed so far */
+    partialCentroidMeans   = 1, /*!< Means of the centroids of the quantile sketch, one row per feature */
+    partialCentroidWeights = 2, /*!< Weights of the centroids of the quantile sketch, one row per feature */
+    partialNCentroids      = 3, /*!< Number of centroids of the quantile sketch used for each feature */
+    partialMinimum         = 4, /*!< Minimums of the features */
+    partialMaximum         = 5  /*!< Maximums of the features */
+};
+
+/**
+ * <a name="DAAL-ENUM-ALGORITHMS__QUANTILES__MASTERINPUTID"></a>
+ * \brief Available identifiers of input objects for the quantiles algorithm on the master node
+ */
+enum MasterInputId
+{
+    partialResults = 0  /*!< Collection of partial results computed on local nodes */
+};
+
 /**
  * \brief Contains version 1.0 of Intel(R) Data Analytics Acceleration Library (Intel(R) DAAL) interface.
  */
@@ -73,8 +98,9 @@ namespace interface1
  */
 struct Parameter : public daal::algorithms::Parameter
 {
-    Parameter(const services::SharedPtr<data_management::NumericTable> quantileOrders = services::SharedPtr<data_management::NumericTable>())
-        : daal::algorithms::Parameter(), quantileOrders(quantileOrders)
+    Parameter(const services::SharedPtr<data_management::NumericTable> quantileOrders = services::SharedPtr<data_management::NumericTable>(),
+              size_t compression = 100)
+        : daal::algorithms::Parameter(), quantileOrders(quantileOrders), compression(compression)
     {
         if(quantileOrders.get() == NULL)
         {
@@ -83,21 +109,68 @@ struct Parameter : public daal::algorithms::Parameter
         }
     }
 
+    /**
+     * Returns the maximal number of centroids the quantile sketch keeps for one feature
+     * \return Maximal number of centroids per feature
+     */
+    size_t getSketchSize() const
+    {
+        return compression + 2;
+    }
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    void check() const DAAL_C11_OVERRIDE
+    {
+        if(compression < 2) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
+
     services::SharedPtr<data_management::NumericTable> quantileOrders;    /*!< Numeric table with quantile orders. Default value is 0.5 (median) */
+    size_t compression;     /*!< Compression of the quantile sketch used in the online and distributed processing modes.
+                                 The sketch keeps at most compression + 2 centroids per feature, and the rank error
+                                 of the computed quantiles is of order 1 / compression. Default value is 100 */
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUTIFACE"></a>
+ * \brief Abstract class that specifies interface of the input objects for the quantiles algorithm
+ */
+class InputIface : public daal::algorithms::Input
+{
+public:
+    InputIface(size_t nElements) : daal::algorithms::Input(nElements) {}
+    virtual size_t getNumberOfFeatures() const = 0;
+    virtual ~InputIface() {}
 };
 
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__INPUT"></a>
  * \brief %Input objects for the quantiles algorithm
  */
-class Input : public daal::algorithms::Input
+class Input : public InputIface
 {
 public:
-    Input() : daal::algorithms::Input(1)
+    Input() : InputIface(1)
     {}
 
     virtual ~Input() {}
 
+    /**
+     * Returns the number of features in the input data set
+     * \return Number of features in the input data set
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::NumericTable> ntPtr = get(data);
+        if(ntPtr)
+        {
+            return ntPtr->getNumberOfColumns();
+        }
+        this->_errors->add(services::ErrorNullInputNumericTable);
+        return 0;
+    }
+
     /**
      * Returns an input object for the quantiles algorithm
      * \param[in] id    Identifier of the %input object
@@ -141,10 +214,197 @@ public:
     }
 };
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__PARTIALRESULT"></a>
+ * \brief Provides methods to access partial results obtained with the compute() method of the
+ *        quantiles algorithm in the online or distributed processing mode.
+ *        Each feature is summarized by a mergeable sketch of weighted centroids sorted by their means,
+ *        so partial results computed on different data blocks or nodes can be combined
+ */
+class PartialResult : public daal::algorithms::PartialResult
+{
+public:
+    PartialResult() : daal::algorithms::PartialResult(6)
+    {}
+
+    virtual ~PartialResult() {}
+
+    /**
+     * Allocates memory to store partial results of the quantiles algorithm
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        size_t nFeatures  = static_cast<const InputIface *>(input)->getNumberOfFeatures();
+        size_t sketchSize = static_cast<const Parameter *>(parameter)->getSketchSize();
+
+        Argument::set(nObservations, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<size_t>(1, 1, data_management::NumericTable::doAllocate, 0)));
+        Argument::set(partialCentroidMeans, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(sketchSize, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, 0)));
+        Argument::set(partialCentroidWeights, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(sketchSize, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, 0)));
+        Argument::set(partialNCentroids, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<int>(1, nFeatures, data_management::NumericTable::doAllocate, 0)));
+        Argument::set(partialMinimum, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, 0)));
+        Argument::set(partialMaximum, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(1, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate, 0)));
+    }
+
+    /**
+     * Resets the sketches stored in the partial result to the empty state
+     */
+    void initialize()
+    {
+        resetTable(get(nObservations).get());
+        resetTable(get(partialNCentroids).get());
+    }
+
+    /**
+     * Returns the number of features in the partial result of the quantiles algorithm
+     * \return Number of features in the partial result
+     */
+    size_t getNumberOfFeatures() const
+    {
+        services::SharedPtr<data_management::NumericTable> ntPtr = get(partialMinimum);
+        if(ntPtr)
+        {
+            return ntPtr->getNumberOfRows();
+        }
+        this->_errors->add(services::ErrorNullPartialResult);
+        return 0;
+    }
+
+    /**
+     * Returns the partial result of the quantiles algorithm
+     * \param[in] id   Identifier of the partial result, \ref PartialResultId
+     * \return Partial result that corresponds to the given identifier
+     */
+    services::SharedPtr<data_management::NumericTable> get(PartialResultId id) const
+    {
+        return services::staticPointerCast<data_management::NumericTable, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Sets the partial result of the quantiles algorithm
+     * \param[in] id    Identifier of the partial result
+     * \param[in] ptr   Pointer to the partial result
+     */
+    void set(PartialResultId id, const services::SharedPtr<data_management::NumericTable> &ptr)
+    {
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] parameter %Parameter of the algorithm
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        checkImpl(getNumberOfFeatures(), 0);
+    }
+
+    /**
+     * Checks the correctness of the partial result
+     * \param[in] input     Pointer to the structure with input objects
+     * \param[in] parameter Pointer to the structure of algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter,
+               int method) const DAAL_C11_OVERRIDE
+    {
+        size_t nFeatures  = static_cast<const InputIface *>(input)->getNumberOfFeatures();
+        size_t sketchSize = static_cast<const Parameter *>(parameter)->getSketchSize();
+        checkImpl(nFeatures, sketchSize);
+    }
+
+    int getSerializationTag() { return SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
+
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::PartialResult::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    /**
+     * Checks the sizes of the partial result tables
+     * \param[in] nFeatures  Expected number of features
+     * \param[in] sketchSize Expected number of centroids per feature, 0 if any size is accepted
+     */
+    void checkImpl(size_t nFeatures, size_t sketchSize) const
+    {
+        if(nFeatures == 0) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+
+        services::SharedPtr<data_management::NumericTable> nObsTable = get(nObservations);
+        if(!nObsTable) { this->_errors->add(services::ErrorNullPartialResult); return; }
+        if(nObsTable->getNumberOfRows() != 1 || nObsTable->getNumberOfColumns() != 1)
+        { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+
+        services::SharedPtr<data_management::NumericTable> meansTable   = get(partialCentroidMeans);
+        services::SharedPtr<data_management::NumericTable> weightsTable = get(partialCentroidWeights);
+        if(!meansTable || !weightsTable) { this->_errors->add(services::ErrorNullPartialResult); return; }
+        if(meansTable->getNumberOfRows() != nFeatures || weightsTable->getNumberOfRows() != nFeatures ||
+           meansTable->getNumberOfColumns() != weightsTable->getNumberOfColumns() || meansTable->getNumberOfColumns() == 0)
+        { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+        if(sketchSize != 0 && meansTable->getNumberOfColumns() != sketchSize)
+        { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+
+        for(size_t i = partialNCentroids; i <= partialMaximum; i++)
+        {
+            services::SharedPtr<data_management::NumericTable> presTable = get((PartialResultId)i);
+            if(!presTable) { this->_errors->add(services::ErrorNullPartialResult); return; }
+            if(presTable->getNumberOfRows() != nFeatures || presTable->getNumberOfColumns() != 1)
+            { this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable); return; }
+        }
+    }
+
+    /** \private */
+    static void resetTable(data_management::NumericTable *table)
+    {
+        if(!table) { return; }
+        size_t nRows = table->getNumberOfRows();
+        size_t nCols = table->getNumberOfColumns();
+        data_management::BlockDescriptor<int> block;
+        table->getBlockOfRows(0, nRows, data_management::writeOnly, block);
+        int *values = block.getBlockPtr();
+        for(size_t i = 0; i < nRows * nCols; i++)
+        {
+            values[i] = 0;
+        }
+        table->releaseBlockOfRows(block);
+    }
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__RESULT"></a>
  * \brief Provides methods to access final results obtained with the compute() method of the
- *        quantiles algorithm in the batch processing mode
+ *        quantiles algorithm in the batch processing mode or with the finalizeCompute() method
+ *        in the online and distributed processing modes
  */
 class Result : public daal::algorithms::Result
 {
@@ -174,6 +434,26 @@ public:
                                                                                     data_management::NumericTable::doAllocate)));
     }
 
+    /**
+     * Allocates memory to store final results of the quantiles algorithm
+     * \param[in] partialResult Partial results of the quantiles algorithm
+     * \param[in] parameter     Parameters of the quantiles algorithm
+     * \param[in] method        Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+        const Parameter *par = static_cast<const Parameter *>(parameter);
+
+        size_t nFeatures = pres->getNumberOfFeatures();
+        size_t nQuantileOrders = par->quantileOrders->getNumberOfColumns();
+
+        Argument::set(quantiles, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nQuantileOrders, nFeatures,
+                                                                                    data_management::NumericTable::doAllocate)));
+    }
+
     /**
      * Returns the final result of the quantiles algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -203,8 +483,48 @@ public:
     void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
     {
         const Input *input = static_cast<const Input *>(in);
-        size_t nFeatures = input->get(data)->getNumberOfColumns();
+        checkImpl(input->get(data)->getNumberOfColumns(), par);
+    }
+
+    /**
+     * Checks the correctness of the Result object
+     * \param[in] partialResult Pointer to the partial results
+     * \param[in] par           Pointer to the parameters structure
+     * \param[in] method        Algorithm computation method
+     */
+    void check(const daal::algorithms::PartialResult *partialResult, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
+    {
+        const PartialResult *pres = static_cast<const PartialResult *>(partialResult);
+        checkImpl(pres->getNumberOfFeatures(), par);
+    }
+
+    int getSerializationTag() { return SERIALIZATION_QUANTILES_RESULT_ID; }
+
+    /**
+    *  Serializes the object
+    *  \param[in]  arch  Storage for the serialized object or data structure
+    */
+    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::InputDataArchive, false>(arch);}
 
+    /**
+    *  Deserializes the object
+    *  \param[in]  arch  Storage for the deserialized object or data structure
+    */
+    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
+    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+
+protected:
+    /** \private */
+    template<typename Archive, bool onDeserialize>
+    void serialImpl(Archive *arch)
+    {
+        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+    }
+
+    /** \private */
+    void checkImpl(size_t nFeatures, const daal::algorithms::Parameter *par) const
+    {
         const Parameter *parameter = static_cast<const Parameter *>(par);
         if(parameter->quantileOrders.get() == NULL)
         {
@@ -228,37 +548,138 @@ public:
             this->_errors->add(services::ErrorIncorrectSizeOfOutputNumericTable);
             return;
         }
+    }
+};
 
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT"></a>
+ * \brief %Input objects for the quantiles algorithm in the distributed processing mode
+ *
+ * \tparam step             Step of distributed processing, \ref ComputeStep
+ */
+template<ComputeStep step>
+class DistributedInput {};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT_STEP1LOCAL"></a>
+ * \brief Local-node input objects for the quantiles algorithm in the distributed processing mode
+ */
+template<>
+class DistributedInput<step1Local> : public Input
+{
+public:
+    DistributedInput() : Input()
+    {}
+
+    virtual ~DistributedInput()
+    {}
+};
+
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__QUANTILES__DISTRIBUTEDINPUT_STEP2MASTER"></a>
+ * \brief Input objects for the quantiles algorithm in the distributed processing mode on the master node
+ */
+template<>
+class DistributedInput<step2Master> : public InputIface
+{
+public:
+    DistributedInput() : InputIface(1)
+    {
+        Argument::set(partialResults, services::SharedPtr<data_management::DataCollection>(new data_management::DataCollection()));
     }
 
-    int getSerializationTag() { return SERIALIZATION_QUANTILES_RESULT_ID; }
+    virtual ~DistributedInput() {}
 
     /**
-    *  Serializes the object
-    *  \param[in]  arch  Storage for the serialized object or data structure
-    */
-    void serializeImpl(data_management::InputDataArchive  *arch) DAAL_C11_OVERRIDE
-    {serialImpl<data_management::InputDataArchive, false>(arch);}
+     * Returns the number of features in the partial results computed on local nodes
+     * \return Number of features
+     */
+    size_t getNumberOfFeatures() const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(partialResults);
+        if(collection && collection->size() > 0)
+        {
+            services::SharedPtr<PartialResult> onePartialResult =
+                services::staticPointerCast<PartialResult, data_management::SerializationIface>((*collection)[0]);
+            if(onePartialResult)
+            {
+                services::SharedPtr<data_management::NumericTable> ntPtr = onePartialResult->get(partialMinimum);
+                if(ntPtr)
+                {
+                    return ntPtr->getNumberOfRows();
+                }
+            }
+            this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
+        }
+        return 0;
+    }
 
     /**
-    *  Deserializes the object
-    *  \param[in]  arch  Storage for the deserialized object or data structure
-    */
-    void deserializeImpl(data_management::OutputDataArchive *arch) DAAL_C11_OVERRIDE
-    {serialImpl<data_management::OutputDataArchive, true>(arch);}
+     * Adds partial result to the collection of input objects for the quantiles algorithm in the distributed processing mode
+     * \param[in] id            Identifier of the input object
+     * \param[in] partialResult Partial result obtained in the first step of the distributed algorithm
+     */
+    void add(MasterInputId id, const services::SharedPtr<PartialResult> &partialResult)
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(id);
+        collection->push_back(services::staticPointerCast<data_management::SerializationIface, PartialResult>(partialResult));
+    }
 
-protected:
-    /** \private */
-    template<typename Archive, bool onDeserialize>
-    void serialImpl(Archive *arch)
+    /**
+     * Sets input object for the quantiles algorithm in the distributed processing mode
+     * \param[in] id  Identifier of the input object
+     * \param[in] ptr Pointer to the input object
+     */
+    void set(MasterInputId id, const services::SharedPtr<data_management::DataCollection> &ptr)
     {
-        daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
+        Argument::set(id, ptr);
+    }
+
+    /**
+     * Returns the collection of input objects
+     * \param[in] id   Identifier of the input object, \ref MasterInputId
+     * \return Collection of distributed input objects
+     */
+    services::SharedPtr<data_management::DataCollection> get(MasterInputId id) const
+    {
+        return services::staticPointerCast<data_management::DataCollection, data_management::SerializationIface>(Argument::get(id));
+    }
+
+    /**
+     * Checks the partial results received from local nodes
+     * \param[in] parameter Pointer to the algorithm parameters
+     * \param[in] method    Computation method
+     */
+    void check(const daal::algorithms::Parameter *parameter, int method) const DAAL_C11_OVERRIDE
+    {
+        services::SharedPtr<data_management::DataCollection> collection = get(partialResults);
+        if(!collection) { this->_errors->add(services::ErrorNullInputDataCollection); return; }
+        size_t nBlocks = collection->size();
+        if(nBlocks == 0) { this->_errors->add(services::ErrorIncorrectNumberOfInputNumericTables); return; }
+
+        size_t nFeatures = getNumberOfFeatures();
+        if(nFeatures == 0) { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+
+        for(size_t i = 0; i < nBlocks; i++)
+        {
+            PartialResult *partialResult = dynamic_cast<PartialResult *>((*collection)[i].get());
+            if(!partialResult) { this->_errors->add(services::ErrorNullPartialResult); return; }
+
+            partialResult->setErrorCollection(this->_errors);
+            partialResult->check(parameter, method);
+            if(this->_errors->size() != 0) { return; }
+            if(partialResult->getNumberOfFeatures() != nFeatures)
+            { this->_errors->add(services::ErrorIncorrectNumberOfFeatures); return; }
+        }
     }
 };
 } // namespace interface1
 using interface1::Parameter;
+using interface1::InputIface;
 using interface1::Input;
+using interface1::PartialResult;
 using interface1::Result;
+using interface1::DistributedInput;
 
 } // namespace daal::algorithms::quantiles
 } // namespace daal::algorithms
@@ -74,13 +74,15 @@ public:
  * \par References
  *      - <a href="DAAL-REF-SORTING-ALGORITHM">Sorting algorithm description and usage models</a>
  *      - Input class
+ *      - Parameter class
  *      - Result class
  */
 template<typename algorithmFPType = double, Method method = defaultDense>
 class DAAL_EXPORT Batch : public daal::algorithms::Analysis<batch>
 {
 public:
-    Input input; /*!< %input data structure */
+    Input input;            /*!< %input data structure */
+    Parameter parameter;    /*!< Sorting parameters structure */
 
     /** Default constructor     */
     Batch()
@@ -98,6 +100,7 @@ public:
     {
         initialize();
         input.set(data, other.input.get(data));
+        parameter = other.parameter;
     }
 
     virtual ~Batch() {}
@@ -145,7 +148,7 @@ protected:
 
     virtual void allocateResult() DAAL_C11_OVERRIDE
     {
-        _result->allocate<algorithmFPType>(&input, method);
+        _result->allocate<algorithmFPType>(&input, &parameter, method);
         _res = _result.get();
     }
 
@@ -153,6 +156,7 @@ protected:
     {
         Analysis<batch>::_ac = new __DAAL_ALGORITHM_CONTAINER(batch, BatchContainer, algorithmFPType, method)(&_env);
         _in  = &input;
+        _par = &parameter;
         _result = services::SharedPtr<Result>(new Result());
     }
 
@@ -41,7 +41,8 @@ namespace sorting
  */
 enum Method
 {
-    defaultDense = 0      /*!< Default: radix method for sorting a data set */
+    defaultDense = 0,     /*!< Default: radix method for sorting a data set */
+    topKDense    = 1      /*!< Partial sort method that selects k smallest or k largest observations of each feature */
 };
 
 /**
@@ -67,6 +68,27 @@ enum ResultId
  */
 namespace interface1
 {
+/**
+ * <a name="DAAL-CLASS-ALGORITHMS__SORTING__PARAMETER"></a>
+ * \brief Parameters of the sorting algorithm
+ */
+struct Parameter : public daal::algorithms::Parameter
+{
+    Parameter(size_t k = 1, bool largest = false) : daal::algorithms::Parameter(), k(k), largest(largest) {}
+
+    /**
+     * Checks the correctness of the parameter
+     */
+    void check() const DAAL_C11_OVERRIDE
+    {
+        if(k == 0) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+    }
+
+    size_t k;           /*!< Number of observations of each feature selected with the topKDense method. Default value is 1 */
+    bool largest;       /*!< If true, the topKDense method selects k largest observations in descending order,
+                             otherwise k smallest observations in ascending order. Default value is false */
+};
+
 /**
  * <a name="DAAL-CLASS-ALGORITHMS__SORTING__INPUT"></a>
  * \brief %Input objects for the sorting algorithm
@@ -104,7 +126,7 @@ public:
      * \param[in] method    Algorithm computation method
      * \param[in] par       Pointer to the parameters of the algorithm
      */
-    void check(const Parameter *par, int method) const DAAL_C11_OVERRIDE
+    void check(const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
     {
         services::SharedPtr<data_management::NumericTable> inTable = get(data);
         if(!inTable)
@@ -119,6 +141,12 @@ public:
             this->_errors->add(services::ErrorIncorrectSizeOfInputNumericTable);
             return;
         }
+        if(method == topKDense)
+        {
+            const Parameter *parameter = static_cast<const Parameter *>(par);
+            if(parameter == 0) { this->_errors->add(services::ErrorNullParameterNotSupported); return; }
+            if(parameter->k > inTable->getNumberOfRows()) { this->_errors->add(services::ErrorIncorrectParameter); return; }
+        }
     }
 };
 
@@ -153,6 +181,25 @@ public:
                                                                                     data_management::NumericTable::doAllocate)));
     }
 
+    /**
+     * Allocates memory to store final results of the sorting algorithms
+     * \param[in] input     Input objects for the sorting algorithm
+     * \param[in] parameter Parameters of the sorting algorithm
+     * \param[in] method    Algorithm computation method
+     */
+    template <typename algorithmFPType>
+    void allocate(const daal::algorithms::Input *input, const daal::algorithms::Parameter *parameter, const int method)
+    {
+        const Input *in = static_cast<const Input *>(input);
+
+        size_t nFeatures = in->get(data)->getNumberOfColumns();
+        size_t nVectors = getNumberOfOutputRows(in->get(data)->getNumberOfRows(), parameter, method);
+
+        Argument::set(sortedData, services::SharedPtr<data_management::SerializationIface>(
+                          new data_management::HomogenNumericTable<algorithmFPType>(nFeatures, nVectors,
+                                                                                    data_management::NumericTable::doAllocate)));
+    }
+
     /**
      * Returns the final result of the sorting algorithm
      * \param[in] id   Identifier of the final result, \ref ResultId
@@ -179,12 +226,12 @@ public:
      * \param[in] par     %Parameter of algorithm
      * \param[in] method Algorithm computation method
      */
-    void check(const daal::algorithms::Input *in, const Parameter *par, int method) const DAAL_C11_OVERRIDE
+    void check(const daal::algorithms::Input *in, const daal::algorithms::Parameter *par, int method) const DAAL_C11_OVERRIDE
     {
         const Input *input = static_cast<const Input *>(in);
 
         size_t nFeatures = input->get(data)->getNumberOfColumns();
-        size_t nVectors  = input->get(data)->getNumberOfRows();
+        size_t nVectors  = getNumberOfOutputRows(input->get(data)->getNumberOfRows(), par, method);
 
         services::SharedPtr<data_management::NumericTable> outputTable = get(sortedData);
 
@@ -216,8 +263,19 @@ protected:
     {
         daal::algorithms::Result::serialImpl<Archive, onDeserialize>(arch);
     }
+
+    /** \private */
+    static size_t getNumberOfOutputRows(size_t nVectors, const daal::algorithms::Parameter *par, int method)
+    {
+        if(method == topKDense && par != 0)
+        {
+            return static_cast<const Parameter *>(par)->k;
+        }
+        return nVectors;
+    }
 };
 } // namespace interface1
+using interface1::Parameter;
 using interface1::Input;
 using interface1::Result;
 
@@ -22,6 +22,7 @@
 #include "services/base.h"
 #include "services/env_detect.h"
 #include "services/library_version_info.h"
+#include "services/daal_profiler.h"
 #include "data_management/compression/bzip2compression.h"
 #include "data_management/compression/compression.h"
 #include "data_management/compression/compression_stream.h"
@@ -56,6 +57,8 @@
 #include "algorithms/classifier/classifier_predict_types.h"
 #include "algorithms/classifier/classifier_predict.h"
 #include "algorithms/classifier/classifier_model.h"
+#include "algorithms/classifier/classifier_model_selection_types.h"
+#include "algorithms/classifier/classifier_model_selection_batch.h"
 #include "algorithms/kmeans/kmeans_types.h"
 #include "algorithms/kmeans/kmeans_batch.h"
 #include "algorithms/kmeans/kmeans_distributed.h"
@@ -165,6 +168,8 @@
 #include "algorithms/boosting/boosting_training_batch.h"
 #include "algorithms/quantiles/quantiles_types.h"
 #include "algorithms/quantiles/quantiles_batch.h"
+#include "algorithms/quantiles/quantiles_online.h"
+#include "algorithms/quantiles/quantiles_distributed.h"
 #include "algorithms/implicit_als/implicit_als_model.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_batch.h"
 #include "algorithms/implicit_als/implicit_als_predict_ratings_distributed.h"
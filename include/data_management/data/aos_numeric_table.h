@@ -24,6 +24,8 @@
 #ifndef __AOS_NUMERIC_TABLE_H__
 #define __AOS_NUMERIC_TABLE_H__
 
+#include "data_management/data/data_conversion.h"
+
 namespace daal
 {
 namespace data_management
@@ -310,19 +312,7 @@ private:
 
         if( !(rwFlag & (int)readOnly) ) return;
 
-        char *ptr = (char *)_ptr + _structSize * idx;
-
-        for( size_t j = 0 ; j < ncols ; j++ )
-        {
-            NumericTableFeature &f = (*_ddict)[j];
-
-            char *location = ptr + _offsets[j];
-
-            T* blockPtr = block.getBlockPtr();
-
-            data_feature_utils::vectorStrideUpCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
-            ( nrows, location, _structSize, blockPtr + j, sizeof(T)*ncols );
-        }
+        data_feature_utils::internal::aosToRows( idx, nrows, _ptr, _structSize, _offsets, *_ddict, block.getBlockPtr() );
     }
 
     template <typename T>
@@ -330,21 +320,7 @@ private:
     {
         if (rwFlag & (int)writeOnly)
         {
-            size_t ncols = getNumberOfColumns();
-
-            char *ptr = (char *)_ptr + _structSize * idx;
-
-            size_t j;
-
-            for( j = 0 ; j < ncols ; j++ )
-            {
-                NumericTableFeature &f = (*_ddict)[j];
-
-                char *location = ptr + _offsets[j];
-
-                data_feature_utils::vectorStrideDownCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
-                ( nrows, buf + j, sizeof(T)*ncols, location, _structSize );
-            }
+            data_feature_utils::internal::rowsToAos( idx, nrows, buf, _ptr, _structSize, _offsets, *_ddict );
         }
     }
 
@@ -353,21 +329,8 @@ private:
     {
         if(block.getRWFlag() & (int)writeOnly)
         {
-            size_t ncols = getNumberOfColumns();
-
-            char *ptr = (char *)_ptr + _structSize * block.getRowsOffset();
-
-            T* blockPtr = block.getBlockPtr();
-
-            for( size_t j = 0 ; j < ncols ; j++ )
-            {
-                NumericTableFeature &f = (*_ddict)[j];
-
-                char *location = ptr + _offsets[j];
-
-                data_feature_utils::vectorStrideDownCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
-                ( block.getNumberOfRows(), blockPtr + j, sizeof(T)*ncols, location, _structSize );
-            }
+            data_feature_utils::internal::rowsToAos( block.getRowsOffset(), block.getNumberOfRows(), block.getBlockPtr(),
+                                                     _ptr, _structSize, _offsets, *_ddict );
         }
         block.setDetails( 0, 0, 0 );
     }
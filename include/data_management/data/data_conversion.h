@@ -0,0 +1,107 @@
+/* file: data_conversion.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the functions that convert blocks of heterogeneous numeric tables
+//  to and from row-major blocks of a single type
+//--
+*/
+
+#ifndef __DATA_CONVERSION_H__
+#define __DATA_CONVERSION_H__
+
+#include "services/daal_defines.h"
+#include "data_management/data/data_dictionary.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace data_feature_utils
+{
+namespace internal
+{
+
+/**
+ *  Copies rows of a table stored as a structure of arrays to a row-major block
+ *  with conversion of the values to the type of the block
+ *  \param[in]  idx     Index of the first row to copy
+ *  \param[in]  nrows   Number of rows to copy
+ *  \param[in]  arrays  Pointers to the arrays of the features
+ *  \param[in]  dict    Data dictionary of the table
+ *  \param[out] dst     Row-major block of size nrows x (number of features)
+ */
+DAAL_EXPORT void soaToRows(size_t idx, size_t nrows, void *const *arrays, NumericTableDictionary &dict, double *dst);
+DAAL_EXPORT void soaToRows(size_t idx, size_t nrows, void *const *arrays, NumericTableDictionary &dict, float  *dst);
+DAAL_EXPORT void soaToRows(size_t idx, size_t nrows, void *const *arrays, NumericTableDictionary &dict, int    *dst);
+
+/**
+ *  Copies a row-major block to rows of a table stored as a structure of arrays
+ *  with conversion of the values to the types of the features
+ *  \param[in]  idx     Index of the first row to write
+ *  \param[in]  nrows   Number of rows to write
+ *  \param[in]  src     Row-major block of size nrows x (number of features)
+ *  \param[in]  arrays  Pointers to the arrays of the features
+ *  \param[in]  dict    Data dictionary of the table
+ */
+DAAL_EXPORT void rowsToSoa(size_t idx, size_t nrows, const double *src, void *const *arrays, NumericTableDictionary &dict);
+DAAL_EXPORT void rowsToSoa(size_t idx, size_t nrows, const float  *src, void *const *arrays, NumericTableDictionary &dict);
+DAAL_EXPORT void rowsToSoa(size_t idx, size_t nrows, const int    *src, void *const *arrays, NumericTableDictionary &dict);
+
+/**
+ *  Copies rows of a table stored as an array of structures to a row-major block
+ *  with conversion of the values to the type of the block
+ *  \param[in]  idx         Index of the first row to copy
+ *  \param[in]  nrows       Number of rows to copy
+ *  \param[in]  ptr         Pointer to the array of structures
+ *  \param[in]  structSize  Size of the structure in bytes
+ *  \param[in]  offsets     Offsets of the features in the structure in bytes
+ *  \param[in]  dict        Data dictionary of the table
+ *  \param[out] dst         Row-major block of size nrows x (number of features)
+ */
+DAAL_EXPORT void aosToRows(size_t idx, size_t nrows, const void *ptr, size_t structSize, const size_t *offsets,
+                           NumericTableDictionary &dict, double *dst);
+DAAL_EXPORT void aosToRows(size_t idx, size_t nrows, const void *ptr, size_t structSize, const size_t *offsets,
+                           NumericTableDictionary &dict, float  *dst);
+DAAL_EXPORT void aosToRows(size_t idx, size_t nrows, const void *ptr, size_t structSize, const size_t *offsets,
+                           NumericTableDictionary &dict, int    *dst);
+
+/**
+ *  Copies a row-major block to rows of a table stored as an array of structures
+ *  with conversion of the values to the types of the features
+ *  \param[in]  idx         Index of the first row to write
+ *  \param[in]  nrows       Number of rows to write
+ *  \param[in]  src         Row-major block of size nrows x (number of features)
+ *  \param[in]  ptr         Pointer to the array of structures
+ *  \param[in]  structSize  Size of the structure in bytes
+ *  \param[in]  offsets     Offsets of the features in the structure in bytes
+ *  \param[in]  dict        Data dictionary of the table
+ */
+DAAL_EXPORT void rowsToAos(size_t idx, size_t nrows, const double *src, void *ptr, size_t structSize, const size_t *offsets,
+                           NumericTableDictionary &dict);
+DAAL_EXPORT void rowsToAos(size_t idx, size_t nrows, const float  *src, void *ptr, size_t structSize, const size_t *offsets,
+                           NumericTableDictionary &dict);
+DAAL_EXPORT void rowsToAos(size_t idx, size_t nrows, const int    *src, void *ptr, size_t structSize, const size_t *offsets,
+                           NumericTableDictionary &dict);
+
+} // namespace internal
+} // namespace data_feature_utils
+} // namespace data_management
+} // namespace daal
+
+#endif
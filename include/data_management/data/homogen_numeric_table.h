@@ -320,6 +320,22 @@ public:
         _memStatus = internallyAllocated;
     }
 
+    /**
+     *  Allocates memory for the data of the numeric table and distributes its pages across NUMA nodes
+     *  \param[in]  placement  Policy of distributing the pages across NUMA nodes.
+     *                          services::numaPartition places the blocks of rows on the nodes
+     *                          that process them in the blocked computations of the algorithms
+     */
+    void allocateDataMemory( services::NumaPlacement placement )
+    {
+        HomogenNumericTable<DataType>::allocateDataMemory();
+
+        if( _ptr )
+        {
+            services::daal_numa_place( _ptr, getNumberOfColumns() * getNumberOfRows() * sizeof(DataType), placement );
+        }
+    }
+
     void freeDataMemory() DAAL_C11_OVERRIDE
     {
         if( getDataMemoryStatus() == internallyAllocated )
@@ -26,8 +26,10 @@
 #define __MERGED_NUMERIC_TABLE_H__
 
 #include "data_management/data/numeric_table.h"
+#include "data_management/data/homogen_numeric_table.h"
 #include "services/daal_memory.h"
 #include "services/daal_defines.h"
+#include "services/daal_atomic_int.h"
 
 namespace daal
 {
@@ -39,7 +41,10 @@ namespace interface1
 
 /**
  *  <a name="DAAL-CLASS-MergedNumericTable"></a>
- *  \brief Class that provides methods to access a collection of numeric tables as if they are joined by columns
+ *  \brief Class that provides methods to access a collection of numeric tables as if they are joined by columns.
+ *         Blocks of column values are accessed directly in the table that contains the column.
+ *         Blocks of rows are assembled from the blocks of rows of all the tables, unless the merged data
+ *         is materialized in a contiguous buffer with the materialize method
  */
 class MergedNumericTable : public NumericTable
 {
@@ -47,13 +52,14 @@ public:
     /**
      *  Constructor for an empty merge Numeric Table
      */
-    MergedNumericTable() : NumericTable(0, 0), _tables(new DataCollection) {}
+    MergedNumericTable() : NumericTable(0, 0), _tables(new DataCollection), _nMaterializedBlocks(0) {}
 
     /**
      *  Constructor for a merge Numeric Table consisting of one table
      *  \param[in]  table       Pointer to the table
      */
-    MergedNumericTable( services::SharedPtr<NumericTable> table) : NumericTable(0, 0), _tables(new DataCollection)
+    MergedNumericTable( services::SharedPtr<NumericTable> table) : NumericTable(0, 0), _tables(new DataCollection),
+        _nMaterializedBlocks(0)
     {
         addNumericTable(table);
     }
@@ -64,7 +70,7 @@ public:
      *  \param[in]  second     Pointer to the second table
      */
     MergedNumericTable( services::SharedPtr<NumericTable> first, services::SharedPtr<NumericTable> second ):
-        NumericTable(0, 0), _tables(new DataCollection)
+        NumericTable(0, 0), _tables(new DataCollection), _nMaterializedBlocks(0)
     {
         addNumericTable(first);
         addNumericTable(second);
@@ -83,6 +89,7 @@ public:
         }
 
         _tables->push_back(table);
+        releaseMaterialized();
 
         size_t ncols = getNumberOfColumns();
         size_t cols = table->getNumberOfColumns();
@@ -107,8 +114,68 @@ public:
         }
     }
 
+    /**
+     *  Copies the merged data into a contiguous buffer of the type T. Subsequent read-only accesses to the blocks
+     *  of rows of the table return pointers to this buffer instead of assembling the rows from the merged tables,
+     *  which is useful if the data is read many times, as in iterative algorithms. Only blocks of the type T
+     *  are returned from the buffer.
+     *  The buffer is released when the data is modified via the merged table or the structure of the table changes;
+     *  if blocks of rows of the buffer are in use at that moment, the buffer is freed after the last of them is released.
+     *  The buffer does not track modifications made directly in the merged tables: in that case call
+     *  releaseMaterialized or materialize again
+     */
+    template <typename T>
+    void materialize()
+    {
+        releaseMaterialized();
+
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        services::SharedPtr<HomogenNumericTable<T> > materialized(new HomogenNumericTable<T>(ncols, nobs, NumericTable::doAllocate));
+        if (ncols * nobs && !materialized->getArray())
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        if (nobs)
+        {
+            assembleRows<T>(0, nobs, materialized->getArray());
+        }
+
+        MaterializedData data;
+        data.table = materialized;
+        data.begin = (const char *)materialized->getArray();
+        data.end   = data.begin + ncols * nobs * sizeof(T);
+        data.type  = data_feature_utils::getIndexNumType<T>();
+
+        MaterializedLock lock(_materializedLock);
+        retireMaterialized();
+        _materialized = data;
+    }
+
+    /**
+     *  Releases the buffer with the materialized merged data
+     */
+    void releaseMaterialized()
+    {
+        MaterializedLock lock(_materializedLock);
+        retireMaterialized();
+    }
+
+    /**
+     *  Returns true if the merged data is materialized in a contiguous buffer
+     *  \return true if the merged data is materialized
+     */
+    bool isMaterialized() const
+    {
+        MaterializedLock lock(_materializedLock);
+        return _materialized.table.get() != NULL;
+    }
+
     void setNumberOfRows(size_t nrow) DAAL_C11_OVERRIDE
     {
+        releaseMaterialized();
         for (size_t i = 0;i < _tables->size(); i++)
         {
             NumericTable* nt = (NumericTable*)(_tables->operator[](i).get());
@@ -119,6 +186,7 @@ public:
 
     void allocateDataMemory() DAAL_C11_OVERRIDE
     {
+        releaseMaterialized();
         for (size_t i = 0;i < _tables->size(); i++)
         {
             NumericTable* nt = (NumericTable*)(_tables->operator[](i).get());
@@ -128,6 +196,7 @@ public:
 
     void freeDataMemory() DAAL_C11_OVERRIDE
     {
+        releaseMaterialized();
         for (size_t i = 0;i < _tables->size(); i++)
         {
             NumericTable* nt = (NumericTable*)(_tables->operator[](i).get());
@@ -253,42 +322,115 @@ protected:
         NumericTable::serialImpl<Archive, onDeserialize>( arch );
 
         arch->setSharedPtrObj(_tables);
+
+        if (onDeserialize) { releaseMaterialized(); }
     }
 
 
 private:
     template<typename T>
-    void internal_inner_repack( size_t pos, size_t cols, size_t rows, size_t ncols, T *src, T *dst )
+    void internal_inner_repack( size_t pos, size_t cols, size_t rows, size_t ncols, const T *src, T *dst )
     {
-        size_t i, j;
+        dst += pos;
+        if (cols == 1)
+        {
+            for(size_t i = 0; i < rows; i++)
+            {
+                dst[i * ncols] = src[i];
+            }
+            return;
+        }
 
-        for(i = 0; i < rows; i++)
+        for(size_t i = 0; i < rows; i++, src += cols, dst += ncols)
         {
-            for(j = 0; j < cols; j++)
+            for(size_t j = 0; j < cols; j++)
             {
-                dst[i * ncols + j + pos] = src[i * cols + j];
+                dst[j] = src[j];
             }
         }
     }
 
     template<typename T>
-    void internal_outer_repack( size_t pos, size_t cols, size_t rows, size_t ncols, T *src, T *dst )
+    void internal_outer_repack( size_t pos, size_t cols, size_t rows, size_t ncols, const T *src, T *dst )
+    {
+        src += pos;
+        if (cols == 1)
+        {
+            for(size_t i = 0; i < rows; i++)
+            {
+                dst[i] = src[i * ncols];
+            }
+            return;
+        }
+
+        for(size_t i = 0; i < rows; i++, src += ncols, dst += cols)
+        {
+            for(size_t j = 0; j < cols; j++)
+            {
+                dst[j] = src[j];
+            }
+        }
+    }
+
+    /* Copies the rows of all the merged tables into the buffer with ncols columns */
+    template <typename T>
+    void assembleRows( size_t idx, size_t nrows, T *dst )
     {
-        size_t i, j;
+        size_t ncols = getNumberOfColumns();
+        size_t cols = 0;
+        BlockDescriptor<T> innerBlock;
+        for (size_t k = 0; k < _tables->size(); k++)
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
+            size_t lcols = nt->getNumberOfColumns();
+
+            nt->getBlockOfRows(idx, nrows, readOnly, innerBlock);
+
+            internal_inner_repack<T>( cols, lcols, nrows, ncols, innerBlock.getBlockPtr(), dst );
+
+            nt->releaseBlockOfRows(innerBlock);
 
-        for(i = 0; i < rows; i++)
+            cols += lcols;
+        }
+    }
+
+    /* Returns the table that contains the feature and the index of the feature in that table */
+    NumericTable *findFeature( size_t feat_idx, size_t *localIdx )
+    {
+        for (size_t k = 0; k < _tables->size(); k++)
         {
-            for(j = 0; j < cols; j++)
+            NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
+            size_t lcols = nt->getNumberOfColumns();
+
+            if (lcols > feat_idx)
             {
-                dst[i * cols + j] = src[i * ncols + j + pos];
+                *localIdx = feat_idx;
+                return nt;
             }
+
+            feat_idx -= lcols;
         }
+        return NULL;
     }
 
 protected:
     template <typename T>
     void getTBlock( size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block )
     {
+        /* Read-only blocks are returned from the materialized data without copying */
+        if (rwFlag == (int)readOnly && getMaterializedBlock<T>(idx, nrows, block))
+        {
+            return;
+        }
+
+        /* A single table does not need to be assembled */
+        if (_tables->size() == 1)
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](0).get());
+            nt->getBlockOfRows(idx, nrows, (ReadWriteMode)rwFlag, block);
+            return;
+        }
+
         size_t ncols = getNumberOfColumns();
         size_t nobs = getNumberOfRows();
         block.setDetails( 0, idx, rwFlag );
@@ -309,28 +451,30 @@ protected:
 
         if( rwFlag & (int)readOnly )
         {
-            size_t cols = 0;
-            BlockDescriptor<T> innerBlock;
-            for (size_t k = 0; k < _tables->size(); k++)
-            {
-                NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
-                size_t lcols = nt->getNumberOfColumns();
-
-                nt->getBlockOfRows(idx, nrows, readOnly, innerBlock);
-
-                internal_inner_repack<T>( cols, lcols, nrows, ncols, innerBlock.getBlockPtr(), block.getBlockPtr());
-
-                nt->releaseBlockOfRows(innerBlock);
-
-                cols += lcols;
-            }
+            assembleRows<T>( idx, nrows, block.getBlockPtr() );
         }
-
     }
 
     template <typename T>
     void releaseTBlock(BlockDescriptor<T>& block)
     {
+        if (releaseMaterializedBlock<T>(block))
+        {
+            return;
+        }
+
+        if(block.getRWFlag() & (int)writeOnly)
+        {
+            releaseMaterialized();
+        }
+
+        if (_tables->size() == 1)
+        {
+            NumericTable* nt = (NumericTable*)(_tables->operator[](0).get());
+            nt->releaseBlockOfRows(block);
+            return;
+        }
+
         if(block.getRWFlag() & (int)writeOnly)
         {
             size_t ncols = getNumberOfColumns();
@@ -355,87 +499,126 @@ protected:
         block.setDetails( 0, 0, 0 );
     }
 
+    /* Column values are accessed directly in the table that contains the column. The details of the block
+       are set to the index of the column in the merged table, and restored at the release of the block */
     template <typename T>
     void getTFeature( size_t feat_idx, size_t idx, size_t nrows, int rwFlag, BlockDescriptor<T>& block )
     {
-        size_t ncols = getNumberOfColumns();
-        size_t nobs = getNumberOfRows();
-        block.setDetails( feat_idx, idx, rwFlag );
-
-        if (idx >= nobs)
+        size_t localIdx = 0;
+        NumericTable* nt = findFeature(feat_idx, &localIdx);
+        if (!nt)
         {
+            block.setDetails( feat_idx, idx, rwFlag );
             block.resizeBuffer( 1, 0 );
             return;
         }
 
-        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
-        if( !block.resizeBuffer( 1, nrows ) )
+        nt->getBlockOfColumnValues(localIdx, idx, nrows, (ReadWriteMode)rwFlag, block);
+        block.setDetails( feat_idx, block.getRowsOffset(), rwFlag );
+    }
+
+    template <typename T>
+    void releaseTFeature( BlockDescriptor<T>& block )
+    {
+        if (block.getRWFlag() & (int)writeOnly)
         {
-            this->_errors->add(services::ErrorMemoryAllocationFailed);
-            return;
+            releaseMaterialized();
         }
 
-        if( rwFlag & (int)readOnly )
+        size_t localIdx = 0;
+        NumericTable* nt = findFeature(block.getColumnsOffset(), &localIdx);
+        if (!nt)
         {
-            T* buffer = block.getBlockPtr();
-            for (size_t k = 0; k < _tables->size(); k++)
-            {
-                NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
-                size_t lcols = nt->getNumberOfColumns();
-
-                if (lcols > feat_idx)
-                {
-                    BlockDescriptor<T> innerBlock;
-                    nt->getBlockOfColumnValues(feat_idx, idx, nrows, readOnly, innerBlock);
-                    T* location = innerBlock.getBlockPtr();
-                    for (size_t i = 0; i < nrows; i++)
-                    {
-                        buffer[i] = location[i];
-                    }
-                    nt->releaseBlockOfColumnValues(innerBlock);
-                    break;
-                }
-
-                feat_idx -= lcols;
-            }
+            block.setDetails( 0, 0, 0 );
+            return;
         }
+
+        block.setDetails( localIdx, block.getRowsOffset(), block.getRWFlag() );
+        nt->releaseBlockOfColumnValues(block);
     }
 
+    /* Contiguous copy of the merged data and the memory it occupies */
+    struct MaterializedData
+    {
+        MaterializedData() : begin(0), end(0), type(data_feature_utils::DAAL_OTHER_T) {}
+
+        bool contains(const void *ptr) const { return ((const char *)ptr >= begin && (const char *)ptr < end); }
+
+        services::SharedPtr<NumericTable> table;
+        const char *begin;
+        const char *end;
+        data_feature_utils::IndexNumType type;
+    };
+
+    /* Simple lock that serializes the accesses to the materialized data from concurrent calls */
+    class MaterializedLock
+    {
+    public:
+        MaterializedLock(services::Atomic<int> &flag) : _flag(flag) { while (_flag.inc() != 1) { _flag.dec(); } }
+        ~MaterializedLock() { _flag.dec(); }
+
+    private:
+        services::Atomic<int> &_flag;
+    };
+
+    /* Returns the rows of the materialized data of the type T. The number of such blocks in use is counted,
+       so the copy is not freed until they are released */
     template <typename T>
-    void releaseTFeature( BlockDescriptor<T>& block )
+    bool getMaterializedBlock( size_t idx, size_t nrows, BlockDescriptor<T>& block )
     {
-        if (block.getRWFlag() & (int)writeOnly)
-        {
-            size_t feat_idx = block.getColumnsOffset();
-            size_t idx = block.getRowsOffset();
-            size_t nrows = block.getNumberOfRows();
-            T* buffer = block.getBlockPtr();
-            for (size_t k = 0; k < _tables->size(); k++)
-            {
-                NumericTable* nt = (NumericTable*)(_tables->operator[](k).get());
-                size_t lcols = nt->getNumberOfColumns();
+        MaterializedLock lock(_materializedLock);
+        if (!_materialized.table.get() || _materialized.type != data_feature_utils::getIndexNumType<T>()) { return false; }
 
-                if (lcols > feat_idx)
-                {
-                    BlockDescriptor<T> innerBlock;
-                    nt->getBlockOfColumnValues(feat_idx, idx, nrows, writeOnly, innerBlock);
-                    T* location = innerBlock.getBlockPtr();
-                    for (size_t i = 0; i < nrows; i++)
-                    {
-                        location[i] = buffer[i];
-                    }
-                    nt->releaseBlockOfColumnValues(innerBlock);
-                    break;
-                }
-
-                feat_idx -= lcols;
-            }
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        if (idx >= nobs) { return false; }
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        block.setDetails( 0, idx, (int)readOnly );
+        block.setPtr( (T *)_materialized.begin + idx * ncols, ncols, nrows );
+        _nMaterializedBlocks++;
+        return true;
+    }
+
+    /* Releases the block if it was returned from the current or a released materialized copy */
+    template <typename T>
+    bool releaseMaterializedBlock( BlockDescriptor<T>& block )
+    {
+        MaterializedLock lock(_materializedLock);
+        if (!_nMaterializedBlocks) { return false; }
+
+        const void *ptr = block.getBlockPtr();
+        bool isMaterializedBlock = _materialized.contains(ptr);
+        for (size_t i = 0; i < _retiredMaterialized.size() && !isMaterializedBlock; i++)
+        {
+            isMaterializedBlock = _retiredMaterialized[i].contains(ptr);
         }
+        if (!isMaterializedBlock) { return false; }
+
         block.setDetails( 0, 0, 0 );
+        if (--_nMaterializedBlocks == 0)
+        {
+            _retiredMaterialized.clear();
+        }
+        return true;
+    }
+
+    /* Drops the current copy. The copy is kept until its blocks in use are released. Called under the lock */
+    void retireMaterialized()
+    {
+        if (_materialized.table.get() && _nMaterializedBlocks)
+        {
+            _retiredMaterialized.push_back(_materialized);
+        }
+        _materialized = MaterializedData();
     }
 
 protected:
     services::SharedPtr<DataCollection> _tables;
+    MaterializedData _materialized;                             /* Contiguous copy of the merged data */
+    services::Collection<MaterializedData> _retiredMaterialized; /* Released copies with blocks in use */
+    size_t _nMaterializedBlocks;                                /* Number of blocks of the copies in use */
+    mutable services::Atomic<int> _materializedLock;            /* Guards the materialized data */
 };
 } // namespace interface1
 using interface1::MergedNumericTable;
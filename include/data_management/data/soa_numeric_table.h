@@ -24,6 +24,8 @@
 #ifndef __SOA_NUMERIC_TABLE_H__
 #define __SOA_NUMERIC_TABLE_H__
 
+#include "data_management/data/data_conversion.h"
+
 namespace daal
 {
 namespace data_management
@@ -363,31 +365,7 @@ private:
 
         if( !(block.getRWFlag() & (int)readOnly) ) return;
 
-        T lbuf[32];
-
-        size_t di = 32;
-
-        T* buffer = block.getBlockPtr();
-
-        for( size_t i = 0 ; i < nrows ; i += di )
-        {
-            if( i + di > nrows ) { di = nrows - i; }
-
-            for( size_t j = 0 ; j < ncols ; j++ )
-            {
-                NumericTableFeature &f = (*_ddict)[j];
-
-                char *ptr = (char *)_arrays[j] + (idx + i) * f.typeSize;
-
-                data_feature_utils::vectorUpCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
-                ( di, ptr, lbuf );
-
-                for( size_t ii = 0 ; ii < di; ii++ )
-                {
-                    buffer[ (i + ii)*ncols + j ] = lbuf[ii];
-                }
-            }
-        }
+        data_feature_utils::internal::soaToRows( idx, nrows, _arrays, *_ddict, block.getBlockPtr() );
     }
 
     template <typename T>
@@ -395,33 +373,7 @@ private:
     {
         if (rwFlag & (int)writeOnly)
         {
-            size_t ncols = getNumberOfColumns();
-            T lbuf[32];
-
-            size_t i, ii, j;
-
-            size_t di = 32;
-
-            for( i = 0 ; i < nrows ; i += di )
-            {
-                if( i + di > nrows ) { di = nrows - i; }
-
-                for( j = 0 ; j < ncols ; j++ )
-                {
-                    NumericTableFeature &f = (*_ddict)[j];
-
-                    char *ptr = (char *)_arrays[j];
-                    char *location = ptr + (idx + i) * f.typeSize;
-
-                    for( ii = 0 ; ii < di; ii++ )
-                    {
-                        lbuf[ii] = buf[ (i + ii) * ncols + j ];
-                    }
-
-                    data_feature_utils::vectorDownCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
-                    ( di, lbuf, location );
-                }
-            }
+            data_feature_utils::internal::rowsToSoa( idx, nrows, buf, _arrays, *_ddict );
         }
     }
 
@@ -430,34 +382,8 @@ private:
     {
         if(block.getRWFlag() & (int)writeOnly)
         {
-            size_t ncols = getNumberOfColumns();
-            size_t nrows = block.getNumberOfRows();
-            size_t idx   = block.getRowsOffset();
-            T lbuf[32];
-
-            size_t di = 32;
-
-            T* blockPtr = block.getBlockPtr();
-
-            for( size_t i = 0 ; i < nrows ; i += di )
-            {
-                if( i + di > nrows ) { di = nrows - i; }
-
-                for( size_t j = 0 ; j < ncols ; j++ )
-                {
-                    NumericTableFeature &f = (*_ddict)[j];
-
-                    char *ptr = (char *)_arrays[j] + (idx + i) * f.typeSize;
-
-                    for( size_t ii = 0 ; ii < di; ii++ )
-                    {
-                        lbuf[ii] = blockPtr[ (i + ii) * ncols + j ];
-                    }
-
-                    data_feature_utils::vectorDownCast[f.indexType][data_feature_utils::getInternalNumType<T>()]
-                    ( di, lbuf, ptr );
-                }
-            }
+            data_feature_utils::internal::rowsToSoa( block.getRowsOffset(), block.getNumberOfRows(), block.getBlockPtr(),
+                                                     _arrays, *_ddict );
         }
         block.setDetails( 0, 0, 0 );
     }
@@ -161,6 +161,7 @@ const int SERIALIZATION_CLASSIFIER_BINARY_CONFUSION_MATRIX_RESULT_ID           =
 const int SERIALIZATION_CLASSIFIER_MULTICLASS_CONFUSION_MATRIX_RESULT_ID       = 101420;
 const int SERIALIZATION_CLASSIFIER_PREDICTION_RESULT_ID                        = 101430;
 const int SERIALIZATION_CLASSIFIER_TRAINING_RESULT_ID                          = 101440;
+const int SERIALIZATION_CLASSIFIER_MODEL_SELECTION_RESULT_ID                   = 101450;
 
 const int SERIALIZATION_MOMENTS_PARTIAL_RESULT_ID                              = 101500;
 const int SERIALIZATION_MOMENTS_RESULT_ID                                      = 101510;
@@ -200,6 +201,7 @@ const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_ID                       =
 const int SERIALIZATION_QR_DISTRIBUTED_PARTIAL_RESULT_STEP3_ID                 = 102430;
 
 const int SERIALIZATION_QUANTILES_RESULT_ID                                    = 102500;
+const int SERIALIZATION_QUANTILES_PARTIAL_RESULT_ID                            = 102510;
 
 const int SERIALIZATION_WEAK_LEARNER_RESULT_ID                                 = 102600;
 
@@ -44,7 +44,37 @@ namespace services
 DAAL_EXPORT void *daal_malloc(size_t size, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
 
 /**
- * Deallocates the space previously allocated by daal_malloc
+ * <a name="DAAL-ENUM-SERVICES__NUMAPLACEMENT"></a>
+ * Policies of distributing the pages of a block of memory across NUMA nodes
+ */
+enum NumaPlacement
+{
+    numaDefault    = 0,     /*!< Pages are placed by the operating system on the node of the thread that touches them first */
+    numaInterleave = 1,     /*!< Pages are interleaved across all NUMA nodes */
+    numaPartition  = 2      /*!< Contiguous parts of the block are placed on the nodes that process the same parts
+                                 of the iteration space in parallel loops over the blocks of the data */
+};
+
+/**
+ * Allocates an aligned block of memory and distributes its pages across NUMA nodes
+ * \param[in] size      Size of the block of memory in bytes
+ * \param[in] placement Policy of distributing the pages across NUMA nodes
+ * \param[in] alignment Alignment constraint. Must be a power of two
+ * \return Pointer to the beginning of a newly allocated block of memory. The block is deallocated with daal_free
+ */
+DAAL_EXPORT void *daal_numa_malloc(size_t size, NumaPlacement placement, size_t alignment = DAAL_MALLOC_DEFAULT_ALIGNMENT);
+
+/**
+ * Distributes the pages of a block of memory across NUMA nodes.
+ * The pages shared with other blocks of memory are not affected
+ * \param[in] ptr       Pointer to the beginning of a block of memory
+ * \param[in] size      Size of the block of memory in bytes
+ * \param[in] placement Policy of distributing the pages across NUMA nodes
+ */
+DAAL_EXPORT void  daal_numa_place(void *ptr, size_t size, NumaPlacement placement);
+
+/**
+ * Deallocates the space previously allocated by daal_malloc or daal_numa_malloc
  * \param[in] ptr   Pointer to the beginning of a block of memory to deallocate
  */
 DAAL_EXPORT void  daal_free(void *ptr);
@@ -0,0 +1,114 @@
+/* file: daal_profiler.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of the class used to profile computations of the algorithms.
+//--
+*/
+
+#ifndef __DAAL_PROFILER_H__
+#define __DAAL_PROFILER_H__
+
+#include "services/base.h"
+#include "services/daal_defines.h"
+
+namespace daal
+{
+namespace services
+{
+namespace interface1
+{
+
+/**
+ * <a name="DAAL-CLASS-PROFILER"></a>
+ * \brief Class that provides methods to record the time spent in the kernels of the algorithms
+ *        and in the named regions of the kernels, the memory allocated in them and the counters
+ *        of the events, such as misses of the SVM kernel cache.
+ *        The recorded regions are exported in the Chrome* trace event format that is viewed
+ *        with chrome://tracing, or as a text summary.
+ *
+ *        The profiler is disabled by default. It is enabled by the enable method or by setting
+ *        the environment variables before the library is loaded:
+ *        DAAL_PROFILE=file writes the trace to the file at the process exit,
+ *        DAAL_PROFILE_SUMMARY=file writes the summary to the file at the process exit.
+ *        The library built with PROFILER=no does not contain the instrumentation
+ */
+class DAAL_EXPORT Profiler : public Base
+{
+public:
+    /**
+     *  Returns the profiler instance
+     *  \return The profiler instance
+     */
+    static Profiler *getInstance();
+
+    /**
+     *  Starts recording of the regions
+     */
+    void enable();
+
+    /**
+     *  Stops recording of the regions. The recorded regions are kept
+     */
+    void disable();
+
+    /**
+     *  Returns the flag that indicates whether the regions are being recorded
+     *  \return true if the regions are being recorded
+     */
+    bool isEnabled() const;
+
+    /**
+     *  Discards the recorded regions and counters.
+     *  Must not be called while computations of the algorithms are running
+     */
+    void reset();
+
+    /**
+     *  Returns the number of recorded regions
+     *  \return The number of recorded regions
+     */
+    size_t getNumberOfEvents() const;
+
+    /**
+     *  Writes the recorded regions and counters to the file in the Chrome* trace event format
+     *  \param[in] fileName  Name of the file
+     *  \return true if the file is written successfully
+     */
+    bool writeChromeTrace(const char *fileName) const;
+
+    /**
+     *  Writes the time spent in the regions aggregated by the region name, the values of
+     *  the counters and the utilization of the threads to the file
+     *  \param[in] fileName  Name of the file
+     *  \return true if the file is written successfully
+     */
+    bool writeSummary(const char *fileName) const;
+
+private:
+    Profiler();
+    Profiler(const Profiler &p);
+    ~Profiler();
+};
+} // namespace interface1
+
+using interface1::Profiler;
+
+}
+}
+#endif
@@ -207,10 +207,13 @@ enum ErrorID
                                                                              computation modes */
 
     // QR errors: -8000..-8199
+    ErrorQRInternal = -8000,                                            /*!< QR internal error */
 
     // Stump errors: -8200..-8399
 
     // SVD errors: -8400..-8599
+    ErrorSvdIthParamIllegalValue = -8400,                               /*!< Incorrect parameter in the internal SVD computation */
+    ErrorSvdXBDSQRDidNotConverge = -8401,                               /*!< Internal SVD computation did not converge */
 
     // SVM errors: -8600..-8799
     ErrorSVMinnerKernel = -8601,                                        /*!< Error in kernel function */
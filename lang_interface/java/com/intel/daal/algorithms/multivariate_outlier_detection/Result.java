@@ -48,7 +48,8 @@ public final class Result extends com.intel.daal.algorithms.Result {
      */
     public NumericTable get(ResultId id) {
         int idValue = id.getValue();
-        if (idValue != ResultId.weights.getValue()) {
+        if (idValue != ResultId.weights.getValue() && idValue != ResultId.location.getValue() &&
+            idValue != ResultId.scatter.getValue() && idValue != ResultId.threshold.getValue()) {
             throw new IllegalArgumentException("id unsupported");
         }
         return new HomogenNumericTable(getContext(), cGetResultTable(cObject, idValue));
@@ -61,7 +62,8 @@ public final class Result extends com.intel.daal.algorithms.Result {
      */
     public void set(ResultId id, NumericTable value) {
         int idValue = id.getValue();
-        if (idValue != ResultId.weights.getValue()) {
+        if (idValue != ResultId.weights.getValue() && idValue != ResultId.location.getValue() &&
+            idValue != ResultId.scatter.getValue() && idValue != ResultId.threshold.getValue()) {
             throw new IllegalArgumentException("id unsupported");
         }
         cSetResultTable(cObject, idValue, value.getCObject());
@@ -32,8 +32,17 @@ public final class ResultId {
         return _value;
     }
 
-    private static final int weightsValue = 0;
+    private static final int weightsValue   = 0;
+    private static final int locationValue  = 1;
+    private static final int scatterValue   = 2;
+    private static final int thresholdValue = 3;
 
     /** Outlier detection results */
-    public static final ResultId weights = new ResultId(weightsValue);
+    public static final ResultId weights   = new ResultId(weightsValue);
+    /** Vector of mean estimates used to compute the results */
+    public static final ResultId location  = new ResultId(locationValue);
+    /** Variance-covariance matrix used to compute the results */
+    public static final ResultId scatter   = new ResultId(scatterValue);
+    /** Limit that defines the outlier region used to compute the results */
+    public static final ResultId threshold = new ResultId(thresholdValue);
 }
@@ -39,5 +39,40 @@ public class PredictionParameter extends com.intel.daal.algorithms.Parameter {
         super(context, cParameter);
     }
 
+    /**
+     *  Gets the number of samples processed by the neural network in one forward pass
+     */
+    public long getBatchSize() {
+        return cGetBatchSize(cObject);
+    }
+
+    /**
+     *  Sets the number of samples processed by the neural network in one forward pass
+     *  @param batchSize Number of samples processed by the neural network in one forward pass
+     */
+    public void setBatchSize(long batchSize) {
+        cSetBatchSize(cObject, batchSize);
+    }
+
+    /**
+     *  Gets the flag that specifies whether the values of the layers share memory buffers
+     */
+    public boolean getReuseActivationMemory() {
+        return cGetReuseActivationMemory(cObject);
+    }
+
+    /**
+     *  Sets the flag that specifies whether the values of the layers share memory buffers.
+     *  If the flag is set, the values of the intermediate layers are overwritten during the prediction
+     *  @param reuseActivationMemory Flag that specifies whether the values of the layers share memory buffers
+     */
+    public void setReuseActivationMemory(boolean reuseActivationMemory) {
+        cSetReuseActivationMemory(cObject, reuseActivationMemory);
+    }
+
     private native long cInit();
+    private native long cGetBatchSize(long cParameter);
+    private native void cSetBatchSize(long cParameter, long batchSize);
+    private native boolean cGetReuseActivationMemory(long cParameter);
+    private native void cSetReuseActivationMemory(long cParameter, boolean reuseActivationMemory);
 }
@@ -45,7 +45,7 @@ public class PredictionResult extends com.intel.daal.algorithms.Result {
      * @return Result that corresponds to the given identifier
      */
     public Tensor get(PredictionResultId id) {
-        if (id == PredictionResultId.prediction) {
+        if (id == PredictionResultId.prediction || id == PredictionResultId.activationMemory) {
             return new HomogenTensor(getContext(), cGetValue(cObject, id.getValue()));
         }
         else {
@@ -59,7 +59,7 @@ public class PredictionResult extends com.intel.daal.algorithms.Result {
      * @param val  Result that corresponds to the given identifier
      */
     public void set(PredictionResultId id, Tensor val) {
-        if (id == PredictionResultId.prediction) {
+        if (id == PredictionResultId.prediction || id == PredictionResultId.activationMemory) {
             cSetValue(cObject, id.getValue(), val.getCObject());
         }
         else {
@@ -45,7 +45,12 @@ public final class PredictionResultId {
         return _value;
     }
 
-    private static final int predictionId = 0;
+    private static final int predictionId       = 0;
+    private static final int activationMemoryId = 1;
 
-    public static final PredictionResultId prediction = new PredictionResultId(predictionId); /*!< Prediction results */
+    public static final PredictionResultId prediction       = new PredictionResultId(predictionId);       /*!< Prediction results */
+    public static final PredictionResultId activationMemory = new PredictionResultId(activationMemoryId); /*!< Memory in bytes used for
+                                                                                                               the values of the layers and
+                                                                                                               the memory needed without
+                                                                                                               buffer reuse */
 }
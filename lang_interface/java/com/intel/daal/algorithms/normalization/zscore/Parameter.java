@@ -57,9 +57,28 @@ public class Parameter extends com.intel.daal.algorithms.Parameter {
     public void setMoments(BatchIface moments) {
         cSetMoments(this.cObject, moments.cBatchIface, _prec.getValue(), _method.getValue(), _cmode.getValue());
     }
+
+    /**
+     * Sets the flag that enables in-place normalization
+     * @param doInPlace If true, the input data table is normalized in place and returned as the normalized data result
+     */
+    public void setDoInPlace(boolean doInPlace) {
+        cSetDoInPlace(this.cObject, doInPlace);
+    }
+
+    /**
+     * Returns the flag that enables in-place normalization
+     * @return Flag that enables in-place normalization
+     */
+    public boolean getDoInPlace() {
+        return cGetDoInPlace(this.cObject);
+    }
+
     private Method _method;
     private ComputeMode _cmode;
     private Precision _prec;
 
     private native void cSetMoments(long cObject, long moments, int prec, int method, int cmode);
+    private native void cSetDoInPlace(long cObject, boolean doInPlace);
+    private native boolean cGetDoInPlace(long cObject);
 }
@@ -396,4 +396,23 @@ public class HomogenNumericTable extends NumericTable {
     public Class<? extends Number> getNumericType() {
         return ((HomogenNumericTableImpl)tableImpl).getNumericType();
     }
+
+    /**
+     * Exposes the data of the table stored in a Java array to native algorithms once,
+     * so that blocks of rows and columns are accessed without calls to the Java side.
+     * The JVM may provide a copy of the array to the native code. In this case the changes
+     * made by native algorithms become visible in the array after unpin(), and the changes
+     * made to the array from Java are not visible to native algorithms until unpin()
+     * @return True if the data is pinned, false if the table does not need or support pinning
+     */
+    public boolean pin() {
+        return ((HomogenNumericTableImpl)tableImpl).pin();
+    }
+
+    /**
+     * Releases the data pinned by pin() and writes back the changes made by native algorithms
+     */
+    public void unpin() {
+        ((HomogenNumericTableImpl)tableImpl).unpin();
+    }
 }
@@ -516,6 +516,18 @@ class HomogenNumericTableArrayImpl extends HomogenNumericTableImpl {
         throw new IllegalArgumentException("can not change number of columns in Homogen Numeric Table with data on Java side");
     }
 
+    /** @copydoc HomogenNumericTable::pin() */
+    @Override
+    public boolean pin() {
+        return pinData(jData);
+    }
+
+    /** @copydoc HomogenNumericTable::unpin() */
+    @Override
+    public void unpin() {
+        unpinData();
+    }
+
     private void initialize(DaalContext context, Class<? extends Number> cls, Object data, long nFeatures, long nVectors) {
         type = cls;
         cObject = newJavaNumericTable(nFeatures, nVectors, NumericTable.StorageLayout.aos);
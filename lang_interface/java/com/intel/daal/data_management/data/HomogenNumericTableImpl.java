@@ -54,6 +54,12 @@ abstract class HomogenNumericTableImpl extends NumericTableImpl {
 
     abstract public Class<? extends Number> getNumericType();
 
+    public boolean pin() {
+        return false;
+    }
+
+    public void unpin() {}
+
     abstract public void set(long row, long column, double value);
 
     abstract public void set(long row, long column, float value);
@@ -300,7 +300,27 @@ abstract public class NumericTableImpl extends SerializableBase {
         return cNewJavaNumericTable(nColumns, nRows, layout.ordinal());
     }
 
+    /**
+     * Exposes the data of the table to the native code as one memory region, so that native
+     * algorithms access blocks of rows and columns without calls back to Java.
+     * Supported for tables with the aos layout and features of the same type
+     * @param data  Direct ByteBuffer or array of doubles, floats, longs or ints with the table data
+     * @return True if the data is pinned, false if the data storage is not supported
+     */
+    protected boolean pinData(Object data) {
+        return cPinJavaData(cObject, data);
+    }
+
+    /**
+     * Releases the data pinned by pinData(Object)
+     */
+    protected void unpinData() {
+        cUnpinJavaData(cObject);
+    }
+
     private native long cNewJavaNumericTable(long nColumns, long nRows, int layout);
+    private native boolean cPinJavaData(long cTable, Object data);
+    private native void cUnpinJavaData(long cTable);
     protected native long cGetCDataDictionary(long cTable);
 
     @Override
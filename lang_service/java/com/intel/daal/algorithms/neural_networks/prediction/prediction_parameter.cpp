@@ -35,3 +35,47 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_predicti
 {
     return (jlong)(new prediction::Parameter());
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_prediction_PredictionParameter
+ * Method:    cGetBatchSize
+ * Signature: (J)J
+ */
+JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_prediction_PredictionParameter_cGetBatchSize
+  (JNIEnv *env, jobject thisObj, jlong cParameter)
+{
+    return (((prediction::Parameter *)cParameter))->batchSize;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_prediction_PredictionParameter
+ * Method:    cSetBatchSize
+ * Signature: (JJ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_prediction_PredictionParameter_cSetBatchSize
+  (JNIEnv *env, jobject thisObj, jlong cParameter, jlong batchSize)
+{
+    (((prediction::Parameter *)cParameter))->batchSize = batchSize;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_prediction_PredictionParameter
+ * Method:    cGetReuseActivationMemory
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_neural_1networks_prediction_PredictionParameter_cGetReuseActivationMemory
+  (JNIEnv *env, jobject thisObj, jlong cParameter)
+{
+    return (((prediction::Parameter *)cParameter))->reuseActivationMemory;
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_neural_networks_prediction_PredictionParameter
+ * Method:    cSetReuseActivationMemory
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_prediction_PredictionParameter_cSetReuseActivationMemory
+  (JNIEnv *env, jobject thisObj, jlong cParameter, jboolean reuseActivationMemory)
+{
+    (((prediction::Parameter *)cParameter))->reuseActivationMemory = reuseActivationMemory;
+}
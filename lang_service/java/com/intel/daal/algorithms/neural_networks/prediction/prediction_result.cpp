@@ -24,6 +24,7 @@
 #include "common_helpers.h"
 
 #define predictionId com_intel_daal_algorithms_neural_networks_prediction_PredictionResultId_predictionId
+#define activationMemoryId com_intel_daal_algorithms_neural_networks_prediction_PredictionResultId_activationMemoryId
 
 USING_COMMON_NAMESPACES();
 using namespace daal::algorithms::neural_networks;
@@ -36,7 +37,7 @@ using namespace daal::algorithms::neural_networks;
 JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_prediction_PredictionResult_cGetValue
   (JNIEnv *env, jobject thisObj, jlong resAddr, jint id)
 {
-    if (id == predictionId)
+    if (id == predictionId || id == activationMemoryId)
     {
         return jniArgument<prediction::Result>::get<prediction::ResultId, Tensor>(resAddr, id);
     }
@@ -52,7 +53,7 @@ JNIEXPORT jlong JNICALL Java_com_intel_daal_algorithms_neural_1networks_predicti
 JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_neural_1networks_prediction_PredictionResult_cSetValue
   (JNIEnv *env, jobject thisObj, jlong resAddr, jint id, jlong ntAddr)
 {
-    if (id == predictionId)
+    if (id == predictionId || id == activationMemoryId)
     {
         jniArgument<prediction::Result>::set<prediction::ResultId, Tensor>(resAddr, id, ntAddr);
     }
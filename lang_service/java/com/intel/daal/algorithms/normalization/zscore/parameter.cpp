@@ -62,3 +62,25 @@ JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Param
         }
     }
 }
+
+/*
+ * Class:     com_intel_daal_algorithms_normalization_zscore_Parameter
+ * Method:    cSetDoInPlace
+ * Signature: (JZ)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Parameter_cSetDoInPlace
+(JNIEnv *env, jobject thisObj, jlong parAddr, jboolean doInPlace)
+{
+    (*((normalization::zscore::BaseParameter *)parAddr)).doInPlace = (doInPlace != 0);
+}
+
+/*
+ * Class:     com_intel_daal_algorithms_normalization_zscore_Parameter
+ * Method:    cGetDoInPlace
+ * Signature: (J)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_algorithms_normalization_zscore_Parameter_cGetDoInPlace
+(JNIEnv *env, jobject thisObj, jlong parAddr)
+{
+    return (jboolean)(*((normalization::zscore::BaseParameter *)parAddr)).doInPlace;
+}
@@ -29,6 +29,7 @@
 
 
 #include "numeric_table.h"
+#include "data_utils.h"
 
 using namespace daal::data_management;
 
@@ -43,7 +44,8 @@ namespace daal
 class JavaNumericTable : public NumericTable
 {
 public:
-    explicit JavaNumericTable(bool featuresEqual = false): NumericTable(0, 0, featuresEqual), jvm(NULL), jJavaNumTable(NULL) {
+    explicit JavaNumericTable(bool featuresEqual = false): NumericTable(0, 0, featuresEqual), jvm(NULL), jJavaNumTable(NULL),
+        _pinnedPtr(NULL), _pinnedObject(NULL), _pinnedIsArray(false), _pinnedType(data_feature_utils::DAAL_OTHER_T) {
     }
 
     /**
@@ -56,7 +58,8 @@ public:
      */
     JavaNumericTable(size_t featnum, size_t obsnum, JavaVM *_jvm, jobject _JavaNumTable,
                      StorageLayout layout = layout_unknown, bool featuresEqual = false):
-        NumericTable(featnum, obsnum, featuresEqual), jvm(_jvm)
+        NumericTable(featnum, obsnum, featuresEqual), jvm(_jvm),
+        _pinnedPtr(NULL), _pinnedObject(NULL), _pinnedIsArray(false), _pinnedType(data_feature_utils::DAAL_OTHER_T)
     {
         _layout = layout;
         _memStatus = userAllocated;
@@ -106,6 +109,7 @@ public:
             else
             {
                 local_tls.is_attached = true;
+                unpinData(local_tls.jenv);
             }
 
             if (jJavaNumTable != NULL)
@@ -290,6 +294,12 @@ public:
     void getTBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> &block,
                    const char *javaMethodName, const char *javaMethodSignature)
     {
+        if(_pinnedPtr != NULL)
+        {
+            getTPinnedBlock<T>(idx, nrows, rwFlag, block);
+            return;
+        }
+
         jint status = JNI_OK;
         _tls local_tls = tls.local();
 
@@ -404,6 +414,12 @@ public:
     template<typename T>
     void releaseTBlock(BlockDescriptor<T> &block, const char *javaMethodName)
     {
+        if(_pinnedPtr != NULL)
+        {
+            releaseTPinnedBlock<T>(block);
+            return;
+        }
+
         jint status = JNI_OK;
         _tls local_tls = tls.local();
         if(block.getRWFlag() == writeOnly)
@@ -464,6 +480,12 @@ public:
     void getTFeature(size_t feature_idx, size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> &block,
                      const char *javaMethodName, const char *javaMethodSignature)
     {
+        if(_pinnedPtr != NULL)
+        {
+            getTPinnedFeature<T>(feature_idx, idx, nrows, rwFlag, block);
+            return;
+        }
+
         jint status = JNI_OK;
         _tls local_tls = tls.local();
 
@@ -563,6 +585,12 @@ public:
     template<typename T>
     void releaseTFeature(BlockDescriptor<T> &block, const char *javaMethodName)
     {
+        if(_pinnedPtr != NULL)
+        {
+            releaseTPinnedFeature<T>(block);
+            return;
+        }
+
         jint status = JNI_OK;
         if(block.getRWFlag() == writeOnly)
         {
@@ -610,6 +638,120 @@ public:
         block.setDetails( 0, 0, 0 );
     }
 
+    /**
+     *  Exposes the data of the Java object to the native code as one memory region.
+     *  While the data is pinned, blocks of rows and columns are served from this region
+     *  without calls to the Java side. Only homogeneous tables with the aos layout are supported.
+     *  If the data is an array of primitives, the JVM may provide a copy of the array;
+     *  the changes are then written back to the array by unpinData()
+     *
+     *  \param jenv[in]  JNI interface pointer for the current thread
+     *  \param jdata[in] Direct java.nio buffer in the native byte order or array of doubles, floats, longs or ints
+     *                   with the data of the table
+     *
+     *  \return true if the data is pinned, false if the data storage is not supported
+     */
+    bool pinData(JNIEnv *jenv, jobject jdata)
+    {
+        unpinData(jenv);
+
+        if(jdata == NULL || _layout != aos) { return false; }
+
+        size_t nElements = getNumberOfColumns() * getNumberOfRows();
+        if(nElements == 0) { return false; }
+
+        void *ptr = jenv->GetDirectBufferAddress(jdata);
+        if(ptr != NULL)
+        {
+            /* Data in the buffer is read as is, so its byte order must match the native one */
+            if(!hasNativeByteOrder(jenv, jdata)) { return false; }
+
+            /* Type of the data in a direct buffer is defined by the data dictionary */
+            data_feature_utils::IndexNumType type = (*_ddict)[0].indexType;
+            for(size_t i = 1; i < getNumberOfColumns(); i++)
+            {
+                if((*_ddict)[i].indexType != type) { return false; }
+            }
+            size_t typeSize = getTypeSize(type);
+            if(typeSize == 0 || (size_t)jenv->GetDirectBufferCapacity(jdata) < nElements * typeSize) { return false; }
+
+            _pinnedObject = jenv->NewGlobalRef(jdata);
+            if(_pinnedObject == NULL) { return false; }
+            _pinnedIsArray = false;
+            _pinnedType    = type;
+            _pinnedPtr     = ptr;
+            return true;
+        }
+
+        data_feature_utils::IndexNumType type = getArrayType(jenv, jdata);
+        if(type == data_feature_utils::DAAL_OTHER_T) { return false; }
+        if((size_t)jenv->GetArrayLength((jarray)jdata) < nElements) { return false; }
+
+        _pinnedObject = jenv->NewGlobalRef(jdata);
+        if(_pinnedObject == NULL) { return false; }
+
+        switch(type)
+        {
+        case data_feature_utils::DAAL_FLOAT64:
+            ptr = jenv->GetDoubleArrayElements((jdoubleArray)_pinnedObject, NULL); break;
+        case data_feature_utils::DAAL_FLOAT32:
+            ptr = jenv->GetFloatArrayElements((jfloatArray)_pinnedObject, NULL);   break;
+        case data_feature_utils::DAAL_INT64_S:
+            ptr = jenv->GetLongArrayElements((jlongArray)_pinnedObject, NULL);     break;
+        default:
+            ptr = jenv->GetIntArrayElements((jintArray)_pinnedObject, NULL);       break;
+        }
+
+        if(ptr == NULL)
+        {
+            jenv->DeleteGlobalRef(_pinnedObject);
+            _pinnedObject = NULL;
+            return false;
+        }
+
+        _pinnedIsArray = true;
+        _pinnedType    = type;
+        _pinnedPtr     = ptr;
+        return true;
+    }
+
+    /**
+     *  Releases the data pinned by pinData(). Further blocks of rows and columns are obtained
+     *  from the Java object
+     *
+     *  \param jenv[in]  JNI interface pointer for the current thread
+     */
+    void unpinData(JNIEnv *jenv)
+    {
+        if(_pinnedObject == NULL) { return; }
+
+        if(_pinnedIsArray)
+        {
+            switch(_pinnedType)
+            {
+            case data_feature_utils::DAAL_FLOAT64:
+                jenv->ReleaseDoubleArrayElements((jdoubleArray)_pinnedObject, (jdouble *)_pinnedPtr, 0); break;
+            case data_feature_utils::DAAL_FLOAT32:
+                jenv->ReleaseFloatArrayElements((jfloatArray)_pinnedObject, (jfloat *)_pinnedPtr, 0);    break;
+            case data_feature_utils::DAAL_INT64_S:
+                jenv->ReleaseLongArrayElements((jlongArray)_pinnedObject, (jlong *)_pinnedPtr, 0);       break;
+            default:
+                jenv->ReleaseIntArrayElements((jintArray)_pinnedObject, (jint *)_pinnedPtr, 0);          break;
+            }
+        }
+        jenv->DeleteGlobalRef(_pinnedObject);
+
+        _pinnedObject  = NULL;
+        _pinnedPtr     = NULL;
+        _pinnedIsArray = false;
+        _pinnedType    = data_feature_utils::DAAL_OTHER_T;
+    }
+
+    /**
+     *  Returns true if the data of the Java object is pinned by pinData()
+     */
+    bool isDataPinned() const { return (_pinnedPtr != NULL); }
+
     virtual void allocateDataMemory() {}
 
     virtual void freeDataMemory() {}
@@ -640,6 +782,167 @@ public:
 
     jobject getJavaObject() { return jJavaNumTable; }
 protected:
+    template<typename T>
+    void getTPinnedBlock(size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( 0, idx, rwFlag );
+
+        if(idx >= nobs)
+        {
+            block.resizeBuffer( ncols, 0 );
+            return;
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        char *location = (char *)_pinnedPtr + idx * ncols * getTypeSize(_pinnedType);
+
+        if(data_feature_utils::getIndexNumType<T>() == _pinnedType)
+        {
+            block.setPtr( (T *)location, ncols, nrows );
+            return;
+        }
+
+        if( !block.resizeBuffer( ncols, nrows ) )
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        if(rwFlag & (int)readOnly)
+        {
+            data_feature_utils::vectorUpCast[_pinnedType][data_feature_utils::getInternalNumType<T>()]
+            ( nrows * ncols, location, block.getBlockPtr() );
+        }
+    }
+
+    template<typename T>
+    void releaseTPinnedBlock(BlockDescriptor<T> &block)
+    {
+        if((block.getRWFlag() & (int)writeOnly) && data_feature_utils::getIndexNumType<T>() != _pinnedType)
+        {
+            size_t ncols = getNumberOfColumns();
+            char *location = (char *)_pinnedPtr + block.getRowsOffset() * ncols * getTypeSize(_pinnedType);
+
+            data_feature_utils::vectorDownCast[_pinnedType][data_feature_utils::getInternalNumType<T>()]
+            ( block.getNumberOfRows() * ncols, block.getBlockPtr(), location );
+        }
+        block.setDetails( 0, 0, 0 );
+    }
+
+    template<typename T>
+    void getTPinnedFeature(size_t feature_idx, size_t idx, size_t nrows, ReadWriteMode rwFlag, BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        size_t nobs  = getNumberOfRows();
+        block.setDetails( feature_idx, idx, rwFlag );
+
+        if(idx >= nobs)
+        {
+            block.resizeBuffer( 1, 0 );
+            return;
+        }
+
+        nrows = ( idx + nrows < nobs ) ? nrows : nobs - idx;
+
+        size_t typeSize = getTypeSize(_pinnedType);
+        char *location = (char *)_pinnedPtr + (idx * ncols + feature_idx) * typeSize;
+
+        if(data_feature_utils::getIndexNumType<T>() == _pinnedType && ncols == 1)
+        {
+            block.setPtr( (T *)location, 1, nrows );
+            return;
+        }
+
+        if( !block.resizeBuffer( 1, nrows ) )
+        {
+            this->_errors->add(services::ErrorMemoryAllocationFailed);
+            return;
+        }
+
+        if(rwFlag & (int)readOnly)
+        {
+            data_feature_utils::vectorStrideUpCast[_pinnedType][data_feature_utils::getInternalNumType<T>()]
+            ( nrows, location, ncols * typeSize, block.getBlockPtr(), sizeof(T) );
+        }
+    }
+
+    template<typename T>
+    void releaseTPinnedFeature(BlockDescriptor<T> &block)
+    {
+        size_t ncols = getNumberOfColumns();
+        bool isZeroCopy = (data_feature_utils::getIndexNumType<T>() == _pinnedType && ncols == 1);
+
+        if((block.getRWFlag() & (int)writeOnly) && !isZeroCopy)
+        {
+            size_t typeSize = getTypeSize(_pinnedType);
+            char *location = (char *)_pinnedPtr + (block.getRowsOffset() * ncols + block.getColumnsOffset()) * typeSize;
+
+            data_feature_utils::vectorStrideDownCast[_pinnedType][data_feature_utils::getInternalNumType<T>()]
+            ( block.getNumberOfRows(), block.getBlockPtr(), sizeof(T), location, ncols * typeSize );
+        }
+        block.setDetails( 0, 0, 0 );
+    }
+
+    static size_t getTypeSize(data_feature_utils::IndexNumType type)
+    {
+        switch(type)
+        {
+        case data_feature_utils::DAAL_FLOAT64: return sizeof(double);
+        case data_feature_utils::DAAL_FLOAT32: return sizeof(float);
+        case data_feature_utils::DAAL_INT64_S: return sizeof(DAAL_INT64);
+        case data_feature_utils::DAAL_INT32_S: return sizeof(int);
+        default:                               return 0;
+        }
+    }
+
+    static data_feature_utils::IndexNumType getArrayType(JNIEnv *jenv, jobject jdata)
+    {
+        static const char *signatures[] = { "[D", "[F", "[J", "[I" };
+        static const data_feature_utils::IndexNumType types[] =
+        {
+            data_feature_utils::DAAL_FLOAT64, data_feature_utils::DAAL_FLOAT32,
+            data_feature_utils::DAAL_INT64_S, data_feature_utils::DAAL_INT32_S
+        };
+
+        for(size_t i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+        {
+            jclass cls = jenv->FindClass(signatures[i]);
+            if(cls == NULL) { jenv->ExceptionClear(); continue; }
+            bool isInstance = jenv->IsInstanceOf(jdata, cls);
+            jenv->DeleteLocalRef(cls);
+            if(isInstance) { return types[i]; }
+        }
+        return data_feature_utils::DAAL_OTHER_T;
+    }
+
+    /* Returns true if the order() of the java.nio buffer is ByteOrder.nativeOrder() */
+    static bool hasNativeByteOrder(JNIEnv *jenv, jobject jbuffer)
+    {
+        bool result = false;
+        jclass clsBuffer    = jenv->GetObjectClass(jbuffer);
+        jclass clsByteOrder = jenv->FindClass("java/nio/ByteOrder");
+        if(clsBuffer != NULL && clsByteOrder != NULL)
+        {
+            jmethodID jmethOrder  = jenv->GetMethodID(clsBuffer, "order", "()Ljava/nio/ByteOrder;");
+            jmethodID jmethNative = jenv->GetStaticMethodID(clsByteOrder, "nativeOrder", "()Ljava/nio/ByteOrder;");
+            if(jmethOrder != NULL && jmethNative != NULL)
+            {
+                jobject jorder       = jenv->CallObjectMethod(jbuffer, jmethOrder);
+                jobject jnativeOrder = jenv->CallStaticObjectMethod(clsByteOrder, jmethNative);
+                result = (jorder != NULL && jenv->IsSameObject(jorder, jnativeOrder));
+                if(jorder       != NULL) { jenv->DeleteLocalRef(jorder); }
+                if(jnativeOrder != NULL) { jenv->DeleteLocalRef(jnativeOrder); }
+            }
+        }
+        if(jenv->ExceptionCheck()) { jenv->ExceptionClear(); result = false; }
+        if(clsBuffer    != NULL) { jenv->DeleteLocalRef(clsBuffer); }
+        if(clsByteOrder != NULL) { jenv->DeleteLocalRef(clsByteOrder); }
+        return result;
+    }
+
     struct _tls
     {
         JNIEnv *jenv;    // JNI interface poiner
@@ -660,6 +963,10 @@ protected:
     tbb::enumerable_thread_specific<_tls> tls;  /**< Thread local storage */
     jobject jJavaNumTable;                      /**< Java object associated with this C++ object */
     JavaVM *jvm;                                /**< Java VM interface function table */
+    void *_pinnedPtr;                           /**< Pointer to the pinned data of the Java object */
+    jobject _pinnedObject;                      /**< Global reference to the Java buffer or array with the pinned data */
+    bool _pinnedIsArray;                        /**< True if the pinned data is an array of primitives */
+    data_feature_utils::IndexNumType _pinnedType; /**< Type of the pinned data */
 
 private:
     static JavaVM *globalJavaVM;
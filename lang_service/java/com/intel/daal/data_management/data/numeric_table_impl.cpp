@@ -290,3 +290,35 @@ JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_NumericTableImp
     SharedPtr<NumericTableDictionary> *dict = (SharedPtr<NumericTableDictionary>*)cDictionary;
     (*nt)->setDictionary(dict->get());
 }
+
+/*
+ * Class:     com_intel_daal_data_1management_data_NumericTableImpl
+ * Method:    cPinJavaData
+ * Signature:(JLjava/lang/Object;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_com_intel_daal_data_1management_data_NumericTableImpl_cPinJavaData
+(JNIEnv *env, jobject thisObj, jlong cTable, jobject data)
+{
+    using namespace daal;
+    SharedPtr<NumericTable> *nt = (SharedPtr<NumericTable> *)cTable;
+    daal::JavaNumericTable *javaTable = dynamic_cast<daal::JavaNumericTable *>(nt->get());
+    if(javaTable == NULL) { return JNI_FALSE; }
+    return (javaTable->pinData(env, data) ? JNI_TRUE : JNI_FALSE);
+}
+
+/*
+ * Class:     com_intel_daal_data_1management_data_NumericTableImpl
+ * Method:    cUnpinJavaData
+ * Signature:(J)V
+ */
+JNIEXPORT void JNICALL Java_com_intel_daal_data_1management_data_NumericTableImpl_cUnpinJavaData
+(JNIEnv *env, jobject thisObj, jlong cTable)
+{
+    using namespace daal;
+    SharedPtr<NumericTable> *nt = (SharedPtr<NumericTable> *)cTable;
+    daal::JavaNumericTable *javaTable = dynamic_cast<daal::JavaNumericTable *>(nt->get());
+    if(javaTable != NULL)
+    {
+        javaTable->unpinData(env);
+    }
+}
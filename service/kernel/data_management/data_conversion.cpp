@@ -0,0 +1,81 @@
+/* file: data_conversion.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Dispatching of the conversion functions for heterogeneous numeric tables
+//  to the implementations for the detected processor type.
+//--
+*/
+
+#include "data_conversion_kernel.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace data_feature_utils
+{
+namespace internal
+{
+
+static int getCpuType()
+{
+    int cpuid = daal::services::Environment::getInstance()->getCpuId();
+    return (cpuid < 0 ? (int)sse2 : cpuid);
+}
+
+#define DAAL_DISPATCH_CONVERSION(func, T, ...)                          \
+    switch(getCpuType())                                                \
+    {                                                                   \
+    case avx512:     func<T, avx512>    (__VA_ARGS__); break;           \
+    case avx512_mic: func<T, avx512_mic>(__VA_ARGS__); break;           \
+    case avx2:       func<T, avx2>      (__VA_ARGS__); break;           \
+    case avx:        func<T, avx>       (__VA_ARGS__); break;           \
+    case sse42:      func<T, sse42>     (__VA_ARGS__); break;           \
+    case ssse3:      func<T, ssse3>     (__VA_ARGS__); break;           \
+    default:         func<T, sse2>      (__VA_ARGS__); break;           \
+    }
+
+#define DAAL_DEFINE_CONVERSION(T)                                                                                   \
+DAAL_EXPORT void soaToRows(size_t idx, size_t nrows, void *const *arrays, NumericTableDictionary &dict, T *dst)     \
+{                                                                                                                   \
+    DAAL_DISPATCH_CONVERSION(soaToRowsImpl, T, idx, nrows, arrays, dict, dst)                                       \
+}                                                                                                                   \
+DAAL_EXPORT void rowsToSoa(size_t idx, size_t nrows, const T *src, void *const *arrays, NumericTableDictionary &dict) \
+{                                                                                                                   \
+    DAAL_DISPATCH_CONVERSION(rowsToSoaImpl, T, idx, nrows, src, arrays, dict)                                       \
+}                                                                                                                   \
+DAAL_EXPORT void aosToRows(size_t idx, size_t nrows, const void *ptr, size_t structSize, const size_t *offsets,     \
+                           NumericTableDictionary &dict, T *dst)                                                    \
+{                                                                                                                   \
+    DAAL_DISPATCH_CONVERSION(aosToRowsImpl, T, idx, nrows, ptr, structSize, offsets, dict, dst)                     \
+}                                                                                                                   \
+DAAL_EXPORT void rowsToAos(size_t idx, size_t nrows, const T *src, void *ptr, size_t structSize,                    \
+                           const size_t *offsets, NumericTableDictionary &dict)                                     \
+{                                                                                                                   \
+    DAAL_DISPATCH_CONVERSION(rowsToAosImpl, T, idx, nrows, src, ptr, structSize, offsets, dict)                     \
+}
+
+DAAL_DEFINE_CONVERSION(double)
+DAAL_DEFINE_CONVERSION(float)
+DAAL_DEFINE_CONVERSION(int)
+
+} // namespace internal
+} // namespace data_feature_utils
+} // namespace data_management
+} // namespace daal
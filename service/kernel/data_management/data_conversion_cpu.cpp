@@ -0,0 +1,50 @@
+/* file: data_conversion_cpu.cpp */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Instantiation of the conversion functions for heterogeneous numeric tables.
+//--
+*/
+
+#include "data_conversion_impl.i"
+
+namespace daal
+{
+namespace data_management
+{
+namespace data_feature_utils
+{
+namespace internal
+{
+
+#define DAAL_INSTANTIATE_CONVERSION(T)                                                                              \
+template void soaToRowsImpl<T, DAAL_CPU>(size_t, size_t, void *const *, NumericTableDictionary &, T *);             \
+template void rowsToSoaImpl<T, DAAL_CPU>(size_t, size_t, const T *, void *const *, NumericTableDictionary &);       \
+template void aosToRowsImpl<T, DAAL_CPU>(size_t, size_t, const void *, size_t, const size_t *,                      \
+                                         NumericTableDictionary &, T *);                                            \
+template void rowsToAosImpl<T, DAAL_CPU>(size_t, size_t, const T *, void *, size_t, const size_t *,                 \
+                                         NumericTableDictionary &);
+
+DAAL_INSTANTIATE_CONVERSION(double)
+DAAL_INSTANTIATE_CONVERSION(float)
+DAAL_INSTANTIATE_CONVERSION(int)
+
+} // namespace internal
+} // namespace data_feature_utils
+} // namespace data_management
+} // namespace daal
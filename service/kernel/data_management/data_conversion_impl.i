@@ -0,0 +1,369 @@
+/* file: data_conversion_impl.i */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Implementation of cache-blocked conversion of blocks of heterogeneous numeric tables
+//  to and from row-major blocks.
+//
+//  Rows are processed in tiles of rowsInTile rows. For a structure of arrays, the values of
+//  colsInTile features of a tile are converted into a contiguous buffer and the buffer is
+//  transposed into the block; the fixed sizes of the buffer let the compiler vectorize the
+//  transposition for the target instruction set. Large blocks are processed in parallel.
+//--
+*/
+
+#ifndef __DATA_CONVERSION_IMPL_I__
+#define __DATA_CONVERSION_IMPL_I__
+
+#include "data_conversion_kernel.h"
+#include "service_defines.h"
+#include "threading.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace data_feature_utils
+{
+namespace internal
+{
+
+const size_t rowsInTile     = 64;           /* Number of rows converted at once */
+const size_t colsInTile     = 8;            /* Number of features transposed at once */
+const size_t rowsInThreadBlock = 8 * rowsInTile;    /* Number of rows processed by one thread */
+const size_t minElementsForThreading = 1 << 16;     /* Minimal size of the block processed in parallel */
+
+template<typename SrcType, typename DstType, CpuType cpu>
+inline void convertVector(size_t n, const SrcType *src, DstType *dst)
+{
+  PRAGMA_IVDEP
+  PRAGMA_VECTOR_ALWAYS
+    for(size_t i = 0; i < n; i++)
+    {
+        dst[i] = static_cast<DstType>(src[i]);
+    }
+}
+
+template<typename SrcType, typename DstType, CpuType cpu>
+inline void convertStrideVector(size_t n, const char *src, size_t srcByteStride, char *dst, size_t dstByteStride)
+{
+  PRAGMA_IVDEP
+    for(size_t i = 0; i < n; i++)
+    {
+        *(DstType *)(dst + i * dstByteStride) = static_cast<DstType>(*(const SrcType *)(src + i * srcByteStride));
+    }
+}
+
+/* Converts n values of the type defined by srcType to the values of type T */
+template<typename T, CpuType cpu>
+void upCastVector(IndexNumType srcType, size_t n, const void *src, T *dst)
+{
+    switch(srcType)
+    {
+    case DAAL_FLOAT32:  convertVector<float,          T, cpu>(n, (const float *)src,          dst); break;
+    case DAAL_FLOAT64:  convertVector<double,         T, cpu>(n, (const double *)src,         dst); break;
+    case DAAL_INT32_S:  convertVector<int,            T, cpu>(n, (const int *)src,            dst); break;
+    case DAAL_INT32_U:  convertVector<unsigned int,   T, cpu>(n, (const unsigned int *)src,   dst); break;
+    case DAAL_INT64_S:  convertVector<DAAL_INT64,     T, cpu>(n, (const DAAL_INT64 *)src,     dst); break;
+    case DAAL_INT64_U:  convertVector<DAAL_UINT64,    T, cpu>(n, (const DAAL_UINT64 *)src,    dst); break;
+    case DAAL_INT8_S:   convertVector<char,           T, cpu>(n, (const char *)src,           dst); break;
+    case DAAL_INT8_U:   convertVector<unsigned char,  T, cpu>(n, (const unsigned char *)src,  dst); break;
+    case DAAL_INT16_S:  convertVector<short,          T, cpu>(n, (const short *)src,          dst); break;
+    case DAAL_INT16_U:  convertVector<unsigned short, T, cpu>(n, (const unsigned short *)src, dst); break;
+    default: break;
+    }
+}
+
+/* Converts n values of type T to the values of the type defined by dstType */
+template<typename T, CpuType cpu>
+void downCastVector(IndexNumType dstType, size_t n, const T *src, void *dst)
+{
+    switch(dstType)
+    {
+    case DAAL_FLOAT32:  convertVector<T, float,          cpu>(n, src, (float *)dst);          break;
+    case DAAL_FLOAT64:  convertVector<T, double,         cpu>(n, src, (double *)dst);         break;
+    case DAAL_INT32_S:  convertVector<T, int,            cpu>(n, src, (int *)dst);            break;
+    case DAAL_INT32_U:  convertVector<T, unsigned int,   cpu>(n, src, (unsigned int *)dst);   break;
+    case DAAL_INT64_S:  convertVector<T, DAAL_INT64,     cpu>(n, src, (DAAL_INT64 *)dst);     break;
+    case DAAL_INT64_U:  convertVector<T, DAAL_UINT64,    cpu>(n, src, (DAAL_UINT64 *)dst);    break;
+    case DAAL_INT8_S:   convertVector<T, char,           cpu>(n, src, (char *)dst);           break;
+    case DAAL_INT8_U:   convertVector<T, unsigned char,  cpu>(n, src, (unsigned char *)dst);  break;
+    case DAAL_INT16_S:  convertVector<T, short,          cpu>(n, src, (short *)dst);          break;
+    case DAAL_INT16_U:  convertVector<T, unsigned short, cpu>(n, src, (unsigned short *)dst); break;
+    default: break;
+    }
+}
+
+/* Converts n values of the type defined by srcType located with the byte stride to the values of type T */
+template<typename T, CpuType cpu>
+void upCastStrideVector(IndexNumType srcType, size_t n, const char *src, size_t srcByteStride, T *dst, size_t dstStride)
+{
+    char *d = (char *)dst;
+    size_t dstByteStride = dstStride * sizeof(T);
+    switch(srcType)
+    {
+    case DAAL_FLOAT32:  convertStrideVector<float,          T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_FLOAT64:  convertStrideVector<double,         T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_INT32_S:  convertStrideVector<int,            T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_INT32_U:  convertStrideVector<unsigned int,   T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_INT64_S:  convertStrideVector<DAAL_INT64,     T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_INT64_U:  convertStrideVector<DAAL_UINT64,    T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_INT8_S:   convertStrideVector<char,           T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_INT8_U:   convertStrideVector<unsigned char,  T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_INT16_S:  convertStrideVector<short,          T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    case DAAL_INT16_U:  convertStrideVector<unsigned short, T, cpu>(n, src, srcByteStride, d, dstByteStride); break;
+    default: break;
+    }
+}
+
+/* Converts n values of type T to the values of the type defined by dstType located with the byte stride */
+template<typename T, CpuType cpu>
+void downCastStrideVector(IndexNumType dstType, size_t n, const T *src, size_t srcStride, char *dst, size_t dstByteStride)
+{
+    const char *s = (const char *)src;
+    size_t srcByteStride = srcStride * sizeof(T);
+    switch(dstType)
+    {
+    case DAAL_FLOAT32:  convertStrideVector<T, float,          cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_FLOAT64:  convertStrideVector<T, double,         cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_INT32_S:  convertStrideVector<T, int,            cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_INT32_U:  convertStrideVector<T, unsigned int,   cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_INT64_S:  convertStrideVector<T, DAAL_INT64,     cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_INT64_U:  convertStrideVector<T, DAAL_UINT64,    cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_INT8_S:   convertStrideVector<T, char,           cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_INT8_U:   convertStrideVector<T, unsigned char,  cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_INT16_S:  convertStrideVector<T, short,          cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    case DAAL_INT16_U:  convertStrideVector<T, unsigned short, cpu>(n, s, srcByteStride, dst, dstByteStride); break;
+    default: break;
+    }
+}
+
+/* Transposes the tile stored by columns with the leading dimension rowsInTile into the rows of the block */
+template<typename T, CpuType cpu>
+void transposeTileToRows(size_t nr, size_t nc, const T *tile, T *dst, size_t ldDst)
+{
+    if(nr == rowsInTile && nc == colsInTile)
+    {
+        for(size_t i = 0; i < rowsInTile; i++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t j = 0; j < colsInTile; j++)
+            {
+                dst[i * ldDst + j] = tile[j * rowsInTile + i];
+            }
+        }
+        return;
+    }
+
+    for(size_t i = 0; i < nr; i++)
+    {
+      PRAGMA_IVDEP
+        for(size_t j = 0; j < nc; j++)
+        {
+            dst[i * ldDst + j] = tile[j * rowsInTile + i];
+        }
+    }
+}
+
+/* Transposes the rows of the block into the tile stored by columns with the leading dimension rowsInTile */
+template<typename T, CpuType cpu>
+void transposeRowsToTile(size_t nr, size_t nc, const T *src, size_t ldSrc, T *tile)
+{
+    if(nr == rowsInTile && nc == colsInTile)
+    {
+        for(size_t j = 0; j < colsInTile; j++)
+        {
+          PRAGMA_IVDEP
+          PRAGMA_VECTOR_ALWAYS
+            for(size_t i = 0; i < rowsInTile; i++)
+            {
+                tile[j * rowsInTile + i] = src[i * ldSrc + j];
+            }
+        }
+        return;
+    }
+
+    for(size_t j = 0; j < nc; j++)
+    {
+      PRAGMA_IVDEP
+        for(size_t i = 0; i < nr; i++)
+        {
+            tile[j * rowsInTile + i] = src[i * ldSrc + j];
+        }
+    }
+}
+
+/* Calls func(iBegin, iEnd) for the ranges of rows of the block, in parallel if the block is large */
+template<typename F>
+void processRowsInBlocks(size_t nrows, size_t ncols, const F &func)
+{
+    size_t nBlocks = (nrows + rowsInThreadBlock - 1) / rowsInThreadBlock;
+    if(nBlocks < 2 || nrows * ncols < minElementsForThreading)
+    {
+        func(0, nrows);
+        return;
+    }
+
+    daal::threader_for(nBlocks, nBlocks, [&](int iBlock)
+    {
+        size_t iBegin = iBlock * rowsInThreadBlock;
+        size_t iEnd   = (iBegin + rowsInThreadBlock < nrows) ? iBegin + rowsInThreadBlock : nrows;
+        func(iBegin, iEnd);
+    } );
+}
+
+template<typename T, CpuType cpu>
+void soaToRowsImpl(size_t idx, size_t nrows, void *const *arrays, NumericTableDictionary &dict, T *dst)
+{
+    size_t ncols = dict.getNumberOfFeatures();
+
+    processRowsInBlocks(nrows, ncols, [&](size_t iBegin, size_t iEnd)
+    {
+        T tile[colsInTile * rowsInTile];
+
+        for(size_t i = iBegin; i < iEnd; i += rowsInTile)
+        {
+            size_t nr = (i + rowsInTile < iEnd) ? rowsInTile : iEnd - i;
+
+            for(size_t j0 = 0; j0 < ncols; j0 += colsInTile)
+            {
+                size_t nc = (j0 + colsInTile < ncols) ? colsInTile : ncols - j0;
+
+                for(size_t j = 0; j < nc; j++)
+                {
+                    NumericTableFeature &f = dict[j0 + j];
+                    const char *src = (const char *)arrays[j0 + j] + (idx + i) * f.typeSize;
+                    upCastVector<T, cpu>(f.indexType, nr, src, tile + j * rowsInTile);
+                }
+
+                transposeTileToRows<T, cpu>(nr, nc, tile, dst + i * ncols + j0, ncols);
+            }
+        }
+    } );
+}
+
+template<typename T, CpuType cpu>
+void rowsToSoaImpl(size_t idx, size_t nrows, const T *src, void *const *arrays, NumericTableDictionary &dict)
+{
+    size_t ncols = dict.getNumberOfFeatures();
+
+    processRowsInBlocks(nrows, ncols, [&](size_t iBegin, size_t iEnd)
+    {
+        T tile[colsInTile * rowsInTile];
+
+        for(size_t i = iBegin; i < iEnd; i += rowsInTile)
+        {
+            size_t nr = (i + rowsInTile < iEnd) ? rowsInTile : iEnd - i;
+
+            for(size_t j0 = 0; j0 < ncols; j0 += colsInTile)
+            {
+                size_t nc = (j0 + colsInTile < ncols) ? colsInTile : ncols - j0;
+
+                transposeRowsToTile<T, cpu>(nr, nc, src + i * ncols + j0, ncols, tile);
+
+                for(size_t j = 0; j < nc; j++)
+                {
+                    NumericTableFeature &f = dict[j0 + j];
+                    char *dst = (char *)arrays[j0 + j] + (idx + i) * f.typeSize;
+                    downCastVector<T, cpu>(f.indexType, nr, tile + j * rowsInTile, dst);
+                }
+            }
+        }
+    } );
+}
+
+/* Returns true if the structure consists of the features of type T without gaps */
+template<typename T>
+bool isPackedStructure(size_t structSize, const size_t *offsets, NumericTableDictionary &dict)
+{
+    size_t ncols = dict.getNumberOfFeatures();
+    if(structSize != ncols * sizeof(T)) { return false; }
+
+    for(size_t j = 0; j < ncols; j++)
+    {
+        if(dict[j].indexType != getIndexNumType<T>() || offsets[j] != j * sizeof(T)) { return false; }
+    }
+    return true;
+}
+
+template<typename T, CpuType cpu>
+void aosToRowsImpl(size_t idx, size_t nrows, const void *ptr, size_t structSize, const size_t *offsets,
+                   NumericTableDictionary &dict, T *dst)
+{
+    size_t ncols = dict.getNumberOfFeatures();
+    bool isPacked = isPackedStructure<T>(structSize, offsets, dict);
+
+    processRowsInBlocks(nrows, ncols, [&](size_t iBegin, size_t iEnd)
+    {
+        if(isPacked)
+        {
+            const T *rows = (const T *)((const char *)ptr + (idx + iBegin) * structSize);
+            convertVector<T, T, cpu>((iEnd - iBegin) * ncols, rows, dst + iBegin * ncols);
+            return;
+        }
+
+        /* The tile of structures stays in cache while its features are converted */
+        for(size_t i = iBegin; i < iEnd; i += rowsInTile)
+        {
+            size_t nr = (i + rowsInTile < iEnd) ? rowsInTile : iEnd - i;
+            const char *tile = (const char *)ptr + (idx + i) * structSize;
+
+            for(size_t j = 0; j < ncols; j++)
+            {
+                upCastStrideVector<T, cpu>(dict[j].indexType, nr, tile + offsets[j], structSize, dst + i * ncols + j, ncols);
+            }
+        }
+    } );
+}
+
+template<typename T, CpuType cpu>
+void rowsToAosImpl(size_t idx, size_t nrows, const T *src, void *ptr, size_t structSize, const size_t *offsets,
+                   NumericTableDictionary &dict)
+{
+    size_t ncols = dict.getNumberOfFeatures();
+    bool isPacked = isPackedStructure<T>(structSize, offsets, dict);
+
+    processRowsInBlocks(nrows, ncols, [&](size_t iBegin, size_t iEnd)
+    {
+        if(isPacked)
+        {
+            T *rows = (T *)((char *)ptr + (idx + iBegin) * structSize);
+            convertVector<T, T, cpu>((iEnd - iBegin) * ncols, src + iBegin * ncols, rows);
+            return;
+        }
+
+        for(size_t i = iBegin; i < iEnd; i += rowsInTile)
+        {
+            size_t nr = (i + rowsInTile < iEnd) ? rowsInTile : iEnd - i;
+            char *tile = (char *)ptr + (idx + i) * structSize;
+
+            for(size_t j = 0; j < ncols; j++)
+            {
+                downCastStrideVector<T, cpu>(dict[j].indexType, nr, src + i * ncols + j, ncols, tile + offsets[j], structSize);
+            }
+        }
+    } );
+}
+
+} // namespace internal
+} // namespace data_feature_utils
+} // namespace data_management
+} // namespace daal
+
+#endif
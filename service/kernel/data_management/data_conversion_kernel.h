@@ -0,0 +1,58 @@
+/* file: data_conversion_kernel.h */
+/*******************************************************************************
+* Copyright 2014-2016 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//++
+//  Declaration of template functions that convert blocks of heterogeneous numeric tables
+//--
+*/
+
+#ifndef __DATA_CONVERSION_KERNEL_H__
+#define __DATA_CONVERSION_KERNEL_H__
+
+#include "env_detect.h"
+#include "data_management/data/data_conversion.h"
+
+namespace daal
+{
+namespace data_management
+{
+namespace data_feature_utils
+{
+namespace internal
+{
+
+template<typename T, CpuType cpu>
+void soaToRowsImpl(size_t idx, size_t nrows, void *const *arrays, NumericTableDictionary &dict, T *dst);
+
+template<typename T, CpuType cpu>
+void rowsToSoaImpl(size_t idx, size_t nrows, const T *src, void *const *arrays, NumericTableDictionary &dict);
+
+template<typename T, CpuType cpu>
+void aosToRowsImpl(size_t idx, size_t nrows, const void *ptr, size_t structSize, const size_t *offsets,
+                   NumericTableDictionary &dict, T *dst);
+
+template<typename T, CpuType cpu>
+void rowsToAosImpl(size_t idx, size_t nrows, const T *src, void *ptr, size_t structSize, const size_t *offsets,
+                   NumericTableDictionary &dict);
+
+} // namespace internal
+} // namespace data_feature_utils
+} // namespace data_management
+} // namespace daal
+
+#endif